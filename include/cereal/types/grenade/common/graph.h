@@ -23,19 +23,20 @@ template <typename Archive>
 void Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::save(
     Archive& ar, std::uint32_t) const
 {
-	ar(m_backend);
-	ar(m_vertices);
-	ar(m_edges);
+	auto const& storage = *m_storage;
+	ar(storage.backend);
+	ar(storage.vertices);
+	ar(storage.edges);
 	// Manual serialization of descriptor mappings because they are not invariant under
 	// serialization, but their ordered sequence is.
 	std::vector<VertexDescriptor> vertex_descriptors;
-	for (auto const& backend_descriptor : boost::make_iterator_range(boost::vertices(*m_backend))) {
-		vertex_descriptors.push_back(m_vertex_descriptors.right.at(backend_descriptor));
+	for (auto const& backend_descriptor : boost::make_iterator_range(boost::vertices(backend()))) {
+		vertex_descriptors.push_back(storage.vertex_descriptors.right.at(backend_descriptor));
 	}
 	ar(vertex_descriptors);
 	std::vector<EdgeDescriptor> edge_descriptors;
-	for (auto const& backend_descriptor : boost::make_iterator_range(boost::edges(*m_backend))) {
-		edge_descriptors.push_back(m_edge_descriptors.right.at(backend_descriptor));
+	for (auto const& backend_descriptor : boost::make_iterator_range(boost::edges(backend()))) {
+		edge_descriptors.push_back(storage.edge_descriptors.right.at(backend_descriptor));
 	}
 	ar(edge_descriptors);
 }
@@ -53,23 +54,27 @@ template <typename Archive>
 void Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::load(
     Archive& ar, std::uint32_t)
 {
-	ar(m_backend);
-	ar(m_vertices);
-	ar(m_edges);
+	// Loading replaces the content, therefore the storage is not detached but replaced.
+	m_storage = std::make_shared<Storage>();
+	m_shareable = true;
+	auto& storage = *m_storage;
+	ar(storage.backend);
+	ar(storage.vertices);
+	ar(storage.edges);
 	// Manual serialization of descriptor mappings because they are not invariant under
 	// serialization, but their ordered sequence is.
 	std::vector<VertexDescriptor> vertex_descriptors;
 	ar(vertex_descriptors);
 	for (size_t i = 0;
-	     auto const& backend_descriptor : boost::make_iterator_range(boost::vertices(*m_backend))) {
-		m_vertex_descriptors.insert({vertex_descriptors.at(i), backend_descriptor});
+	     auto const& backend_descriptor : boost::make_iterator_range(boost::vertices(backend()))) {
+		storage.vertex_descriptors.insert({vertex_descriptors.at(i), backend_descriptor});
 		i++;
 	}
 	std::vector<EdgeDescriptor> edge_descriptors;
 	ar(edge_descriptors);
 	for (size_t i = 0;
-	     auto const& backend_descriptor : boost::make_iterator_range(boost::edges(*m_backend))) {
-		m_edge_descriptors.insert({edge_descriptors.at(i), backend_descriptor});
+	     auto const& backend_descriptor : boost::make_iterator_range(boost::edges(backend()))) {
+		storage.edge_descriptors.insert({edge_descriptors.at(i), backend_descriptor});
 		i++;
 	}
 }
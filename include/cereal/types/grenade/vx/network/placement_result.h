@@ -0,0 +1,22 @@
+#pragma once
+#include "grenade/vx/network/abstract/placement_result.h"
+
+#include "cereal/types/halco/common/geometry.h"
+#include <cereal/types/map.hpp>
+#include <cereal/types/vector.hpp>
+
+namespace grenade::vx::network::abstract {
+
+/**
+ * Serialize placement result.
+ * The timing statistics are not serialized, since they are only valid for the process which
+ * performed the placement.
+ */
+template <typename Archive>
+void serialize(Archive& ar, PlacementResult& value)
+{
+	ar(value.neuron_anchors);
+	ar(value.background_locations);
+}
+
+} // namespace grenade::vx::network::abstract
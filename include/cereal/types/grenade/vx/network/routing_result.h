@@ -0,0 +1,51 @@
+#pragma once
+#include "grenade/vx/network/connection_routing_result.h"
+#include "grenade/vx/network/routing_result.h"
+
+#include "cereal/types/halco/common/geometry.h"
+#include <cereal/types/map.hpp>
+#include <cereal/types/optional.hpp>
+#include <cereal/types/vector.hpp>
+
+namespace grenade::vx::network {
+
+template <typename Archive>
+void serialize(Archive& ar, ConnectionToHardwareRoutes& value)
+{
+	ar(value.atomic_neurons_on_target_compartment);
+}
+
+template <typename Archive>
+void serialize(Archive& ar, RoutingResult::Chip::PlacedConnection& value)
+{
+	ar(value.label);
+	ar(value.synapse_row);
+	ar(value.synapse_on_row);
+}
+
+template <typename Archive>
+void serialize(Archive& ar, RoutingResult::Chip& value)
+{
+	ar(value.connection_routing_result);
+	ar(value.connections);
+	ar(value.external_spike_labels);
+	ar(value.background_spike_source_labels);
+	ar(value.background_spike_source_masks);
+	ar(value.internal_neuron_labels);
+	ar(value.synapse_driver_compare_masks);
+	ar(value.synapse_row_modes);
+	ar(value.crossbar_nodes);
+}
+
+/**
+ * Serialize routing result.
+ * The timing statistics are not serialized, since they are only valid for the process which
+ * performed the routing.
+ */
+template <typename Archive>
+void serialize(Archive& ar, RoutingResult& value)
+{
+	ar(value.chips);
+}
+
+} // namespace grenade::vx::network
@@ -4,6 +4,7 @@
 #include "grenade/common/port_data.h"
 #include "grenade/common/port_on_topology.h"
 #include "hate/visibility.h"
+#include <memory>
 
 namespace grenade {
 namespace common GENPYBIND_TAG_GRENADE_COMMON {
@@ -16,10 +17,13 @@ struct Topology;
  */
 struct GENPYBIND(visible) SYMBOL_VISIBLE Data
 {
-	typedef dapr::Map<PortOnTopology, PortData> Ports GENPYBIND(opaque(false));
+	typedef dapr::Map<PortOnTopology, PortData, std::shared_ptr> Ports GENPYBIND(opaque(false));
 
 	/**
 	 * Data given per port per vertex of topology.
+	 * Copies share the data of each port until it is replaced (copy-on-write), which makes copying
+	 * independent of the size of the data and allows to compare ports of copies, which were not
+	 * replaced since, in constant time.
 	 */
 	Ports ports;
 
@@ -29,8 +33,12 @@ struct GENPYBIND(visible) SYMBOL_VISIBLE Data
 	 */
 	virtual size_t batch_size() const;
 
-	bool operator==(Data const& other) const = default;
-	bool operator!=(Data const& other) const = default;
+	/**
+	 * Compare data of all ports.
+	 * Ports sharing their data are equal without comparing the data.
+	 */
+	bool operator==(Data const& other) const;
+	bool operator!=(Data const& other) const;
 
 	GENPYBIND(stringstream)
 	friend std::ostream& operator<<(std::ostream& os, Data const& data) SYMBOL_VISIBLE;
@@ -64,6 +64,7 @@ struct SYMBOL_VISIBLE Graph
 	/**
 	 * Copy graph.
 	 * The copy preserves the descriptors of all elements.
+	 * The element storage is shared with the other graph until either is modified.
 	 */
 	Graph(Graph const& other);
 
@@ -75,6 +76,7 @@ struct SYMBOL_VISIBLE Graph
 	/**
 	 * Copy graph.
 	 * The copy preserves the descriptors of all elements.
+	 * The element storage is shared with the other graph until either is modified.
 	 */
 	Graph& operator=(Graph const& other);
 
@@ -177,6 +179,8 @@ struct SYMBOL_VISIBLE Graph
 
 	/**
 	 * Get vertex property.
+	 * Since the returned reference allows modification at any later point in time, copies of the
+	 * graph made afterwards don't share its storage.
 	 * @param descriptor Vertex descriptor
 	 * @throws std::out_of_range On vertex not being present in graph
 	 */
@@ -474,25 +478,64 @@ struct SYMBOL_VISIBLE Graph
 	 * Get whether graphs are equal.
 	 * This is the case exactly if all vertex descriptors and properties as well as all edge
 	 * descriptors and properties match in order and the edges connect the same vertices.
+	 * Graphs sharing their storage are equal without comparison of their elements.
 	 */
 	bool operator==(Graph const& other) const;
 	bool operator!=(Graph const& other) const;
 
+	/**
+	 * Get whether the graph shares its element storage with the other graph.
+	 * This is the case for copies until either of them is modified.
+	 */
+	bool shares_storage_with(Graph const& other) const;
+
 private:
 	Backend& backend() const;
-	std::unique_ptr<Backend> m_backend;
-	dapr::AutoKeyMap<VertexDescriptor, Vertex, dapr::Map<VertexDescriptor, Vertex, Holder>>
-	    m_vertices;
-	dapr::AutoKeyMap<EdgeDescriptor, Edge, dapr::Map<EdgeDescriptor, Edge, Holder>> m_edges;
-
-	boost::bimap<
-	    boost::bimaps::set_of<VertexDescriptor>,
-	    boost::bimaps::set_of<typename Backend::vertex_descriptor>>
-	    m_vertex_descriptors;
-	boost::bimap<
-	    boost::bimaps::set_of<EdgeDescriptor>,
-	    boost::bimaps::set_of<typename Backend::edge_descriptor>>
-	    m_edge_descriptors;
+
+	/**
+	 * Storage of the graph structure and the element properties.
+	 * Copies of a graph share the storage until one of them is modified (copy-on-write), which
+	 * makes copying a graph constant in time and allows to compare unmodified copies in constant
+	 * time.
+	 */
+	struct Storage
+	{
+		Storage();
+
+		/**
+		 * Copy storage.
+		 * The copy preserves the descriptors of all elements.
+		 */
+		Storage(Storage const& other);
+
+		std::unique_ptr<Backend> backend;
+		dapr::AutoKeyMap<VertexDescriptor, Vertex, dapr::Map<VertexDescriptor, Vertex, Holder>>
+		    vertices;
+		dapr::AutoKeyMap<EdgeDescriptor, Edge, dapr::Map<EdgeDescriptor, Edge, Holder>> edges;
+
+		boost::bimap<
+		    boost::bimaps::set_of<VertexDescriptor>,
+		    boost::bimaps::set_of<typename Backend::vertex_descriptor>>
+		    vertex_descriptors;
+		boost::bimap<
+		    boost::bimaps::set_of<EdgeDescriptor>,
+		    boost::bimaps::set_of<typename Backend::edge_descriptor>>
+		    edge_descriptors;
+	};
+
+	std::shared_ptr<Storage> m_storage;
+
+	/**
+	 * Whether the storage may be shared with copies of the graph.
+	 * This is not the case once a mutable reference to a vertex property was handed out, since
+	 * modifications through it would otherwise be visible in the copies.
+	 */
+	bool m_shareable;
+
+	/**
+	 * Ensure exclusive ownership of the storage before modification by cloning it if it is shared.
+	 */
+	void detach();
 
 	void check_contains(VertexDescriptor const& descriptor, char const* description) const;
 	void check_contains(EdgeDescriptor const& descriptor, char const* description) const;
@@ -34,7 +34,7 @@ void Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Hol
 		// Number of unmappable vertices
 		size_t unmapped_vertices = 0;
 		for (auto vertex : other.vertices()) {
-			if (boost::get(f, other.m_vertex_descriptors.left.at(vertex)) ==
+			if (boost::get(f, other.m_storage->vertex_descriptors.left.at(vertex)) ==
 			    detail::UndirectedGraph::null_vertex()) {
 				unmapped_vertices++;
 			}
@@ -44,10 +44,10 @@ void Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Hol
 		vertex_mapping.clear();
 		vertex_mapping_reverse.clear();
 		for (auto vertex : other.vertices()) {
-			vertex_mapping[vertex] = VertexDescriptor(m_vertex_descriptors.right.at(
-			    boost::get(f, other.m_vertex_descriptors.left.at(vertex))));
-			vertex_mapping_reverse[VertexDescriptor(m_vertex_descriptors.right.at(
-			    boost::get(f, other.m_vertex_descriptors.left.at(vertex))))] = vertex;
+			vertex_mapping[vertex] = VertexDescriptor(m_storage->vertex_descriptors.right.at(
+			    boost::get(f, other.m_storage->vertex_descriptors.left.at(vertex))));
+			vertex_mapping_reverse[VertexDescriptor(m_storage->vertex_descriptors.right.at(
+			    boost::get(f, other.m_storage->vertex_descriptors.left.at(vertex))))] = vertex;
 		}
 
 		// Adjusts smallest number of unmappable vertices for all callbacks.
@@ -71,13 +71,13 @@ void Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Hol
 	        typename Backend::vertex_descriptor const& descriptor,
 	        typename Backend::vertex_descriptor const& other_descriptor) {
 		    return vertex_equivalent(
-		        m_vertex_descriptors.right.at(descriptor),
-		        other.m_vertex_descriptors.right.at(other_descriptor));
+		        m_storage->vertex_descriptors.right.at(descriptor),
+		        other.m_storage->vertex_descriptors.right.at(other_descriptor));
 	    };
 
 	std::vector<typename Backend::vertex_descriptor> vertex_order;
 	for (auto vertex : other.vertices()) {
-		vertex_order.push_back(other.m_vertex_descriptors.left.at(vertex));
+		vertex_order.push_back(other.m_storage->vertex_descriptors.left.at(vertex));
 	}
 
 	auto vertex_index_map_this = get_backend_vertex_index_map();
@@ -121,7 +121,7 @@ void Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Hol
 		// Number of unmappable vertices
 		size_t unmapped_vertices = 0;
 		for (auto vertex : other.vertices()) {
-			if (boost::get(f, other.m_vertex_descriptors.left.at(vertex)) ==
+			if (boost::get(f, other.m_storage->vertex_descriptors.left.at(vertex)) ==
 			    detail::UndirectedGraph::null_vertex()) {
 				unmapped_vertices++;
 			}
@@ -131,10 +131,10 @@ void Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Hol
 		vertex_mapping.clear();
 		vertex_mapping_reverse.clear();
 		for (auto vertex : other.vertices()) {
-			vertex_mapping[vertex] = VertexDescriptor(m_vertex_descriptors.right.at(
-			    boost::get(f, other.m_vertex_descriptors.left.at(vertex))));
-			vertex_mapping_reverse[VertexDescriptor(m_vertex_descriptors.right.at(
-			    boost::get(f, other.m_vertex_descriptors.left.at(vertex))))] = vertex;
+			vertex_mapping[vertex] = VertexDescriptor(m_storage->vertex_descriptors.right.at(
+			    boost::get(f, other.m_storage->vertex_descriptors.left.at(vertex))));
+			vertex_mapping_reverse[VertexDescriptor(m_storage->vertex_descriptors.right.at(
+			    boost::get(f, other.m_storage->vertex_descriptors.left.at(vertex))))] = vertex;
 		}
 
 		// Adjusts smallest number of unmappable vertices for all callbacks.
@@ -158,13 +158,13 @@ void Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Hol
 	        typename Backend::vertex_descriptor const& descriptor,
 	        typename Backend::vertex_descriptor const& other_descriptor) {
 		    return vertex_equivalent(
-		        m_vertex_descriptors.right.at(descriptor),
-		        other.m_vertex_descriptors.right.at(other_descriptor));
+		        m_storage->vertex_descriptors.right.at(descriptor),
+		        other.m_storage->vertex_descriptors.right.at(other_descriptor));
 	    };
 
 	std::vector<typename Backend::vertex_descriptor> vertex_order;
 	for (auto vertex : other.vertices()) {
-		vertex_order.push_back(other.m_vertex_descriptors.left.at(vertex));
+		vertex_order.push_back(other.m_storage->vertex_descriptors.left.at(vertex));
 	}
 
 	auto vertex_index_map_this = get_backend_vertex_index_map();
@@ -17,6 +17,61 @@
 
 namespace grenade::common {
 
+template <
+    typename Derived,
+    typename Backend,
+    typename Vertex,
+    typename Edge,
+    typename VertexDescriptor,
+    typename EdgeDescriptor,
+    template <typename...>
+    typename Holder>
+Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::Storage::
+    Storage() :
+    backend(std::make_unique<Backend>()),
+    vertices(),
+    edges(),
+    vertex_descriptors(),
+    edge_descriptors()
+{
+}
+
+template <
+    typename Derived,
+    typename Backend,
+    typename Vertex,
+    typename Edge,
+    typename VertexDescriptor,
+    typename EdgeDescriptor,
+    template <typename...>
+    typename Holder>
+Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::Storage::Storage(
+    Storage const& other) :
+    backend(std::make_unique<Backend>()),
+    vertices(other.vertices),
+    edges(other.edges),
+    vertex_descriptors(),
+    edge_descriptors()
+{
+	for (auto const& backend_descriptor :
+	     boost::make_iterator_range(boost::vertices(*other.backend))) {
+		vertex_descriptors.insert(
+		    {other.vertex_descriptors.right.at(backend_descriptor), boost::add_vertex(*backend)});
+	}
+	for (auto const& other_backend_descriptor :
+	     boost::make_iterator_range(boost::edges(*other.backend))) {
+		auto const [backend_descriptor, success] = boost::add_edge(
+		    vertex_descriptors.left.at(other.vertex_descriptors.right.at(
+		        boost::source(other_backend_descriptor, *other.backend))),
+		    vertex_descriptors.left.at(other.vertex_descriptors.right.at(
+		        boost::target(other_backend_descriptor, *other.backend))),
+		    *backend);
+		assert(success);
+		edge_descriptors.insert(
+		    {other.edge_descriptors.right.at(other_backend_descriptor), backend_descriptor});
+	}
+}
+
 template <
     typename Derived,
     typename Backend,
@@ -27,11 +82,7 @@ template <
     template <typename...>
     typename Holder>
 Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::Graph() :
-    m_backend(std::make_unique<Backend>()),
-    m_vertices(),
-    m_edges(),
-    m_vertex_descriptors(),
-    m_edge_descriptors()
+    m_storage(std::make_shared<Storage>()), m_shareable(true)
 {
 }
 
@@ -46,11 +97,7 @@ template <
     typename Holder>
 Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::Graph(
     Graph const& other) :
-    m_backend(std::make_unique<Backend>()),
-    m_vertices(),
-    m_edges(),
-    m_vertex_descriptors(),
-    m_edge_descriptors()
+    m_storage(), m_shareable(true)
 {
 	operator=(other);
 }
@@ -66,11 +113,7 @@ template <
     typename Holder>
 Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::Graph(
     Graph&& other) :
-    m_backend(std::move(other.m_backend)),
-    m_vertices(std::move(other.m_vertices)),
-    m_edges(std::move(other.m_edges)),
-    m_vertex_descriptors(std::move(other.m_vertex_descriptors)),
-    m_edge_descriptors(std::move(other.m_edge_descriptors))
+    m_storage(std::move(other.m_storage)), m_shareable(other.m_shareable)
 {
 }
 
@@ -88,20 +131,15 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
     Graph const& other)
 {
 	if (this != &other) {
-		m_backend = std::make_unique<Backend>();
-		m_vertices = other.m_vertices;
-		m_edges = other.m_edges;
-		for (auto const other_descriptor : other.vertices()) {
-			auto const backend_descriptor(boost::add_vertex(backend()));
-			m_vertex_descriptors.insert({other_descriptor, backend_descriptor});
+		if (!other.m_storage) {
+			throw std::logic_error("Unexpected access to moved-from object.");
 		}
-		for (auto const other_descriptor : other.edges()) {
-			auto const [backend_descriptor, success] = boost::add_edge(
-			    m_vertex_descriptors.left.at(other.source(other_descriptor)),
-			    m_vertex_descriptors.left.at(other.target(other_descriptor)), backend());
-			assert(success);
-			m_edge_descriptors.insert({other_descriptor, backend_descriptor});
+		if (other.m_shareable) {
+			m_storage = other.m_storage;
+		} else {
+			m_storage = std::make_shared<Storage>(*other.m_storage);
 		}
+		m_shareable = true;
 	}
 	return *this;
 }
@@ -120,15 +158,31 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
     Graph&& other)
 {
 	if (this != &other) {
-		m_backend = std::move(other.m_backend);
-		m_vertices = std::move(other.m_vertices);
-		m_edges = std::move(other.m_edges);
-		m_vertex_descriptors = std::move(other.m_vertex_descriptors);
-		m_edge_descriptors = std::move(other.m_edge_descriptors);
+		m_storage = std::move(other.m_storage);
+		m_shareable = other.m_shareable;
 	}
 	return *this;
 }
 
+template <
+    typename Derived,
+    typename Backend,
+    typename Vertex,
+    typename Edge,
+    typename VertexDescriptor,
+    typename EdgeDescriptor,
+    template <typename...>
+    typename Holder>
+void Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::detach()
+{
+	if (!m_storage) {
+		throw std::logic_error("Unexpected access to moved-from object.");
+	}
+	if (m_storage.use_count() > 1) {
+		m_storage = std::make_shared<Storage>(*m_storage);
+	}
+}
+
 template <
     typename Derived,
     typename Backend,
@@ -142,9 +196,10 @@ VertexDescriptor
 Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::add_vertex(
     Vertex const& vertex)
 {
-	VertexDescriptor const descriptor = m_vertices.insert(vertex);
+	detach();
+	VertexDescriptor const descriptor = m_storage->vertices.insert(vertex);
 	auto const backend_descriptor(boost::add_vertex(backend()));
-	m_vertex_descriptors.insert({descriptor, backend_descriptor});
+	m_storage->vertex_descriptors.insert({descriptor, backend_descriptor});
 	return descriptor;
 }
 
@@ -161,9 +216,10 @@ VertexDescriptor
 Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::add_vertex(
     Vertex&& vertex)
 {
-	VertexDescriptor const descriptor = m_vertices.insert(std::move(vertex));
+	detach();
+	VertexDescriptor const descriptor = m_storage->vertices.insert(std::move(vertex));
 	auto const backend_descriptor(boost::add_vertex(backend()));
-	m_vertex_descriptors.insert({descriptor, backend_descriptor});
+	m_storage->vertex_descriptors.insert({descriptor, backend_descriptor});
 	return descriptor;
 }
 
@@ -180,11 +236,13 @@ EdgeDescriptor
 Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::add_edge(
     VertexDescriptor const& source, VertexDescriptor const& target, Edge const& edge)
 {
+	detach();
 	check_contains(source, "add edge from source");
 	check_contains(target, "add edge to target");
-	EdgeDescriptor const descriptor = m_edges.insert(edge);
+	EdgeDescriptor const descriptor = m_storage->edges.insert(edge);
 	auto const [backend_descriptor, success] = boost::add_edge(
-	    m_vertex_descriptors.left.at(source), m_vertex_descriptors.left.at(target), backend());
+	    m_storage->vertex_descriptors.left.at(source),
+	    m_storage->vertex_descriptors.left.at(target), backend());
 	if (!success) {
 		std::stringstream ss;
 		ss << "Trying to add edge from source (" << source << ") to target (" << target
@@ -192,7 +250,7 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
 		   << ") and graph doesn't support multiple edges between the same vertices.";
 		throw std::runtime_error(ss.str());
 	}
-	m_edge_descriptors.insert({descriptor, backend_descriptor});
+	m_storage->edge_descriptors.insert({descriptor, backend_descriptor});
 	return descriptor;
 }
 
@@ -209,11 +267,13 @@ EdgeDescriptor
 Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::add_edge(
     VertexDescriptor const& source, VertexDescriptor const& target, Edge&& edge)
 {
+	detach();
 	check_contains(source, "add edge from source");
 	check_contains(target, "add edge to target");
-	EdgeDescriptor const descriptor = m_edges.insert(std::move(edge));
+	EdgeDescriptor const descriptor = m_storage->edges.insert(std::move(edge));
 	auto const [backend_descriptor, success] = boost::add_edge(
-	    m_vertex_descriptors.left.at(source), m_vertex_descriptors.left.at(target), backend());
+	    m_storage->vertex_descriptors.left.at(source),
+	    m_storage->vertex_descriptors.left.at(target), backend());
 	if (!success) {
 		std::stringstream ss;
 		ss << "Trying to add edge from source (" << source << ") to target (" << target
@@ -221,7 +281,7 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
 		   << ") and graph doesn't support multiple edges between the same vertices.";
 		throw std::runtime_error(ss.str());
 	}
-	m_edge_descriptors.insert({descriptor, backend_descriptor});
+	m_storage->edge_descriptors.insert({descriptor, backend_descriptor});
 	return descriptor;
 }
 
@@ -237,14 +297,16 @@ template <
 void Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::remove_edge(
     VertexDescriptor const& source, VertexDescriptor const& target)
 {
+	detach();
 	for (auto const descriptor : edge_range(source, target)) {
-		auto const num_elements_removed = m_edges.erase(descriptor);
+		auto const num_elements_removed = m_storage->edges.erase(descriptor);
 		assert(num_elements_removed == 1);
-		auto const num_descriptors_removed = m_edge_descriptors.left.erase(descriptor);
+		auto const num_descriptors_removed = m_storage->edge_descriptors.left.erase(descriptor);
 		assert(num_descriptors_removed == 1);
 	}
 	boost::remove_edge(
-	    m_vertex_descriptors.left.at(source), m_vertex_descriptors.left.at(target), backend());
+	    m_storage->vertex_descriptors.left.at(source),
+	    m_storage->vertex_descriptors.left.at(target), backend());
 }
 
 template <
@@ -259,10 +321,11 @@ template <
 void Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::remove_edge(
     EdgeDescriptor const& descriptor)
 {
+	detach();
 	check_contains(descriptor, "remove");
-	m_edges.erase(descriptor);
-	boost::remove_edge(m_edge_descriptors.left.at(descriptor), backend());
-	m_edge_descriptors.left.erase(descriptor);
+	m_storage->edges.erase(descriptor);
+	boost::remove_edge(m_storage->edge_descriptors.left.at(descriptor), backend());
+	m_storage->edge_descriptors.left.erase(descriptor);
 }
 
 template <
@@ -337,14 +400,15 @@ template <
 void Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::remove_vertex(
     VertexDescriptor const& descriptor)
 {
+	detach();
 	check_contains(descriptor, "remove");
 	if (in_degree(descriptor) != 0 || out_degree(descriptor) != 0) {
 		throw std::runtime_error("Trying to remove vertex which has connected edges.");
 	}
 
-	boost::remove_vertex(m_vertex_descriptors.left.at(descriptor), backend());
-	m_vertex_descriptors.left.erase(descriptor);
-	m_vertices.erase(descriptor);
+	boost::remove_vertex(m_storage->vertex_descriptors.left.at(descriptor), backend());
+	m_storage->vertex_descriptors.left.erase(descriptor);
+	m_storage->vertices.erase(descriptor);
 }
 
 template <
@@ -358,11 +422,12 @@ template <
     typename Holder>
 void Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::clear()
 {
+	detach();
 	for (auto vertex : vertices()) {
 		clear_vertex(vertex);
 	}
-	while (!m_vertices.empty()) {
-		remove_vertex(m_vertices.begin()->first);
+	while (!m_storage->vertices.empty()) {
+		remove_vertex(m_storage->vertices.begin()->first);
 	}
 }
 
@@ -379,8 +444,10 @@ Vertex&
 Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::get_mutable(
     VertexDescriptor const& descriptor)
 {
+	detach();
+	m_shareable = false;
 	check_contains(descriptor, "get_mutable");
-	return m_vertices.get_mutable(descriptor);
+	return m_storage->vertices.get_mutable(descriptor);
 }
 
 template <
@@ -396,7 +463,7 @@ Vertex const& Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescri
     VertexDescriptor const& descriptor) const
 {
 	check_contains(descriptor, "get");
-	return m_vertices.get(descriptor);
+	return m_storage->vertices.get(descriptor);
 }
 
 template <
@@ -411,8 +478,9 @@ template <
 void Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::set(
     VertexDescriptor const& descriptor, Vertex const& vertex)
 {
+	detach();
 	check_contains(descriptor, "set");
-	m_vertices.set(descriptor, vertex);
+	m_storage->vertices.set(descriptor, vertex);
 }
 
 template <
@@ -427,8 +495,9 @@ template <
 void Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::set(
     VertexDescriptor const& descriptor, Vertex&& vertex)
 {
+	detach();
 	check_contains(descriptor, "set");
-	m_vertices.set(descriptor, std::move(vertex));
+	m_storage->vertices.set(descriptor, std::move(vertex));
 }
 
 template <
@@ -444,7 +513,7 @@ Edge const& Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescript
     EdgeDescriptor const& descriptor) const
 {
 	check_contains(descriptor, "get");
-	return m_edges.get(descriptor);
+	return m_storage->edges.get(descriptor);
 }
 
 template <
@@ -459,8 +528,9 @@ template <
 void Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::set(
     EdgeDescriptor const& descriptor, Edge const& edge)
 {
+	detach();
 	check_contains(descriptor, "set");
-	m_edges.set(descriptor, edge);
+	m_storage->edges.set(descriptor, edge);
 }
 
 template <
@@ -475,8 +545,9 @@ template <
 void Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::set(
     EdgeDescriptor const& descriptor, Edge&& edge)
 {
+	detach();
 	check_contains(descriptor, "set");
-	m_edges.set(descriptor, std::move(edge));
+	m_storage->edges.set(descriptor, std::move(edge));
 }
 
 template <
@@ -495,9 +566,10 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
 {
 	auto const backend_vertices = boost::vertices(backend());
 	return {
-	    VertexIterator{backend_vertices.first, detail::DescriptorTransform{&m_vertex_descriptors}},
 	    VertexIterator{
-	        backend_vertices.second, detail::DescriptorTransform{&m_vertex_descriptors}}};
+	        backend_vertices.first, detail::DescriptorTransform{&m_storage->vertex_descriptors}},
+	    VertexIterator{
+	        backend_vertices.second, detail::DescriptorTransform{&m_storage->vertex_descriptors}}};
 }
 
 template <
@@ -516,8 +588,10 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
 {
 	auto const backend_edges = boost::edges(backend());
 	return {
-	    EdgeIterator{backend_edges.first, detail::DescriptorTransform{&m_edge_descriptors}},
-	    EdgeIterator{backend_edges.second, detail::DescriptorTransform{&m_edge_descriptors}}};
+	    EdgeIterator{
+	        backend_edges.first, detail::DescriptorTransform{&m_storage->edge_descriptors}},
+	    EdgeIterator{
+	        backend_edges.second, detail::DescriptorTransform{&m_storage->edge_descriptors}}};
 }
 
 template <
@@ -537,12 +611,14 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
 {
 	check_contains(descriptor, "get adjacent vertices of");
 	auto const backend_adjacent_vertices =
-	    boost::adjacent_vertices(m_vertex_descriptors.left.at(descriptor), backend());
+	    boost::adjacent_vertices(m_storage->vertex_descriptors.left.at(descriptor), backend());
 	return {
 	    AdjacencyIterator{
-	        backend_adjacent_vertices.first, detail::DescriptorTransform{&m_vertex_descriptors}},
+	        backend_adjacent_vertices.first,
+	        detail::DescriptorTransform{&m_storage->vertex_descriptors}},
 	    AdjacencyIterator{
-	        backend_adjacent_vertices.second, detail::DescriptorTransform{&m_vertex_descriptors}}};
+	        backend_adjacent_vertices.second,
+	        detail::DescriptorTransform{&m_storage->vertex_descriptors}}};
 }
 
 template <
@@ -562,14 +638,14 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
 {
 	check_contains(descriptor, "get inverse adjacent vertices of");
 	auto const backend_inv_adjacent_vertices =
-	    boost::inv_adjacent_vertices(m_vertex_descriptors.left.at(descriptor), backend());
+	    boost::inv_adjacent_vertices(m_storage->vertex_descriptors.left.at(descriptor), backend());
 	return {
 	    InvAdjacencyIterator{
 	        backend_inv_adjacent_vertices.first,
-	        detail::DescriptorTransform{&m_vertex_descriptors}},
+	        detail::DescriptorTransform{&m_storage->vertex_descriptors}},
 	    InvAdjacencyIterator{
 	        backend_inv_adjacent_vertices.second,
-	        detail::DescriptorTransform{&m_vertex_descriptors}}};
+	        detail::DescriptorTransform{&m_storage->vertex_descriptors}}};
 }
 
 template <
@@ -589,11 +665,12 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
 {
 	check_contains(descriptor, "get out-edges of");
 	auto const backend_out_edges =
-	    boost::out_edges(m_vertex_descriptors.left.at(descriptor), backend());
+	    boost::out_edges(m_storage->vertex_descriptors.left.at(descriptor), backend());
 	return {
-	    OutEdgeIterator{backend_out_edges.first, detail::DescriptorTransform{&m_edge_descriptors}},
 	    OutEdgeIterator{
-	        backend_out_edges.second, detail::DescriptorTransform{&m_edge_descriptors}}};
+	        backend_out_edges.first, detail::DescriptorTransform{&m_storage->edge_descriptors}},
+	    OutEdgeIterator{
+	        backend_out_edges.second, detail::DescriptorTransform{&m_storage->edge_descriptors}}};
 }
 
 template <
@@ -613,10 +690,12 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
 {
 	check_contains(descriptor, "get in-edges of");
 	auto const backend_in_edges =
-	    boost::in_edges(m_vertex_descriptors.left.at(descriptor), backend());
+	    boost::in_edges(m_storage->vertex_descriptors.left.at(descriptor), backend());
 	return {
-	    InEdgeIterator{backend_in_edges.first, detail::DescriptorTransform{&m_edge_descriptors}},
-	    InEdgeIterator{backend_in_edges.second, detail::DescriptorTransform{&m_edge_descriptors}}};
+	    InEdgeIterator{
+	        backend_in_edges.first, detail::DescriptorTransform{&m_storage->edge_descriptors}},
+	    InEdgeIterator{
+	        backend_in_edges.second, detail::DescriptorTransform{&m_storage->edge_descriptors}}};
 }
 
 template <
@@ -633,8 +712,8 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
     EdgeDescriptor const& descriptor) const
 {
 	check_contains(descriptor, "get source of");
-	return m_vertex_descriptors.right.at(
-	    boost::source(m_edge_descriptors.left.at(descriptor), backend()));
+	return m_storage->vertex_descriptors.right.at(
+	    boost::source(m_storage->edge_descriptors.left.at(descriptor), backend()));
 }
 
 template <
@@ -651,8 +730,8 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
     EdgeDescriptor const& descriptor) const
 {
 	check_contains(descriptor, "get target of");
-	return m_vertex_descriptors.right.at(
-	    boost::target(m_edge_descriptors.left.at(descriptor), backend()));
+	return m_storage->vertex_descriptors.right.at(
+	    boost::target(m_storage->edge_descriptors.left.at(descriptor), backend()));
 }
 
 template <
@@ -668,7 +747,7 @@ size_t Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, H
     VertexDescriptor const& descriptor) const
 {
 	check_contains(descriptor, "get out-degree of");
-	return boost::out_degree(m_vertex_descriptors.left.at(descriptor), backend());
+	return boost::out_degree(m_storage->vertex_descriptors.left.at(descriptor), backend());
 }
 
 template <
@@ -684,7 +763,7 @@ size_t Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, H
     VertexDescriptor const& descriptor) const
 {
 	check_contains(descriptor, "get in-degree of");
-	return boost::in_degree(m_vertex_descriptors.left.at(descriptor), backend());
+	return boost::in_degree(m_storage->vertex_descriptors.left.at(descriptor), backend());
 }
 
 template <
@@ -736,11 +815,13 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
 	check_contains(source, "get edge_range from source");
 	check_contains(target, "get edge_range to target");
 	auto const backend_edge_range = boost::edge_range(
-	    m_vertex_descriptors.left.at(source), m_vertex_descriptors.left.at(target), backend());
+	    m_storage->vertex_descriptors.left.at(source),
+	    m_storage->vertex_descriptors.left.at(target), backend());
 	return {
-	    OutEdgeIterator{backend_edge_range.first, detail::DescriptorTransform{&m_edge_descriptors}},
 	    OutEdgeIterator{
-	        backend_edge_range.second, detail::DescriptorTransform{&m_edge_descriptors}}};
+	        backend_edge_range.first, detail::DescriptorTransform{&m_storage->edge_descriptors}},
+	    OutEdgeIterator{
+	        backend_edge_range.second, detail::DescriptorTransform{&m_storage->edge_descriptors}}};
 }
 
 template <
@@ -755,7 +836,7 @@ template <
 bool Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::contains(
     VertexDescriptor const& descriptor) const
 {
-	return m_vertices.contains(descriptor);
+	return m_storage->vertices.contains(descriptor);
 }
 
 template <
@@ -770,7 +851,7 @@ template <
 bool Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::contains(
     EdgeDescriptor const& descriptor) const
 {
-	return m_edges.contains(descriptor);
+	return m_storage->edges.contains(descriptor);
 }
 
 template <
@@ -790,7 +871,8 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
 		std::map<typename Backend::vertex_descriptor, size_t> strongly_connected_component_coloring;
 		std::map<typename Backend::vertex_descriptor, size_t> vertex_index_map;
 		for (size_t vertex_index = 0; auto const vertex_descriptor : vertices()) {
-			vertex_index_map.emplace(m_vertex_descriptors.left.at(vertex_descriptor), vertex_index);
+			vertex_index_map.emplace(
+			    m_storage->vertex_descriptors.left.at(vertex_descriptor), vertex_index);
 			vertex_index++;
 		}
 		boost::strong_components(
@@ -798,7 +880,7 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
 		    boost::vertex_index_map(boost::make_assoc_property_map(vertex_index_map)));
 		std::map<VertexDescriptor, size_t> ret;
 		for (auto const& [key, value] : strongly_connected_component_coloring) {
-			ret.emplace(VertexDescriptor(m_vertex_descriptors.right.at(key)), value);
+			ret.emplace(VertexDescriptor(m_storage->vertex_descriptors.right.at(key)), value);
 		}
 		return ret;
 	} else {
@@ -909,8 +991,8 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
 
 	for (auto const& [key_1, value_1] : vertex_index_1) {
 		vertex_mapping.emplace(
-		    m_vertex_descriptors.right.at(key_1),
-		    other.m_vertex_descriptors.right.at(f.at(value_1)));
+		    m_storage->vertex_descriptors.right.at(key_1),
+		    other.m_storage->vertex_descriptors.right.at(f.at(value_1)));
 	}
 
 	return vertex_mapping;
@@ -945,7 +1027,7 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
 		}
 		std::vector<VertexDescriptor> ret;
 		for (auto const& vertex : topogically_sorted_backend_vertices) {
-			ret.push_back(m_vertex_descriptors.right.at(vertex));
+			ret.push_back(m_storage->vertex_descriptors.right.at(vertex));
 		}
 		return ret;
 	} else {
@@ -1019,9 +1101,10 @@ Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>:
 		std::vector<VertexDescriptor> ret;
 
 		boost::breadth_first_search(
-		    backend(), m_vertex_descriptors.left.at(source),
-		    boost::visitor(ReachableFromVisitor<VertexDescriptor, decltype(m_vertex_descriptors)>(
-		                       ret, m_vertex_descriptors))
+		    backend(), m_storage->vertex_descriptors.left.at(source),
+		    boost::visitor(
+		        ReachableFromVisitor<VertexDescriptor, decltype(m_storage->vertex_descriptors)>(
+		            ret, m_storage->vertex_descriptors))
 		        .vertex_index_map(boost::make_assoc_property_map(vertex_index_map)));
 		return ret;
 	} else {
@@ -1084,6 +1167,10 @@ template <
 bool Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::operator==(
     Graph const& other) const
 {
+	if (m_storage && m_storage == other.m_storage) {
+		return true;
+	}
+
 	if ((num_vertices() != other.num_vertices()) || (num_edges() != other.num_edges())) {
 		return false;
 	}
@@ -1093,8 +1180,8 @@ bool Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Hol
 	auto vertices_it = boost::vertices(backend()).first;
 	auto other_vertices_it = boost::vertices(other.backend()).first;
 	for (size_t i = 0; i < num_vertices(); ++i) {
-		if (m_vertex_descriptors.right.at(*vertices_it) !=
-		    other.m_vertex_descriptors.right.at(*other_vertices_it)) {
+		if (m_storage->vertex_descriptors.right.at(*vertices_it) !=
+		    other.m_storage->vertex_descriptors.right.at(*other_vertices_it)) {
 			return false;
 		}
 		vertex_descriptor_translation.emplace(*vertices_it, *other_vertices_it);
@@ -1106,7 +1193,8 @@ bool Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Hol
 	        boost::edges(backend()).first, boost::edges(backend()).second,
 	        boost::edges(other.backend()).first, boost::edges(other.backend()).second,
 	        [&](auto const& aa, auto const& bb) {
-		        return (m_edge_descriptors.right.at(aa) == other.m_edge_descriptors.right.at(bb)) &&
+		        return (m_storage->edge_descriptors.right.at(aa) ==
+		                other.m_storage->edge_descriptors.right.at(bb)) &&
 		               (vertex_descriptor_translation.at(boost::source(aa, backend())) ==
 		                boost::source(bb, other.backend())) &&
 		               (vertex_descriptor_translation.at(boost::target(aa, backend())) ==
@@ -1115,7 +1203,8 @@ bool Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Hol
 		return false;
 	}
 
-	return m_vertices == other.m_vertices && m_edges == other.m_edges;
+	return m_storage->vertices == other.m_storage->vertices &&
+	       m_storage->edges == other.m_storage->edges;
 }
 
 template <
@@ -1133,6 +1222,21 @@ bool Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Hol
 	return !(*this == other);
 }
 
+template <
+    typename Derived,
+    typename Backend,
+    typename Vertex,
+    typename Edge,
+    typename VertexDescriptor,
+    typename EdgeDescriptor,
+    template <typename...>
+    typename Holder>
+bool Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::
+    shares_storage_with(Graph const& other) const
+{
+	return m_storage && m_storage == other.m_storage;
+}
+
 template <
     typename Derived,
     typename Backend,
@@ -1213,10 +1317,10 @@ template <
 Backend& Graph<Derived, Backend, Vertex, Edge, VertexDescriptor, EdgeDescriptor, Holder>::backend()
     const
 {
-	if (!m_backend) {
+	if (!m_storage) {
 		throw std::logic_error("Unexpected access to moved-from object.");
 	}
-	return *m_backend;
+	return *m_storage->backend;
 }
 
 } // namespace grenade::common
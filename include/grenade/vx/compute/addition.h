@@ -1,8 +1,10 @@
 #pragma once
+#include <optional>
 #include <vector>
 
 #include "grenade/common/topology.h"
 #include "grenade/common/vertex_on_topology.h"
+#include "grenade/vx/compute/detail/fusable_operation.h"
 #include "grenade/vx/signal_flow/types.h"
 
 namespace cereal {
@@ -54,6 +56,11 @@ private:
 	grenade::common::VertexOnTopology m_vertex{};
 	std::vector<signal_flow::Int8> m_other{};
 
+	std::optional<detail::FusableOperation> get_fusable_operation(
+	    size_t batch_size, lola::vx::v3::Chip const& config) const SYMBOL_VISIBLE;
+
+	friend struct Sequence;
+
 	friend struct cereal::access;
 	template <typename Archive>
 	void serialize(Archive& ar, std::uint32_t);
@@ -1,7 +1,9 @@
 #pragma once
+#include <optional>
 #include <vector>
 
 #include "grenade/common/topology.h"
+#include "grenade/vx/compute/detail/fusable_operation.h"
 #include "grenade/vx/signal_flow/types.h"
 #include "lola/vx/v3/chip.h"
 
@@ -51,6 +53,11 @@ private:
 	std::shared_ptr<grenade::common::Topology> m_graph;
 	grenade::common::VertexOnTopology m_vertex{};
 
+	std::optional<detail::FusableOperation> get_fusable_operation(
+	    size_t batch_size, lola::vx::v3::Chip const& config) const SYMBOL_VISIBLE;
+
+	friend struct Sequence;
+
 	friend struct cereal::access;
 	template <typename Archive>
 	void serialize(Archive& ar, std::uint32_t);
@@ -1,8 +1,11 @@
 #pragma once
+#include <optional>
+#include <stdexcept>
 #include <vector>
 #include <gtest/gtest_prod.h>
 
 #include "grenade/vx/common/time.h"
+#include "grenade/vx/compute/detail/fusable_operation.h"
 #include "grenade/vx/compute/mac.h"
 #include "grenade/vx/signal_flow/types.h"
 
@@ -38,6 +41,11 @@ public:
 	 * dimension. */
 	typedef std::vector<std::vector<signal_flow::UInt5>> Activations;
 
+	/**
+	 * Default maximal number of input windows run on the MAC at once.
+	 */
+	static constexpr size_t default_max_windows_per_run = 10000;
+
 	Conv1d() = default;
 
 	/**
@@ -48,6 +56,10 @@ public:
 	 * @param num_sends Number of times a input activation is sent to the specific row
 	 * @param wait_between_events Wait time between input events in FPGA cycles
 	 * @param enable_loopback Enable loopback of events with statistic analysis
+	 * @param max_windows_per_run Maximal number of input windows over all batch entries, which are
+	 * gathered and run on the MAC at once. It bounds the memory required for the gathered windows
+	 * and their results, larger numbers lead to fewer runs.
+	 * @throws std::runtime_error On the maximal number of windows per run being zero
 	 */
 	template <typename WeightsT>
 	Conv1d(
@@ -56,7 +68,8 @@ public:
 	    size_t stride,
 	    size_t num_sends = 1,
 	    common::Time wait_between_events = common::Time(25),
-	    bool enable_loopback = false);
+	    bool enable_loopback = false,
+	    size_t max_windows_per_run = default_max_windows_per_run);
 
 	/**
 	 * Run given set of activations given the weights from construction.
@@ -82,12 +95,21 @@ private:
 	size_t m_in_channels{};
 	size_t m_out_channels{};
 	size_t m_stride{};
+	size_t m_max_windows_per_run{default_max_windows_per_run};
 
 	MAC m_mac{};
 
 	size_t m_num_sends{};
 	common::Time m_wait_between_events{};
 
+	/**
+	 * Never fusable since batch entries are unrolled on the host, see detail::FusableOperation.
+	 */
+	std::optional<detail::FusableOperation> get_fusable_operation(
+	    size_t batch_size, lola::vx::v3::Chip const& config) const SYMBOL_VISIBLE;
+
+	friend struct Sequence;
+
 	friend struct cereal::access;
 	template <typename Archive>
 	void serialize(Archive& ar, std::uint32_t);
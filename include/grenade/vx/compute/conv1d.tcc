@@ -7,13 +7,18 @@ Conv1d::Conv1d(
     size_t stride,
     size_t num_sends,
     common::Time wait_between_events,
-    bool enable_loopback) :
+    bool enable_loopback,
+    size_t max_windows_per_run) :
     m_enable_loopback(enable_loopback),
     m_input_size(input_size),
     m_stride(stride),
+    m_max_windows_per_run(max_windows_per_run),
     m_num_sends(num_sends),
     m_wait_between_events(wait_between_events)
 {
+	if (m_max_windows_per_run == 0) {
+		throw std::runtime_error("Maximal number of windows per run is zero.");
+	}
 	build_mac(std::forward<Weights>(weights));
 }
 
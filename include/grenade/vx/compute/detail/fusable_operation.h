@@ -0,0 +1,50 @@
+#pragma once
+#include "grenade/common/input_data.h"
+#include "grenade/common/port_on_topology.h"
+#include "grenade/common/topology.h"
+#include "hate/visibility.h"
+#include <memory>
+#include <vector>
+
+namespace grenade::vx::compute::detail {
+
+/**
+ * Compute operation prepared for execution together with other operations in a single topology.
+ *
+ * Compute operations usable in a Sequence provide it via
+ * `std::optional<FusableOperation> get_fusable_operation(size_t batch_size, Chip const& config)`,
+ * where the batch size is the number of batch entries of the input and the chip configuration is
+ * the static configuration to be used. The operation is std::nullopt, if the compute operation
+ * requires to be run on its own.
+ */
+struct FusableOperation
+{
+	/** Topology of operation. */
+	std::shared_ptr<grenade::common::Topology const> topology;
+	/** Input data of operation except for the data of the input port. */
+	grenade::common::InputData input_data;
+	/** Input port of operation. */
+	grenade::common::PortOnTopology input;
+	/** Output port of operation. */
+	grenade::common::PortOnTopology output;
+
+	/**
+	 * Compare operations, where topologies are compared by identity.
+	 */
+	bool operator==(FusableOperation const& other) const = default;
+	bool operator!=(FusableOperation const& other) const = default;
+};
+
+/**
+ * Fuse chain of operations into a single operation, where the output port of each operation is
+ * connected to the input port of the following operation.
+ * Execution instances and time domains of the operations are renumbered to be disjoint and ordered
+ * like the operations.
+ * @param operations Operations to fuse
+ * @throws std::invalid_argument On no operations being given, on the output port of an operation
+ * not matching the input port of the following operation in type or size or on a time domain not
+ * being located on a chip entity
+ */
+FusableOperation fuse(std::vector<FusableOperation> const& operations) SYMBOL_VISIBLE;
+
+} // namespace grenade::vx::compute::detail
@@ -1,10 +1,14 @@
 #pragma once
+#include <optional>
 #include <vector>
 #include <gtest/gtest_prod.h>
 
 #include "grenade/common/topology.h"
 #include "grenade/common/vertex_on_topology.h"
 #include "grenade/vx/common/time.h"
+#include "grenade/vx/common/timed_data.h"
+#include "grenade/vx/compute/detail/fusable_operation.h"
+#include "grenade/vx/compute/madc_recording_sink.h"
 #include "grenade/vx/execution/jit_graph_executor.h"
 #include "grenade/vx/signal_flow/types.h"
 #include "grenade/vx/signal_flow/vertex/synapse_array_view.h"
@@ -13,6 +17,8 @@
 #include "haldls/vx/v3/event.h"
 #include "haldls/vx/v3/synapse_driver.h"
 #include "lola/vx/v3/synapse.h"
+#include <memory>
+#include <mutex>
 #include <string>
 
 namespace cereal {
@@ -69,7 +75,8 @@ public:
 	 * @param enable_loopback Enable loopback of events with statistic analysis
 	 * @param madc_recording_neuron Neuron ID to record via MADC
 	 * @param madc_recording_path Path to which to store MADC neuron membrane recordings in CSV
-	 * format. If file exists new data is appended. By default recording is disabled.
+	 * format unless another sink is set via set_madc_recording_sink(). If file exists new data is
+	 * appended. By default recording is disabled.
 	 */
 	template <typename WeightsT>
 	MAC(WeightsT&& weights,
@@ -80,8 +87,44 @@ public:
 	        halco::hicann_dls::vx::v3::AtomicNeuronOnDLS(),
 	    std::string madc_recording_path = "");
 
+	/**
+	 * Set sink for MADC recordings replacing the default sink, which appends to the recording
+	 * path in TSV format.
+	 * Runs don't wait for the sink to write the recordings to its file. Recordings of a run are
+	 * visible in the file after flush_madc_recording() or after destruction of the sink, which
+	 * happens once it is neither set in the operation nor its copies. The default sink is
+	 * destructed at the end of every run.
+	 * The sink is shared between copies of the operation and is not serialized.
+	 * @param sink Sink to use
+	 * @throws std::runtime_error On MADC recording not being enabled
+	 */
+	void set_madc_recording_sink(std::shared_ptr<MADCRecordingSink> sink) SYMBOL_VISIBLE;
+
+	/**
+	 * Block until the recordings of all previous runs are written to the file of the set MADC
+	 * recording sink.
+	 * Does nothing if no sink is set.
+	 */
+	void flush_madc_recording() const SYMBOL_VISIBLE;
+
+	class Prepared;
+
+	/**
+	 * Prepare operation for repeated runs with the given static chip configuration.
+	 * The parameterization of the topology, which contains the weights and the chip
+	 * configuration, is constructed once and reused for every run of the prepared operation.
+	 * The prepared operation shares the topology with the MAC, but doesn't depend on its lifetime.
+	 * @param config Static chip configuration to be used
+	 */
+	Prepared prepare(lola::vx::v3::Chip const& config) const SYMBOL_VISIBLE;
+
 	/**
 	 * Run given set of activations weights given on construction.
+	 * The operation prepared for the chip configuration is kept and reused by subsequent runs with
+	 * an equal configuration. The chip configuration is still handed to the executor on every run,
+	 * which transfers it to the hardware.
+	 * The configuration is compared to the one of the kept operation on every run. Runs are not
+	 * serialized, the kept operation is only locked for its lookup and replacement.
 	 * @param inputs Input activations to use
 	 * @param config Static chip configuration to be used
 	 * @param executor Executor backend to use
@@ -92,6 +135,21 @@ public:
 	    lola::vx::v3::Chip const& config,
 	    execution::JITGraphExecutor& executor) const SYMBOL_VISIBLE;
 
+	/**
+	 * Run given set of activations weights given on construction.
+	 * The configuration object serves as fingerprint of the configuration, the kept prepared
+	 * operation is reused without comparing the configuration if the same object is given.
+	 * Therefore, the configuration is required to not be modified after construction.
+	 * @param inputs Input activations to use
+	 * @param config Static chip configuration to be used
+	 * @param executor Executor backend to use
+	 * @return Resulting accumulated membrane potentials
+	 */
+	std::vector<std::vector<signal_flow::Int8>> run(
+	    Activations const& inputs,
+	    std::shared_ptr<lola::vx::v3::Chip const> const& config,
+	    execution::JITGraphExecutor& executor) const SYMBOL_VISIBLE;
+
 	size_t input_size() const SYMBOL_VISIBLE;
 	size_t output_size() const SYMBOL_VISIBLE;
 
@@ -135,16 +193,151 @@ private:
 
 	halco::hicann_dls::vx::v3::AtomicNeuronOnDLS m_madc_recording_neuron;
 	std::string m_madc_recording_path;
+	std::shared_ptr<MADCRecordingSink> m_madc_recording_sink;
 	std::map<grenade::common::ExecutionInstanceOnExecutor, grenade::common::VertexOnTopology>
 	    m_madc_recording_vertices;
 	std::map<grenade::common::ExecutionInstanceOnExecutor, grenade::common::VertexOnTopology>
 	    m_chip_vertices;
 
+	/**
+	 * Get parameterization of topology, i.e. input data except for the input activations and
+	 * runtimes.
+	 * @param config Static chip configuration to be used
+	 */
+	grenade::common::InputData get_parameterization(lola::vx::v3::Chip const& config) const
+	    SYMBOL_VISIBLE;
+
+	/**
+	 * Not fusable for enabled loopback or MADC recording, see detail::FusableOperation.
+	 * The input data shares the parameterization with the cached operation prepared for the
+	 * configuration.
+	 */
+	std::optional<detail::FusableOperation> get_fusable_operation(
+	    size_t batch_size, lola::vx::v3::Chip const& config) const SYMBOL_VISIBLE;
+
+	/**
+	 * Operation prepared for the chip configuration of the most recent run.
+	 * The mutex only guards lookup and replacement of the entry, runs using the prepared operation
+	 * are executed concurrently. Copies start empty.
+	 */
+	struct PreparedCache
+	{
+		PreparedCache() = default;
+		PreparedCache(PreparedCache const&) : PreparedCache() {}
+		PreparedCache& operator=(PreparedCache const& other) SYMBOL_VISIBLE;
+
+		/**
+		 * Immutable operation prepared for a chip configuration.
+		 */
+		struct Entry
+		{
+			/**
+			 * Configuration for which the operation is prepared.
+			 * Its address is the fingerprint of configurations given as shared object.
+			 */
+			std::shared_ptr<lola::vx::v3::Chip const> config;
+			std::shared_ptr<Prepared const> prepared;
+		};
+
+		/**
+		 * Get current entry.
+		 */
+		std::shared_ptr<Entry const> get() SYMBOL_VISIBLE;
+
+		/**
+		 * Replace current entry.
+		 */
+		void set(std::shared_ptr<Entry const> value) SYMBOL_VISIBLE;
+
+		/**
+		 * Remove prepared operation.
+		 */
+		void reset() SYMBOL_VISIBLE;
+
+	private:
+		std::mutex m_mutex;
+		std::shared_ptr<Entry const> m_entry;
+	};
+	mutable PreparedCache m_prepared_cache;
+
+	/**
+	 * Get operation prepared for the given chip configuration from the cache.
+	 * The configuration is compared to the cached one without holding the cache's lock.
+	 * @param config Static chip configuration to be used
+	 */
+	std::shared_ptr<Prepared const> get_prepared(lola::vx::v3::Chip const& config) const
+	    SYMBOL_VISIBLE;
+
+	/**
+	 * Get operation prepared for the given chip configuration from the cache.
+	 * The configuration is only compared to the cached one, if it is not the cached object.
+	 * Operations are prepared without holding the cache's lock.
+	 * @param config Static chip configuration to be used
+	 */
+	std::shared_ptr<Prepared const> get_prepared(
+	    std::shared_ptr<lola::vx::v3::Chip const> const& config) const SYMBOL_VISIBLE;
+
+	/**
+	 * Run given set of activations already in the representation of the topology input using the
+	 * cached prepared operation, see Prepared::run_timed.
+	 * @param inputs Timed input activations to use with one data entry per batch entry
+	 * @param config Static chip configuration to be used
+	 * @param executor Executor backend to use
+	 * @return Resulting accumulated membrane potentials
+	 */
+	std::vector<std::vector<signal_flow::Int8>> run_timed(
+	    std::vector<common::TimedDataSequence<std::vector<signal_flow::UInt5>>>&& inputs,
+	    lola::vx::v3::Chip const& config,
+	    execution::JITGraphExecutor& executor) const SYMBOL_VISIBLE;
+
+	friend struct Sequence;
+	friend class Conv1d;
+
 	friend struct cereal::access;
 	template <typename Archive>
 	void serialize(Archive& ar, std::uint32_t);
 };
 
+/**
+ * MAC operation prepared for a static chip configuration.
+ * On each run, only the input activations are converted.
+ * The prepared operation holds an immutable copy of the MAC, which shares its topology.
+ */
+class MAC::Prepared
+{
+public:
+	/**
+	 * Run given set of activations.
+	 * @param inputs Input activations to use
+	 * @param executor Executor backend to use
+	 * @return Resulting accumulated membrane potentials
+	 */
+	std::vector<std::vector<signal_flow::Int8>> run(
+	    Activations const& inputs, execution::JITGraphExecutor& executor) const SYMBOL_VISIBLE;
+
+private:
+	Prepared(std::shared_ptr<MAC const> mac, grenade::common::InputData&& input_data)
+	    SYMBOL_VISIBLE;
+
+	/**
+	 * Run given set of activations already in the representation of the topology input.
+	 * The activations are moved into a copy of the input data, which shares the parameterization
+	 * with the prepared operation. The prepared operation is therefore not modified and can be
+	 * run concurrently.
+	 * @param inputs Timed input activations to use with one data entry per batch entry
+	 * @param executor Executor backend to use
+	 * @return Resulting accumulated membrane potentials
+	 */
+	std::vector<std::vector<signal_flow::Int8>> run_timed(
+	    std::vector<common::TimedDataSequence<std::vector<signal_flow::UInt5>>>&& inputs,
+	    execution::JITGraphExecutor& executor) const SYMBOL_VISIBLE;
+
+	std::shared_ptr<MAC const> m_mac;
+	grenade::common::InputData m_input_data;
+
+	friend class MAC;
+};
+
 } // namespace compute
 
 } // namespace grenade::vx
@@ -0,0 +1,166 @@
+#pragma once
+#include "grenade/common/execution_instance_id.h"
+#include "grenade/vx/signal_flow/event.h"
+#include "hate/visibility.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace grenade::vx::compute {
+
+/**
+ * Sink for MADC membrane recordings of compute operations.
+ * Recorded samples may be buffered and are required to be written to the underlying file at the
+ * latest on flush() or destruction of the sink.
+ */
+struct SYMBOL_VISIBLE MADCRecordingSink
+{
+	virtual ~MADCRecordingSink();
+
+	/**
+	 * Record samples of a batch entry of an execution instance.
+	 * @param execution_instance Execution instance of the samples
+	 * @param batch_entry Batch entry of the samples
+	 * @param samples Samples to record
+	 */
+	virtual void write(
+	    grenade::common::ExecutionInstanceID const& execution_instance,
+	    size_t batch_entry,
+	    signal_flow::TimedMADCSampleFromChipSequence const& samples) = 0;
+
+	/**
+	 * Block until all recorded samples are written to the underlying file.
+	 */
+	virtual void flush() = 0;
+};
+
+/**
+ * Sink writing MADC recordings as tab-separated text with a line per sample.
+ * If the file exists, new data is appended, otherwise a header line is written first.
+ */
+struct SYMBOL_VISIBLE TSVMADCRecordingSink : public MADCRecordingSink
+{
+	/**
+	 * Open file for recording.
+	 * @param path Path of file
+	 * @throws std::runtime_error On file not being writable
+	 */
+	TSVMADCRecordingSink(std::string const& path);
+
+	virtual void write(
+	    grenade::common::ExecutionInstanceID const& execution_instance,
+	    size_t batch_entry,
+	    signal_flow::TimedMADCSampleFromChipSequence const& samples) override;
+
+	virtual void flush() override;
+
+private:
+	std::ofstream m_file;
+};
+
+/**
+ * Sink writing MADC recordings in a binary format from a separate writer thread.
+ *
+ * A file consists of a file header followed by blocks.
+ * Each block starts with a block header carrying the execution instance, batch entry, MADC
+ * channel and number of samples and is followed by the fixed-width records of the samples.
+ * Consecutive samples on the same channel share a block.
+ * All values are stored in host byte order, which is recorded in the file header.
+ * Records are encoded into a buffer, which is handed to the writer thread once it exceeds the
+ * buffer size, so that recording does not wait for the file I/O.
+ * Writes and flushes may be issued concurrently from multiple threads.
+ */
+struct SYMBOL_VISIBLE BinaryMADCRecordingSink : public MADCRecordingSink
+{
+	struct FileHeader
+	{
+		char magic[16];
+		uint32_t version;
+		uint32_t byte_order_mark;
+		uint32_t block_header_size;
+		uint32_t record_size;
+	};
+
+	struct BlockHeader
+	{
+		uint64_t execution_instance;
+		uint64_t batch_entry;
+		uint32_t channel;
+		uint32_t reserved;
+		uint64_t num_samples;
+	};
+
+	struct Record
+	{
+		uint64_t time;
+		uint16_t value;
+		uint16_t reserved[3];
+	};
+
+	static constexpr char magic[16] = "grenade-madc";
+	static constexpr uint32_t version = 0;
+	static constexpr uint32_t byte_order_mark = 0x01020304;
+
+	/**
+	 * Open file for recording and start writer thread.
+	 * If the file exists, new blocks are appended.
+	 * @param path Path of file
+	 * @param buffer_size Size in bytes of encoded records after which they are handed to the
+	 * writer thread
+	 * @throws std::runtime_error On file not being writable or the header of an existing file not
+	 * matching
+	 */
+	BinaryMADCRecordingSink(std::string const& path, size_t buffer_size = 1024 * 1024);
+
+	BinaryMADCRecordingSink(BinaryMADCRecordingSink const&) = delete;
+	BinaryMADCRecordingSink& operator=(BinaryMADCRecordingSink const&) = delete;
+
+	/**
+	 * Write all remaining records and stop writer thread.
+	 */
+	virtual ~BinaryMADCRecordingSink();
+
+	/**
+	 * @throws std::runtime_error On a previous write of the writer thread having failed
+	 */
+	virtual void write(
+	    grenade::common::ExecutionInstanceID const& execution_instance,
+	    size_t batch_entry,
+	    signal_flow::TimedMADCSampleFromChipSequence const& samples) override;
+
+	/**
+	 * @throws std::runtime_error On a write of the writer thread having failed
+	 */
+	virtual void flush() override;
+
+private:
+	/**
+	 * Hand encoded records to the writer thread.
+	 * Requires the buffer mutex to be held.
+	 */
+	void submit();
+	void work();
+	void rethrow_writer_exception();
+
+	std::ofstream m_file;
+	size_t m_buffer_size;
+	std::mutex m_buffer_mutex;
+	std::vector<char> m_buffer;
+
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::queue<std::vector<char>> m_queue;
+	bool m_busy;
+	bool m_stop;
+	std::exception_ptr m_writer_exception;
+	std::thread m_writer;
+};
+
+} // namespace grenade::vx::compute
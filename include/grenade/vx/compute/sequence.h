@@ -4,11 +4,14 @@
 #include "grenade/vx/compute/argmax.h"
 #include "grenade/vx/compute/conv1d.h"
 #include "grenade/vx/compute/converting_relu.h"
+#include "grenade/vx/compute/detail/fusable_operation.h"
 #include "grenade/vx/compute/mac.h"
 #include "grenade/vx/compute/relu.h"
 #include "hate/visibility.h"
 #include <list>
+#include <map>
 #include <variant>
+#include <vector>
 
 namespace cereal {
 struct access;
@@ -44,12 +47,41 @@ struct Sequence
 
 	Sequence() = default;
 
+	/**
+	 * Run sequence of entries on given input.
+	 * Consecutive entries, which support it, are fused into a single topology with disjoint
+	 * execution instances per entry and are executed in a single run without transferring
+	 * intermediate results to the host. Other entries, e.g. Conv1d, are run on their own.
+	 * The fused operations are kept and reused by subsequent runs, if the operations to fuse are
+	 * unchanged, e.g. for equal batch size and chip configuration. Then, only the input values are
+	 * replaced.
+	 * @param input Input values to use
+	 * @param config Static chip configuration to be used
+	 * @param executor Executor backend to use
+	 * @return Resulting values of the last entry
+	 */
 	IOData run(
 	    IOData const& input,
 	    lola::vx::v3::Chip const& config,
 	    execution::JITGraphExecutor& executor) SYMBOL_VISIBLE;
 
 private:
+	/**
+	 * Operation fused from consecutive fusable entries.
+	 */
+	struct FusedOperation
+	{
+		/** Operations of the entries. */
+		std::vector<detail::FusableOperation> operations;
+		/** Operation fused from the operations of the entries. */
+		detail::FusableOperation fused;
+	};
+
+	/**
+	 * Fused operations of the most recent run by position of their first entry in the sequence.
+	 */
+	std::map<size_t, FusedOperation> m_fused_operations;
+
 	friend struct cereal::access;
 	template <typename Archive>
 	void serialize(Archive& ar, std::uint32_t);
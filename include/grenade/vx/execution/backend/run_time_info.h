@@ -1,7 +1,9 @@
 #pragma once
 #include "grenade/vx/common/chip_on_connection.h"
+#include "hxcomm/common/connection_time_info.h"
 #include <chrono>
 #include <map>
+#include <vector>
 
 namespace grenade::vx::execution::backend {
 
@@ -15,6 +17,20 @@ struct RunTimeInfo
 	 * connection.
 	 */
 	std::map<common::ChipOnConnection, std::chrono::nanoseconds> execution_duration;
+
+	/**
+	 * Time info of a chunk of playback programs executed back-to-back on all chips.
+	 */
+	struct Chunk
+	{
+		/** Begin of execution of chunk. */
+		std::chrono::steady_clock::time_point begin;
+		/** Time info of connection accumulated during execution of chunk per chip on connection. */
+		std::map<common::ChipOnConnection, hxcomm::ConnectionTimeInfo> time_info;
+	};
+
+	/** Time info per executed chunk of realtime snippets in order of execution. */
+	std::vector<Chunk> chunks;
 };
 
 } // namespace grenade::vx::execution::backend
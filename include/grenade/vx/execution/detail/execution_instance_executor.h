@@ -4,8 +4,10 @@
 #include "grenade/vx/execution/backend/playback_program.h"
 #include "grenade/vx/execution/detail/execution_instance_realtime_executor.h"
 #include "grenade/vx/execution/detail/generator/health_info.h"
+#include "grenade/vx/execution/detail/profiler.h"
 #include "grenade/vx/execution/detail/system.h"
 #include "grenade/vx/execution/execution_instance_hooks.h"
+#include "grenade/vx/execution/health_info_sampling.h"
 #include "halco/common/typed_array.h"
 #include "halco/hicann-dls/vx/v3/ppu.h"
 #include "haldls/vx/v3/ppu.h"
@@ -29,10 +31,24 @@ struct ExecutionInstanceExecutor
 		struct Chip
 		{
 			std::vector<generator::PPUReadHooks::Result> ppu_read_hooks_results;
+			/** Bulk reads of aggregated PPU symbol snapshots in order of batch entries. */
+			std::vector<generator::PPUReadSnapshots::Result> ppu_snapshot_results;
+			/**
+			 * Health info results before and after each sampled interval of chunks.
+			 * An interval is either a single sampled chunk or, since the counters are cumulative,
+			 * all chunks from the first to the last one.
+			 */
 			std::vector<generator::HealthInfo::Result> health_info_results_pre;
 			std::vector<generator::HealthInfo::Result> health_info_results_post;
 		};
 
+		/** Whether execution health info is sampled. */
+		bool enable_health_info{true};
+		/** Number of chunks covered by the sampled intervals. */
+		size_t num_sampled_chunks{0};
+		/** Total number of chunks. */
+		size_t num_chunks{0};
+
 		std::map<common::ChipOnConnection, Chip> chips;
 
 		ExecutionInstanceRealtimeExecutor::PostProcessor realtime;
@@ -50,6 +66,8 @@ struct ExecutionInstanceExecutor
 	 * @param input_data Input data to use
 	 * @param hooks Execution instance hooks to use
 	 * @param chips_on_connection Chip identifiers on connection to use
+	 * @param health_info_sampling Sampling policy of execution health information
+	 * @param profiler Profiler to record the program construction in, no recording if null
 	 */
 	ExecutionInstanceExecutor(
 	    std::vector<std::shared_ptr<grenade::common::LinkedTopology>> const& topologies,
@@ -57,7 +75,9 @@ struct ExecutionInstanceExecutor
 	    std::vector<grenade::common::OutputData>& output_data,
 	    std::vector<std::reference_wrapper<grenade::common::InputData const>> const& input_data,
 	    ExecutionInstanceHooks& hooks,
-	    std::vector<common::ChipOnConnection> const& chips_on_connection) SYMBOL_VISIBLE;
+	    std::vector<common::ChipOnConnection> const& chips_on_connection,
+	    HealthInfoSampling const& health_info_sampling = HealthInfoSampling(),
+	    Profiler* profiler = nullptr) SYMBOL_VISIBLE;
 
 	std::pair<backend::PlaybackProgram, PostProcessor> operator()(
 	    std::map<common::ChipOnConnection, hxcomm::HwdbEntry> const& chip_hwdb_entries) const
@@ -70,6 +90,8 @@ private:
 	std::vector<std::reference_wrapper<grenade::common::InputData const>> const& m_input_data;
 	ExecutionInstanceHooks& m_hooks;
 	std::vector<common::ChipOnConnection> m_chips_on_connection;
+	HealthInfoSampling m_health_info_sampling;
+	Profiler* m_profiler;
 };
 
 } // namespace grenade::vx::execution::detail
@@ -8,7 +8,9 @@
 #include "grenade/common/linked_topology.h"
 #include "grenade/common/output_data.h"
 #include "grenade/common/vertex_on_topology.h"
+#include "grenade/vx/execution/detail/profiler.h"
 #include "grenade/vx/execution/execution_instance_hooks.h"
+#include "grenade/vx/execution/health_info_sampling.h"
 #include "hate/visibility.h"
 #include "lola/vx/v3/chip.h"
 #include "stadls/vx/v3/playback_program.h"
@@ -43,6 +45,8 @@ struct ExecutionInstanceNode
 	 * @param hooks Execution instance hooks to use
 	 * @param execution_instance_vertex_descriptors Vertex descriptors per realtime snippet of
 	 * execution instance to visit
+	 * @param health_info_sampling Sampling policy of execution health information
+	 * @param profiler Profiler to record execution phases in
 	 */
 	ExecutionInstanceNode(
 	    std::vector<grenade::common::OutputData>& output_data,
@@ -52,8 +56,9 @@ struct ExecutionInstanceNode
 	    std::vector<std::reference_wrapper<grenade::common::InputData const>> const& data,
 	    backend::StatefulConnection& connection,
 	    ExecutionInstanceHooks& hooks,
-	    std::vector<grenade::common::VertexOnTopology> const& execution_instance_vertex_descriptors)
-	    SYMBOL_VISIBLE;
+	    std::vector<grenade::common::VertexOnTopology> const& execution_instance_vertex_descriptors,
+	    HealthInfoSampling const& health_info_sampling,
+	    Profiler& profiler) SYMBOL_VISIBLE;
 
 	void operator()(tbb::flow::continue_msg) SYMBOL_VISIBLE;
 
@@ -82,6 +87,8 @@ private:
 	backend::StatefulConnection& connection;
 	ExecutionInstanceHooks& hooks;
 	std::vector<grenade::common::VertexOnTopology> const& execution_instance_vertex_descriptors;
+	HealthInfoSampling health_info_sampling;
+	Profiler& profiler;
 	log4cxx::LoggerPtr logger;
 };
 
@@ -11,6 +11,11 @@
 #include "stadls/vx/v3/absolute_time_playback_program_container_ticket.h"
 #include "stadls/vx/v3/container_ticket.h"
 #include "stadls/vx/v3/playback_program_builder.h"
+#include <cstdint>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace grenade::vx::execution::detail::generator {
 
@@ -166,6 +171,131 @@ private:
 };
 
 
+/**
+ * Layout of snapshots of PPU symbols in the snapshot buffer in external DRAM.
+ * Only symbols located in PPU-internal memory are part of a snapshot, they are placed after one
+ * another in the order of their names.
+ */
+struct PPUSnapshotLayout
+{
+	/**
+	 * Construct layout.
+	 * @param symbol_names PPU symbol names to read out
+	 * @param symbols PPU symbols to use for location lookup
+	 * @throws std::runtime_error On unknown symbol, too many symbols or the snapshot buffer not
+	 * fitting a single snapshot
+	 */
+	PPUSnapshotLayout(
+	    std::set<std::string> const& symbol_names,
+	    lola::vx::v3::PPUElfFile::symbols_type const& symbols) SYMBOL_VISIBLE;
+
+	/** Symbols in snapshot in order of placement. */
+	std::vector<std::pair<std::string, halco::hicann_dls::vx::v3::PPUMemoryBlockOnPPU>> regions;
+	/** Size of a single snapshot in bytes. */
+	size_t size_in_bytes;
+	/** Number of snapshots fitting into the snapshot buffer. */
+	size_t capacity;
+	/** Symbol names not part of the snapshots, which are to be read directly. */
+	std::set<std::string> remaining_symbol_names;
+};
+
+
+/**
+ * Generator for a playback program snippet for a snapshot of PPU symbols into the snapshot buffer.
+ * The PPUs place the snapshot at their current offset in the snapshot buffer and advance it past
+ * the snapshot, so only the command is issued, which requires the PPUs to be idle. Only the first
+ * snapshot of a chunk resets the offset to the beginning of the snapshot buffer.
+ * Completion of the snapshots is awaited once per chunk by PPUReadSnapshots.
+ */
+struct PPUSnapshot
+{
+	typedef hate::Nil Result;
+	typedef stadls::vx::v3::PlaybackProgramBuilder Builder;
+
+	/**
+	 * Construct generator for snapshot.
+	 * @param index Index of snapshot in snapshot buffer, which is expected to be advanced by one
+	 * for each snapshot of a chunk
+	 * @param symbols PPU symbols to use for location lookup
+	 */
+	PPUSnapshot(size_t index, lola::vx::v3::PPUElfFile::symbols_type const& symbols) :
+	    m_index(index), m_symbols(symbols)
+	{}
+
+protected:
+	stadls::vx::PlaybackGeneratorReturn<Builder, Result> generate() const SYMBOL_VISIBLE;
+
+	friend auto stadls::vx::generate<PPUSnapshot>(PPUSnapshot const&);
+
+private:
+	size_t m_index;
+	lola::vx::v3::PPUElfFile::symbols_type const& m_symbols;
+};
+
+
+/**
+ * Generator for a playback program snippet for a bulk read of the snapshot buffer.
+ * Before the read, the PPUs are awaited to complete the last snapshot.
+ */
+struct PPUReadSnapshots
+{
+	struct Result
+	{
+		halco::common::typed_array<
+		    std::vector<stadls::vx::v3::ContainerTicket>,
+		    halco::hicann_dls::vx::v3::PPUOnDLS>
+		    tickets;
+
+		std::vector<std::pair<std::string, halco::hicann_dls::vx::v3::PPUMemoryBlockOnPPU>>
+		    regions;
+		size_t size_in_bytes;
+		size_t num_snapshots;
+
+		/**
+		 * Split read snapshot buffer into the read PPU symbols of the individual snapshots.
+		 * @return Read PPU symbols per snapshot
+		 */
+		std::vector<PPUReadHooks::Result::ReadPPUSymbols> evaluate() const;
+
+		/**
+		 * Split given snapshot buffer content into the PPU symbols of the individual snapshots.
+		 * @param bytes Bytes read from the beginning of the snapshot buffer of each PPU
+		 * @return Read PPU symbols per snapshot
+		 * @throws std::logic_error On size of bytes not matching the number of snapshots
+		 */
+		std::vector<PPUReadHooks::Result::ReadPPUSymbols> evaluate(
+		    halco::common::
+		        typed_array<std::vector<uint8_t>, halco::hicann_dls::vx::v3::PPUOnDLS> const&
+		            bytes) const SYMBOL_VISIBLE;
+	};
+
+	typedef stadls::vx::v3::PlaybackProgramBuilder Builder;
+
+	/**
+	 * Construct generator for bulk read.
+	 * @param layout Layout of snapshots
+	 * @param num_snapshots Number of snapshots to read from the beginning of the snapshot buffer
+	 * @param symbols PPU symbols to use for location lookup
+	 */
+	PPUReadSnapshots(
+	    PPUSnapshotLayout const& layout,
+	    size_t num_snapshots,
+	    lola::vx::v3::PPUElfFile::symbols_type const& symbols) :
+	    m_layout(layout), m_num_snapshots(num_snapshots), m_symbols(symbols)
+	{}
+
+protected:
+	stadls::vx::PlaybackGeneratorReturn<Builder, Result> generate() const SYMBOL_VISIBLE;
+
+	friend auto stadls::vx::generate<PPUReadSnapshots>(PPUReadSnapshots const&);
+
+private:
+	PPUSnapshotLayout const& m_layout;
+	size_t m_num_snapshots;
+	lola::vx::v3::PPUElfFile::symbols_type const& m_symbols;
+};
+
+
 /**
  * Generator for a playback program snippet for reads of PPU symbols requested for periodic CADC
  * readout.
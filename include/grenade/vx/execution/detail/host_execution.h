@@ -0,0 +1,70 @@
+#pragma once
+#include "grenade/common/edge_on_topology.h"
+#include "grenade/common/input_data.h"
+#include "grenade/common/output_data.h"
+#include "grenade/common/vertex_on_topology.h"
+#include "grenade/vx/signal_flow/vertex/transformation.h"
+#include "hate/visibility.h"
+#include <functional>
+#include <vector>
+
+namespace grenade::common {
+struct Topology;
+} // namespace grenade::common
+
+namespace grenade::vx::execution::detail {
+
+/**
+ * Get whether topology can be executed on the host only.
+ * This is the case if all vertices are transformations with assigned execution instance, no edge
+ * restricts the channels of its target port and the topology is acyclic.
+ * @param topology Topology to check
+ */
+bool is_host_only(grenade::common::Topology const& topology) SYMBOL_VISIBLE;
+
+/**
+ * Execute host-only topology by directly applying the transformations in topological order.
+ * No linked topology, execution instance graph or playback program is constructed.
+ * @param topology Topology to execute, needs to be host-only
+ * @param input_data Input data to use
+ * @throws std::runtime_error On not all input to a transformation being provided
+ * @throws std::logic_error On edge restricting the target port
+ */
+grenade::common::OutputData run_host_only(
+    grenade::common::Topology const& topology,
+    grenade::common::InputData const& input_data) SYMBOL_VISIBLE;
+
+/**
+ * Apply transformation vertex to its input.
+ * Input of ports with in-edges is provided by the given callable, input of all other ports is
+ * taken from the input data.
+ * @param vertex_descriptor Descriptor of transformation vertex
+ * @param vertex Transformation vertex
+ * @param topology Topology containing the vertex
+ * @param input_data Input data to use for ports without in-edges
+ * @param get_edge_input Callable returning the input transported by the given in-edge
+ * @return Results per output port
+ * @throws std::runtime_error On not all input to the transformation being provided
+ * @throws std::logic_error On edge restricting the target port
+ */
+std::vector<signal_flow::vertex::Transformation::Results> apply_transformation(
+    grenade::common::VertexOnTopology const& vertex_descriptor,
+    signal_flow::vertex::Transformation const& vertex,
+    grenade::common::Topology const& topology,
+    grenade::common::InputData const& input_data,
+    std::function<signal_flow::vertex::Transformation::Dynamics(
+        grenade::common::EdgeOnTopology const&)> const& get_edge_input) SYMBOL_VISIBLE;
+
+/**
+ * Get section of transformation results transported by the given edge.
+ * Edges covering the complete source port skip the section extraction.
+ * @param results Results of source port of edge
+ * @param topology Topology containing the edge
+ * @param edge_descriptor Descriptor of edge
+ */
+signal_flow::vertex::Transformation::Dynamics get_edge_section(
+    signal_flow::vertex::Transformation::Results const& results,
+    grenade::common::Topology const& topology,
+    grenade::common::EdgeOnTopology const& edge_descriptor) SYMBOL_VISIBLE;
+
+} // namespace grenade::vx::execution::detail
@@ -34,6 +34,13 @@ public:
 	bool has_periodic_cadc_readout = false;
 	bool has_periodic_cadc_readout_on_dram = false;
 	size_t num_periodic_cadc_samples = 0;
+	/**
+	 * Whether to generate a snapshot buffer in external DRAM into which PPU symbols are copied on
+	 * Status::snapshot.
+	 */
+	bool has_snapshot = false;
+	/** Size of snapshot buffer per PPU in bytes. */
+	size_t snapshot_buffer_size = 0;
 
 private:
 	std::vector<std::tuple<
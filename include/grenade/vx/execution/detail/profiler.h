@@ -0,0 +1,99 @@
+#pragma once
+#include "grenade/vx/execution/profile.h"
+#include "hate/visibility.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace grenade::vx::execution::detail {
+
+/**
+ * Recorder of spans of execution phases.
+ * Spans are appended to a buffer local to the recording thread without locking, only the first
+ * recording of a thread registers its buffer with the profiler.
+ * Recording is skipped altogether while the profiler is disabled.
+ * Retrieval and clearing of the recorded spans are not to be performed concurrently to recording.
+ */
+class Profiler
+{
+public:
+	typedef std::chrono::steady_clock clock_type;
+
+	/**
+	 * Scope recording a span from its construction to its destruction.
+	 */
+	class Scope
+	{
+	public:
+		/**
+		 * Begin span.
+		 * @param profiler Profiler to record span in
+		 * @param span Span to record, begin, duration and thread are set on recording
+		 */
+		Scope(Profiler* profiler, ExecutionProfile::Span span) SYMBOL_VISIBLE;
+
+		Scope(Scope const&) = delete;
+		Scope& operator=(Scope const&) = delete;
+
+		/**
+		 * End and record span.
+		 */
+		~Scope() SYMBOL_VISIBLE;
+
+	private:
+		Profiler* m_profiler;
+		ExecutionProfile::Span m_span;
+		clock_type::time_point m_begin;
+	};
+
+	Profiler() SYMBOL_VISIBLE;
+
+	Profiler(Profiler const&) = delete;
+	Profiler& operator=(Profiler const&) = delete;
+
+	~Profiler() SYMBOL_VISIBLE;
+
+	void set_enabled(bool value) SYMBOL_VISIBLE;
+	bool get_enabled() const SYMBOL_VISIBLE;
+
+	/**
+	 * Record span.
+	 * @param span Span to record, begin, duration and thread are set from the given time points
+	 * @param begin Begin of span
+	 * @param end End of span
+	 */
+	void record(
+	    ExecutionProfile::Span span,
+	    clock_type::time_point const& begin,
+	    clock_type::time_point const& end) SYMBOL_VISIBLE;
+
+	/**
+	 * Get recorded spans.
+	 */
+	ExecutionProfile get_profile() const SYMBOL_VISIBLE;
+
+	/**
+	 * Remove recorded spans and restart the time reference of subsequently recorded spans.
+	 */
+	void clear() SYMBOL_VISIBLE;
+
+private:
+	struct Buffer
+	{
+		size_t thread;
+		std::vector<ExecutionProfile::Span> spans;
+	};
+
+	Buffer& get_buffer();
+
+	size_t const m_id;
+	std::atomic<bool> m_enabled;
+	clock_type::time_point m_epoch;
+	mutable std::mutex m_buffers_mutex;
+	std::vector<std::unique_ptr<Buffer>> m_buffers;
+};
+
+} // namespace grenade::vx::execution::detail
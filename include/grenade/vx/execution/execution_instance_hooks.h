@@ -8,6 +8,7 @@
 #include "stadls/vx/v3/absolute_time_playback_program_builder.h"
 #include "stadls/vx/v3/playback_program_builder.h"
 #include <map>
+#include <optional>
 #include <variant>
 
 namespace grenade::vx {
@@ -33,6 +34,18 @@ struct GENPYBIND(
 
 		typedef std::set<std::string> ReadPPUSymbols;
 
+		/**
+		 * Aggregation of reads of PPU symbols.
+		 * Symbols located in PPU-internal memory are copied by the PPU into a snapshot buffer
+		 * in external DRAM after every batch entry. The buffer is read in a single bulk
+		 * transfer once it is full and after the last batch entry.
+		 */
+		struct ReadPPUSymbolsAggregation
+		{
+			/** Size of snapshot buffer per PPU in bytes. */
+			size_t buffer_size_in_bytes{1024 * 1024};
+		};
+
 		Chip() = default;
 		Chip(
 		    stadls::vx::v3::PlaybackProgramBuilder& pre_static_config,
@@ -64,6 +77,12 @@ struct GENPYBIND(
 		 * PPU symbols to read after every batch entry.
 		 */
 		ReadPPUSymbols read_ppu_symbols;
+
+		/**
+		 * Aggregation of reads of PPU symbols.
+		 * If not present, all PPU symbols are read directly after every batch entry.
+		 */
+		std::optional<ReadPPUSymbolsAggregation> read_ppu_symbols_aggregation;
 	};
 
 	std::map<common::ChipOnConnection, Chip> chips GENPYBIND(hidden);
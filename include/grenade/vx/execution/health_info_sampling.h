@@ -0,0 +1,74 @@
+#pragma once
+#include "grenade/vx/genpybind.h"
+#include "hate/visibility.h"
+#include <cstddef>
+#include <ostream>
+
+namespace grenade::vx {
+namespace execution GENPYBIND_TAG_GRENADE_VX_EXECUTION {
+
+/**
+ * Sampling policy of the execution health information.
+ * The health information is read before and after each sampled playback program chunk of an
+ * execution instance and the resulting counter deltas are accumulated over all sampled chunks.
+ * Each read of the health information adds a fixed cost to a chunk, which is avoided for chunks
+ * which are not sampled.
+ * The number of sampled chunks and the total number of chunks are annotated to the resulting
+ * health information.
+ */
+struct GENPYBIND(visible) HealthInfoSampling
+{
+	enum class Mode
+	{
+		/** Sample every chunk. */
+		every_chunk,
+		/**
+		 * Sample only the first and the last chunk.
+		 * Since the counters are cumulative, they are read only before the first and after the
+		 * last chunk and the resulting delta covers all chunks.
+		 */
+		first_and_last,
+		/** Sample every N-th chunk starting with the first one. */
+		every_nth,
+		/** Don't sample, no health information is annotated. */
+		off
+	};
+
+	/** Mode of sampling. */
+	Mode mode{Mode::every_chunk};
+	/** Period of sampled chunks for Mode::every_nth. */
+	size_t period{1};
+
+	HealthInfoSampling() = default;
+
+	/**
+	 * Construct sampling policy.
+	 * @param mode Mode of sampling
+	 * @param period Period of sampled chunks for Mode::every_nth
+	 * @throws std::invalid_argument On zero period for Mode::every_nth
+	 */
+	HealthInfoSampling(Mode mode, size_t period = 1) SYMBOL_VISIBLE;
+
+	/**
+	 * Get whether sampling policy is valid, i.e. the period is non-zero for Mode::every_nth.
+	 */
+	bool valid() const SYMBOL_VISIBLE;
+
+	/**
+	 * Get whether chunk is to be sampled.
+	 * @param chunk Index of chunk
+	 * @param num_chunks Number of chunks
+	 * @throws std::invalid_argument On zero period for Mode::every_nth
+	 */
+	bool is_sampled(size_t chunk, size_t num_chunks) const SYMBOL_VISIBLE;
+
+	bool operator==(HealthInfoSampling const& other) const SYMBOL_VISIBLE;
+	bool operator!=(HealthInfoSampling const& other) const SYMBOL_VISIBLE;
+
+	GENPYBIND(stringstream)
+	friend std::ostream& operator<<(std::ostream& os, HealthInfoSampling const& value)
+	    SYMBOL_VISIBLE;
+};
+
+} // namespace execution
+} // namespace grenade::vx
@@ -5,7 +5,10 @@
 #include "grenade/common/output_data.h"
 #include "grenade/common/topology.h"
 #include "grenade/vx/execution/backend/stateful_connection.h"
+#include "grenade/vx/execution/detail/profiler.h"
 #include "grenade/vx/execution/execution_instance_hooks.h"
+#include "grenade/vx/execution/health_info_sampling.h"
+#include "grenade/vx/execution/profile.h"
 #include "halco/hicann-dls/vx/v3/chip.h"
 #include "hate/visibility.h"
 #include "lola/vx/v3/chip.h"
@@ -100,8 +103,44 @@ public:
 
 	std::map<grenade::common::ConnectionOnExecutor, size_t> connection_sizes() const SYMBOL_VISIBLE;
 
+	/**
+	 * Set sampling policy of the execution health information used for subsequent runs.
+	 * @param value Sampling policy
+	 * @throws std::invalid_argument On sampling policy not being valid
+	 */
+	void set_health_info_sampling(HealthInfoSampling const& value) SYMBOL_VISIBLE;
+
+	/**
+	 * Get sampling policy of the execution health information.
+	 */
+	HealthInfoSampling const& get_health_info_sampling() const SYMBOL_VISIBLE;
+
+	/**
+	 * Set whether to record the durations of the execution phases of subsequent runs.
+	 * Profiling is disabled by default.
+	 * @param value Whether to enable profiling
+	 */
+	void set_enable_profiling(bool value) SYMBOL_VISIBLE;
+
+	/**
+	 * Get whether the durations of the execution phases are recorded.
+	 */
+	bool get_enable_profiling() const SYMBOL_VISIBLE;
+
+	/**
+	 * Get profile of the execution phases recorded since construction or the last clear.
+	 */
+	ExecutionProfile get_profile() const SYMBOL_VISIBLE;
+
+	/**
+	 * Clear recorded profile.
+	 */
+	void clear_profile() SYMBOL_VISIBLE;
+
 private:
 	std::map<grenade::common::ConnectionOnExecutor, backend::StatefulConnection> m_connections;
+	HealthInfoSampling m_health_info_sampling;
+	std::unique_ptr<detail::Profiler> m_profiler;
 
 	/**
 	 * Check whether the given graph can be executed.
@@ -0,0 +1,142 @@
+#pragma once
+#include "grenade/common/execution_instance_on_executor.h"
+#include "grenade/vx/common/chip_on_connection.h"
+#include "grenade/vx/genpybind.h"
+#include "hate/visibility.h"
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(__GENPYBIND__) || defined(__GENPYBIND_GENERATED__)
+#include <pybind11/chrono.h>
+#include <pybind11/stl.h>
+#endif
+
+namespace grenade::vx {
+namespace execution GENPYBIND_TAG_GRENADE_VX_EXECUTION {
+
+/**
+ * Profile of the host-side phases of graph executions.
+ * A profile is a collection of spans, each of which is the duration of a phase within the context
+ * of an execution instance, chip, realtime snippet and playback program chunk, if applicable.
+ */
+struct GENPYBIND(visible) ExecutionProfile
+{
+	enum class Phase
+	{
+		/** Rewrite of the topologies into execution instances. */
+		rewrite,
+		/** Construction of the playback program. */
+		program_build,
+		/** Compilation of the PPU program. */
+		ppu_compile,
+		/** Encoding of a playback program chunk. */
+		encode,
+		/** Transfer of a playback program chunk to the hardware. */
+		transfer,
+		/** Wait for the execution of a playback program chunk on the hardware. */
+		wait,
+		/** Decoding of the responses of a playback program chunk. */
+		decode,
+		/** Post-processing of the results of an execution instance. */
+		post_process,
+		/** Merge of the results of an execution instance into the global results. */
+		merge
+	};
+
+	/**
+	 * Duration of a phase.
+	 */
+	struct Span
+	{
+		Phase phase{Phase::program_build};
+		/** Execution instance of the span, if applicable. */
+		std::optional<grenade::common::ExecutionInstanceOnExecutor> execution_instance;
+		/** Chip of the span, if applicable. */
+		std::optional<common::ChipOnConnection> chip;
+		/** Realtime snippet of the span, if applicable. */
+		std::optional<size_t> snippet;
+		/** Playback program chunk of the span, if applicable. */
+		std::optional<size_t> chunk;
+		/** Begin of the span relative to the begin of profiling. */
+		std::chrono::nanoseconds begin{0};
+		/** Duration of the span. */
+		std::chrono::nanoseconds duration{0};
+		/** Index of the thread on which the span was recorded. */
+		size_t thread{0};
+		/**
+		 * Whether only the duration of the span is measured and its begin is synthesized.
+		 * Synthesized spans are part of the summary, but not of the Chrome trace timeline.
+		 */
+		bool synthesized{false};
+
+		bool operator==(Span const& other) const SYMBOL_VISIBLE;
+		bool operator!=(Span const& other) const SYMBOL_VISIBLE;
+
+		GENPYBIND(stringstream)
+		friend std::ostream& operator<<(std::ostream& os, Span const& value) SYMBOL_VISIBLE;
+	};
+
+	/**
+	 * Durations of the phases aggregated over all spans.
+	 */
+	struct Summary
+	{
+		struct Entry
+		{
+			/** Number of spans. */
+			size_t count{0};
+			/** Accumulated duration of spans. */
+			std::chrono::nanoseconds total{0};
+			/** Minimal duration of a span. */
+			std::chrono::nanoseconds min{0};
+			/** Maximal duration of a span. */
+			std::chrono::nanoseconds max{0};
+
+			bool operator==(Entry const& other) const SYMBOL_VISIBLE;
+			bool operator!=(Entry const& other) const SYMBOL_VISIBLE;
+		};
+
+		/** Aggregated durations per phase with at least one span. */
+		std::map<Phase, Entry> phases;
+
+		bool operator==(Summary const& other) const SYMBOL_VISIBLE;
+		bool operator!=(Summary const& other) const SYMBOL_VISIBLE;
+
+		GENPYBIND(stringstream)
+		friend std::ostream& operator<<(std::ostream& os, Summary const& value) SYMBOL_VISIBLE;
+	};
+
+	/** Recorded spans ordered by their begin. */
+	std::vector<Span> spans;
+
+	/**
+	 * Aggregate the durations of the spans per phase.
+	 */
+	Summary get_summary() const SYMBOL_VISIBLE;
+
+	/**
+	 * Get profile in the Chrome trace-event JSON format.
+	 * Each span is a complete event on the thread it was recorded on, the execution instance,
+	 * chip, snippet and chunk are annotated as arguments.
+	 * Synthesized spans are omitted, since their placement on the timeline is not measured.
+	 * The result can be loaded into e.g. chrome://tracing or Perfetto.
+	 */
+	std::string to_chrome_trace() const SYMBOL_VISIBLE;
+
+	bool operator==(ExecutionProfile const& other) const SYMBOL_VISIBLE;
+	bool operator!=(ExecutionProfile const& other) const SYMBOL_VISIBLE;
+
+	GENPYBIND(stringstream)
+	friend std::ostream& operator<<(std::ostream& os, ExecutionProfile const& value)
+	    SYMBOL_VISIBLE;
+};
+
+std::ostream& operator<<(std::ostream& os, ExecutionProfile::Phase const& value) SYMBOL_VISIBLE;
+
+} // namespace execution
+} // namespace grenade::vx
@@ -10,5 +10,7 @@ GENPYBIND_MANUAL({
 })
 
 #include "grenade/vx/execution/execution_instance_hooks.h"
+#include "grenade/vx/execution/health_info_sampling.h"
 #include "grenade/vx/execution/jit_graph_executor.h"
+#include "grenade/vx/execution/profile.h"
 #include "grenade/vx/execution/run.h"
@@ -37,6 +37,8 @@ grenade::common::OutputData run(
 
 /**
  * Run the specified graphs with specified inputs on the supplied executor.
+ * If all graphs solely consist of transformations and no hooks are given, they are evaluated on
+ * the host without involving the executor's connections.
  * @param executor Executor to use
  * @param graphs Graphs to execute (one per snippet)
  * @param configs Maps of configurations (one per snippet)
@@ -0,0 +1,203 @@
+#pragma once
+#include "grenade/common/data.h"
+#include "grenade/common/input_data.h"
+#include "grenade/common/port_data.h"
+#include "grenade/common/port_on_topology.h"
+#include "grenade/vx/genpybind.h"
+#include "grenade/vx/signal_flow/event.h"
+#include "grenade/vx/signal_flow/types.h"
+#include "hate/visibility.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace grenade::vx::network {
+namespace abstract GENPYBIND_TAG_GRENADE_VX_NETWORK_ABSTRACT {
+
+/**
+ * Binary on-disk format of the port data of InputData and OutputData.
+ *
+ * A file consists of a fixed-size header, data columns and an index of all entries, which is
+ * located at the end of the file and referenced from the header.
+ * Spike, MADC and CADC recorder results as well as external source spike trains are stored as
+ * contiguous typed columns of event times and values together with an offset column, which
+ * delimits the events of each (outer, inner) pair, e.g. (batch entry, channel).
+ * Each column is aligned to 64 bytes and is memory-mapped on load.
+ * The events are required to be of homogeneous shape, i.e. the inner size is equal for all outer
+ * entries. Ragged data of these types is rejected and not stored via the cereal fallback, since
+ * their serialization is not registered.
+ * Other port data is stored as a polymorphic cereal archive, which requires its serialization to
+ * be registered, e.g. by linking grenade_vx_serialization.
+ * Time-domain runtimes of InputData are stored in the index, which supports
+ * ClockCycleTimeDomainRuntimes. Executor-specific results of OutputData are not archived.
+ */
+struct GENPYBIND(visible) SYMBOL_VISIBLE DataArchive
+{
+	/**
+	 * Type of stored port data.
+	 */
+	enum class Type : uint8_t
+	{
+		spike_recorder_results,
+		madc_recorder_results,
+		cadc_recorder_results,
+		external_source_dynamics,
+		cereal
+	};
+
+	typedef grenade::vx::common::Time::value_type TimeValue;
+	typedef signal_flow::MADCSampleFromChip::Value::value_type MADCValue;
+	typedef signal_flow::Int8::value_type CADCValue;
+
+	/**
+	 * View onto memory-mapped event columns of an entry.
+	 * The events of the pair (outer, inner) are located in [offsets[outer * inner_size + inner],
+	 * offsets[outer * inner_size + inner + 1]) of the times and values.
+	 * For recorder results, the outer dimension is the batch entry and the inner dimension the
+	 * channel, for external source spike trains the outer dimension is the neuron and the inner
+	 * dimension the batch entry.
+	 */
+	struct Events
+	{
+		size_t outer_size;
+		size_t inner_size;
+		std::span<uint64_t const> offsets;
+		std::span<TimeValue const> times;
+		/**
+		 * Sample values, only present for MADC recorder results.
+		 */
+		std::span<MADCValue const> madc_values;
+		/**
+		 * Sample values, only present for CADC recorder results.
+		 */
+		std::span<CADCValue const> cadc_values;
+	};
+};
+
+
+/**
+ * Streaming writer of a data archive.
+ * Port data is appended to the file on each write, the index is written on close.
+ */
+struct GENPYBIND(visible) SYMBOL_VISIBLE DataArchiveWriter
+{
+	/**
+	 * Create archive file.
+	 * @param path Path of file, an existing file is overwritten
+	 * @throws std::runtime_error On file not being writable
+	 */
+	DataArchiveWriter(std::string const& path);
+
+	DataArchiveWriter(DataArchiveWriter const&) = delete;
+	DataArchiveWriter& operator=(DataArchiveWriter const&) = delete;
+
+	/**
+	 * Close archive if not already closed.
+	 */
+	~DataArchiveWriter();
+
+	/**
+	 * Append port data.
+	 * @param port Port of data
+	 * @param data Data to append
+	 * @throws std::runtime_error On archive already containing data of port or being closed
+	 * @throws std::runtime_error On events not being of homogeneous shape, in which case the
+	 * archive is left unchanged
+	 */
+	void write(grenade::common::PortOnTopology const& port, grenade::common::PortData const& data);
+
+	/**
+	 * Append data of all ports and the time-domain runtimes of input data.
+	 * @param data Data to append
+	 * @throws std::runtime_error On time-domain runtimes not being ClockCycleTimeDomainRuntimes or
+	 * the archive already containing runtimes of a time domain, in which case no data is appended
+	 */
+	void write(grenade::common::InputData const& data);
+
+	/**
+	 * Append data of all ports.
+	 * @param data Data to append
+	 */
+	void write(grenade::common::Data const& data);
+
+	/**
+	 * Write index and close file.
+	 */
+	void close();
+
+private:
+	struct Impl;
+	std::unique_ptr<Impl> m_impl;
+};
+
+
+/**
+ * Reader of a data archive.
+ * The file is memory-mapped, event columns can be accessed without copying.
+ */
+struct GENPYBIND(visible) SYMBOL_VISIBLE DataArchiveReader
+{
+	/**
+	 * Open archive file.
+	 * @param path Path of file
+	 * @throws std::runtime_error On file not being readable or not being a valid archive
+	 */
+	DataArchiveReader(std::string const& path);
+
+	DataArchiveReader(DataArchiveReader const&) = delete;
+	DataArchiveReader& operator=(DataArchiveReader const&) = delete;
+
+	~DataArchiveReader();
+
+	/**
+	 * Get ports for which data is stored in the order of writing.
+	 */
+	std::vector<grenade::common::PortOnTopology> get_ports() const;
+
+	/**
+	 * Get type of data stored for port.
+	 * @param port Port to get type for
+	 * @throws std::out_of_range On no data being stored for port
+	 */
+	DataArchive::Type get_type(grenade::common::PortOnTopology const& port) const;
+
+	/**
+	 * Get view onto memory-mapped event columns of port.
+	 * The view is valid during the lifetime of the reader.
+	 * @param port Port to get events for
+	 * @throws std::out_of_range On no data being stored for port
+	 * @throws std::runtime_error On data of port not being stored as event columns
+	 */
+	DataArchive::Events get_events(grenade::common::PortOnTopology const& port) const
+	    GENPYBIND(hidden);
+
+	/**
+	 * Read port data.
+	 * @param port Port to read data for
+	 * @throws std::out_of_range On no data being stored for port
+	 */
+	std::unique_ptr<grenade::common::PortData> read(
+	    grenade::common::PortOnTopology const& port) const;
+
+	/**
+	 * Read data of all ports and the stored time-domain runtimes.
+	 * @param data Input data to add ports and time-domain runtimes to
+	 */
+	void read(grenade::common::InputData& data) const;
+
+	/**
+	 * Read data of all ports.
+	 * @param data Data to add ports to
+	 */
+	void read(grenade::common::Data& data) const;
+
+private:
+	struct Impl;
+	std::unique_ptr<Impl> m_impl;
+};
+
+} // namespace abstract
+} // namespace grenade::vx::network
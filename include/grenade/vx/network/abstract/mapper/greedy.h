@@ -5,6 +5,7 @@
 #include "grenade/vx/execution/jit_graph_executor.h"
 #include "grenade/vx/genpybind.h"
 #include "grenade/vx/network/abstract/mapper.h"
+#include "grenade/vx/network/abstract/mapper/persistent_cache.h"
 #include "grenade/vx/network/abstract/placement/greedy_placer.h"
 #include "grenade/vx/network/routing/greedy_router.h"
 #include "halco/hicann-dls/vx/v3/neuron.h"
@@ -58,11 +59,37 @@ struct GreedyMapperCallUnrollPyBind11Helper<std::variant<T, Ts...>>
  * - perform placement and add placed entities into hardware topology layer
  * - perform calibration and add its results into the linked topology
  * - perform routing and add routing entities into hardware topology layer
+ *
+ * The placement and routing results of the last invocation are cached and reused if the
+ * respective input topology only differs in properties the step does not depend on.
+ * Placement is reused if the partitioned topology only differs in parameter spaces of populations
+ * and projections. Routing is reused if additionally the placed hardware topology is unchanged and
+ * the synapse parameter spaces of projections require the same number of hardware synapse circuits.
+ * This makes remapping a topology, of which only parameters changed, skip placement, routing and
+ * connectum validation.
+ * Additionally, the complete mapped topology of the last invocation is reused, if the model
+ * topology only differs in synapse parameter spaces of projections, which require the same number
+ * of hardware synapse circuits, and the same calibration and executor objects are used. Then, only
+ * the weight split of the synapse parameter spaces onto the projections of the layers of the mapped
+ * topology is performed, while topology rewrites, placement, calibration and routing are skipped.
+ * Modifications of the calibration object in between invocations therefore require clear_cache().
+ * Optionally, placement and routing results are additionally cached on disk to share them between
+ * processes, see PersistentMappingCache.
  */
 struct GENPYBIND(visible) SYMBOL_VISIBLE GreedyMapper : public Mapper
 {
 	GreedyMapper();
 
+	/**
+	 * Copy configuration of mapper.
+	 * The cached placement and routing results are not copied, the copy starts with an empty
+	 * cache. The router and persistent cache are shared with the copied mapper.
+	 */
+	GreedyMapper(GreedyMapper const& other);
+	GreedyMapper& operator=(GreedyMapper const& other);
+
+	virtual ~GreedyMapper();
+
 	typedef std::vector<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> NeuronPermutation;
 	typedef std::vector<halco::hicann_dls::vx::v3::PADIBusOnPADIBusBlock>
 	    BackgroundSourcePermutation;
@@ -79,8 +106,103 @@ struct GENPYBIND(visible) SYMBOL_VISIBLE GreedyMapper : public Mapper
 	GENPYBIND(setter_for(background_source_permutation))
 	void set_background_source_permutation(BackgroundSourcePermutation value);
 
+	GENPYBIND(getter_for(placement_mode))
+	GreedyPlacer::Mode get_placement_mode() const;
+
+	GENPYBIND(setter_for(placement_mode))
+	void set_placement_mode(GreedyPlacer::Mode value);
+
 	void set_router(std::shared_ptr<routing::Router> router);
 
+	/**
+	 * Validation of the connectum of the found hardware network against the connectum expected
+	 * from the abstract network.
+	 */
+	struct GENPYBIND(visible) ConnectumValidation
+	{
+		enum class Mode
+		{
+			/**
+			 * Skip validation.
+			 */
+			disabled,
+			/**
+			 * Generate, sort and compare both full connectums.
+			 */
+			full,
+			/**
+			 * Compare digests of connectum fragments of equal source population and projection.
+			 * Full connectums are only generated for the mismatching fragments to report them.
+			 */
+			digest
+		};
+
+		Mode mode = Mode::digest;
+
+		/**
+		 * Fraction of source populations, whose outgoing connections are validated.
+		 * The selection is deterministic given the seed.
+		 * Setting a fraction smaller than one reduces the validation duration proportionally.
+		 */
+		double sampling_fraction = 1.;
+		size_t sampling_seed = 0;
+
+		/**
+		 * Get whether the outgoing connections of the given source population are validated.
+		 */
+		bool contains(grenade::common::VertexOnTopology const& source_population) const
+		    SYMBOL_VISIBLE;
+	};
+
+	GENPYBIND(getter_for(connectum_validation))
+	ConnectumValidation const& get_connectum_validation() const;
+
+	GENPYBIND(setter_for(connectum_validation))
+	void set_connectum_validation(ConnectumValidation value);
+
+	/**
+	 * Clear cached placement, routing and mapping results of previous invocations.
+	 * This does not alter the persistent cache.
+	 */
+	void clear_cache();
+
+	/**
+	 * Statistics of reuse of cached placement and routing results.
+	 */
+	struct GENPYBIND(visible) CacheStatistics
+	{
+		/**
+		 * Number of invocations, which reused the cached placement result.
+		 */
+		size_t num_reused_placements = 0;
+		/**
+		 * Number of invocations, which reused the cached routing result.
+		 */
+		size_t num_reused_routings = 0;
+		/**
+		 * Number of invocations, which reused the complete cached mapped topology.
+		 * These are also counted as reused placement and routing results.
+		 */
+		size_t num_reused_mappings = 0;
+	};
+
+	/**
+	 * Get statistics of reuse of cached results since construction or the last invocation of
+	 * clear_cache().
+	 */
+	CacheStatistics get_cache_statistics() const;
+
+	/**
+	 * Set persistent cache for placement and routing results shared between processes.
+	 * Results loaded from the persistent cache are validated by the connectum validation.
+	 * Routing results are only cached persistently when routing with a GreedyRouter, since the
+	 * options of other routers are unknown.
+	 * @param cache Cache to use, nullptr disables persistent caching
+	 */
+	void set_persistent_cache(std::shared_ptr<PersistentMappingCache> cache);
+
+	std::shared_ptr<PersistentMappingCache> get_persistent_cache() const;
+
 	virtual grenade::common::LinkedTopology GENPYBIND(hidden) operator()(
 	    std::shared_ptr<grenade::common::Topology const> topology,
 	    Calibration const& calibration,
@@ -108,7 +230,12 @@ struct GENPYBIND(visible) SYMBOL_VISIBLE GreedyMapper : public Mapper
 private:
 	GreedyPlacer m_placer;
 	std::shared_ptr<routing::Router> m_router;
+	ConnectumValidation m_connectum_validation;
 	log4cxx::LoggerPtr m_logger;
+	std::shared_ptr<PersistentMappingCache> m_persistent_cache;
+
+	struct Cache;
+	std::unique_ptr<Cache> m_cache;
 };
 
 
@@ -0,0 +1,101 @@
+#pragma once
+#include "grenade/vx/genpybind.h"
+#include "grenade/vx/network/abstract/placement_result.h"
+#include "grenade/vx/network/routing_result.h"
+#include "hate/visibility.h"
+#include <cstddef>
+#include <optional>
+#include <string>
+
+namespace log4cxx {
+class Logger;
+typedef std::shared_ptr<Logger> LoggerPtr;
+} // namespace log4cxx
+
+namespace grenade::vx::network {
+namespace abstract GENPYBIND_TAG_GRENADE_VX_NETWORK_ABSTRACT {
+
+/**
+ * On-disk cache of placement and routing results shared between processes.
+ * Entries are keyed by a serialized description of the input of the respective mapping step,
+ * which is required to fully determine its result, e.g. the serialized partitioned topology
+ * together with the placer configuration.
+ * Entries are stored in a single directory, one file per entry, named by a hash of the key.
+ * Writes are atomic by writing to a temporary file followed by a rename, so that concurrent
+ * processes never observe partially written entries.
+ * On load, the format version, the complete key digest and a hash of the payload are validated
+ * and invalid entries are removed.
+ * If the accumulated size of all entries exceeds the maximal size, least-recently used entries
+ * are evicted.
+ */
+struct GENPYBIND(
+    visible,
+    holder_type("std::shared_ptr<grenade::vx::network::abstract::PersistentMappingCache>"))
+    SYMBOL_VISIBLE PersistentMappingCache
+{
+	/**
+	 * Construct cache in directory.
+	 * The directory is created if it does not exist.
+	 * @param directory Directory to store entries in
+	 * @param max_size_in_bytes Maximal accumulated size of all entries
+	 */
+	PersistentMappingCache(
+	    std::string directory, size_t max_size_in_bytes = size_t(1) * 1024 * 1024 * 1024);
+
+	std::string const& get_directory() const;
+	size_t get_max_size_in_bytes() const;
+
+	/**
+	 * Load placement result stored for key.
+	 * @param key Key of entry
+	 * @return Placement result if a valid entry is present
+	 */
+	std::optional<PlacementResult> load_placement(std::string const& key) const;
+
+	/**
+	 * Store placement result for key.
+	 * @param key Key of entry
+	 * @param value Placement result to store
+	 */
+	void store_placement(std::string const& key, PlacementResult const& value) const;
+
+	/**
+	 * Load routing result stored for key.
+	 * @param key Key of entry
+	 * @return Routing result if a valid entry is present
+	 */
+	std::optional<RoutingResult> load_routing(std::string const& key) const;
+
+	/**
+	 * Store routing result for key.
+	 * @param key Key of entry
+	 * @param value Routing result to store
+	 */
+	void store_routing(std::string const& key, RoutingResult const& value) const;
+
+	/**
+	 * Remove all entries.
+	 */
+	void clear() const;
+
+	/**
+	 * Get accumulated size of all entries.
+	 */
+	size_t size_in_bytes() const;
+
+private:
+	std::string m_directory;
+	size_t m_max_size_in_bytes;
+	log4cxx::LoggerPtr m_logger;
+
+	template <typename T>
+	std::optional<T> load(std::string const& key, std::string const& extension) const;
+
+	template <typename T>
+	void store(std::string const& key, std::string const& extension, T const& value) const;
+
+	void evict() const;
+};
+
+} // namespace abstract
+} // namespace grenade::vx::network
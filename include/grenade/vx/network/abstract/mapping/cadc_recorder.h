@@ -2,6 +2,8 @@
 #include "grenade/common/inter_topology_hyper_edge.h"
 #include "grenade/vx/genpybind.h"
 #include "hate/visibility.h"
+#include <cstddef>
+#include <vector>
 
 namespace grenade::vx::network {
 namespace abstract GENPYBIND_TAG_GRENADE_VX_NETWORK_ABSTRACT {
@@ -12,7 +14,18 @@ namespace abstract GENPYBIND_TAG_GRENADE_VX_NETWORK_ABSTRACT {
 struct SYMBOL_VISIBLE GENPYBIND(visible) CADCRecorderMapping
     : public grenade::common::InterTopologyHyperEdge
 {
-	CADCRecorderMapping();
+	/**
+	 * Index of recorded neuron for each read-out column of each linked vertex.
+	 */
+	typedef std::vector<std::vector<size_t>> Slots;
+
+	CADCRecorderMapping(Slots slots);
+
+	/**
+	 * Assignment of read-out columns to recorded neurons, which is generated once from the
+	 * placement of the recorded neurons on construction of the mapping.
+	 */
+	Slots slots;
 
 	virtual bool valid(
 	    grenade::common::InterGraphHyperEdgeVertexDescriptors<
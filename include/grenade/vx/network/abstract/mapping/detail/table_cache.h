@@ -0,0 +1,87 @@
+#pragma once
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace grenade::vx::network::abstract::detail {
+
+/**
+ * Cache of a single table generated from a set of inputs.
+ * The table is stored together with the key it was generated for and reused as long as the key of
+ * a lookup compares equal.
+ * The key therefore has to contain the values of all inputs the table is generated from. It must
+ * not identify them by their address, since the address of a destroyed object can be reused by a
+ * different one.
+ * Copies and moves don't transfer the cached table, they start empty.
+ * Lookups are thread-safe.
+ * @tparam Key Equality-comparable description of the inputs of the table
+ * @tparam Table Type of table
+ */
+template <typename Key, typename Table>
+class TableCache
+{
+public:
+	TableCache() = default;
+
+	TableCache(TableCache const&) : TableCache() {}
+	TableCache(TableCache&&) : TableCache() {}
+
+	TableCache& operator=(TableCache const& other)
+	{
+		if (this != &other) {
+			reset();
+		}
+		return *this;
+	}
+
+	TableCache& operator=(TableCache&& other)
+	{
+		if (this != &other) {
+			reset();
+		}
+		return *this;
+	}
+
+	/**
+	 * Get table for given inputs.
+	 * If no table is cached or the cached table was generated for a different key, the table is
+	 * generated anew and replaces the cached one.
+	 * @param key Description of inputs of the table
+	 * @param generate Callable generating the table from the key
+	 */
+	template <typename Generate>
+	std::shared_ptr<Table const> get(Key key, Generate&& generate) const
+	{
+		std::lock_guard lock(m_mutex);
+		if (!m_entry || !(m_entry->first == key)) {
+			Table table = std::forward<Generate>(generate)(std::as_const(key));
+			m_entry =
+			    std::make_shared<std::pair<Key, Table> const>(std::move(key), std::move(table));
+		}
+		return std::shared_ptr<Table const>(m_entry, &m_entry->second);
+	}
+
+	/**
+	 * Get whether a table is cached.
+	 */
+	bool empty() const
+	{
+		std::lock_guard lock(m_mutex);
+		return !m_entry;
+	}
+
+	/**
+	 * Remove cached table.
+	 */
+	void reset()
+	{
+		std::lock_guard lock(m_mutex);
+		m_entry.reset();
+	}
+
+private:
+	mutable std::mutex m_mutex;
+	mutable std::shared_ptr<std::pair<Key, Table> const> m_entry;
+};
+
+} // namespace grenade::vx::network::abstract::detail
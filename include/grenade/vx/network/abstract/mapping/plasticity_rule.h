@@ -2,7 +2,7 @@
 #include "grenade/common/inter_topology_hyper_edge.h"
 #include "grenade/vx/genpybind.h"
 #include "hate/visibility.h"
-
+#include <memory>
 
 namespace grenade::vx::network {
 namespace abstract GENPYBIND_TAG_GRENADE_VX_NETWORK_ABSTRACT {
@@ -13,7 +13,21 @@ namespace abstract GENPYBIND_TAG_GRENADE_VX_NETWORK_ABSTRACT {
 struct SYMBOL_VISIBLE GENPYBIND(visible) PlasticityRuleMapping
     : public grenade::common::InterTopologyHyperEdge
 {
-	PlasticityRuleMapping();
+	/**
+	 * Construct mapping between the given hardware plasticity rule vertex and plasticity rule.
+	 * The translation of hardware recording locations to logical synapses and neurons is generated
+	 * once from the given topology and shared between copies of the mapping.
+	 * @param linked_vertex_descriptors Hardware plasticity rule vertex
+	 * @param reference_vertex_descriptors Plasticity rule vertex
+	 * @param topology Topology containing the hardware plasticity rule vertex with its in-edges and
+	 * the mappings of the recorded projections and populations
+	 */
+	PlasticityRuleMapping(
+	    grenade::common::InterGraphHyperEdgeVertexDescriptors<
+	        grenade::common::VertexOnTopology> const& linked_vertex_descriptors,
+	    grenade::common::InterGraphHyperEdgeVertexDescriptors<
+	        grenade::common::VertexOnTopology> const& reference_vertex_descriptors,
+	    grenade::common::LinkedTopology const& topology);
 
 	virtual bool valid(
 	    grenade::common::InterGraphHyperEdgeVertexDescriptors<
@@ -48,6 +62,14 @@ struct SYMBOL_VISIBLE GENPYBIND(visible) PlasticityRuleMapping
 protected:
 	virtual std::ostream& print(std::ostream& os) const override;
 	virtual bool is_equal_to(InterTopologyHyperEdge const& other) const override;
+
+private:
+	struct Table;
+
+	/**
+	 * Table of hardware recording locations for all logical synapses and neurons.
+	 */
+	std::shared_ptr<Table const> m_table;
 };
 
 } // namespace abstract
@@ -5,6 +5,7 @@
 #include "grenade/vx/network/abstract/multicompartment/mechanism_environment.h"
 #include "grenade/vx/network/abstract/multicompartment/mechanism_on_compartment.h"
 #include <map>
+#include <ostream>
 #include <set>
 
 namespace grenade::vx::network {
@@ -67,6 +68,17 @@ struct GENPYBIND(visible) SYMBOL_VISIBLE Environment
 	std::set<std::pair<grenade::common::CompartmentOnNeuron, grenade::common::CompartmentOnNeuron>>
 	get_recordable_pairs() const;
 
+	bool operator==(Environment const& other) const = default;
+	bool operator!=(Environment const& other) const = default;
+
+	/**
+	 * Hash of environment, which is equal for environments comparing equal.
+	 */
+	GENPYBIND(expose_as(__hash__))
+	size_t hash() const SYMBOL_VISIBLE;
+
+	GENPYBIND(stringstream)
+	friend std::ostream& operator<<(std::ostream& os, Environment const& value) SYMBOL_VISIBLE;
 
 private:
 	std::map<
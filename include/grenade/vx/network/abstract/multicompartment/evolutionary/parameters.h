@@ -21,6 +21,8 @@ struct SYMBOL_VISIBLE GENPYBIND(visible) EvolutionaryParameters
 
 	// Number of runs which are executed in parallel.
 	size_t parallel_threads = 1;
+	// Whether fitness values are memoized, which doesn't alter the result
+	bool memoize_fitness = true;
 
 	// Population size
 	size_t population_size;
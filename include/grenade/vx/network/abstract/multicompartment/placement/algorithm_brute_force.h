@@ -4,7 +4,6 @@
 #include "hate/timer.h"
 #include <atomic>
 #include <fstream>
-#include <future>
 #include <iostream>
 #include <math.h>
 
@@ -16,6 +15,19 @@ typedef std::shared_ptr<Logger> LoggerPtr;
 namespace grenade::vx::network {
 namespace abstract GENPYBIND_TAG_GRENADE_VX_NETWORK_ABSTRACT {
 
+/**
+ * Exhaustive placement of multicompartment neurons.
+ * Switch configurations are enumerated as a branch-and-bound search over the neuron circuits
+ * column by column with increasing width of the placement. Subtrees are explored as tasks on a
+ * TBB task group, which balances unevenly sized subtrees via work stealing. Partial
+ * configurations are pruned as soon as a completed column contains an invalid connection.
+ * Configurations which only differ by swapping the two rows or by an empty offset to the left
+ * are enumerated once. Of all valid configurations of the smallest width, the first in
+ * enumeration order is selected, which makes the result independent of the scheduling of tasks and
+ * the number of threads. The best configuration found so far is shared between all tasks to prune
+ * subtrees which can not yield a result preceding it. If the timeout is reached during the search,
+ * no result is returned, since configurations preceding the ones found might not have been checked.
+ */
 struct GENPYBIND(visible) SYMBOL_VISIBLE PlacementAlgorithmBruteForce : public PlacementAlgorithm
 {
 	PlacementAlgorithmBruteForce();
@@ -41,38 +53,25 @@ struct GENPYBIND(visible) SYMBOL_VISIBLE PlacementAlgorithmBruteForce : public P
 	void reset();
 
 	// Parameters for run
-	// Number of configurations checked in parallel.
+	// Maximal number of threads used for the search, 0 for a single-threaded search.
 	size_t parallel_runs = 0;
 	// Highest iterated neuron circuits x coordinate.
 	size_t x_limit = 10;
 
 private:
-	AlgorithmResult run_parallel(
-	    Neuron const& neuron,
-	    ResourceManager const& resources,
-	    size_t parallel,
-	    size_t x_max,
-	    size_t index_min);
-
-	void run_partial(
-	    Neuron const& neuron,
-	    ResourceManager const& resources,
-	    size_t result_index,
-	    size_t loop_limit);
-
 	/**
-	 * Validates if Placement in coordinate_system matches target neuron
-	 * @param result_index Current configuration coordinate system with placed neuron in m_results
+	 * Validates if Placement in coordinate_system matches target neuron.
+	 * On success, the compartments of the target neuron are assigned to the coordinate system.
+	 * @param result Configuration of coordinate system with placed neuron
 	 * @param x_max Upper limit to which coordinate system is checked for validity
 	 * @param neuron Target neuron
 	 * @param resources Required resources for neuron-placement
 	 */
 	bool GENPYBIND(hidden) valid(
-	    size_t result_index, size_t x_max, Neuron const& neuron, ResourceManager const& resources);
-
-
-	std::vector<AlgorithmResult> m_results;
-	std::vector<AlgorithmResult> m_results_temp;
+	    AlgorithmResult& result,
+	    size_t x_max,
+	    Neuron const& neuron,
+	    ResourceManager const& resources) const;
 
 	// Termination variable for parallelisation
 	std::atomic<bool> m_termintate_parallel;
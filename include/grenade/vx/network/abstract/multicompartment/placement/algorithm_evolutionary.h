@@ -10,7 +10,7 @@
 #include <array>
 #include <atomic>
 #include <fstream>
-#include <future>
+#include <memory>
 #include <random>
 
 namespace log4cxx {
@@ -23,6 +23,15 @@ typedef std::shared_ptr<Logger> LoggerPtr;
 namespace grenade::vx::network {
 namespace abstract GENPYBIND_TAG_GRENADE_VX_NETWORK_ABSTRACT {
 
+/**
+ * Evolutionary placement of multicompartment neurons.
+ * The fitness of the individuals of a generation is evaluated in parallel on a persistent task
+ * arena with `parallel_threads` workers. Fitness values are memoized by the canonical switch
+ * configuration of the coordinate system an individual represents, so duplicates and mutations
+ * without effect on the coordinate system are not evaluated again. The subgraph-isomorphism term
+ * is additionally memoized by the structure of the constructed neuron, since most mutations leave
+ * the compartment graph unchanged. Memoization can be disabled via the run parameters.
+ */
 struct GENPYBIND(visible) SYMBOL_VISIBLE PlacementAlgorithmEvolutionary : public PlacementAlgorithm
 {
 	// Runs Algorithm
@@ -35,6 +44,15 @@ struct GENPYBIND(visible) SYMBOL_VISIBLE PlacementAlgorithmEvolutionary : public
 
 	PlacementAlgorithmEvolutionary(EvolutionaryParameters run_parameters);
 
+	/**
+	 * Copy algorithm including its state.
+	 * The task arena and memoized fitness values are not copied but created anew.
+	 */
+	PlacementAlgorithmEvolutionary(PlacementAlgorithmEvolutionary const& other);
+	PlacementAlgorithmEvolutionary& operator=(PlacementAlgorithmEvolutionary const& other);
+
+	virtual ~PlacementAlgorithmEvolutionary();
+
 	/**
 	 * Clone the algorithm. Only clones the initial configuration not the current state of the
 	 * algorithm. New algorithm is in state as after reset(). Since PlacementAlgorithm is the
@@ -163,6 +181,9 @@ private:
 	std::vector<NeuronPlacementResult> m_placement_results;
 
 	log4cxx::LoggerPtr m_logger;
+
+	struct Impl;
+	std::unique_ptr<Impl> m_impl;
 };
 } // namepsace abstract
 } // namespace grenade::vx::network
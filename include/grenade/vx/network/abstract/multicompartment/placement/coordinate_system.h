@@ -1,9 +1,13 @@
 #pragma once
 
 #include "grenade/common/compartment_on_neuron.h"
+#include "grenade/vx/network/abstract/mapping/detail/table_cache.h"
 #include "grenade/vx/network/abstract/multicompartment/neuron.h"
 #include "grenade/vx/network/abstract/multicompartment/neuron_circuit.h"
+#include "grenade/vx/network/abstract/multicompartment/placement/coordinate_system_bitboard.h"
 #include <array>
+#include <cstddef>
+#include <memory>
 #include <tuple>
 #if defined(__GENPYBIND__) or defined(__GENPYBIND_GENERATED__)
 #include <pybind11/stl.h>
@@ -15,6 +19,11 @@ namespace abstract GENPYBIND_TAG_GRENADE_VX_NETWORK_ABSTRACT {
 /**
  * A 2d-grid representing the neuron circuits on the BSS-2-chip. Connections between neuron circuits
  * can be formed. Used in the placement algorithms for multicompartment neurons.
+ *
+ * Queries over the whole grid are evaluated on a bitboard representation of the switches, which is
+ * cached until the switches are modified. Modifications therefore have to be performed via the
+ * member functions or operator[], references obtained from the latter must not be used to modify
+ * switches after a subsequent query.
  */
 struct SYMBOL_VISIBLE GENPYBIND(visible) CoordinateSystem
 {
@@ -271,9 +280,34 @@ struct SYMBOL_VISIBLE GENPYBIND(visible) CoordinateSystem
 	bool operator==(CoordinateSystem const& other) const;
 	bool operator!=(CoordinateSystem const& other) const;
 
+	/**
+	 * Access row of neuron circuits for modification.
+	 * Invalidates the cached bitboard representation.
+	 * @param y Row coordinate
+	 */
 	std::array<NeuronCircuit, 256>& operator[](size_t y);
 
+	/**
+	 * Neuron circuits of the grid.
+	 * Modifications of switches have to be performed via operator[] or the member functions, since
+	 * direct modification is not tracked by the cached bitboard representation.
+	 */
 	std::array<std::array<NeuronCircuit, 256>, 2> coordinate_system;
+
+private:
+	/**
+	 * Get bitboard representation of the current switch configuration.
+	 * The representation is generated on first use after a modification and reused afterwards.
+	 */
+	std::shared_ptr<CoordinateSystemBitboard const> get_bitboard() const;
+
+	/**
+	 * Invalidate cached bitboard representation.
+	 */
+	void invalidate_bitboard();
+
+	size_t m_generation = 0;
+	detail::TableCache<size_t, CoordinateSystemBitboard> m_bitboard;
 };
 
 } // namespace abstract
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "grenade/vx/genpybind.h"
+#include "hate/visibility.h"
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <vector>
+
+namespace grenade::vx::network {
+namespace abstract GENPYBIND_TAG_GRENADE_VX_NETWORK_ABSTRACT {
+
+struct CoordinateSystem;
+
+/**
+ * Bit-parallel representation of the switch configuration of a coordinate system.
+ * Each switch type is stored as a bitboard over all 2x256 neuron circuits, with bit x of row y
+ * representing the neuron circuit at (x, y). Horizontal links between columns x and x + 1 are
+ * stored at bit x.
+ * Queries over the whole coordinate system are evaluated with word-level operations, flood fills
+ * along horizontal links use logarithmic-step prefix propagation.
+ */
+struct SYMBOL_VISIBLE CoordinateSystemBitboard
+{
+	typedef std::bitset<256> Row;
+	typedef std::array<Row, 2> Board;
+
+	/**
+	 * Construct bitboard from switch configuration of coordinate system.
+	 * @param coordinate_system Coordinate system to represent.
+	 */
+	explicit CoordinateSystemBitboard(CoordinateSystem const& coordinate_system);
+
+	/**
+	 * Neuron circuits which are connected in any way, see CoordinateSystem::connected.
+	 */
+	Board connected() const;
+
+	/**
+	 * Check for connections with open ends, see CoordinateSystem::has_empty_connections.
+	 * @param x_max Upper limit to check.
+	 */
+	bool has_empty_connections(size_t x_max) const;
+
+	/**
+	 * Check for connections both directly and via shared line, see
+	 * CoordinateSystem::has_double_connections.
+	 * @param x_max Upper limit to check.
+	 */
+	bool has_double_connections(size_t x_max) const;
+
+	/**
+	 * Check for neuron circuits connected via conductance and directly to the shared line, see
+	 * CoordinateSystem::double_switch.
+	 * @param x_max Upper limit to check.
+	 */
+	bool double_switch(size_t x_max) const;
+
+	/**
+	 * Get connected components of neuron circuits which are connected directly.
+	 * Components are ordered by their first neuron circuit, iterating rows first and columns
+	 * second, which matches the order of CoordinateSystem::assign_compartments.
+	 * @param via_shared_line Whether neuron circuits directly connected to the same shared line
+	 * segment are connected.
+	 */
+	std::vector<Board> components(bool via_shared_line) const;
+
+	/**
+	 * Neuron circuits reachable from the seeds by moving along set links in one row.
+	 * @param seeds Starting neuron circuits, which are included in the result.
+	 * @param links Links between neighbouring neuron circuits at the left one's position.
+	 * @param right Whether to move to the right or to the left.
+	 */
+	static Row fill(Row const& seeds, Row const& links, bool right);
+
+	Board switch_shared_right;
+	Board switch_right;
+	Board switch_top_bottom;
+	Board switch_circuit_shared;
+	Board switch_circuit_shared_conductance;
+
+private:
+	/**
+	 * Neuron circuits connected to neighbours in the same row via conductance.
+	 */
+	Row connected_right_shared(size_t y) const;
+
+	/**
+	 * Neuron circuits on a shared line segment with at least one other neuron circuit which is
+	 * set in the given mask.
+	 */
+	Row on_segment_with(size_t y, Row const& mask) const;
+};
+
+} // namespace abstract
+} // namespace grenade::vx::network
@@ -17,6 +17,8 @@ namespace abstract GENPYBIND_TAG_GRENADE_VX_NETWORK_ABSTRACT {
  * Greedy placement algorithm.
  * Neurons on populations are placed in order of iteration in the topology.
  * The placer uses the permutation sequences to decide where to place a neuron sequentially.
+ * Optionally, the connectivity of the topology is considered to choose the neuron circuits, see
+ * Mode.
  */
 struct SYMBOL_VISIBLE GENPYBIND(visible) GreedyPlacer : public Placer
 {
@@ -38,6 +40,35 @@ struct SYMBOL_VISIBLE GENPYBIND(visible) GreedyPlacer : public Placer
 	GENPYBIND(setter_for(background_source_permutation))
 	void set_background_source_permutation(BackgroundSourcePermutation value);
 
+	/**
+	 * Mode of choosing the neuron circuits for a neuron.
+	 */
+	enum class Mode
+	{
+		/**
+		 * Place each neuron at the first available anchor in order of the neuron permutation.
+		 */
+		permutation,
+		/**
+		 * Place each neuron at the first available anchor in order of the neuron permutation,
+		 * whose PADI-bus minimizes the estimated number of required synapse rows.
+		 * The estimate uses the average connection density between populations on the same
+		 * execution instance and places the events of a source neuron on the PADI-bus given by
+		 * its neuron event output and the hemisphere of each target neuron. The number of
+		 * synapse rows of a PADI-bus is the largest accumulated in-degree of any target neuron
+		 * via this PADI-bus, as checked by the routing constraints. Distributing the sources of
+		 * a target population across the PADI-busses reduces the synapse driver pressure and
+		 * therefore increases the probability of routing success.
+		 */
+		connectivity_aware
+	};
+
+	GENPYBIND(getter_for(mode))
+	Mode get_mode() const;
+
+	GENPYBIND(setter_for(mode))
+	void set_mode(Mode value);
+
 	/**
 	 * Place given topology.
 	 * @param topology Topology to place for
@@ -49,6 +80,7 @@ struct SYMBOL_VISIBLE GENPYBIND(visible) GreedyPlacer : public Placer
 private:
 	NeuronPermutation m_neuron_permutation;
 	BackgroundSourcePermutation m_background_source_permutation;
+	Mode m_mode;
 	log4cxx::LoggerPtr m_logger;
 };
 
@@ -23,6 +23,7 @@ GENPYBIND_MANUAL({
 #include "grenade/vx/network/abstract/executor_global.h"
 #include "grenade/vx/network/abstract/mapper.h"
 #include "grenade/vx/network/abstract/mapper/greedy.h"
+#include "grenade/vx/network/abstract/mapper/persistent_cache.h"
 #include "grenade/vx/network/abstract/mapping/cadc_recorder.h"
 #include "grenade/vx/network/abstract/mapping/calibrated_neuron.h"
 #include "grenade/vx/network/abstract/mapping/chip.h"
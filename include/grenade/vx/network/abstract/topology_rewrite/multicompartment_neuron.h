@@ -16,6 +16,10 @@ namespace grenade::vx::network::abstract {
 
 /**
  * Rewrite for multi-compartment neuron to CalibratedNeuron.
+ * Populations with structurally identical neuron model, parameter space and environment share a
+ * single local placement and mechanism assignment. Placement of distinct neuron models is
+ * performed in parallel on copies of the placement algorithm.
+ * Deduplication doesn't alter the result and can be disabled.
  */
 struct SYMBOL_VISIBLE MulticompartmentNeuronRewrite : public grenade::common::TopologyRewrite
 {
@@ -23,15 +27,18 @@ struct SYMBOL_VISIBLE MulticompartmentNeuronRewrite : public grenade::common::To
 	 * Construct topology rewrite operation targeting given topology.
 	 * @param topology Linked topology
 	 * @param placement_algorithm Placement algorithm to use
+	 * @param deduplicate_models Whether to place identical neuron models only once
 	 */
 	MulticompartmentNeuronRewrite(
 	    std::shared_ptr<grenade::common::LinkedTopology> topology,
-	    std::unique_ptr<PlacementAlgorithm> placement_algorithm);
+	    std::unique_ptr<PlacementAlgorithm> placement_algorithm,
+	    bool deduplicate_models = true);
 
 	virtual void operator()() const override;
 
 private:
 	std::unique_ptr<PlacementAlgorithm> m_placement_algorithm;
+	bool m_deduplicate_models;
 
 	/**
 	 * Check that no interval of parameters contains more than one point (min == max).
@@ -1,6 +1,9 @@
 #pragma once
+#include "grenade/common/edge_on_topology.h"
 #include "grenade/common/topology_rewrite.h"
+#include "grenade/common/vertex_on_topology.h"
 #include "hate/visibility.h"
+#include <vector>
 
 namespace grenade::vx::network::abstract {
 
@@ -8,6 +11,8 @@ namespace grenade::vx::network::abstract {
  * Rewrite of execution instance transitions of populations.
  * It replaces the transition by a SpikeRecorder on the source execution instance and a population
  * with ExternalSourceNeuron on the target execution instance.
+ * Out-edges crossing execution instances are indexed in a single pass by source execution
+ * instance, target execution instance and population before the transitions are added.
  */
 struct SYMBOL_VISIBLE PopulationExecutionInstanceTransitionRewrite
     : public grenade::common::TopologyRewrite
@@ -20,6 +25,26 @@ struct SYMBOL_VISIBLE PopulationExecutionInstanceTransitionRewrite
 	    std::shared_ptr<grenade::common::LinkedTopology> topology);
 
 	virtual void operator()() const override;
+
+private:
+	/**
+	 * Add copy of external source population on target execution instance.
+	 * @param vertex_descriptor External source population
+	 * @param out_edges Out-edges of population to target execution instance
+	 */
+	void add_external_source_transition(
+	    grenade::common::VertexOnTopology const& vertex_descriptor,
+	    std::vector<grenade::common::EdgeOnTopology> const& out_edges) const;
+
+	/**
+	 * Add spike recorder and external source population for out-edges of population to target
+	 * execution instance.
+	 * @param vertex_descriptor Population
+	 * @param out_edges Out-edges of population to target execution instance
+	 */
+	void add_population_transition(
+	    grenade::common::VertexOnTopology const& vertex_descriptor,
+	    std::vector<grenade::common::EdgeOnTopology> const& out_edges) const;
 };
 
 } // namespace grenade::vx::network::abstract
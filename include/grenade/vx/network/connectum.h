@@ -7,8 +7,11 @@
 #include "halco/hicann-dls/vx/v3/synapse.h"
 #include "haldls/vx/v3/event.h"
 #include "hate/visibility.h"
+#include <cstdint>
+#include <functional>
 #include <iosfwd>
 #include <map>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -39,9 +42,100 @@ struct ConnectumConnection
 };
 
 
+/**
+ * Order-independent digest of a connectum.
+ * The connections are split into fragments of equal source population and projection. For each
+ * fragment, the number of connections and the wrapping sum of the hashes of its connections is
+ * stored. This allows comparing connectums as multisets without storing or sorting them.
+ */
+struct ConnectumDigest
+{
+	/**
+	 * Source population and projection of the connections of a fragment.
+	 */
+	typedef std::pair<grenade::common::VertexOnTopology, grenade::common::VertexOnTopology>
+	    FragmentOnConnectum;
+
+	struct Fragment
+	{
+		size_t size = 0;
+		uint64_t hash_sum = 0;
+
+		bool operator==(Fragment const& other) const SYMBOL_VISIBLE;
+		bool operator!=(Fragment const& other) const SYMBOL_VISIBLE;
+	};
+
+	std::map<FragmentOnConnectum, Fragment> fragments;
+
+	/**
+	 * Add connection to digest.
+	 */
+	void insert(ConnectumConnection const& connection) SYMBOL_VISIBLE;
+
+	/**
+	 * Add all connections of other digest to digest.
+	 */
+	void merge(ConnectumDigest const& other) SYMBOL_VISIBLE;
+
+	/**
+	 * Get number of connections in digest.
+	 */
+	size_t size() const SYMBOL_VISIBLE;
+
+	/**
+	 * Get fragments, which differ between this and the other digest.
+	 */
+	std::vector<FragmentOnConnectum> get_mismatching_fragments(ConnectumDigest const& other) const
+	    SYMBOL_VISIBLE;
+
+	bool operator==(ConnectumDigest const& other) const SYMBOL_VISIBLE;
+	bool operator!=(ConnectumDigest const& other) const SYMBOL_VISIBLE;
+};
+
+
+/**
+ * Filter on source populations of connections to generate.
+ * An empty filter includes all source populations.
+ */
+typedef std::function<bool(grenade::common::VertexOnTopology const&)> ConnectumSourceFilter;
+
+/**
+ * Generate connectum expected from abstract network.
+ * Execution instances are processed in parallel.
+ * @param topology Mapped topology
+ * @param source_filter Filter on source populations of connections to generate
+ */
 std::vector<ConnectumConnection> generate_connectum_from_abstract_network(
-    grenade::common::LinkedTopology const& topology) SYMBOL_VISIBLE;
+    grenade::common::LinkedTopology const& topology,
+    ConnectumSourceFilter const& source_filter = {}) SYMBOL_VISIBLE;
+
+/**
+ * Generate connectum realized by hardware network.
+ * Execution instances are processed in parallel and source populations not included in the
+ * filter are skipped altogether.
+ * @param topology Mapped topology
+ * @param source_filter Filter on source populations of connections to generate
+ */
 std::vector<ConnectumConnection> generate_connectum_from_hardware_network(
-    grenade::common::LinkedTopology const& topology) SYMBOL_VISIBLE;
+    grenade::common::LinkedTopology const& topology,
+    ConnectumSourceFilter const& source_filter = {}) SYMBOL_VISIBLE;
+
+/**
+ * Generate digest of connectum expected from abstract network without storing the connectum.
+ * @param topology Mapped topology
+ * @param source_filter Filter on source populations of connections to generate
+ */
+ConnectumDigest generate_connectum_digest_from_abstract_network(
+    grenade::common::LinkedTopology const& topology,
+    ConnectumSourceFilter const& source_filter = {}) SYMBOL_VISIBLE;
+
+/**
+ * Generate digest of connectum realized by hardware network without storing the connectum.
+ * @param topology Mapped topology
+ * @param source_filter Filter on source populations of connections to generate
+ */
+ConnectumDigest generate_connectum_digest_from_hardware_network(
+    grenade::common::LinkedTopology const& topology,
+    ConnectumSourceFilter const& source_filter = {}) SYMBOL_VISIBLE;
 
 } // namespace grenade::vx::network
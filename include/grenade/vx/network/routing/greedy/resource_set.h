@@ -0,0 +1,223 @@
+#pragma once
+#include "halco/common/geometry.h"
+#include <bitset>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+
+namespace grenade::vx::network::routing::greedy {
+
+/**
+ * Dense set of hardware resources identified by a halco coordinate.
+ * The set is stored as a bitset indexed by the enum value of the coordinate, which is suitable for
+ * the small and fixed resource spaces of the chip, e.g. neurons, PADI-busses or neuron event
+ * outputs. Iteration yields the contained coordinates in ascending order, equal to the order of a
+ * std::set of the same coordinates.
+ * @tparam Coordinate Halco coordinate with enum representation
+ */
+template <typename Coordinate>
+struct ResourceSet
+{
+	typedef Coordinate value_type;
+
+	struct const_iterator
+	{
+		typedef std::forward_iterator_tag iterator_category;
+		typedef Coordinate value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef Coordinate const* pointer;
+		typedef Coordinate reference;
+
+		const_iterator() = default;
+
+		Coordinate operator*() const
+		{
+			return Coordinate(halco::common::Enum(m_index));
+		}
+
+		const_iterator& operator++()
+		{
+			m_index = m_set->next(m_index + 1);
+			return *this;
+		}
+
+		const_iterator operator++(int)
+		{
+			auto ret = *this;
+			++(*this);
+			return ret;
+		}
+
+		bool operator==(const_iterator const& other) const
+		{
+			return m_index == other.m_index;
+		}
+
+		bool operator!=(const_iterator const& other) const
+		{
+			return !(*this == other);
+		}
+
+	private:
+		friend struct ResourceSet;
+
+		const_iterator(ResourceSet const* set, size_t index) : m_set(set), m_index(index) {}
+
+		ResourceSet const* m_set = nullptr;
+		size_t m_index = Coordinate::size;
+	};
+
+	typedef const_iterator iterator;
+
+	ResourceSet() = default;
+
+	ResourceSet(std::initializer_list<Coordinate> values)
+	{
+		for (auto const& value : values) {
+			insert(value);
+		}
+	}
+
+	template <typename InputIt>
+	ResourceSet(InputIt first, InputIt last)
+	{
+		insert(first, last);
+	}
+
+	/**
+	 * Set containing all resources.
+	 */
+	static ResourceSet all()
+	{
+		ResourceSet ret;
+		ret.m_bits.set();
+		return ret;
+	}
+
+	void insert(Coordinate const& value)
+	{
+		m_bits.set(value.toEnum());
+	}
+
+	template <typename InputIt>
+	void insert(InputIt first, InputIt last)
+	{
+		for (; first != last; ++first) {
+			insert(*first);
+		}
+	}
+
+	void erase(Coordinate const& value)
+	{
+		m_bits.reset(value.toEnum());
+	}
+
+	bool contains(Coordinate const& value) const
+	{
+		return m_bits.test(value.toEnum());
+	}
+
+	size_t size() const
+	{
+		return m_bits.count();
+	}
+
+	bool empty() const
+	{
+		return m_bits.none();
+	}
+
+	void clear()
+	{
+		m_bits.reset();
+	}
+
+	const_iterator begin() const
+	{
+		return const_iterator(this, next(0));
+	}
+
+	const_iterator end() const
+	{
+		return const_iterator(this, Coordinate::size);
+	}
+
+	/**
+	 * Whether all resources of the other set are contained in this set.
+	 */
+	bool includes(ResourceSet const& other) const
+	{
+		return (other.m_bits & ~m_bits).none();
+	}
+
+	/**
+	 * Whether this and the other set share at least one resource.
+	 */
+	bool intersects(ResourceSet const& other) const
+	{
+		return (m_bits & other.m_bits).any();
+	}
+
+	ResourceSet& operator|=(ResourceSet const& other)
+	{
+		m_bits |= other.m_bits;
+		return *this;
+	}
+
+	ResourceSet& operator&=(ResourceSet const& other)
+	{
+		m_bits &= other.m_bits;
+		return *this;
+	}
+
+	/**
+	 * Remove all resources contained in the other set.
+	 */
+	ResourceSet& operator-=(ResourceSet const& other)
+	{
+		m_bits &= ~other.m_bits;
+		return *this;
+	}
+
+	friend ResourceSet operator|(ResourceSet lhs, ResourceSet const& rhs)
+	{
+		return lhs |= rhs;
+	}
+
+	friend ResourceSet operator&(ResourceSet lhs, ResourceSet const& rhs)
+	{
+		return lhs &= rhs;
+	}
+
+	friend ResourceSet operator-(ResourceSet lhs, ResourceSet const& rhs)
+	{
+		return lhs -= rhs;
+	}
+
+	bool operator==(ResourceSet const& other) const
+	{
+		return m_bits == other.m_bits;
+	}
+
+	bool operator!=(ResourceSet const& other) const
+	{
+		return !(*this == other);
+	}
+
+private:
+	/**
+	 * Get index of first contained resource starting at given index or Coordinate::size if none
+	 * is contained.
+	 */
+	size_t next(size_t index) const
+	{
+		while (index < Coordinate::size && !m_bits.test(index)) {
+			++index;
+		}
+		return index;
+	}
+
+	std::bitset<Coordinate::size> m_bits;
+};
+
+} // namespace grenade::vx::network::routing::greedy
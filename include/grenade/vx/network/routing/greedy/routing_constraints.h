@@ -3,6 +3,7 @@
 #include "grenade/common/vertex_on_topology.h"
 #include "grenade/vx/network/connection_routing_result.h"
 #include "grenade/vx/network/receptor.h"
+#include "grenade/vx/network/routing/greedy/resource_set.h"
 #include "halco/common/typed_array.h"
 #include "halco/hicann-dls/vx/v3/background.h"
 #include "halco/hicann-dls/vx/v3/chip.h"
@@ -203,8 +204,8 @@ struct RoutingConstraints
 	/**
 	 * Get neurons which are neither recorded nor serve as source of (a) connection(s).
 	 */
-	std::set<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> get_neither_recorded_nor_source_neurons()
-	    const SYMBOL_VISIBLE;
+	ResourceSet<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS>
+	get_neither_recorded_nor_source_neurons() const SYMBOL_VISIBLE;
 
 	/**
 	 * Get on-chip neurons forwarding their events per neuron event output.
@@ -218,18 +219,18 @@ struct RoutingConstraints
 	 * Get on-chip neurons forwarding their events onto each PADI-bus.
 	 * This function assumes the crossbar to forward all events at every node.
 	 */
-	std::map<
-	    halco::hicann_dls::vx::v3::PADIBusOnDLS,
-	    std::set<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS>>
+	halco::common::typed_array<
+	    ResourceSet<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS>,
+	    halco::hicann_dls::vx::v3::PADIBusOnDLS>
 	get_neurons_on_padi_bus() const SYMBOL_VISIBLE;
 
 	/**
 	 * Get neuron event outputs projecting onto each PADI-bus.
 	 * This function assumes the crossbar to forward all events at every node.
 	 */
-	std::map<
-	    halco::hicann_dls::vx::v3::PADIBusOnDLS,
-	    std::set<halco::hicann_dls::vx::v3::NeuronEventOutputOnDLS>>
+	halco::common::typed_array<
+	    ResourceSet<halco::hicann_dls::vx::v3::NeuronEventOutputOnDLS>,
+	    halco::hicann_dls::vx::v3::PADIBusOnDLS>
 	get_neuron_event_outputs_on_padi_bus() const SYMBOL_VISIBLE;
 
 	/**
@@ -251,13 +252,13 @@ struct RoutingConstraints
 		/**
 		 * Neuron sources.
 		 */
-		std::set<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> neuron_sources;
+		ResourceSet<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> neuron_sources;
 
 		/**
 		 * Neuron circuits, which don't serve as source for any other target neuron but are still
 		 * recorded and therefore elicit spike events.
 		 */
-		std::set<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> only_recorded_neurons;
+		ResourceSet<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> only_recorded_neurons;
 
 		/**
 		 * Internal connections.
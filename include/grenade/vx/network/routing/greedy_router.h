@@ -76,6 +76,11 @@ struct SYMBOL_VISIBLE GENPYBIND(
 
 	virtual ~GreedyRouter();
 
+	/**
+	 * Get options of the routing algorithm.
+	 */
+	Options const& get_options() const;
+
 	virtual RoutingResult operator()(grenade::common::LinkedTopology const& topology) override;
 
 private:
@@ -0,0 +1,22 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace grenade::vx::ppu::detail {
+
+/**
+ * Region of PPU-internal memory copied into the snapshot buffer on Status::snapshot.
+ * Address and size are given in bytes and are aligned to words.
+ */
+struct SnapshotRegion
+{
+	uint32_t address;
+	uint32_t size;
+};
+
+/**
+ * Maximal number of regions copied on Status::snapshot.
+ */
+constexpr size_t max_num_snapshot_regions = 32;
+
+} // namespace grenade::vx::ppu::detail
@@ -18,7 +18,8 @@ enum class Status : uint32_t
 	inside_periodic_read,
 	stop_periodic_read,
 	stop,
-	scheduler
+	scheduler,
+	snapshot
 };
 
 #ifndef __ppu__
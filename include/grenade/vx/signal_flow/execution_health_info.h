@@ -9,6 +9,7 @@
 #include "haldls/vx/v3/phy.h"
 #include "haldls/vx/v3/routing_crossbar.h"
 #include "hate/visibility.h"
+#include <cstddef>
 #include <iosfwd>
 #include <map>
 
@@ -60,13 +61,25 @@ struct GENPYBIND(visible) ExecutionHealthInfo
 
 		std::map<common::ChipOnConnection, Chip> chips;
 
+		/**
+		 * Number of playback program chunks covered by the counter values.
+		 * Chunks, which are not sampled, don't contribute to the counter values.
+		 */
+		size_t num_sampled_chunks{0};
+
+		/**
+		 * Total number of playback program chunks of the execution.
+		 */
+		size_t num_chunks{0};
+
 		/**
 		 * Calculates difference of counter values, expects rhs > lhs.
+		 * The numbers of chunks are left unchanged.
 		 */
 		ExecutionInstance& operator-=(ExecutionInstance const& rhs) SYMBOL_VISIBLE;
 
 		/**
-		 * Calculates sum of counter values.
+		 * Calculates sum of counter values and numbers of chunks.
 		 */
 		ExecutionInstance& operator+=(ExecutionInstance const& rhs) SYMBOL_VISIBLE;
 
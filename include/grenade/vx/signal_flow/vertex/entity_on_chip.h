@@ -35,6 +35,11 @@ struct SYMBOL_VISIBLE EntityOnChip : public grenade::common::PartitionedVertex
 
 	virtual std::optional<grenade::common::TimeDomainOnTopology> get_time_domain() const override;
 
+	/**
+	 * Set time domain.
+	 */
+	void set_time_domain(grenade::common::TimeDomainOnTopology const& value) SYMBOL_VISIBLE;
+
 protected:
 	virtual bool is_equal_to(grenade::common::Vertex const& other) const override;
 	virtual std::ostream& print(std::ostream& os) const override;
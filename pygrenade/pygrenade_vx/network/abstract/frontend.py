@@ -120,6 +120,8 @@ class ExperimentSnippet:
 
         snippet.topology = mapped_topology.get_root()
 
+        # Copies of input data share the data of each port until it is
+        # replaced, adding elements therefore only copies their changed ports.
         input_data = pygrenade_common.InputData(
             self.input_data)
         output_data = None
@@ -130,14 +132,13 @@ class ExperimentSnippet:
         snippet.input_data = input_data
         snippet.output_data = output_data
 
-        if self.last_topology:
-            snippet.last_topology = pygrenade_common.Topology(
-                self.last_topology)
+        # The last topology and input data are snapshots, which are only
+        # replaced but never modified, and can therefore be shared.
+        snippet.last_topology = self.last_topology
 
         if self.last_input_data:
             assert self.last_input_data == self.input_data
-            snippet.last_input_data = pygrenade_common.InputData(
-                snippet.input_data)
+        snippet.last_input_data = self.last_input_data
 
         return snippet
 
@@ -244,6 +245,7 @@ class Experiment:
         if snippet.last_input_data is None \
                 or snippet.last_input_data != \
                 snippet.input_data:
+            # The snapshot shares the data of all ports with the snippet.
             snippet.last_input_data = \
                 pygrenade_common.InputData(snippet.input_data)
         self.log.DEBUG(
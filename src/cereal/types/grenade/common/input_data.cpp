@@ -3,6 +3,7 @@
 #include "cereal/types/dapr/map.h"
 #include "cereal/types/halco/common/geometry.h"
 #include "grenade/cerealization.h"
+#include <cereal/types/memory.hpp>
 #include <cereal/types/utility.hpp>
 
 
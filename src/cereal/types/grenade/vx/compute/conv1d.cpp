@@ -7,7 +7,7 @@
 namespace grenade::vx::compute {
 
 template <typename Archive>
-void Conv1d::serialize(Archive& ar, std::uint32_t const)
+void Conv1d::serialize(Archive& ar, std::uint32_t const version)
 {
 	ar(m_enable_loopback);
 	ar(m_input_size);
@@ -18,9 +18,14 @@ void Conv1d::serialize(Archive& ar, std::uint32_t const)
 	ar(m_mac);
 	ar(m_num_sends);
 	ar(m_wait_between_events);
+	if (version >= 1) {
+		ar(m_max_windows_per_run);
+	} else {
+		m_max_windows_per_run = default_max_windows_per_run;
+	}
 }
 
 } // namespace grenade::vx::compute
 
 EXPLICIT_INSTANTIATE_CEREAL_SERIALIZE(grenade::vx::compute::Conv1d)
-CEREAL_CLASS_VERSION(grenade::vx::compute::Conv1d, 0)
+CEREAL_CLASS_VERSION(grenade::vx::compute::Conv1d, 1)
@@ -24,6 +24,7 @@ void MAC::serialize(Archive& ar, std::uint32_t const)
 	ar(m_madc_recording_path);
 	ar(m_madc_recording_vertices);
 	ar(m_chip_vertices);
+	m_prepared_cache.reset();
 }
 
 } // namespace grenade::vx::compute
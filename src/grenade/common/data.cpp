@@ -41,6 +41,29 @@ size_t Data::batch_size() const
 	return 0;
 }
 
+bool Data::operator==(Data const& other) const
+{
+	if (ports.size() != other.ports.size()) {
+		return false;
+	}
+	for (auto const& [descriptor, port] : ports) {
+		if (!other.ports.contains(descriptor)) {
+			return false;
+		}
+		auto const& other_port = other.ports.get(descriptor);
+		// data shared between copies is not compared
+		if (&port != &other_port && !(port == other_port)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool Data::operator!=(Data const& other) const
+{
+	return !(*this == other);
+}
+
 std::ostream& operator<<(std::ostream& os, Data const& data)
 {
 	hate::IndentingOstream ios(os);
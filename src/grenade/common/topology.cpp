@@ -83,8 +83,9 @@ void Topology::set(Vertices vertices)
 {
 	Vertices old_vertices;
 	for (auto const& [descriptor, _] : vertices) {
-		// store old vertex to restore if check fails
-		old_vertices.set(descriptor, std::move(Graph::get_mutable(descriptor)));
+		// store old vertex to restore if check fails, copied instead of moved out of the graph in
+		// order to not prevent sharing of the graph's storage with later copies
+		old_vertices.set(descriptor, Graph::get(descriptor));
 		// set new vertex
 		Graph::set(descriptor, std::move(vertices.get(descriptor)));
 	}
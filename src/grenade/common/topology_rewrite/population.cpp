@@ -9,7 +9,12 @@
 #include "grenade/common/multi_index_sequence/cuboid.h"
 #include "grenade/common/population.h"
 #include "hate/math.h"
+#include <algorithm>
 #include <memory>
+#include <optional>
+#include <set>
+#include <unordered_set>
+#include <tbb/parallel_for.h>
 
 namespace grenade::common {
 
@@ -23,6 +28,222 @@ PopulationTopologyRewrite::PopulationTopologyRewrite(
 {
 }
 
+namespace {
+
+/**
+ * Split of a single population into intervals.
+ * It only contains data derived from the unaltered topology and can therefore be computed
+ * independently for each population.
+ */
+struct PopulationSplit
+{
+	typename LinkedTopology::ReferenceGraph::VertexDescriptor old_reference;
+
+	/** New populations in order of their slices. */
+	std::vector<Population> populations;
+
+	/** In-edges of new population with source, index in populations and edge property. */
+	std::vector<std::tuple<VertexOnTopology, size_t, Edge>> in_edges;
+
+	/** Out-edges of new population with index in populations, target and edge property. */
+	std::vector<std::tuple<size_t, VertexOnTopology, Edge>> out_edges;
+};
+
+/**
+ * Slice indices of a population and connections on the executor associated to each slice.
+ */
+typedef std::pair<std::set<size_t>, std::vector<ConnectionOnExecutor>> PopulationSlicing;
+
+PopulationSlicing slice_population(
+    Population const& population,
+    ResourceEstimator::Resource const& resource_estimation,
+    PopulationTopologyRewrite::SystemResources const& system_resources,
+    PopulationTopologyRewrite::SystemResources::const_iterator& current_system_resources_it)
+{
+	// storage for slice indices and associated connections
+	std::set<size_t> slice_indices;
+	std::vector<ConnectionOnExecutor> connections_on_executor;
+
+	// We iterate trying to slice the remaining sequence of cells on the population until the
+	// currently sliced sequence resource requirements are larger than the system resources.
+	// Then we remember this slice, select the next connection on the executor (and its system
+	// resources) and start over with the remaining sequence.
+	auto const& population_shape = population.get_shape();
+	std::optional<size_t> largest_performable_slice = std::nullopt;
+	size_t last_performed_slice = 0;
+	auto remaining_slice_sequence = population_shape.copy();
+	for (size_t current_slice = 1; current_slice <= population_shape.size(); ++current_slice) {
+		auto const current_slice_sequence = std::move(
+		    remaining_slice_sequence->slice({current_slice - last_performed_slice}).at(0));
+		assert(current_system_resources_it != system_resources.end());
+		if (!resource_estimation.subsequence(*current_slice_sequence)
+		         ->any_scalar_greater(*current_system_resources_it->second)) {
+			largest_performable_slice = current_slice;
+		} else {
+			if (!largest_performable_slice) {
+				throw std::runtime_error(
+				    "No slice found for population which is smaller than system resources.");
+			} else {
+				slice_indices.insert(*largest_performable_slice);
+				connections_on_executor.push_back(current_system_resources_it->first);
+
+				remaining_slice_sequence =
+				    std::move(remaining_slice_sequence
+				                  ->slice({*largest_performable_slice - last_performed_slice})
+				                  .at(1));
+				last_performed_slice = *largest_performable_slice;
+
+				largest_performable_slice = std::nullopt;
+
+				current_slice -= 1;
+
+				current_system_resources_it++;
+				if (current_system_resources_it == system_resources.end()) {
+					current_system_resources_it = system_resources.begin();
+				}
+			}
+		}
+	}
+	connections_on_executor.push_back(current_system_resources_it->first);
+
+	assert(slice_indices.size() + 1 == connections_on_executor.size());
+	return {std::move(slice_indices), std::move(connections_on_executor)};
+}
+
+PopulationSplit split_population(
+    LinkedTopology const& topology,
+    VertexOnTopology const& vertex_descriptor,
+    PopulationSlicing const& slicing)
+{
+	PopulationSplit split;
+
+	auto const& population = dynamic_cast<Population const&>(topology.get(vertex_descriptor));
+
+	// get reference population vertex descriptor
+	std::unordered_set<typename LinkedTopology::ReferenceGraph::VertexDescriptor> old_references;
+	for (auto const& link : topology.inter_graph_hyper_edges_by_linked(vertex_descriptor)) {
+		auto const& references = topology.references(link);
+		assert(references.size() == 1);
+		old_references.insert(references.at(0));
+	}
+	assert(old_references.size() == 1);
+	split.old_reference = *old_references.begin();
+
+	auto const& [slice_indices, connections_on_executor] = slicing;
+	auto const new_population_shapes = population.get_shape().slice(slice_indices);
+
+	// create new populations
+	for (size_t i = 0; auto const& new_population_shape : new_population_shapes) {
+		assert(new_population_shape);
+		auto new_population_parameter_space = population.get_parameter_space().get_section(
+		    *CuboidMultiIndexSequence({population.get_shape().size()})
+		         .related_sequence_subset_restriction(
+		             population.get_shape(), *new_population_shape));
+		assert(new_population_parameter_space);
+		if (population.get_execution_instance_on_executor()) {
+			throw std::runtime_error("Partitioning population, for which the execution instance "
+			                         "on executor is constrained, is not supported.");
+		}
+		split.populations.emplace_back(Population(
+		    population.get_cell(), *new_population_shape, *new_population_parameter_space,
+		    population.get_time_domain(),
+		    ExecutionInstanceOnExecutor(ExecutionInstanceID(), connections_on_executor.at(i))));
+		i++;
+	}
+
+	// create new in-edges
+	for (size_t i = 0; auto const& new_vertex : split.populations) {
+		auto const new_input_ports = new_vertex.get_input_ports();
+		for (auto const in_edge_descriptor : topology.in_edges(vertex_descriptor)) {
+			auto const& in_edge = topology.get(in_edge_descriptor);
+			// logic below only works for injective edge channels
+			if (!in_edge.get_channels_on_source().is_injective() ||
+			    !in_edge.get_channels_on_target().is_injective()) {
+				throw std::runtime_error("PopulationTopologyRewrite edge rewrite only works "
+				                         "for injective edge channels");
+			}
+			auto const channels_on_target =
+			    new_input_ports.at(in_edge.port_on_target)
+			        .get_channels()
+			        .subset_restriction(in_edge.get_channels_on_target());
+			assert(channels_on_target);
+			auto const channels_on_source =
+			    in_edge.get_channels_on_source().related_sequence_subset_restriction(
+			        in_edge.get_channels_on_target(),
+			        new_input_ports.at(in_edge.port_on_target).get_channels());
+			assert(channels_on_source);
+			if (channels_on_source->size() == 0) {
+				continue;
+			}
+			split.in_edges.push_back(std::make_tuple(
+			    topology.source(in_edge_descriptor), i,
+			    Edge(
+			        *channels_on_source, *channels_on_target, in_edge.port_on_source,
+			        in_edge.port_on_target)));
+		}
+		i++;
+	}
+
+	// create new out-edges
+	for (size_t i = 0; auto const& new_vertex : split.populations) {
+		auto const new_output_ports = new_vertex.get_output_ports();
+		for (auto const out_edge_descriptor : topology.out_edges(vertex_descriptor)) {
+			auto const& out_edge = topology.get(out_edge_descriptor);
+			// logic below only works for injective edge channels
+			if (!out_edge.get_channels_on_source().is_injective() ||
+			    !out_edge.get_channels_on_target().is_injective()) {
+				throw std::runtime_error("PopulationTopologyRewrite edge rewrite only works "
+				                         "for injective edge channels");
+			}
+			auto const channels_on_source = out_edge.get_channels_on_source().subset_restriction(
+			    new_output_ports.at(out_edge.port_on_source).get_channels());
+			assert(channels_on_source);
+			if (channels_on_source->size() == 0) {
+				continue;
+			}
+			auto const channels_on_target =
+			    out_edge.get_channels_on_target().related_sequence_subset_restriction(
+			        out_edge.get_channels_on_source(), *channels_on_source);
+			assert(channels_on_target);
+			split.out_edges.push_back(std::make_tuple(
+			    i, topology.target(out_edge_descriptor),
+			    Edge(
+			        *channels_on_source, *channels_on_target, out_edge.port_on_source,
+			        out_edge.port_on_target)));
+		}
+		i++;
+	}
+	return split;
+}
+
+void apply_population_split(
+    LinkedTopology& topology, VertexOnTopology const& vertex_descriptor, PopulationSplit&& split)
+{
+	// add new populations to topology
+	std::vector<VertexOnTopology> new_vertex_descriptors;
+	for (auto& new_population : split.populations) {
+		auto const new_population_descriptor = topology.add_vertex(std::move(new_population));
+		topology.add_inter_graph_hyper_edge(
+		    {new_population_descriptor}, {split.old_reference}, PopulationInterTopologyHyperEdge());
+		new_vertex_descriptors.push_back(new_population_descriptor);
+	}
+
+	topology.clear_vertex(vertex_descriptor);
+
+	// add new in-edges
+	for (auto const& [source, target, edge] : split.in_edges) {
+		topology.add_edge(source, new_vertex_descriptors.at(target), edge);
+	}
+	// add new out-edges
+	for (auto const& [source, target, edge] : split.out_edges) {
+		topology.add_edge(new_vertex_descriptors.at(source), target, edge);
+	}
+
+	topology.remove_vertex(vertex_descriptor);
+}
+
+} // namespace
+
 void PopulationTopologyRewrite::operator()() const
 {
 	if (!m_resource_estimator) {
@@ -41,184 +262,71 @@ void PopulationTopologyRewrite::operator()() const
 		}
 	}
 	auto current_system_resources_it = m_system_resources.begin();
-	for (auto const vertex_descriptor : all_population_vertices) {
-		auto const& population =
-		    dynamic_cast<Population const&>(get_topology().get(vertex_descriptor));
-
-		// get reference population vertex descriptor
-		std::unordered_set<typename LinkedTopology::ReferenceGraph::VertexDescriptor>
-		    old_references;
-		for (auto const& link :
-		     get_topology().inter_graph_hyper_edges_by_linked(vertex_descriptor)) {
-			auto const& references = get_topology().references(link);
-			assert(references.size() == 1);
-			old_references.insert(references.at(0));
-		}
-		assert(old_references.size() == 1);
-		auto const& old_reference = *old_references.begin();
-
-		// storage for slice indices and associated connections
-		std::set<size_t> slice_indices;
-		std::vector<ConnectionOnExecutor> connections_on_executor;
-
-		auto const resource_estimation = m_resource_estimator->operator()(vertex_descriptor);
-		assert(resource_estimation);
-
-		// We iterate trying to slice the remaining sequence of cells on the population until the
-		// currently sliced sequence resource requirements are larger than the system resources.
-		// Then we remember this slice, select the next connection on the executor (and its system
-		// resources) and start over with the remaining sequence.
-		auto const& population_shape = population.get_shape();
-		std::optional<size_t> largest_performable_slice = std::nullopt;
-		size_t last_performed_slice = 0;
-		auto remaining_slice_sequence = population_shape.copy();
-		for (size_t current_slice = 1; current_slice <= population_shape.size(); ++current_slice) {
-			auto const current_slice_sequence = std::move(
-			    remaining_slice_sequence->slice({current_slice - last_performed_slice}).at(0));
-			assert(current_system_resources_it != m_system_resources.end());
-			if (!resource_estimation->subsequence(*current_slice_sequence)
-			         ->any_scalar_greater(*current_system_resources_it->second)) {
-				largest_performable_slice = current_slice;
-			} else {
-				if (!largest_performable_slice) {
-					throw std::runtime_error(
-					    "No slice found for population which is smaller than system resources.");
-				} else {
-					slice_indices.insert(*largest_performable_slice);
-					connections_on_executor.push_back(current_system_resources_it->first);
-
-					remaining_slice_sequence =
-					    std::move(remaining_slice_sequence
-					                  ->slice({*largest_performable_slice - last_performed_slice})
-					                  .at(1));
-					last_performed_slice = *largest_performable_slice;
-
-					largest_performable_slice = std::nullopt;
-
-					current_slice -= 1;
-
-					current_system_resources_it++;
-					if (current_system_resources_it == m_system_resources.end()) {
-						current_system_resources_it = m_system_resources.begin();
-					}
-				}
+
+	// The resource estimation and split of a population only depend on its adjacent vertices. If
+	// no population is adjacent to another population, replacing one population does not alter
+	// the input to the split of any other population and all splits can be computed concurrently
+	// on the unaltered topology. Only the slicing, which assigns connections on the executor
+	// round-robin, is sequential. Otherwise we fall back to the sequential rewrite.
+	std::unordered_set<VertexOnTopology> const population_vertex_set(
+	    all_population_vertices.begin(), all_population_vertices.end());
+	auto const is_adjacent_to_population = [&](VertexOnTopology const& vertex_descriptor) {
+		for (auto const in_edge : get_topology().in_edges(vertex_descriptor)) {
+			if (population_vertex_set.contains(get_topology().source(in_edge))) {
+				return true;
 			}
 		}
-		connections_on_executor.push_back(current_system_resources_it->first);
-
-		assert(slice_indices.size() + 1 == connections_on_executor.size());
-		auto const new_population_shapes = population_shape.slice(slice_indices);
-
-		// create new populations
-		std::vector<Population> new_populations;
-		for (size_t i = 0; auto const& new_population_shape : new_population_shapes) {
-			assert(new_population_shape);
-			auto new_population_parameter_space = population.get_parameter_space().get_section(
-			    *CuboidMultiIndexSequence({population.get_shape().size()})
-			         .related_sequence_subset_restriction(
-			             population.get_shape(), *new_population_shape));
-			assert(new_population_parameter_space);
-			if (population.get_execution_instance_on_executor()) {
-				throw std::runtime_error(
-				    "Partitioning population, for which the execution instance "
-				    "on executor is constrained, is not supported.");
+		for (auto const out_edge : get_topology().out_edges(vertex_descriptor)) {
+			if (population_vertex_set.contains(get_topology().target(out_edge))) {
+				return true;
 			}
-			new_populations.emplace_back(Population(
-			    population.get_cell(), *new_population_shape, *new_population_parameter_space,
-			    population.get_time_domain(),
-			    ExecutionInstanceOnExecutor(ExecutionInstanceID(), connections_on_executor.at(i))));
-			i++;
 		}
+		return false;
+	};
+	bool const independent = std::none_of(
+	    all_population_vertices.begin(), all_population_vertices.end(), is_adjacent_to_population);
 
-		// add new populations to topology
-		std::vector<VertexOnTopology> new_vertex_descriptors;
-		for (auto const& new_population : new_populations) {
-			auto const new_population_descriptor = get_topology().add_vertex(new_population);
-			get_topology().add_inter_graph_hyper_edge(
-			    {new_population_descriptor}, {old_reference}, PopulationInterTopologyHyperEdge());
-			new_vertex_descriptors.push_back(new_population_descriptor);
+	if (!independent) {
+		for (auto const vertex_descriptor : all_population_vertices) {
+			auto const resource_estimation = m_resource_estimator->operator()(vertex_descriptor);
+			assert(resource_estimation);
+			auto const slicing = slice_population(
+			    dynamic_cast<Population const&>(get_topology().get(vertex_descriptor)),
+			    *resource_estimation, m_system_resources, current_system_resources_it);
+			apply_population_split(
+			    get_topology(), vertex_descriptor,
+			    split_population(get_topology(), vertex_descriptor, slicing));
 		}
+		return;
+	}
 
-		// create new in-edges
-		std::vector<std::tuple<VertexOnTopology, VertexOnTopology, Edge>> new_in_edges;
-		for (auto const& new_vertex_descriptor : new_vertex_descriptors) {
-			for (auto const in_edge_descriptor : get_topology().in_edges(vertex_descriptor)) {
-				auto const& in_edge = get_topology().get(in_edge_descriptor);
-				// logic below only works for injective edge channels
-				if (!in_edge.get_channels_on_source().is_injective() ||
-				    !in_edge.get_channels_on_target().is_injective()) {
-					throw std::runtime_error("PopulationTopologyRewrite edge rewrite only works "
-					                         "for injective edge channels");
-				}
-				auto const& new_vertex =
-				    dynamic_cast<Population const&>(get_topology().get(new_vertex_descriptor));
-				auto const new_input_ports = new_vertex.get_input_ports();
-				auto const channels_on_target =
-				    new_input_ports.at(in_edge.port_on_target)
-				        .get_channels()
-				        .subset_restriction(in_edge.get_channels_on_target());
-				assert(channels_on_target);
-				auto const channels_on_source =
-				    in_edge.get_channels_on_source().related_sequence_subset_restriction(
-				        in_edge.get_channels_on_target(),
-				        new_input_ports.at(in_edge.port_on_target).get_channels());
-				assert(channels_on_source);
-				if (channels_on_source->size() == 0) {
-					continue;
-				}
-				new_in_edges.push_back(std::make_tuple(
-				    get_topology().source(in_edge_descriptor), new_vertex_descriptor,
-				    Edge(
-				        *channels_on_source, *channels_on_target, in_edge.port_on_source,
-				        in_edge.port_on_target)));
-			}
-		}
+	LinkedTopology const& topology = get_topology();
 
-		// create new out-edges
-		std::vector<std::tuple<VertexOnTopology, VertexOnTopology, Edge>> new_out_edges;
-		for (auto const& new_vertex_descriptor : new_vertex_descriptors) {
-			for (auto const out_edge_descriptor : get_topology().out_edges(vertex_descriptor)) {
-				auto const& out_edge = get_topology().get(out_edge_descriptor);
-				// logic below only works for injective edge channels
-				if (!out_edge.get_channels_on_source().is_injective() ||
-				    !out_edge.get_channels_on_target().is_injective()) {
-					throw std::runtime_error("PopulationTopologyRewrite edge rewrite only works "
-					                         "for injective edge channels");
-				}
-				auto const& new_vertex =
-				    dynamic_cast<Population const&>(get_topology().get(new_vertex_descriptor));
-				auto const new_output_ports = new_vertex.get_output_ports();
-				auto const channels_on_source =
-				    out_edge.get_channels_on_source().subset_restriction(
-				        new_output_ports.at(out_edge.port_on_source).get_channels());
-				assert(channels_on_source);
-				if (channels_on_source->size() == 0) {
-					continue;
-				}
-				auto const channels_on_target =
-				    out_edge.get_channels_on_target().related_sequence_subset_restriction(
-				        out_edge.get_channels_on_source(), *channels_on_source);
-				assert(channels_on_target);
-				new_out_edges.push_back(std::make_tuple(
-				    new_vertex_descriptor, get_topology().target(out_edge_descriptor),
-				    Edge(
-				        *channels_on_source, *channels_on_target, out_edge.port_on_source,
-				        out_edge.port_on_target)));
-			}
-		}
+	std::vector<std::unique_ptr<ResourceEstimator::Resource>> resource_estimations(
+	    all_population_vertices.size());
+	tbb::parallel_for(size_t(0), all_population_vertices.size(), [&](size_t const i) {
+		resource_estimations.at(i) =
+		    m_resource_estimator->operator()(all_population_vertices.at(i));
+		assert(resource_estimations.at(i));
+	});
 
-		get_topology().clear_vertex(vertex_descriptor);
+	std::vector<PopulationSlicing> slicings;
+	slicings.reserve(all_population_vertices.size());
+	for (size_t i = 0; i < all_population_vertices.size(); ++i) {
+		slicings.push_back(slice_population(
+		    dynamic_cast<Population const&>(topology.get(all_population_vertices.at(i))),
+		    *resource_estimations.at(i), m_system_resources, current_system_resources_it));
+	}
 
-		// add new in-edges
-		for (auto const& [source, target, edge] : new_in_edges) {
-			get_topology().add_edge(source, target, edge);
-		}
-		// add new out-edges
-		for (auto const& [source, target, edge] : new_out_edges) {
-			get_topology().add_edge(source, target, edge);
-		}
+	std::vector<PopulationSplit> splits(all_population_vertices.size());
+	tbb::parallel_for(size_t(0), all_population_vertices.size(), [&](size_t const i) {
+		splits.at(i) = split_population(topology, all_population_vertices.at(i), slicings.at(i));
+	});
 
-		get_topology().remove_vertex(vertex_descriptor);
+	// apply in order of the vertices to yield the same descriptors as the sequential rewrite
+	for (size_t i = 0; i < all_population_vertices.size(); ++i) {
+		apply_population_split(
+		    get_topology(), all_population_vertices.at(i), std::move(splits.at(i)));
 	}
 }
 
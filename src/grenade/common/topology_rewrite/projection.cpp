@@ -8,8 +8,11 @@
 #include "grenade/common/projection.h"
 #include "grenade/common/vertex_on_topology.h"
 #include "hate/math.h"
+#include <algorithm>
 #include <memory>
 #include <stdexcept>
+#include <unordered_set>
+#include <tbb/parallel_for.h>
 
 namespace grenade::common {
 
@@ -18,6 +21,170 @@ ProjectionTopologyRewrite::ProjectionTopologyRewrite(std::shared_ptr<LinkedTopol
 {
 }
 
+namespace {
+
+/**
+ * Split of a single projection along its post-synaptic populations.
+ * It only contains data derived from the unaltered topology and can therefore be computed
+ * independently for each projection.
+ */
+struct ProjectionSplit
+{
+	typename LinkedTopology::ReferenceGraph::VertexDescriptor old_reference;
+
+	/** Edges to projection, which are replicated to all new projections. */
+	std::vector<std::tuple<VertexOnTopology, Edge>> in_edges;
+
+	/** New projections in order of the out-edges to populations. */
+	std::vector<Projection> projections;
+
+	/** Out-edges of new projection with index in projections, target and edge property. */
+	std::vector<std::tuple<size_t, VertexOnTopology, Edge>> out_edges;
+};
+
+ProjectionSplit split_projection(
+    LinkedTopology const& topology, VertexOnTopology const& vertex_descriptor)
+{
+	ProjectionSplit split;
+
+	// get reference projection vertex descriptor
+	std::unordered_set<typename LinkedTopology::ReferenceGraph::VertexDescriptor> old_references;
+	for (auto const& link : topology.inter_graph_hyper_edges_by_linked(vertex_descriptor)) {
+		auto const& references = topology.references(link);
+		assert(references.size() == 1);
+		old_references.insert(references.at(0));
+	}
+
+	assert(old_references.size() == 1);
+	split.old_reference = *old_references.begin();
+
+	for (auto const in_edge : topology.in_edges(vertex_descriptor)) {
+		auto const source_descriptor = topology.source(in_edge);
+		split.in_edges.push_back(std::make_tuple(source_descriptor, topology.get(in_edge)));
+	}
+
+	auto const& projection = dynamic_cast<Projection const&>(topology.get(vertex_descriptor));
+	auto const connector_input_sequence = projection.get_connector().get_input_sequence();
+	auto const connector_output_sequence = projection.get_connector().get_output_sequence();
+	auto const connector_io_sequence =
+	    connector_input_sequence->cartesian_product(*connector_output_sequence);
+	// split projection along edges to post-synaptic populations
+	for (auto const out_edge : topology.out_edges(vertex_descriptor)) {
+		auto const target_descriptor = topology.target(out_edge);
+		if (auto const ptr = dynamic_cast<Population const*>(&topology.get(target_descriptor));
+		    ptr) {
+			auto const& channels_on_projection = topology.get(out_edge).get_channels_on_source();
+
+			std::set<size_t> projection_dimensions;
+			for (size_t i = 0;
+			     i < projection.get_connector().get_input_sequence()->dimensionality() -
+			             projection.get_synapse()
+			                 .get_input_ports()
+			                 .projection.at(topology.get(out_edge).port_on_source)
+			                 .get_channels()
+			                 .dimensionality();
+			     ++i) {
+				projection_dimensions.insert(i);
+			}
+
+			auto const projection_channels_on_source =
+			    channels_on_projection.distinct_projection(projection_dimensions);
+			auto const projection_sequence_slice =
+			    projection.get_connector().get_input_sequence()->cartesian_product(
+			        *projection_channels_on_source);
+			assert(projection_sequence_slice);
+			auto const projection_sequence =
+			    projection_sequence_slice->subset_restriction(*connector_io_sequence);
+			assert(projection_sequence);
+			auto projection_connector =
+			    projection.get_connector().get_section(*projection_sequence);
+			auto projection_parameter_space = projection.get_synapse_parameter_space().get_section(
+			    *CuboidMultiIndexSequence({projection.get_synapse_parameter_space().size()})
+			         .subset_restriction(
+			             *projection_connector->get_synapse_parameterization_indices(
+			                 *projection_sequence)));
+
+			auto const& channels_on_target = topology.get(out_edge).get_channels_on_target();
+			split.out_edges.push_back(std::make_tuple(
+			    split.projections.size(), target_descriptor,
+			    Edge(
+			        channels_on_projection, channels_on_target,
+			        topology.get(out_edge).port_on_source,
+			        topology.get(out_edge).port_on_target)));
+			split.projections.emplace_back(
+			    projection.get_synapse(), *projection_parameter_space, *projection_connector,
+			    projection.get_time_domain(), projection.get_execution_instance_on_executor());
+		}
+	}
+	// create new edges to all vertices which are not populations
+	for (size_t i = 0; i < split.projections.size(); ++i) {
+		auto const new_vertex_output_ports = split.projections.at(i).get_output_ports();
+		for (auto const out_edge_descriptor : topology.out_edges(vertex_descriptor)) {
+			auto const target_descriptor = topology.target(out_edge_descriptor);
+			if (auto const ptr = dynamic_cast<Population const*>(&topology.get(target_descriptor));
+			    !ptr) {
+				auto const& out_edge = topology.get(out_edge_descriptor);
+
+				auto const channels_on_source =
+				    new_vertex_output_ports.at(out_edge.port_on_source)
+				        .get_channels()
+				        .subset_restriction(out_edge.get_channels_on_source());
+				assert(channels_on_source);
+
+				auto const channels_on_target =
+				    out_edge.get_channels_on_target().related_sequence_subset_restriction(
+				        out_edge.get_channels_on_source(),
+				        new_vertex_output_ports.at(out_edge.port_on_source).get_channels());
+				assert(channels_on_target);
+
+				if (channels_on_source->size() == 0) {
+					continue;
+				}
+
+				split.out_edges.push_back(std::make_tuple(
+				    i, target_descriptor,
+				    Edge(
+				        *channels_on_source, *channels_on_target, out_edge.port_on_source,
+				        out_edge.port_on_target)));
+			}
+		}
+	}
+	return split;
+}
+
+void apply_projection_split(
+    LinkedTopology& topology, VertexOnTopology const& vertex_descriptor, ProjectionSplit&& split)
+{
+	std::vector<VertexOnTopology> new_vertices;
+	for (auto& projection : split.projections) {
+		new_vertices.push_back(topology.add_vertex(std::move(projection)));
+	}
+
+	topology.clear_vertex(vertex_descriptor);
+
+	// set links to new projections
+	for (auto const& new_vertex : new_vertices) {
+		topology.add_inter_graph_hyper_edge(
+		    {new_vertex}, {split.old_reference}, ProjectionInterTopologyHyperEdge());
+	}
+
+	// add in-edges to new projections
+	for (auto const& [source, edge] : split.in_edges) {
+		for (auto const& target : new_vertices) {
+			topology.add_edge(source, target, edge);
+		}
+	}
+
+	// add out-edges to new projections
+	for (auto const& [source, target, edge] : split.out_edges) {
+		topology.add_edge(new_vertices.at(source), target, edge);
+	}
+
+	topology.remove_vertex(vertex_descriptor);
+}
+
+} // namespace
+
 void ProjectionTopologyRewrite::operator()() const
 {
 	// copy vertex descriptors because they are modified in the loop (by replacing projections)
@@ -29,147 +196,48 @@ void ProjectionTopologyRewrite::operator()() const
 			all_projection_vertices.push_back(vertex_descriptor);
 		}
 	}
-	for (auto const vertex_descriptor : all_projection_vertices) {
-		// get reference projection vertex descriptor
-		std::unordered_set<typename LinkedTopology::ReferenceGraph::VertexDescriptor>
-		    old_references;
-		for (auto const& link :
-		     get_topology().inter_graph_hyper_edges_by_linked(vertex_descriptor)) {
-			auto const& references = get_topology().references(link);
-			assert(references.size() == 1);
-			old_references.insert(references.at(0));
-		}
-
-		assert(old_references.size() == 1);
-		auto const& old_reference = *old_references.begin();
 
-		std::vector<std::tuple<VertexOnTopology, VertexOnTopology, Edge>> new_edges;
-		std::vector<std::tuple<VertexOnTopology, Edge>> new_in_edges;
-		std::vector<VertexOnTopology> new_vertices;
+	// The split of a projection only depends on its adjacent vertices. If no projection is
+	// adjacent to another projection, replacing one projection does not alter the input to the
+	// split of any other projection and all splits can be computed concurrently on the unaltered
+	// topology. Otherwise we fall back to the sequential rewrite.
+	std::unordered_set<VertexOnTopology> const projection_vertex_set(
+	    all_projection_vertices.begin(), all_projection_vertices.end());
+	auto const is_adjacent_to_projection = [&](VertexOnTopology const& vertex_descriptor) {
 		for (auto const in_edge : get_topology().in_edges(vertex_descriptor)) {
-			auto const source_descriptor = get_topology().source(in_edge);
-			new_in_edges.push_back(std::make_tuple(source_descriptor, get_topology().get(in_edge)));
-		}
-
-		auto const& projection =
-		    dynamic_cast<Projection const&>(get_topology().get(vertex_descriptor));
-		auto const connector_input_sequence = projection.get_connector().get_input_sequence();
-		auto const connector_output_sequence = projection.get_connector().get_output_sequence();
-		auto const connector_io_sequence =
-		    connector_input_sequence->cartesian_product(*connector_output_sequence);
-		// split projection along edges to post-synaptic populations
-		for (auto const out_edge : get_topology().out_edges(vertex_descriptor)) {
-			auto const target_descriptor = get_topology().target(out_edge);
-			if (auto const ptr =
-			        dynamic_cast<Population const*>(&get_topology().get(target_descriptor));
-			    ptr) {
-				auto const& channels_on_projection =
-				    get_topology().get(out_edge).get_channels_on_source();
-
-				std::set<size_t> projection_dimensions;
-				for (size_t i = 0;
-				     i < projection.get_connector().get_input_sequence()->dimensionality() -
-				             projection.get_synapse()
-				                 .get_input_ports()
-				                 .projection.at(get_topology().get(out_edge).port_on_source)
-				                 .get_channels()
-				                 .dimensionality();
-				     ++i) {
-					projection_dimensions.insert(i);
-				}
-
-				auto const projection_channels_on_source =
-				    channels_on_projection.distinct_projection(projection_dimensions);
-				auto const projection_sequence_slice =
-				    projection.get_connector().get_input_sequence()->cartesian_product(
-				        *projection_channels_on_source);
-				assert(projection_sequence_slice);
-				auto const projection_sequence =
-				    projection_sequence_slice->subset_restriction(*connector_io_sequence);
-				assert(projection_sequence);
-				auto projection_connector =
-				    projection.get_connector().get_section(*projection_sequence);
-				auto projection_parameter_space =
-				    projection.get_synapse_parameter_space().get_section(
-				        *CuboidMultiIndexSequence({projection.get_synapse_parameter_space().size()})
-				             .subset_restriction(
-				                 *projection_connector->get_synapse_parameterization_indices(
-				                     *projection_sequence)));
-
-				Projection new_projection(
-				    projection.get_synapse(), *projection_parameter_space, *projection_connector,
-				    projection.get_time_domain(), projection.get_execution_instance_on_executor());
-				auto const new_projection_descriptor = get_topology().add_vertex(new_projection);
-
-				auto const& channels_on_target =
-				    get_topology().get(out_edge).get_channels_on_target();
-				new_edges.push_back(std::make_tuple(
-				    new_projection_descriptor, target_descriptor,
-				    Edge(
-				        channels_on_projection, channels_on_target,
-				        get_topology().get(out_edge).port_on_source,
-				        get_topology().get(out_edge).port_on_target)));
-				new_vertices.push_back(new_projection_descriptor);
+			if (projection_vertex_set.contains(get_topology().source(in_edge))) {
+				return true;
 			}
 		}
-		// create new edges to all vertices which are not populations
-		for (auto const& new_vertex_descriptor : new_vertices) {
-			auto const& new_vertex =
-			    dynamic_cast<Projection const&>(get_topology().get(new_vertex_descriptor));
-			auto const new_vertex_output_ports = new_vertex.get_output_ports();
-			for (auto const out_edge_descriptor : get_topology().out_edges(vertex_descriptor)) {
-				auto const target_descriptor = get_topology().target(out_edge_descriptor);
-				if (auto const ptr =
-				        dynamic_cast<Population const*>(&get_topology().get(target_descriptor));
-				    !ptr) {
-					auto const& out_edge = get_topology().get(out_edge_descriptor);
-
-					auto const channels_on_source =
-					    new_vertex_output_ports.at(out_edge.port_on_source)
-					        .get_channels()
-					        .subset_restriction(out_edge.get_channels_on_source());
-					assert(channels_on_source);
-
-					auto const channels_on_target =
-					    out_edge.get_channels_on_target().related_sequence_subset_restriction(
-					        out_edge.get_channels_on_source(),
-					        new_vertex_output_ports.at(out_edge.port_on_source).get_channels());
-					assert(channels_on_target);
-
-					if (channels_on_source->size() == 0) {
-						continue;
-					}
-
-					new_edges.push_back(std::make_tuple(
-					    new_vertex_descriptor, get_topology().target(out_edge_descriptor),
-					    Edge(
-					        *channels_on_source, *channels_on_target, out_edge.port_on_source,
-					        out_edge.port_on_target)));
-				}
+		for (auto const out_edge : get_topology().out_edges(vertex_descriptor)) {
+			if (projection_vertex_set.contains(get_topology().target(out_edge))) {
+				return true;
 			}
 		}
-
-		get_topology().clear_vertex(vertex_descriptor);
-
-		// set links to new projections
-		for (auto const& new_vertex : new_vertices) {
-			get_topology().add_inter_graph_hyper_edge(
-			    {new_vertex}, {old_reference}, ProjectionInterTopologyHyperEdge());
-		}
-
-		// add in-edges to new projections
-		for (auto const& [source, edge] : new_in_edges) {
-			for (auto const& target : new_vertices) {
-				get_topology().add_edge(source, target, edge);
-			}
+		return false;
+	};
+	bool const independent = std::none_of(
+	    all_projection_vertices.begin(), all_projection_vertices.end(), is_adjacent_to_projection);
+
+	if (!independent) {
+		for (auto const vertex_descriptor : all_projection_vertices) {
+			apply_projection_split(
+			    get_topology(), vertex_descriptor,
+			    split_projection(get_topology(), vertex_descriptor));
 		}
+		return;
+	}
 
-		// add out-edges to new projections
-		for (auto const& [source, target, edge] : new_edges) {
-			get_topology().add_edge(source, target, edge);
-		}
+	std::vector<ProjectionSplit> splits(all_projection_vertices.size());
+	LinkedTopology const& topology = get_topology();
+	tbb::parallel_for(size_t(0), all_projection_vertices.size(), [&](size_t const i) {
+		splits.at(i) = split_projection(topology, all_projection_vertices.at(i));
+	});
 
-		get_topology().remove_vertex(vertex_descriptor);
+	// apply in order of the vertices to yield the same descriptors as the sequential rewrite
+	for (size_t i = 0; i < all_projection_vertices.size(); ++i) {
+		apply_projection_split(
+		    get_topology(), all_projection_vertices.at(i), std::move(splits.at(i)));
 	}
 }
 
@@ -36,7 +36,7 @@ size_t Addition::output_size() const
 
 std::vector<std::vector<signal_flow::Int8>> Addition::run(
     std::vector<std::vector<signal_flow::Int8>> const& inputs,
-    lola::vx::v3::Chip const&,
+    lola::vx::v3::Chip const& config,
     execution::JITGraphExecutor& executor) const
 {
 	using namespace halco::hicann_dls::vx;
@@ -57,7 +57,7 @@ std::vector<std::vector<signal_flow::Int8>> Addition::run(
 		throw std::runtime_error("Provided inputs size does not match Addition input size.");
 	}
 
-	grenade::common::InputData input_map;
+	grenade::common::InputData input_map = get_fusable_operation(inputs.size(), config)->input_data;
 	std::vector<common::TimedDataSequence<std::vector<signal_flow::Int8>>> timed_inputs(
 	    inputs.size());
 	for (size_t i = 0; i < inputs.size(); ++i) {
@@ -66,14 +66,6 @@ std::vector<std::vector<signal_flow::Int8>> Addition::run(
 	}
 	input_map.ports.set({m_vertex, 0}, signal_flow::vertex::Transformation::Dynamics(timed_inputs));
 
-	std::vector<common::TimedDataSequence<std::vector<signal_flow::Int8>>> others(inputs.size());
-	for (auto& o : others) {
-		o.resize(1);
-		// TODO: Think about what to do with timing information
-		o.at(0).data = m_other;
-	}
-	input_map.ports.set({m_vertex, 1}, signal_flow::vertex::Transformation::Dynamics(others));
-
 	auto const output_map = execution::run(executor, m_topology, input_map);
 
 	auto const timed_outputs =
@@ -89,4 +81,19 @@ std::vector<std::vector<signal_flow::Int8>> Addition::run(
 	return outputs;
 }
 
+std::optional<detail::FusableOperation> Addition::get_fusable_operation(
+    size_t const batch_size, lola::vx::v3::Chip const&) const
+{
+	grenade::common::InputData input_data;
+	std::vector<common::TimedDataSequence<std::vector<signal_flow::Int8>>> others(batch_size);
+	for (auto& o : others) {
+		o.resize(1);
+		// TODO: Think about what to do with timing information
+		o.at(0).data = m_other;
+	}
+	input_data.ports.set({m_vertex, 1}, signal_flow::vertex::Transformation::Dynamics(others));
+	return detail::FusableOperation{
+	    m_topology, std::move(input_data), {m_vertex, 0}, {m_vertex, 0}};
+}
+
 } // namespace grenade::vx::compute
@@ -74,35 +74,53 @@ std::vector<std::vector<signal_flow::Int8>> Conv1d::run(
 	}
 
 	size_t const num = (m_input_size - m_kernel_size) / m_stride + 1;
-	grenade::vx::compute::Conv1d::Activations mac_inputs(inputs.size() * num);
+	size_t const num_windows = inputs.size() * num;
 
-	for (size_t b = 0; b < inputs.size(); ++b) {
-		for (size_t n = 0; n < num; ++n) {
-			auto& local = mac_inputs.at(b * num + n);
-			local.resize(m_kernel_size * m_in_channels);
+	std::vector<std::vector<signal_flow::Int8>> output(inputs.size());
+	for (auto& local : output) {
+		local.reserve(m_out_channels * num);
+	}
+
+	// the windows are gathered and run in chunks, which bounds the memory of the MAC inputs and
+	// outputs by the chunk size instead of the number of all windows
+	for (size_t chunk_begin = 0; chunk_begin < num_windows; chunk_begin += m_max_windows_per_run) {
+		size_t const chunk_end = std::min(chunk_begin + m_max_windows_per_run, num_windows);
+
+		// gather the strided input windows directly into the MAC input representation, the window
+		// of in_channel i at position n starts at i * input_size + n * stride with kernel_size
+		// values
+		std::vector<common::TimedDataSequence<std::vector<signal_flow::UInt5>>> mac_inputs(
+		    chunk_end - chunk_begin);
+		for (size_t w = chunk_begin; w < chunk_end; ++w) {
+			auto const input_begin = inputs.at(w / num).begin();
+			size_t const n = w % num;
+			auto& mac_input = mac_inputs.at(w - chunk_begin);
+			mac_input.resize(1);
+			auto& local = mac_input.at(0).data;
+			local.reserve(m_kernel_size * m_in_channels);
 			for (size_t i = 0; i < m_in_channels; ++i) {
-				for (size_t k = 0; k < m_kernel_size; ++k) {
-					local.at(i * m_kernel_size + k) =
-					    inputs.at(b).at(i * m_input_size + (n * m_stride) + k);
-				}
+				auto const window_begin = input_begin + i * m_input_size + n * m_stride;
+				local.insert(local.end(), window_begin, window_begin + m_kernel_size);
 			}
 		}
-	}
 
-	auto const mac_output = m_mac.run(mac_inputs, config, executor);
+		auto const mac_output = m_mac.run_timed(std::move(mac_inputs), config, executor);
 
-	std::vector<std::vector<signal_flow::Int8>> output(inputs.size());
-	for (size_t b = 0; b < output.size(); ++b) {
-		auto& local = output.at(b);
-		local.resize(m_out_channels * num);
-		for (size_t n = 0; n < num; ++n) {
-			auto& mac_local = mac_output.at(b * num + n);
-			for (size_t o = 0; o < m_out_channels; ++o) {
-				local.at(n * m_out_channels + o) = mac_local.at(o);
-			}
+		// each MAC output is the contiguous block of out_channels at window position n, windows
+		// are ordered by batch entry and position
+		for (size_t w = chunk_begin; w < chunk_end; ++w) {
+			auto const& mac_local = mac_output.at(w - chunk_begin);
+			auto& local = output.at(w / num);
+			local.insert(local.end(), mac_local.begin(), mac_local.begin() + m_out_channels);
 		}
 	}
 	return output;
 }
 
+std::optional<detail::FusableOperation> Conv1d::get_fusable_operation(
+    size_t, lola::vx::v3::Chip const&) const
+{
+	return std::nullopt;
+}
+
 } // namespace grenade::vx::compute
@@ -78,4 +78,10 @@ size_t ConvertingReLU::output_size() const
 	return input_size();
 }
 
+std::optional<detail::FusableOperation> ConvertingReLU::get_fusable_operation(
+    size_t, lola::vx::v3::Chip const&) const
+{
+	return detail::FusableOperation{m_graph, {}, {m_vertex, 0}, {m_vertex, 0}};
+}
+
 } // namespace grenade::vx::compute
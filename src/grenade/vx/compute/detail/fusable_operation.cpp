@@ -0,0 +1,120 @@
+#include "grenade/vx/compute/detail/fusable_operation.h"
+
+#include "grenade/common/edge.h"
+#include "grenade/common/execution_instance_on_executor.h"
+#include "grenade/common/multi_index_sequence/cuboid.h"
+#include "grenade/common/partitioned_vertex.h"
+#include "grenade/common/time_domain_on_topology.h"
+#include "grenade/vx/signal_flow/vertex/entity_on_chip.h"
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <optional>
+#include <stdexcept>
+
+namespace grenade::vx::compute::detail {
+
+FusableOperation fuse(std::vector<FusableOperation> const& operations)
+{
+	if (operations.empty()) {
+		throw std::invalid_argument("Fusing requires at least one operation.");
+	}
+
+	auto topology = std::make_shared<grenade::common::Topology>();
+	grenade::common::InputData input_data;
+	std::optional<grenade::common::PortOnTopology> input;
+	std::optional<grenade::common::PortOnTopology> previous_output;
+
+	size_t execution_instance_offset = 0;
+	size_t time_domain_offset = 0;
+	for (auto const& operation : operations) {
+		assert(operation.topology);
+
+		// copy vertices with renumbered execution instances and time domains
+		size_t num_execution_instances = 0;
+		size_t num_time_domains = 0;
+		std::map<grenade::common::VertexOnTopology, grenade::common::VertexOnTopology>
+		    vertex_translation;
+		for (auto const& vertex_descriptor : operation.topology->vertices()) {
+			auto vertex = operation.topology->get(vertex_descriptor).copy();
+			if (auto const partitioned_vertex =
+			        dynamic_cast<grenade::common::PartitionedVertex*>(vertex.get());
+			    partitioned_vertex && partitioned_vertex->get_execution_instance_on_executor()) {
+				auto const execution_instance =
+				    *partitioned_vertex->get_execution_instance_on_executor();
+				size_t const index = execution_instance.execution_instance_id.value();
+				num_execution_instances = std::max(num_execution_instances, index + 1);
+				partitioned_vertex->set_execution_instance_on_executor(
+				    grenade::common::ExecutionInstanceOnExecutor(
+				        grenade::common::ExecutionInstanceID(index + execution_instance_offset),
+				        execution_instance.connection_on_executor));
+			}
+			if (auto const time_domain = vertex->get_time_domain(); time_domain) {
+				auto const entity_on_chip =
+				    dynamic_cast<signal_flow::vertex::EntityOnChip*>(vertex.get());
+				if (!entity_on_chip) {
+					throw std::invalid_argument(
+					    "Fusing requires time domains to be located on chip entities.");
+				}
+				num_time_domains = std::max(num_time_domains, time_domain->value() + 1);
+				entity_on_chip->set_time_domain(grenade::common::TimeDomainOnTopology(
+				    time_domain->value() + time_domain_offset));
+			}
+			vertex_translation.emplace(vertex_descriptor, topology->add_vertex(std::move(*vertex)));
+		}
+		for (auto const& edge_descriptor : operation.topology->edges()) {
+			topology->add_edge(
+			    vertex_translation.at(operation.topology->source(edge_descriptor)),
+			    vertex_translation.at(operation.topology->target(edge_descriptor)),
+			    operation.topology->get(edge_descriptor));
+		}
+
+		for (auto const& [port, port_data] : operation.input_data.ports) {
+			input_data.ports.set({vertex_translation.at(port.first), port.second}, port_data);
+		}
+		for (auto const& [time_domain, runtimes] : operation.input_data.time_domain_runtimes) {
+			num_time_domains = std::max(num_time_domains, time_domain.value() + 1);
+			input_data.time_domain_runtimes.set(
+			    grenade::common::TimeDomainOnTopology(time_domain.value() + time_domain_offset),
+			    runtimes);
+		}
+		execution_instance_offset += num_execution_instances;
+		time_domain_offset += num_time_domains;
+
+		// connect to previous operation
+		grenade::common::PortOnTopology const local_input{
+		    vertex_translation.at(operation.input.first), operation.input.second};
+		if (previous_output) {
+			auto const output_port = topology->get(previous_output->first)
+			                             .get_output_ports()
+			                             .at(previous_output->second);
+			auto const input_port =
+			    topology->get(local_input.first).get_input_ports().at(local_input.second);
+			if (output_port.get_type() != input_port.get_type()) {
+				throw std::invalid_argument(
+				    "Output type of operation doesn't match input type of following operation.");
+			}
+			auto const size = output_port.get_channels().size();
+			if (size != input_port.get_channels().size()) {
+				throw std::invalid_argument(
+				    "Output size of operation doesn't match input size of following operation.");
+			}
+			topology->add_edge(
+			    previous_output->first, local_input.first,
+			    grenade::common::Edge(
+			        grenade::common::CuboidMultiIndexSequence({size}),
+			        grenade::common::CuboidMultiIndexSequence({size}), previous_output->second,
+			        local_input.second));
+		} else {
+			input = local_input;
+		}
+		previous_output = grenade::common::PortOnTopology{
+		    vertex_translation.at(operation.output.first), operation.output.second};
+	}
+
+	assert(input);
+	assert(previous_output);
+	return FusableOperation{std::move(topology), std::move(input_data), *input, *previous_output};
+}
+
+} // namespace grenade::vx::compute::detail
@@ -28,6 +28,7 @@
 #include "grenade/vx/signal_flow/vertex/transformation/mac_spiketrain_generator.h"
 #include "hate/math.h"
 #include "hate/timer.h"
+#include "lola/vx/v3/chip.h"
 
 #include <boost/accumulators/accumulators.hpp>
 #include <boost/accumulators/statistics.hpp>
@@ -35,7 +36,6 @@
 #include <tbb/parallel_for_each.h>
 
 #include <algorithm>
-#include <fstream>
 #include <map>
 
 namespace grenade::vx::compute {
@@ -229,6 +229,12 @@ MAC::insert_synram(
 
 namespace {
 
+network::abstract::ClockCycleTimeDomainRuntimes get_time_domain_runtimes(size_t const batch_size)
+{
+	std::vector<std::optional<common::Time>> runtimes(batch_size);
+	return network::abstract::ClockCycleTimeDomainRuntimes(runtimes, common::Time());
+}
+
 auto get_hemisphere_placement(
     detail::SingleChipExecutionInstanceManager& execution_instance_manager,
     std::vector<detail::RangeSplit::SubRange> const& x_split_ranges,
@@ -492,12 +498,165 @@ size_t MAC::output_size() const
 	return 0;
 }
 
+grenade::common::InputData MAC::get_parameterization(lola::vx::v3::Chip const& config) const
+{
+	using namespace halco::hicann_dls::vx::v3;
+
+	grenade::common::InputData input_data;
+	for (auto const& [d, data] : m_parameterization.ports) {
+		input_data.ports.set(d, data);
+	}
+	for (auto const& neuron_vertex : m_neuron_vertices) {
+		auto const& vertex =
+		    dynamic_cast<signal_flow::vertex::NeuronView const&>(m_topology->get(neuron_vertex));
+		std::vector<signal_flow::vertex::NeuronView::Parameterization::Config> configs(
+		    vertex.get_columns().size());
+		for (size_t i = 0; i < configs.size(); ++i) {
+			configs.at(i).enable_reset = true;
+			configs.at(i).atomic_neuron_config = config.neuron_block.atomic_neurons.at(
+			    AtomicNeuronOnDLS(vertex.get_columns().at(i), vertex.row));
+		}
+		signal_flow::vertex::NeuronView::Parameterization neuron_parameterization(configs);
+		input_data.ports.set({neuron_vertex, 1}, neuron_parameterization);
+	}
+	for (auto const& [_, chip_vertex] : m_chip_vertices) {
+		signal_flow::vertex::Chip::Parameterization chip_parameterization(config);
+		input_data.ports.set({chip_vertex, 0}, chip_parameterization);
+	}
+	return input_data;
+}
+
+std::optional<detail::FusableOperation> MAC::get_fusable_operation(
+    size_t const batch_size, lola::vx::v3::Chip const& config) const
+{
+	// loopback statistics and MADC recording are evaluated after each run of the MAC
+	if (m_enable_loopback || !m_madc_recording_path.empty()) {
+		return std::nullopt;
+	}
+	// the copy shares the parameterization with the operation prepared for the configuration
+	auto input_data = get_prepared(config)->m_input_data;
+	input_data.time_domain_runtimes.set(
+	    grenade::common::TimeDomainOnTopology(), get_time_domain_runtimes(batch_size));
+	return detail::FusableOperation{
+	    m_topology, std::move(input_data), {m_input_vertex, 0}, {m_output_vertex, 0}};
+}
+
+void MAC::set_madc_recording_sink(std::shared_ptr<MADCRecordingSink> sink)
+{
+	if (m_madc_recording_path.empty()) {
+		throw std::runtime_error("MADC recording is not enabled.");
+	}
+	m_madc_recording_sink = std::move(sink);
+	// the prepared operation holds a copy of the operation with the previous sink
+	m_prepared_cache.reset();
+}
+
+void MAC::flush_madc_recording() const
+{
+	if (m_madc_recording_sink) {
+		m_madc_recording_sink->flush();
+	}
+}
+
+MAC::PreparedCache& MAC::PreparedCache::operator=(PreparedCache const& other)
+{
+	if (this != &other) {
+		reset();
+	}
+	return *this;
+}
+
+std::shared_ptr<MAC::PreparedCache::Entry const> MAC::PreparedCache::get()
+{
+	std::lock_guard lock(m_mutex);
+	return m_entry;
+}
+
+void MAC::PreparedCache::set(std::shared_ptr<Entry const> value)
+{
+	std::lock_guard lock(m_mutex);
+	m_entry = std::move(value);
+}
+
+void MAC::PreparedCache::reset()
+{
+	set(nullptr);
+}
+
+MAC::Prepared MAC::prepare(lola::vx::v3::Chip const& config) const
+{
+	return Prepared(std::make_shared<MAC const>(*this), get_parameterization(config));
+}
+
+std::shared_ptr<MAC::Prepared const> MAC::get_prepared(lola::vx::v3::Chip const& config) const
+{
+	// the entry is immutable and therefore compared without holding the lock
+	if (auto const entry = m_prepared_cache.get(); entry && *entry->config == config) {
+		return entry->prepared;
+	}
+	auto const shared_config = std::make_shared<lola::vx::v3::Chip const>(config);
+	auto const prepared = std::make_shared<Prepared const>(prepare(*shared_config));
+	m_prepared_cache.set(std::make_shared<PreparedCache::Entry const>(
+	    PreparedCache::Entry{shared_config, prepared}));
+	return prepared;
+}
+
+std::shared_ptr<MAC::Prepared const> MAC::get_prepared(
+    std::shared_ptr<lola::vx::v3::Chip const> const& config) const
+{
+	if (!config) {
+		throw std::invalid_argument("Running MAC requires chip configuration.");
+	}
+	auto const entry = m_prepared_cache.get();
+	if (entry && entry->config == config) {
+		return entry->prepared;
+	}
+	// equal configuration given as other object reuses the prepared operation, which is then
+	// found by the configuration object in subsequent runs
+	auto const prepared = (entry && *entry->config == *config)
+	                          ? entry->prepared
+	                          : std::make_shared<Prepared const>(prepare(*config));
+	m_prepared_cache.set(
+	    std::make_shared<PreparedCache::Entry const>(PreparedCache::Entry{config, prepared}));
+	return prepared;
+}
+
 std::vector<std::vector<signal_flow::Int8>> MAC::run(
     Activations const& inputs,
     lola::vx::v3::Chip const& config,
     execution::JITGraphExecutor& executor) const
 {
-	using namespace halco::hicann_dls::vx::v3;
+	return get_prepared(config)->run(inputs, executor);
+}
+
+std::vector<std::vector<signal_flow::Int8>> MAC::run(
+    Activations const& inputs,
+    std::shared_ptr<lola::vx::v3::Chip const> const& config,
+    execution::JITGraphExecutor& executor) const
+{
+	return get_prepared(config)->run(inputs, executor);
+}
+
+std::vector<std::vector<signal_flow::Int8>> MAC::run_timed(
+    std::vector<common::TimedDataSequence<std::vector<signal_flow::UInt5>>>&& inputs,
+    lola::vx::v3::Chip const& config,
+    execution::JITGraphExecutor& executor) const
+{
+	return get_prepared(config)->run_timed(std::move(inputs), executor);
+}
+
+MAC::Prepared::Prepared(std::shared_ptr<MAC const> mac, grenade::common::InputData&& input_data) :
+    m_mac(std::move(mac)), m_input_data(std::move(input_data))
+{
+	if (!m_mac) {
+		throw std::invalid_argument("Prepared MAC operation requires operation.");
+	}
+}
+
+std::vector<std::vector<signal_flow::Int8>> MAC::Prepared::run(
+    Activations const& inputs, execution::JITGraphExecutor& executor) const
+{
+	auto const& mac = *m_mac;
 	auto logger = log4cxx::Logger::getLogger("grenade.MAC");
 
 	if (inputs.size() == 0) {
@@ -513,12 +672,11 @@ std::vector<std::vector<signal_flow::Int8>> MAC::run(
 	}
 
 	// fill topology inputs (with signal_flow::UInt5(0))
-	if (batch_entry_size != input_size()) {
+	if (batch_entry_size != mac.input_size()) {
 		throw std::runtime_error("Provided inputs size does not match MAC input size.");
 	}
 
 	hate::Timer input_timer;
-	grenade::common::InputData input_data;
 	std::vector<common::TimedDataSequence<std::vector<signal_flow::UInt5>>> timed_inputs(
 	    inputs.size());
 	for (size_t i = 0; i < inputs.size(); ++i) {
@@ -526,43 +684,41 @@ std::vector<std::vector<signal_flow::Int8>> MAC::run(
 		// TODO: Think about what to do with timing information
 		timed_inputs.at(i).at(0).data = inputs.at(i);
 	}
-	input_data.ports.set(
-	    {m_input_vertex, 0}, signal_flow::vertex::Transformation::Dynamics(timed_inputs));
-	std::vector<std::optional<common::Time>> runtimes(inputs.size());
-	input_data.time_domain_runtimes.set(
-	    grenade::common::TimeDomainOnTopology(),
-	    network::abstract::ClockCycleTimeDomainRuntimes(runtimes, common::Time()));
 	LOG4CXX_DEBUG(logger, "run(): input processing time: " << input_timer.print());
 
-	for (auto const& [d, data] : m_parameterization.ports) {
-		input_data.ports.set(d, data);
-	}
-	for (auto const& neuron_vertex : m_neuron_vertices) {
-		auto const& vertex =
-		    dynamic_cast<signal_flow::vertex::NeuronView const&>(m_topology->get(neuron_vertex));
-		std::vector<signal_flow::vertex::NeuronView::Parameterization::Config> configs(
-		    vertex.get_columns().size());
-		for (size_t i = 0; i < configs.size(); ++i) {
-			configs.at(i).enable_reset = true;
-			configs.at(i).atomic_neuron_config = config.neuron_block.atomic_neurons.at(
-			    AtomicNeuronOnDLS(vertex.get_columns().at(i), vertex.row));
-		}
-		signal_flow::vertex::NeuronView::Parameterization neuron_parameterization(configs);
-		input_data.ports.set({neuron_vertex, 1}, neuron_parameterization);
-	}
-	for (auto const& [_, chip_vertex] : m_chip_vertices) {
-		signal_flow::vertex::Chip::Parameterization chip_parameterization(config);
-		input_data.ports.set({chip_vertex, 0}, chip_parameterization);
-	}
+	return run_timed(std::move(timed_inputs), executor);
+}
+
+std::vector<std::vector<signal_flow::Int8>> MAC::Prepared::run_timed(
+    std::vector<common::TimedDataSequence<std::vector<signal_flow::UInt5>>>&& inputs,
+    execution::JITGraphExecutor& executor) const
+{
+	using namespace halco::hicann_dls::vx::v3;
+	auto const& mac = *m_mac;
+	auto logger = log4cxx::Logger::getLogger("grenade.MAC");
+
+	assert(!inputs.empty());
+	assert(std::all_of(inputs.begin(), inputs.end(), [&mac](auto const& batch_entry) {
+		return batch_entry.size() == 1 && batch_entry.at(0).data.size() == mac.input_size();
+	}));
+
+	// only the input activations and runtimes are replaced in the copy, which shares the
+	// parameterization
+	auto input_data = m_input_data;
+	input_data.time_domain_runtimes.set(
+	    grenade::common::TimeDomainOnTopology(), get_time_domain_runtimes(inputs.size()));
+	input_data.ports.set(
+	    {mac.m_input_vertex, 0},
+	    signal_flow::vertex::Transformation::Dynamics(std::move(inputs)));
 
 	// run Graph with given inputs and return results
-	auto const output_activation_map = execution::run(executor, m_topology, input_data);
+	auto const output_activation_map = execution::run(executor, mac.m_topology, input_data);
 
 	hate::Timer output_timer;
 	auto const timed_outputs =
 	    std::get<std::vector<common::TimedDataSequence<std::vector<signal_flow::Int8>>>>(
 	        dynamic_cast<signal_flow::vertex::Transformation::Results const&>(
-	            output_activation_map.ports.get({m_output_vertex, 0}))
+	            output_activation_map.ports.get({mac.m_output_vertex, 0}))
 	            .value);
 	std::vector<std::vector<signal_flow::Int8>> output(timed_outputs.size());
 	for (size_t i = 0; i < output.size(); ++i) {
@@ -570,7 +726,7 @@ std::vector<std::vector<signal_flow::Int8>> MAC::run(
 		output.at(i) = timed_outputs.at(i).at(0).data;
 	}
 
-	if (m_enable_loopback) {
+	if (mac.m_enable_loopback) {
 		boost::accumulators::accumulator_set<
 		    double, boost::accumulators::features<
 		                boost::accumulators::tag::mean, boost::accumulators::tag::variance>>
@@ -617,25 +773,18 @@ std::vector<std::vector<signal_flow::Int8>> MAC::run(
 		                << "mean(" << boost::accumulators::mean(acc) << "), std("
 		                << std::sqrt(boost::accumulators::variance(acc)) << ")" << std::endl);
 	}
-	if (m_madc_recording_path != "" && !m_madc_recording_vertices.empty()) {
-		if (!std::filesystem::exists(m_madc_recording_path)) {
-			std::ofstream file(m_madc_recording_path);
-			assert(file.is_open());
-			file << "ExecutionIndex\tbatch\ttime\tvalue\n";
+	if (mac.m_madc_recording_path != "" && !mac.m_madc_recording_vertices.empty()) {
+		auto sink = mac.m_madc_recording_sink;
+		if (!sink) {
+			sink = std::make_shared<TSVMADCRecordingSink>(mac.m_madc_recording_path);
 		}
-		std::ofstream file(m_madc_recording_path, std::ios_base::app);
-		assert(file.is_open());
-		for (auto [instance, vertex] : m_madc_recording_vertices) {
-			auto const madc_data =
+		for (auto [instance, vertex] : mac.m_madc_recording_vertices) {
+			auto const& madc_data =
 			    dynamic_cast<signal_flow::vertex::MADCReadoutView::Results const&>(
 			        output_activation_map.ports.get({vertex, 0}))
 			        .samples;
 			for (size_t b = 0; b < output_activation_map.batch_size(); ++b) {
-				auto const& local_madc_data = madc_data.at(b);
-				for (auto const& sample : local_madc_data) {
-					file << instance.execution_instance_id.value() << "\t" << b << "\t"
-					     << sample.time.value() << "\t" << sample.data.value.value() << "\n";
-				}
+				sink->write(instance.execution_instance_id, b, madc_data.at(b));
 			}
 		}
 	}
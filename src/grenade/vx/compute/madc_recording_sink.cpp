@@ -0,0 +1,213 @@
+#include "grenade/vx/compute/madc_recording_sink.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <stdexcept>
+
+namespace grenade::vx::compute {
+
+static_assert(sizeof(BinaryMADCRecordingSink::FileHeader) == 32);
+static_assert(sizeof(BinaryMADCRecordingSink::BlockHeader) == 32);
+static_assert(sizeof(BinaryMADCRecordingSink::Record) == 16);
+
+MADCRecordingSink::~MADCRecordingSink() {}
+
+TSVMADCRecordingSink::TSVMADCRecordingSink(std::string const& path)
+{
+	bool const exists = std::filesystem::exists(path);
+	m_file.open(path, std::ios_base::app);
+	if (!m_file.is_open()) {
+		throw std::runtime_error("Opening MADC recording file (" + path + ") failed.");
+	}
+	if (!exists) {
+		m_file << "ExecutionIndex\tbatch\ttime\tvalue\n";
+	}
+}
+
+void TSVMADCRecordingSink::write(
+    grenade::common::ExecutionInstanceID const& execution_instance,
+    size_t const batch_entry,
+    signal_flow::TimedMADCSampleFromChipSequence const& samples)
+{
+	for (auto const& sample : samples) {
+		m_file << execution_instance.value() << "\t" << batch_entry << "\t" << sample.time.value()
+		       << "\t" << sample.data.value.value() << "\n";
+	}
+}
+
+void TSVMADCRecordingSink::flush()
+{
+	m_file.flush();
+}
+
+BinaryMADCRecordingSink::BinaryMADCRecordingSink(std::string const& path, size_t buffer_size) :
+    m_file(),
+    m_buffer_size(buffer_size),
+    m_buffer_mutex(),
+    m_buffer(),
+    m_mutex(),
+    m_condition(),
+    m_queue(),
+    m_busy(false),
+    m_stop(false),
+    m_writer_exception(),
+    m_writer()
+{
+	FileHeader header{};
+	std::memcpy(header.magic, magic, sizeof(magic));
+	header.version = version;
+	header.byte_order_mark = byte_order_mark;
+	header.block_header_size = sizeof(BlockHeader);
+	header.record_size = sizeof(Record);
+
+	if (std::filesystem::exists(path) && std::filesystem::file_size(path) != 0) {
+		std::ifstream file(path, std::ios_base::binary);
+		FileHeader existing_header{};
+		file.read(reinterpret_cast<char*>(&existing_header), sizeof(FileHeader));
+		if (!file || std::memcmp(&existing_header, &header, sizeof(FileHeader)) != 0) {
+			throw std::runtime_error(
+			    "Header of existing MADC recording file (" + path + ") doesn't match.");
+		}
+		m_file.open(path, std::ios_base::binary | std::ios_base::app);
+	} else {
+		m_file.open(path, std::ios_base::binary | std::ios_base::trunc);
+		m_file.write(reinterpret_cast<char const*>(&header), sizeof(FileHeader));
+	}
+	if (!m_file) {
+		throw std::runtime_error("Opening MADC recording file (" + path + ") failed.");
+	}
+
+	m_buffer.reserve(m_buffer_size);
+	m_writer = std::thread([this]() { work(); });
+}
+
+BinaryMADCRecordingSink::~BinaryMADCRecordingSink()
+{
+	{
+		std::lock_guard buffer_lock(m_buffer_mutex);
+		submit();
+	}
+	{
+		std::lock_guard lock(m_mutex);
+		m_stop = true;
+	}
+	m_condition.notify_all();
+	m_writer.join();
+}
+
+void BinaryMADCRecordingSink::write(
+    grenade::common::ExecutionInstanceID const& execution_instance,
+    size_t const batch_entry,
+    signal_flow::TimedMADCSampleFromChipSequence const& samples)
+{
+	rethrow_writer_exception();
+
+	auto const append = [this](auto const& value) {
+		auto const data = reinterpret_cast<char const*>(&value);
+		m_buffer.insert(m_buffer.end(), data, data + sizeof(value));
+	};
+
+	std::lock_guard buffer_lock(m_buffer_mutex);
+	for (auto begin = samples.begin(); begin != samples.end();) {
+		auto const channel = begin->data.channel;
+		auto const end = std::find_if(begin, samples.end(), [channel](auto const& sample) {
+			return sample.data.channel != channel;
+		});
+
+		BlockHeader block_header{};
+		block_header.execution_instance = execution_instance.value();
+		block_header.batch_entry = batch_entry;
+		block_header.channel = channel.value();
+		block_header.num_samples = static_cast<uint64_t>(std::distance(begin, end));
+		append(block_header);
+		for (auto it = begin; it != end; ++it) {
+			Record record{};
+			record.time = it->time.value();
+			record.value = it->data.value.value();
+			append(record);
+		}
+		begin = end;
+	}
+
+	if (m_buffer.size() >= m_buffer_size) {
+		submit();
+	}
+}
+
+void BinaryMADCRecordingSink::flush()
+{
+	{
+		std::lock_guard buffer_lock(m_buffer_mutex);
+		submit();
+	}
+	{
+		std::unique_lock lock(m_mutex);
+		m_condition.wait(lock, [this]() { return m_queue.empty() && !m_busy; });
+	}
+	rethrow_writer_exception();
+}
+
+void BinaryMADCRecordingSink::submit()
+{
+	if (m_buffer.empty()) {
+		return;
+	}
+	{
+		std::lock_guard lock(m_mutex);
+		m_queue.push(std::move(m_buffer));
+	}
+	m_condition.notify_all();
+	m_buffer = std::vector<char>();
+	m_buffer.reserve(m_buffer_size);
+}
+
+void BinaryMADCRecordingSink::work()
+{
+	std::unique_lock lock(m_mutex);
+	while (true) {
+		m_condition.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+		if (m_queue.empty()) {
+			// stop is only requested after the last buffer was submitted
+			return;
+		}
+		auto buffer = std::move(m_queue.front());
+		m_queue.pop();
+		bool const is_last = m_queue.empty();
+		m_busy = true;
+		lock.unlock();
+		std::exception_ptr writer_exception;
+		try {
+			m_file.write(buffer.data(), buffer.size());
+			if (is_last) {
+				m_file.flush();
+			}
+			if (!m_file) {
+				throw std::runtime_error("Writing MADC recording file failed.");
+			}
+		} catch (...) {
+			writer_exception = std::current_exception();
+		}
+		lock.lock();
+		if (writer_exception) {
+			m_writer_exception = writer_exception;
+		}
+		m_busy = false;
+		m_condition.notify_all();
+	}
+}
+
+void BinaryMADCRecordingSink::rethrow_writer_exception()
+{
+	std::exception_ptr writer_exception;
+	{
+		std::lock_guard lock(m_mutex);
+		std::swap(writer_exception, m_writer_exception);
+	}
+	if (writer_exception) {
+		std::rethrow_exception(writer_exception);
+	}
+}
+
+} // namespace grenade::vx::compute
@@ -79,4 +79,10 @@ size_t ReLU::output_size() const
 	return input_size();
 }
 
+std::optional<detail::FusableOperation> ReLU::get_fusable_operation(
+    size_t, lola::vx::v3::Chip const&) const
+{
+	return detail::FusableOperation{m_graph, {}, {m_vertex, 0}, {m_vertex, 0}};
+}
+
 } // namespace grenade::vx::compute
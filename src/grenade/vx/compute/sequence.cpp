@@ -1,6 +1,13 @@
 #include "grenade/vx/compute/sequence.h"
 
+#include "grenade/vx/compute/detail/fusable_operation.h"
 #include "grenade/vx/execution/jit_graph_executor.h"
+#include "grenade/vx/execution/run.h"
+#include "grenade/vx/signal_flow/vertex/transformation.h"
+#include <cassert>
+#include <optional>
+#include <stdexcept>
+#include <vector>
 
 namespace grenade::vx::compute {
 
@@ -22,6 +29,77 @@ struct run_input<F>
 template <auto F>
 using run_input_t = typename run_input<F>::type;
 
+/**
+ * Get input port data of given values without timing information.
+ */
+signal_flow::vertex::Transformation::Dynamics get_dynamics(Sequence::IOData const& values)
+{
+	return std::visit(
+	    [](auto const& v) {
+		    typedef typename std::decay_t<decltype(v)>::value_type Values;
+		    std::vector<common::TimedDataSequence<Values>> timed(v.size());
+		    for (size_t i = 0; i < v.size(); ++i) {
+			    timed.at(i).resize(1);
+			    timed.at(i).at(0).data = v.at(i);
+		    }
+		    return signal_flow::vertex::Transformation::Dynamics(std::move(timed));
+	    },
+	    values);
+}
+
+/**
+ * Extract values of given type from output port data.
+ * @return Whether the port data contains values of given type
+ */
+template <typename T>
+bool get_values(
+    signal_flow::vertex::Transformation::Results const& results, Sequence::IOData& values)
+{
+	auto const timed =
+	    std::get_if<std::vector<common::TimedDataSequence<std::vector<T>>>>(&results.value);
+	if (!timed) {
+		return false;
+	}
+	std::vector<std::vector<T>> ret(timed->size());
+	for (size_t i = 0; i < ret.size(); ++i) {
+		assert(timed->at(i).size() == 1);
+		ret.at(i) = timed->at(i).at(0).data;
+	}
+	values = std::move(ret);
+	return true;
+}
+
+/**
+ * Check that given values are valid input to given entry, which is otherwise done by the entry
+ * when it is run on its own.
+ * @tparam Input Type of input values of entry
+ * @param entry Entry to check input for
+ * @param values Values to check
+ */
+template <typename Input, typename Entry>
+void check_input(Entry const& entry, Sequence::IOData const& values)
+{
+	auto const inputs = std::get_if<Input>(&values);
+	if (!inputs) {
+		throw std::runtime_error("Provided inputs type does not match entry input type.");
+	}
+
+	if (inputs->empty()) {
+		throw std::runtime_error("Provided inputs are empty.");
+	}
+
+	size_t const batch_entry_size = inputs->front().size();
+	for (auto const& batch_entry : *inputs) {
+		if (batch_entry.size() != batch_entry_size) {
+			throw std::runtime_error("Provided batch entries don't share a common size.");
+		}
+	}
+
+	if (batch_entry_size != entry.input_size()) {
+		throw std::runtime_error("Provided inputs size does not match entry input size.");
+	}
+}
+
 } // namespace detail
 
 Sequence::IOData Sequence::run(
@@ -35,13 +113,58 @@ Sequence::IOData Sequence::run(
 
 	IOData tmp = input;
 
-	auto const visit_entry = [&](auto const& e) -> IOData {
+	// consecutive fusable entries are executed together in a single topology, which avoids
+	// transferring intermediate results to the host between the entries
+	std::vector<detail::FusableOperation> operations;
+	size_t operations_position = 0;
+	auto const run_operations = [&]() {
+		if (operations.empty()) {
+			return;
+		}
+		// the operations of the entries share their parameterization between runs, comparing them
+		// to the operations of the previous run is therefore cheap
+		auto& fused_operation = m_fused_operations[operations_position];
+		if (fused_operation.operations != operations) {
+			fused_operation.fused = detail::fuse(operations);
+			fused_operation.operations = std::move(operations);
+		}
+		operations.clear();
+		// only the input values are replaced in the copy, which shares all other data
+		auto input_data = fused_operation.fused.input_data;
+		input_data.ports.set(fused_operation.fused.input, detail::get_dynamics(tmp));
+		auto const output_data =
+		    execution::run(executor, fused_operation.fused.topology, input_data);
+		auto const& results = dynamic_cast<signal_flow::vertex::Transformation::Results const&>(
+		    output_data.ports.get(fused_operation.fused.output));
+		if (!detail::get_values<signal_flow::UInt5>(results, tmp) &&
+		    !detail::get_values<signal_flow::Int8>(results, tmp) &&
+		    !detail::get_values<signal_flow::UInt32>(results, tmp)) {
+			throw std::logic_error("Output type of compute sequence entry not supported.");
+		}
+	};
+
+	size_t position = 0;
+	auto const visit_entry = [&](auto const& e) {
 		typedef detail::run_input_t<&std::decay_t<decltype(e)>::run> Input;
-		return e.run(std::get<Input>(tmp), config, executor);
+		size_t const batch_size = std::visit([](auto const& v) { return v.size(); }, tmp);
+		if (auto operation = e.get_fusable_operation(batch_size, config); operation) {
+			// the first operation receives the input values, the connections between the
+			// following operations are checked on fusing
+			if (operations.empty()) {
+				detail::check_input<Input>(e, tmp);
+				operations_position = position;
+			}
+			operations.push_back(std::move(*operation));
+			return;
+		}
+		run_operations();
+		tmp = e.run(std::get<Input>(tmp), config, executor);
 	};
 	for (auto const& entry : data) {
-		tmp = std::visit(visit_entry, entry);
+		std::visit(visit_entry, entry);
+		position++;
 	}
+	run_operations();
 	return tmp;
 }
 
@@ -8,10 +8,13 @@
 #include "grenade/vx/execution/detail/generator/get_state.h"
 #include "grenade/vx/execution/detail/generator/ppu.h"
 #include "hate/timer.h"
+#include <chrono>
 #include <functional>
 #include <mutex>
 #include <ranges>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace grenade::vx::execution::backend {
 
@@ -168,6 +171,7 @@ RunTimeInfo run(StatefulConnection& connection, PlaybackProgram& program)
 	    chips_on_connection.size(), std::chrono::nanoseconds{0});
 
 	bool runs_successful = true;
+	std::vector<RunTimeInfo::Chunk> chunks;
 
 
 	// Execution of base programs and realtime snippets
@@ -249,6 +253,9 @@ RunTimeInfo run(StatefulConnection& connection, PlaybackProgram& program)
 
 		// Execute realtime sections
 		for (auto& real_time_section : realtime_sections) {
+			RunTimeInfo::Chunk chunk;
+			chunk.begin = std::chrono::steady_clock::now();
+			auto const time_info_before = connection.get_time_info();
 			try {
 				run(connection.m_initialized_connection, real_time_section);
 			} catch (std::runtime_error const& error) {
@@ -256,6 +263,19 @@ RunTimeInfo run(StatefulConnection& connection, PlaybackProgram& program)
 				    logger, "Run of playback program not successful: " << error.what() << ".");
 				runs_successful = false;
 			}
+			auto const time_info_after = connection.get_time_info();
+			for (size_t i = 0; i < chips_on_connection.size(); i++) {
+				auto& time_info = chunk.time_info[chips_on_connection.at(i)];
+				time_info.encode_duration =
+				    time_info_after.at(i).encode_duration - time_info_before.at(i).encode_duration;
+				time_info.decode_duration =
+				    time_info_after.at(i).decode_duration - time_info_before.at(i).decode_duration;
+				time_info.commit_duration =
+				    time_info_after.at(i).commit_duration - time_info_before.at(i).commit_duration;
+				time_info.execution_duration = time_info_after.at(i).execution_duration -
+				                               time_info_before.at(i).execution_duration;
+			}
+			chunks.push_back(std::move(chunk));
 		}
 
 		// If the PPUs (can) alter state, read it back to update current_config accordingly to
@@ -335,6 +355,7 @@ RunTimeInfo run(StatefulConnection& connection, PlaybackProgram& program)
 	}
 
 	RunTimeInfo ret;
+	ret.chunks = std::move(chunks);
 	for (size_t i = 0; i < chips_on_connection.size(); i++) {
 		ret.execution_duration[chips_on_connection.at(i)] =
 		    connection_execution_duration_after.at(i) - connection_execution_duration_before.at(i);
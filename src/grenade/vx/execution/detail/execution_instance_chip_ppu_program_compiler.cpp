@@ -7,9 +7,11 @@
 #include "grenade/vx/execution/backend/playback_program.h"
 #include "grenade/vx/execution/detail/execution_instance_chip_snippet_ppu_usage_visitor.h"
 #include "grenade/vx/execution/detail/execution_instance_chip_snippet_realtime_executor.h"
+#include "grenade/vx/execution/detail/generator/ppu.h"
 #include "grenade/vx/execution/detail/ppu_program_generator.h"
 #include "grenade/vx/network/abstract/clock_cycle_time_domain_runtimes.h"
 #include "grenade/vx/ppu.h"
+#include "grenade/vx/ppu/detail/snapshot.h"
 #include "grenade/vx/ppu/detail/status.h"
 #include "grenade/vx/signal_flow/vertex/pad_readout.h"
 #include "grenade/vx/signal_flow/vertex/plasticity_rule.h"
@@ -217,6 +219,12 @@ ExecutionInstanceChipPPUProgramCompiler::operator()() const
 				estimated_cadc_recording_size = maximal_size;
 			}
 			ppu_program_generator.num_periodic_cadc_samples = estimated_cadc_recording_size;
+			if (auto const& aggregation =
+			        m_hooks.chips.at(m_chip_on_connection).read_ppu_symbols_aggregation;
+			    aggregation) {
+				ppu_program_generator.has_snapshot = true;
+				ppu_program_generator.snapshot_buffer_size = aggregation->buffer_size_in_bytes;
+			}
 			// TODO: move to execution::detail namespace
 			CachingCompiler compiler;
 			auto program = compiler.compile(ppu_program_generator.done());
@@ -238,6 +246,30 @@ ExecutionInstanceChipPPUProgramCompiler::operator()() const
 		}
 		LOG4CXX_TRACE(logger, "Generated PPU program in " << ppu_timer.print() << ".");
 
+		// regions of PPU symbols to copy into the snapshot buffer for aggregated reads
+		std::optional<PPUMemoryBlock> snapshot_regions;
+		std::optional<PPUMemoryBlockOnPPU> snapshot_regions_coord;
+		PPUMemoryWordOnPPU snapshot_num_regions_coord;
+		size_t snapshot_num_regions = 0;
+		if (m_hooks.chips.at(m_chip_on_connection).read_ppu_symbols_aggregation) {
+			generator::PPUSnapshotLayout const layout(
+			    m_hooks.chips.at(m_chip_on_connection).read_ppu_symbols, *result.symbols);
+			snapshot_regions_coord =
+			    std::get<PPUMemoryBlockOnPPU>(result.symbols->at("snapshot_regions").coordinate);
+			snapshot_num_regions_coord =
+			    std::get<PPUMemoryBlockOnPPU>(result.symbols->at("snapshot_num_regions").coordinate)
+			        .toMin();
+			snapshot_regions = PPUMemoryBlock(snapshot_regions_coord->toPPUMemoryBlockSize());
+			snapshot_num_regions = layout.regions.size();
+			size_t w = 0;
+			for (auto const& [_, coord] : layout.regions) {
+				snapshot_regions->at(w++) = PPUMemoryWord(PPUMemoryWord::Value(
+				    coord.toMin().value() * sizeof(PPUMemoryWord::raw_type)));
+				snapshot_regions->at(w++) = PPUMemoryWord(PPUMemoryWord::Value(
+				    coord.toPPUMemoryBlockSize().value() * sizeof(PPUMemoryWord::raw_type)));
+			}
+		}
+
 		for (size_t i = 0; i < snippet_count; i++) {
 			for (auto const ppu : iter_all<PPUOnDLS>()) {
 				// set neuron reset mask
@@ -253,6 +285,13 @@ ExecutionInstanceChipPPUProgramCompiler::operator()() const
 				// set PPU location
 				result.internal[i][ppu].at(ppu_location_coord) =
 				    PPUMemoryWord(PPUMemoryWord::Value(ppu.value()));
+				// set snapshot regions
+				if (snapshot_regions) {
+					result.internal[i][ppu].set_subblock(
+					    snapshot_regions_coord->toMin(), *snapshot_regions);
+					result.internal[i][ppu].at(snapshot_num_regions_coord) =
+					    PPUMemoryWord(PPUMemoryWord::Value(snapshot_num_regions));
+				}
 			}
 
 			// inject playback-hook PPU symbols to be overwritten
@@ -77,6 +77,15 @@ std::vector<grenade::common::OutputData> ExecutionInstanceExecutor::PostProcesso
 			    .read_ppu_symbols.at(b)[chip_on_connection] =
 			    chip.ppu_read_hooks_results.at(b).evaluate();
 		}
+		// merge aggregated PPU symbol snapshots, which are ordered like the batch entries
+		for (size_t b = 0; auto const& ppu_snapshot_result : chip.ppu_snapshot_results) {
+			for (auto&& snapshot : ppu_snapshot_result.evaluate()) {
+				results_global.at(num_realtime_snippets - 1)
+				    .read_ppu_symbols.at(b)[chip_on_connection]
+				    .merge(std::move(snapshot));
+				b++;
+			}
+		}
 
 		for (size_t i = 0; i < chip.health_info_results_pre.size(); ++i) {
 			execution_health_info.chips[chip_on_connection] +=
@@ -85,8 +94,12 @@ std::vector<grenade::common::OutputData> ExecutionInstanceExecutor::PostProcesso
 		}
 	}
 
-	// annotate execution health info
-	results_global.at(num_realtime_snippets - 1).execution_health_info = execution_health_info;
+	// annotate execution health info accumulated over the sampled chunks
+	if (enable_health_info) {
+		execution_health_info.num_sampled_chunks = num_sampled_chunks;
+		execution_health_info.num_chunks = num_chunks;
+		results_global.at(num_realtime_snippets - 1).execution_health_info = execution_health_info;
+	}
 
 	for (size_t i = 0; i < num_realtime_snippets; i++) {
 		results.at(i).execution_instances.set(execution_instance, results_global.at(i));
@@ -102,13 +115,17 @@ ExecutionInstanceExecutor::ExecutionInstanceExecutor(
     std::vector<grenade::common::OutputData>& output_data,
     std::vector<std::reference_wrapper<grenade::common::InputData const>> const& input_data,
     ExecutionInstanceHooks& hooks,
-    std::vector<common::ChipOnConnection> const& chips_on_connection) :
+    std::vector<common::ChipOnConnection> const& chips_on_connection,
+    HealthInfoSampling const& health_info_sampling,
+    Profiler* profiler) :
     m_topologies(topologies),
     m_execution_instance_vertex_descriptors(execution_instance_vertex_descriptors),
     m_output_data(output_data),
     m_input_data(input_data),
     m_hooks(hooks),
-    m_chips_on_connection(chips_on_connection)
+    m_chips_on_connection(chips_on_connection),
+    m_health_info_sampling(health_info_sampling),
+    m_profiler(profiler)
 {
 }
 
@@ -129,6 +146,16 @@ ExecutionInstanceExecutor::operator()(
 	     1));
 	size_t const snippet_count = m_output_data.size();
 
+	auto const first_topology_strong_component_invariant_ptr =
+	    m_topologies.at(0)
+	        ->get(m_execution_instance_vertex_descriptors.at(0))
+	        .get_strong_component_invariant();
+	assert(first_topology_strong_component_invariant_ptr);
+	auto const& execution_instance =
+	    dynamic_cast<grenade::common::PartitionedVertex::StrongComponentInvariant const&>(
+	        *first_topology_strong_component_invariant_ptr)
+	        .execution_instance_on_executor.value();
+
 	hate::Timer const configs_timer;
 
 	backend::PlaybackProgram playback_program;
@@ -151,6 +178,13 @@ ExecutionInstanceExecutor::operator()(
 
 		playback_program.chips.at(chip_on_connection).system_configs.reserve(snippet_count);
 		for (size_t j = 0; j < snippet_count; j++) {
+			ExecutionProfile::Span span;
+			span.phase = ExecutionProfile::Phase::program_build;
+			span.execution_instance = execution_instance;
+			span.chip = chip_on_connection;
+			span.snippet = j;
+			Profiler::Scope const profiler_scope(m_profiler, std::move(span));
+
 			if (std::holds_alternative<hwdb4cpp::HXCubeSetupEntry>(
 			        chip_hwdb_entries.at(chip_on_connection))) {
 				playback_program.chips.at(chip_on_connection)
@@ -211,6 +245,12 @@ ExecutionInstanceExecutor::operator()(
 			    playback_program.chips.at(chip_on_connection).system_configs.at(j));
 		}
 
+		ExecutionProfile::Span span;
+		span.phase = ExecutionProfile::Phase::ppu_compile;
+		span.execution_instance = execution_instance;
+		span.chip = chip_on_connection;
+		Profiler::Scope const profiler_scope(m_profiler, std::move(span));
+
 		auto const ppu_program = ExecutionInstanceChipPPUProgramCompiler(
 		    m_topologies, m_execution_instance_vertex_descriptors, m_input_data, m_hooks,
 		    chip_on_connection)();
@@ -218,23 +258,21 @@ ExecutionInstanceExecutor::operator()(
 		ppu_programs[chip_on_connection] = ppu_program;
 	}
 
+	ExecutionProfile::Span span;
+	span.phase = ExecutionProfile::Phase::program_build;
+	span.execution_instance = execution_instance;
+	// covers construction of the realtime program and the assembly of the batch entries
+	Profiler::Scope const profiler_scope(m_profiler, std::move(span));
+
 	auto [realtime_program, realtime_post_processor] = ExecutionInstanceRealtimeExecutor(
 	    m_topologies, m_execution_instance_vertex_descriptors, m_input_data, m_output_data,
 	    ppu_programs, m_chips_on_connection)();
 
-	auto const first_topology_strong_component_invariant_ptr =
-	    m_topologies.at(0)
-	        ->get(m_execution_instance_vertex_descriptors.at(0))
-	        .get_strong_component_invariant();
-	assert(first_topology_strong_component_invariant_ptr);
-	auto const& execution_instance =
-	    dynamic_cast<grenade::common::PartitionedVertex::StrongComponentInvariant const&>(
-	        *first_topology_strong_component_invariant_ptr)
-	        .execution_instance_on_executor.value();
-
 	PostProcessor post_processor;
 	post_processor.execution_instance = execution_instance;
 	post_processor.realtime = std::move(realtime_post_processor);
+	post_processor.enable_health_info =
+	    m_health_info_sampling.mode != HealthInfoSampling::Mode::off;
 
 	// are all equal, use first one
 	size_t const batch_size = m_input_data.at(0).get().batch_size();
@@ -263,6 +301,20 @@ ExecutionInstanceExecutor::operator()(
 		}
 	}
 
+	// Layouts of PPU symbol snapshots for aggregated readout
+	std::map<common::ChipOnConnection, generator::PPUSnapshotLayout> ppu_snapshot_layouts;
+	for (auto const& chip_on_connection : m_chips_on_connection) {
+		auto const& local_playback_program = playback_program.chips.at(chip_on_connection);
+		if (m_hooks.chips.at(chip_on_connection).read_ppu_symbols_aggregation &&
+		    local_playback_program.ppu_symbols) {
+			ppu_snapshot_layouts.emplace(
+			    chip_on_connection,
+			    generator::PPUSnapshotLayout(
+			        m_hooks.chips.at(chip_on_connection).read_ppu_symbols,
+			        *local_playback_program.ppu_symbols));
+		}
+	}
+
 	// Experiment assembly
 	std::vector<std::map<common::ChipOnConnection, PlaybackProgramBuilder>> assembled_builders;
 	for (size_t i = 0; i < batch_size; i++) {
@@ -407,12 +459,37 @@ ExecutionInstanceExecutor::operator()(
 			}
 			// append PPU read hooks
 			if (local_playback_program.ppu_symbols) {
-				auto [ppu_read_hooks_builder, ppu_read_hooks_result] =
-				    generate(generator::PPUReadHooks(
-				        local_hooks.read_ppu_symbols, *local_playback_program.ppu_symbols));
-				assembled_builder.merge_back(ppu_read_hooks_builder);
-				post_processor.chips[chip_on_connection].ppu_read_hooks_results.push_back(
-				    std::move(ppu_read_hooks_result));
+				auto const& symbols = *local_playback_program.ppu_symbols;
+				// symbols in PPU-internal memory are aggregated in the snapshot buffer and read in
+				// bulk once it is full or after the last batch entry
+				auto const ppu_snapshot_layout = ppu_snapshot_layouts.find(chip_on_connection);
+				if (ppu_snapshot_layout != ppu_snapshot_layouts.end()) {
+					auto const& layout = ppu_snapshot_layout->second;
+					auto [ppu_read_hooks_builder, ppu_read_hooks_result] = generate(
+					    generator::PPUReadHooks(layout.remaining_symbol_names, symbols));
+					assembled_builder.merge_back(ppu_read_hooks_builder);
+					post_processor.chips[chip_on_connection].ppu_read_hooks_results.push_back(
+					    std::move(ppu_read_hooks_result));
+					if (layout.capacity > 0) {
+						size_t const index = i % layout.capacity;
+						assembled_builder.merge_back(
+						    generate(generator::PPUSnapshot(index, symbols)).builder);
+						if (index == layout.capacity - 1 || i == batch_size - 1) {
+							auto [ppu_read_snapshots_builder, ppu_read_snapshots_result] =
+							    generate(generator::PPUReadSnapshots(layout, index + 1, symbols));
+							assembled_builder.merge_back(ppu_read_snapshots_builder);
+							post_processor.chips[chip_on_connection]
+							    .ppu_snapshot_results.push_back(
+							        std::move(ppu_read_snapshots_result));
+						}
+					}
+				} else {
+					auto [ppu_read_hooks_builder, ppu_read_hooks_result] =
+					    generate(generator::PPUReadHooks(local_hooks.read_ppu_symbols, symbols));
+					assembled_builder.merge_back(ppu_read_hooks_builder);
+					post_processor.chips[chip_on_connection].ppu_read_hooks_results.push_back(
+					    std::move(ppu_read_hooks_result));
+				}
 			}
 			// wait for response data
 			assembled_builder.block_until(BarrierOnFPGA(), haldls::vx::v3::Barrier::omnibus);
@@ -531,7 +608,12 @@ ExecutionInstanceExecutor::operator()(
 	// chunk builders into maximally-sized builders, add pre & post measurements
 	std::vector<std::map<common::ChipOnConnection, PlaybackProgramBuilder>>
 	    chunked_assembled_builders;
-	size_t const pre_size_to_fpga = generate(generator::HealthInfo()).builder.done().size_to_fpga();
+	// space for the measurements is reserved in every chunk, since whether a chunk is sampled is
+	// only known after chunking
+	size_t const pre_size_to_fpga =
+	    post_processor.enable_health_info
+	        ? generate(generator::HealthInfo()).builder.done().size_to_fpga()
+	        : 0;
 	size_t const post_size_to_fpga = pre_size_to_fpga;
 	std::map<common::ChipOnConnection, PlaybackProgramBuilder> chunked_assembled_builder;
 	for (auto& assembled_builders_per_chip : assembled_builders) {
@@ -555,29 +637,46 @@ ExecutionInstanceExecutor::operator()(
 		chunked_assembled_builders.emplace_back(std::move(chunked_assembled_builder));
 	}
 
-	// add pre and post measurements and construct finalized playback programs
-	for (auto& chunked_assembled_builder_per_chip : chunked_assembled_builders) {
+	// add pre and post measurements of sampled chunks and construct finalized playback programs
+	size_t const num_chunks = chunked_assembled_builders.size();
+	// the counters are cumulative, therefore the first and last chunk are measured as a single
+	// interval from before the first to after the last chunk, which covers all chunks
+	bool const is_single_interval =
+	    m_health_info_sampling.mode == HealthInfoSampling::Mode::first_and_last;
+	post_processor.num_chunks = num_chunks;
+	for (size_t chunk = 0; auto& chunked_assembled_builder_per_chip : chunked_assembled_builders) {
+		bool const is_sampled = m_health_info_sampling.is_sampled(chunk, num_chunks);
+		bool const is_measured_pre = is_single_interval ? (chunk == 0) : is_sampled;
+		bool const is_measured_post = is_single_interval ? (chunk + 1 == num_chunks) : is_sampled;
+		if (is_single_interval || is_sampled) {
+			post_processor.num_sampled_chunks++;
+		}
 		for (auto& [chip_on_connection, chunked_assembled_builder] :
 		     chunked_assembled_builder_per_chip) {
 			PlaybackProgramBuilder final_builder;
 
-			auto [health_info_builder_pre, health_info_result_pre] =
-			    generate(generator::HealthInfo());
-			post_processor.chips[chip_on_connection].health_info_results_pre.push_back(
-			    health_info_result_pre);
-			final_builder.merge_back(health_info_builder_pre.done());
-			final_builder.block_until(BarrierOnFPGA(), haldls::vx::v3::Barrier::omnibus);
+			if (is_measured_pre) {
+				auto [health_info_builder_pre, health_info_result_pre] =
+				    generate(generator::HealthInfo());
+				post_processor.chips[chip_on_connection].health_info_results_pre.push_back(
+				    health_info_result_pre);
+				final_builder.merge_back(health_info_builder_pre.done());
+				final_builder.block_until(BarrierOnFPGA(), haldls::vx::v3::Barrier::omnibus);
+			}
 
 			final_builder.merge_back(chunked_assembled_builder);
 
-			auto [health_info_builder_post, health_info_result_post] =
-			    generate(generator::HealthInfo());
-			post_processor.chips[chip_on_connection].health_info_results_post.push_back(
-			    health_info_result_post);
-			final_builder.merge_back(health_info_builder_post.done());
-			final_builder.block_until(BarrierOnFPGA(), haldls::vx::v3::Barrier::omnibus);
+			if (is_measured_post) {
+				auto [health_info_builder_post, health_info_result_post] =
+				    generate(generator::HealthInfo());
+				post_processor.chips[chip_on_connection].health_info_results_post.push_back(
+				    health_info_result_post);
+				final_builder.merge_back(health_info_builder_post.done());
+				final_builder.block_until(BarrierOnFPGA(), haldls::vx::v3::Barrier::omnibus);
+			}
 			playback_program.chips[chip_on_connection].programs.emplace_back(final_builder.done());
 		}
+		chunk++;
 	}
 
 	return {std::move(playback_program), std::move(post_processor)};
@@ -20,7 +20,9 @@
 #include "haldls/vx/v3/omnibus_constants.h"
 #include "haldls/vx/v3/timer.h"
 #include "hate/timer.h"
+#include <chrono>
 #include <mutex>
+#include <utility>
 #include <log4cxx/logger.h>
 
 namespace grenade::vx::execution::detail {
@@ -33,7 +35,9 @@ ExecutionInstanceNode::ExecutionInstanceNode(
     std::vector<std::reference_wrapper<grenade::common::InputData const>> const& input_data,
     backend::StatefulConnection& connection,
     ExecutionInstanceHooks& hooks,
-    std::vector<grenade::common::VertexOnTopology> const& execution_instance_vertex_descriptors) :
+    std::vector<grenade::common::VertexOnTopology> const& execution_instance_vertex_descriptors,
+    HealthInfoSampling const& health_info_sampling,
+    Profiler& profiler) :
     output_data(output_data),
     results_mutex(results_mutex),
     topologies(topologies),
@@ -42,6 +46,8 @@ ExecutionInstanceNode::ExecutionInstanceNode(
     connection(connection),
     hooks(hooks),
     execution_instance_vertex_descriptors(execution_instance_vertex_descriptors),
+    health_info_sampling(health_info_sampling),
+    profiler(profiler),
     logger(log4cxx::Logger::getLogger("grenade.ExecutionInstanceNode"))
 {}
 
@@ -55,7 +61,7 @@ void ExecutionInstanceNode::operator()(tbb::flow::continue_msg)
 
 	ExecutionInstanceExecutor executor(
 	    topologies, execution_instance_vertex_descriptors, output_data, input_data, hooks,
-	    connection.get_chips_on_connection());
+	    connection.get_chips_on_connection(), health_info_sampling, &profiler);
 
 	hate::Timer const compile_timer;
 
@@ -83,11 +89,51 @@ void ExecutionInstanceNode::operator()(tbb::flow::continue_msg)
 		run_successful = false;
 	}
 
-	auto local_results = post_processor(std::move(playback_program));
+	// the connection only provides the accumulated durations per phase of each chunk, their
+	// spans are therefore placed back-to-back from the begin of the chunk and marked as
+	// synthesized.
+	if (profiler.get_enabled()) {
+		for (size_t i = 0; auto const& chunk : run_time_info.chunks) {
+			for (auto const& [chip_on_connection, time_info] : chunk.time_info) {
+				auto begin = chunk.begin;
+				for (auto const& [phase, duration] :
+				     {std::pair{ExecutionProfile::Phase::encode, time_info.encode_duration},
+				      std::pair{ExecutionProfile::Phase::transfer, time_info.commit_duration},
+				      std::pair{ExecutionProfile::Phase::wait, time_info.execution_duration},
+				      std::pair{ExecutionProfile::Phase::decode, time_info.decode_duration}}) {
+					ExecutionProfile::Span span;
+					span.phase = phase;
+					span.execution_instance = execution_instance;
+					span.chip = chip_on_connection;
+					span.chunk = i;
+					span.synthesized = true;
+					auto const end = begin + std::chrono::duration_cast<
+					                             Profiler::clock_type::duration>(duration);
+					profiler.record(std::move(span), begin, end);
+					begin = end;
+				}
+			}
+			i++;
+		}
+	}
+
+	std::vector<grenade::common::OutputData> local_results;
+	{
+		ExecutionProfile::Span span;
+		span.phase = ExecutionProfile::Phase::post_process;
+		span.execution_instance = execution_instance;
+		Profiler::Scope const profiler_scope(&profiler, std::move(span));
+		local_results = post_processor(std::move(playback_program));
+	}
 
 	// alter global results
 	std::lock_guard lock(results_mutex);
 
+	ExecutionProfile::Span span;
+	span.phase = ExecutionProfile::Phase::merge;
+	span.execution_instance = execution_instance;
+	Profiler::Scope const profiler_scope(&profiler, std::move(span));
+
 	// add execution duration per hardware to result data map
 	if (!local_results.at(local_results.size() - 1)
 	         .execution_instances.contains(execution_instance)) {
@@ -1,6 +1,5 @@
 #include "grenade/vx/execution/detail/execution_instance_snippet_realtime_executor.h"
 
-#include "grenade/common/multi_index_sequence/cuboid.h"
 #include "grenade/common/port_data.h"
 #include "grenade/common/port_on_topology.h"
 #include "grenade/vx/common/chip_on_connection.h"
@@ -8,6 +7,7 @@
 #include "grenade/vx/execution/detail/generator/madc.h"
 #include "grenade/vx/execution/detail/generator/ppu.h"
 #include "grenade/vx/execution/detail/generator/timed_spike_to_chip_sequence.h"
+#include "grenade/vx/execution/detail/host_execution.h"
 #include "grenade/vx/ppu.h"
 #include "grenade/vx/ppu/detail/extmem.h"
 #include "grenade/vx/ppu/detail/status.h"
@@ -135,86 +135,41 @@ template <>
 void ExecutionInstanceSnippetRealtimeExecutor::process(
     grenade::common::VertexOnTopology const vertex, signal_flow::vertex::Transformation const& data)
 {
-	// fill input value
-	auto const input_ports = data.get_input_ports();
-	std::vector<std::optional<std::reference_wrapper<grenade::common::PortData const>>>
-	    value_input_optional(input_ports.size());
-	// use list for stability of element location in memory
-	std::list<signal_flow::vertex::Transformation::Dynamics> value_input_storage;
-	for (size_t input_port_on_vertex = 0; input_port_on_vertex < input_ports.size();
-	     ++input_port_on_vertex) {
-		if (m_input_data.ports.contains({vertex, input_port_on_vertex})) {
-			value_input_optional.at(input_port_on_vertex) =
-			    std::cref(m_input_data.ports.get({vertex, input_port_on_vertex}));
-		}
-	}
-	for (auto const& in_edge_descriptor : m_topology.get_reference().in_edges(vertex)) {
-		auto const& in_edge = m_topology.get_reference().get(in_edge_descriptor);
-		if (in_edge.get_channels_on_target().size() !=
-		    input_ports.at(in_edge.port_on_target).get_channels().size()) {
-			throw std::logic_error("Edge with port restriction unsupported.");
-		}
-		auto const& source_descriptor = m_topology.get_reference().source(in_edge_descriptor);
-		auto const& source = m_topology.get_reference().get(source_descriptor);
-		auto const source_port = source.get_output_ports().at(in_edge.port_on_source);
-		assert(m_data);
-		auto const& source_results =
-		    m_data->at(grenade::common::PortOnTopology{source_descriptor, in_edge.port_on_source});
-		if (auto const crossbar_l2_output_results =
-		        dynamic_cast<signal_flow::vertex::CrossbarL2Output::Results const*>(
-		            &source_results);
-		    crossbar_l2_output_results) {
-			value_input_storage.push_back(
-			    signal_flow::vertex::Transformation::Dynamics(crossbar_l2_output_results->spikes));
-		} else if (auto const madc_results =
-		               dynamic_cast<signal_flow::vertex::MADCReadoutView::Results const*>(
-		                   &source_results);
-		           madc_results) {
-			value_input_storage.push_back(
-			    signal_flow::vertex::Transformation::Dynamics(madc_results->samples));
-		} else if (auto const cadc_results =
-		               dynamic_cast<signal_flow::vertex::CADCMembraneReadoutView::Results const*>(
-		                   &source_results);
-		           cadc_results) {
-			value_input_storage.push_back(
-			    signal_flow::vertex::Transformation::Dynamics(cadc_results->samples));
-		} else if (auto const transformation_results =
-		               dynamic_cast<signal_flow::vertex::Transformation::Results const*>(
+	auto const& topology = m_topology.get_reference();
+	assert(m_data);
+	auto value_output = apply_transformation(
+	    vertex, data, topology, m_input_data,
+	    [&](grenade::common::EdgeOnTopology const& in_edge_descriptor) {
+		    auto const& source_results = m_data->at(grenade::common::PortOnTopology{
+		        topology.source(in_edge_descriptor),
+		        topology.get(in_edge_descriptor).port_on_source});
+		    if (auto const crossbar_l2_output_results =
+		            dynamic_cast<signal_flow::vertex::CrossbarL2Output::Results const*>(
+		                &source_results);
+		        crossbar_l2_output_results) {
+			    return signal_flow::vertex::Transformation::Dynamics(
+			        crossbar_l2_output_results->spikes);
+		    } else if (auto const madc_results =
+		                   dynamic_cast<signal_flow::vertex::MADCReadoutView::Results const*>(
+		                       &source_results);
+		               madc_results) {
+			    return signal_flow::vertex::Transformation::Dynamics(madc_results->samples);
+		    } else if (auto const cadc_results = dynamic_cast<
+		                   signal_flow::vertex::CADCMembraneReadoutView::Results const*>(
 		                   &source_results);
-		           transformation_results) {
-			value_input_storage.push_back(signal_flow::vertex::Transformation::Dynamics(
-			    transformation_results
-			        ->get_section(
-			            *grenade::common::CuboidMultiIndexSequence(
-			                 {source_port.get_channels().size()})
-			                 .related_sequence_subset_restriction(
-			                     source_port.get_channels(), in_edge.get_channels_on_source()))
-			        ->value));
-		} else {
-			throw std::logic_error("Input data type not supported.");
-		}
-		value_input_optional.at(in_edge.port_on_target) = std::cref(value_input_storage.back());
-	}
-	if (!std::all_of(value_input_optional.begin(), value_input_optional.end(), [](auto const& o) {
-		    return static_cast<bool>(o);
-	    })) {
-		std::stringstream ss;
-		ss << "Not all input to transformation is provided:\n";
-		ss << vertex << ": " << data;
-		throw std::runtime_error(ss.str());
-	}
-	std::vector<std::reference_wrapper<grenade::common::PortData const>> value_input;
-	for (auto const& vo : value_input_optional) {
-		value_input.push_back(*vo);
-	}
-
-	// execute transformation
-	auto value_output = data.get_function().apply(value_input);
+		               cadc_results) {
+			    return signal_flow::vertex::Transformation::Dynamics(cadc_results->samples);
+		    } else if (auto const transformation_results =
+		                   dynamic_cast<signal_flow::vertex::Transformation::Results const*>(
+		                       &source_results);
+		               transformation_results) {
+			    return get_edge_section(*transformation_results, topology, in_edge_descriptor);
+		    }
+		    throw std::logic_error("Input data type not supported.");
+	    });
 	// process output value
 	for (size_t i = 0; i < value_output.size(); ++i) {
-		m_data->insert(
-		    grenade::common::PortOnTopology{vertex, i},
-		    signal_flow::vertex::Transformation::Results(std::move(value_output.at(i))));
+		m_data->insert(grenade::common::PortOnTopology{vertex, i}, std::move(value_output.at(i)));
 	}
 }
 
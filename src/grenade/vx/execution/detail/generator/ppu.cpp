@@ -1,6 +1,7 @@
 #include "grenade/vx/execution/detail/generator/ppu.h"
 
 #include "grenade/vx/ppu.h"
+#include "grenade/vx/ppu/detail/snapshot.h"
 #include "halco/common/iter_all.h"
 #include "halco/hicann-dls/vx/v3/fpga.h"
 #include "halco/hicann-dls/vx/v3/ppu.h"
@@ -8,6 +9,9 @@
 #include "haldls/vx/v3/block.h"
 #include "haldls/vx/v3/ppu.h"
 #include "hate/variant.h"
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
 #include <log4cxx/logger.h>
 
 namespace grenade::vx::execution::detail::generator {
@@ -197,6 +201,175 @@ PPUReadHooks::generate() const
 }
 
 
+PPUSnapshotLayout::PPUSnapshotLayout(
+    std::set<std::string> const& symbol_names,
+    lola::vx::v3::PPUElfFile::symbols_type const& symbols) :
+    regions(), size_in_bytes(0), capacity(0), remaining_symbol_names()
+{
+	for (auto const& name : symbol_names) {
+		if (!symbols.contains(name)) {
+			throw std::runtime_error("Provided unknown symbol name via ExecutionInstanceHooks.");
+		}
+		if (auto const coord = std::get_if<PPUMemoryBlockOnPPU>(&symbols.at(name).coordinate);
+		    coord) {
+			regions.push_back({name, *coord});
+			size_in_bytes +=
+			    coord->toPPUMemoryBlockSize().value() * sizeof(PPUMemoryWord::raw_type);
+		} else {
+			remaining_symbol_names.insert(name);
+		}
+	}
+	if (regions.size() > ppu::detail::max_num_snapshot_regions) {
+		throw std::runtime_error(
+		    "Number of PPU symbols to aggregate (" + std::to_string(regions.size()) +
+		    ") exceeds maximum (" + std::to_string(ppu::detail::max_num_snapshot_regions) + ").");
+	}
+	if (regions.empty()) {
+		return;
+	}
+	auto const buffer_coord =
+	    std::get<ExternalPPUDRAMMemoryBlockOnFPGA>(symbols.at("snapshot_buffer_top").coordinate);
+	size_t const buffer_size = buffer_coord.toMax().value() - buffer_coord.toMin().value() + 1;
+	capacity = buffer_size / size_in_bytes;
+	if (capacity == 0) {
+		throw std::runtime_error(
+		    "PPU symbol snapshot buffer (" + std::to_string(buffer_size) +
+		    " B) doesn't fit a single snapshot (" + std::to_string(size_in_bytes) + " B).");
+	}
+}
+
+
+stadls::vx::PlaybackGeneratorReturn<PPUSnapshot::Builder, PPUSnapshot::Result>
+PPUSnapshot::generate() const
+{
+	Builder builder;
+
+	auto const status_coord =
+	    std::get<PPUMemoryBlockOnPPU>(m_symbols.at("status").coordinate).toMin();
+
+	for (auto const ppu : iter_all<PPUOnDLS>()) {
+		// the PPU advances the offset on each snapshot, it is only reset at the start of a chunk
+		if (m_index == 0) {
+			auto const offset_coord =
+			    std::get<PPUMemoryBlockOnPPU>(m_symbols.at("snapshot_offset").coordinate).toMin();
+			builder.write(
+			    PPUMemoryWordOnDLS(offset_coord, ppu), PPUMemoryWord(PPUMemoryWord::Value(0)));
+		}
+		builder.write(
+		    PPUMemoryWordOnDLS(status_coord, ppu),
+		    PPUMemoryWord(
+		        PPUMemoryWord::Value(static_cast<uint32_t>(ppu::detail::Status::snapshot))));
+	}
+	return {std::move(builder), {}};
+}
+
+
+std::vector<PPUReadHooks::Result::ReadPPUSymbols> PPUReadSnapshots::Result::evaluate() const
+{
+	halco::common::typed_array<std::vector<uint8_t>, PPUOnDLS> bytes;
+	for (auto const ppu : iter_all<PPUOnDLS>()) {
+		for (auto const& ticket : tickets[ppu]) {
+			for (auto const& byte :
+			     dynamic_cast<lola::vx::v3::ExternalPPUDRAMMemoryBlock const&>(ticket.get())
+			         .get_bytes()) {
+				bytes[ppu].push_back(byte.get_value().value());
+			}
+		}
+	}
+	return evaluate(bytes);
+}
+
+std::vector<PPUReadHooks::Result::ReadPPUSymbols> PPUReadSnapshots::Result::evaluate(
+    halco::common::typed_array<std::vector<uint8_t>, PPUOnDLS> const& bytes) const
+{
+	for (auto const ppu : iter_all<PPUOnDLS>()) {
+		if (bytes[ppu].size() != num_snapshots * size_in_bytes) {
+			throw std::logic_error("Size of read PPU symbol snapshots doesn't match expectation.");
+		}
+	}
+
+	std::vector<PPUReadHooks::Result::ReadPPUSymbols> ret(num_snapshots);
+	for (size_t s = 0; s < num_snapshots; ++s) {
+		size_t offset = s * size_in_bytes;
+		for (auto const& [name, coord] : regions) {
+			std::map<HemisphereOnDLS, PPUMemoryBlock> values;
+			for (auto const ppu : iter_all<PPUOnDLS>()) {
+				PPUMemoryBlock block(coord.toPPUMemoryBlockSize());
+				for (size_t w = 0; w < coord.toPPUMemoryBlockSize().value(); ++w) {
+					// PPU memory is big-endian
+					PPUMemoryWord::raw_type word = 0;
+					for (size_t i = 0; i < sizeof(PPUMemoryWord::raw_type); ++i) {
+						word |= static_cast<PPUMemoryWord::raw_type>(bytes[ppu].at(
+						            offset + w * sizeof(PPUMemoryWord::raw_type) + i))
+						        << ((sizeof(PPUMemoryWord::raw_type) - 1 - i) * CHAR_BIT);
+					}
+					block.at(w) = PPUMemoryWord(PPUMemoryWord::Value(word));
+				}
+				values.emplace(HemisphereOnDLS(ppu.value()), std::move(block));
+			}
+			ret.at(s)[name] = std::move(values);
+			offset += coord.toPPUMemoryBlockSize().value() * sizeof(PPUMemoryWord::raw_type);
+		}
+	}
+	return ret;
+}
+
+stadls::vx::PlaybackGeneratorReturn<PPUReadSnapshots::Builder, PPUReadSnapshots::Result>
+PPUReadSnapshots::generate() const
+{
+	Builder builder;
+	Result result;
+	result.regions = m_layout.regions;
+	result.size_in_bytes = m_layout.size_in_bytes;
+	result.num_snapshots = m_num_snapshots;
+
+	// increase instruction timeout
+	InstructionTimeoutConfig instruction_timeout;
+	instruction_timeout.set_value(InstructionTimeoutConfig::Value(
+	    100000 * InstructionTimeoutConfig::Value::fpga_clock_cycles_per_us));
+	builder.write(halco::hicann_dls::vx::InstructionTimeoutConfigOnFPGA(), instruction_timeout);
+
+	// wait for completion of last snapshot
+	auto const status_coord =
+	    std::get<PPUMemoryBlockOnPPU>(m_symbols.at("status").coordinate).toMin();
+	for (auto const ppu : iter_all<PPUOnDLS>()) {
+		PollingOmnibusBlockConfig config;
+		config.set_address(PPUMemoryWord::addresses<PollingOmnibusBlockConfig::Address>(
+		                       PPUMemoryWordOnDLS(status_coord, ppu))
+		                       .at(0));
+		config.set_target(
+		    PollingOmnibusBlockConfig::Value(static_cast<uint32_t>(ppu::detail::Status::idle)));
+		config.set_mask(PollingOmnibusBlockConfig::Value(0xffffffff));
+		builder.write(PollingOmnibusBlockConfigOnFPGA(), config);
+		builder.block_until(BarrierOnFPGA(), Barrier::omnibus);
+		builder.block_until(PollingOmnibusBlockOnFPGA(), PollingOmnibusBlock());
+	}
+
+	// reset instruction timeout to default
+	builder.write(
+	    halco::hicann_dls::vx::InstructionTimeoutConfigOnFPGA(), InstructionTimeoutConfig());
+
+	size_t const size = m_num_snapshots * m_layout.size_in_bytes;
+	halco::common::typed_array<std::string, PPUOnDLS> const buffer_names{
+	    "snapshot_buffer_top", "snapshot_buffer_bot"};
+	for (auto const ppu : iter_all<PPUOnDLS>()) {
+		auto const min =
+		    std::get<ExternalPPUDRAMMemoryBlockOnFPGA>(m_symbols.at(buffer_names[ppu]).coordinate)
+		        .toMin();
+		typedef std::decay_t<decltype(min)> Byte;
+		// split into tickets of at most ticket_split_size_in_bytes
+		for (size_t current = 0; current < size; current += ticket_split_size_in_bytes) {
+			result.tickets[ppu].push_back(builder.read(ExternalPPUDRAMMemoryBlockOnFPGA(
+			    Byte(min.value() + current),
+			    Byte(min.value() + std::min(current + ticket_split_size_in_bytes, size) - 1))));
+		}
+	}
+	builder.block_until(BarrierOnFPGA(), Barrier::omnibus);
+
+	return {std::move(builder), std::move(result)};
+}
+
+
 stadls::vx::PlaybackGeneratorReturn<PPUPeriodicCADCRead::Builder, PPUPeriodicCADCRead::Result>
 PPUPeriodicCADCRead::generate() const
 {
@@ -0,0 +1,182 @@
+#include "grenade/vx/execution/detail/host_execution.h"
+
+#include "grenade/common/multi_index_sequence/cuboid.h"
+#include "grenade/common/port_on_topology.h"
+#include "grenade/common/topology.h"
+#include "grenade/vx/network/abstract/execution_instance_global.h"
+#include "grenade/vx/signal_flow/vertex/transformation.h"
+#include <algorithm>
+#include <list>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace grenade::vx::execution::detail {
+
+namespace {
+
+/**
+ * Get vertices in topological order.
+ * @return Vertices or std::nullopt on topology being cyclic
+ */
+std::optional<std::vector<grenade::common::VertexOnTopology>> get_topological_order(
+    grenade::common::Topology const& topology)
+{
+	std::map<grenade::common::VertexOnTopology, size_t> remaining_in_degree;
+	std::vector<grenade::common::VertexOnTopology> ret;
+	ret.reserve(topology.num_vertices());
+	for (auto const& vertex_descriptor : topology.vertices()) {
+		if (auto const in_degree = topology.in_degree(vertex_descriptor); in_degree == 0) {
+			ret.push_back(vertex_descriptor);
+		} else {
+			remaining_in_degree.emplace(vertex_descriptor, in_degree);
+		}
+	}
+	for (size_t i = 0; i < ret.size(); ++i) {
+		auto const vertex_descriptor = ret.at(i);
+		for (auto const& out_edge : topology.out_edges(vertex_descriptor)) {
+			auto const target = topology.target(out_edge);
+			if (--remaining_in_degree.at(target) == 0) {
+				ret.push_back(target);
+			}
+		}
+	}
+	if (ret.size() != topology.num_vertices()) {
+		return std::nullopt;
+	}
+	return ret;
+}
+
+} // namespace
+
+bool is_host_only(grenade::common::Topology const& topology)
+{
+	for (auto const& vertex_descriptor : topology.vertices()) {
+		auto const transformation = dynamic_cast<signal_flow::vertex::Transformation const*>(
+		    &topology.get(vertex_descriptor));
+		if (!transformation || !transformation->get_execution_instance_on_executor()) {
+			return false;
+		}
+	}
+	for (auto const& edge_descriptor : topology.edges()) {
+		auto const& edge = topology.get(edge_descriptor);
+		if (edge.get_channels_on_target().size() != topology.get(topology.target(edge_descriptor))
+		                                                .get_input_ports()
+		                                                .at(edge.port_on_target)
+		                                                .get_channels()
+		                                                .size()) {
+			return false;
+		}
+	}
+	return get_topological_order(topology).has_value();
+}
+
+grenade::common::OutputData run_host_only(
+    grenade::common::Topology const& topology, grenade::common::InputData const& input_data)
+{
+	auto const order = get_topological_order(topology);
+	if (!order) {
+		throw std::logic_error("Host-only execution requires acyclic topology.");
+	}
+
+	grenade::common::OutputData output_data;
+	for (auto const& vertex_descriptor : *order) {
+		auto const& vertex = dynamic_cast<signal_flow::vertex::Transformation const&>(
+		    topology.get(vertex_descriptor));
+
+		auto value_output = apply_transformation(
+		    vertex_descriptor, vertex, topology, input_data,
+		    [&](grenade::common::EdgeOnTopology const& in_edge_descriptor) {
+			    // sources precede in topological order, therefore their results are present
+			    return get_edge_section(
+			        static_cast<signal_flow::vertex::Transformation::Results const&>(
+			            output_data.ports.get(
+			                {topology.source(in_edge_descriptor),
+			                 topology.get(in_edge_descriptor).port_on_source})),
+			        topology, in_edge_descriptor);
+		    });
+		for (size_t i = 0; i < value_output.size(); ++i) {
+			output_data.ports.set(
+			    grenade::common::PortOnTopology{vertex_descriptor, i},
+			    std::move(value_output.at(i)));
+		}
+
+		auto const& execution_instance = vertex.get_execution_instance_on_executor().value();
+		if (!output_data.execution_instances.contains(execution_instance)) {
+			output_data.execution_instances.set(
+			    execution_instance, network::abstract::ExecutionInstanceGlobal());
+		}
+	}
+	return output_data;
+}
+
+std::vector<signal_flow::vertex::Transformation::Results> apply_transformation(
+    grenade::common::VertexOnTopology const& vertex_descriptor,
+    signal_flow::vertex::Transformation const& vertex,
+    grenade::common::Topology const& topology,
+    grenade::common::InputData const& input_data,
+    std::function<signal_flow::vertex::Transformation::Dynamics(
+        grenade::common::EdgeOnTopology const&)> const& get_edge_input)
+{
+	// fill input value
+	auto const input_ports = vertex.get_input_ports();
+	std::vector<std::optional<std::reference_wrapper<grenade::common::PortData const>>>
+	    value_input_optional(input_ports.size());
+	// use list for stability of element location in memory
+	std::list<signal_flow::vertex::Transformation::Dynamics> value_input_storage;
+	for (size_t input_port_on_vertex = 0; input_port_on_vertex < input_ports.size();
+	     ++input_port_on_vertex) {
+		if (input_data.ports.contains({vertex_descriptor, input_port_on_vertex})) {
+			value_input_optional.at(input_port_on_vertex) =
+			    std::cref(input_data.ports.get({vertex_descriptor, input_port_on_vertex}));
+		}
+	}
+	for (auto const& in_edge_descriptor : topology.in_edges(vertex_descriptor)) {
+		auto const& in_edge = topology.get(in_edge_descriptor);
+		if (in_edge.get_channels_on_target().size() !=
+		    input_ports.at(in_edge.port_on_target).get_channels().size()) {
+			throw std::logic_error("Edge with port restriction unsupported.");
+		}
+		value_input_storage.push_back(get_edge_input(in_edge_descriptor));
+		value_input_optional.at(in_edge.port_on_target) = std::cref(value_input_storage.back());
+	}
+	if (!std::all_of(value_input_optional.begin(), value_input_optional.end(), [](auto const& o) {
+		    return static_cast<bool>(o);
+	    })) {
+		std::stringstream ss;
+		ss << "Not all input to transformation is provided:\n";
+		ss << vertex_descriptor << ": " << vertex;
+		throw std::runtime_error(ss.str());
+	}
+	std::vector<std::reference_wrapper<grenade::common::PortData const>> value_input;
+	for (auto const& vo : value_input_optional) {
+		value_input.push_back(*vo);
+	}
+
+	// execute transformation
+	return vertex.get_function().apply(value_input);
+}
+
+signal_flow::vertex::Transformation::Dynamics get_edge_section(
+    signal_flow::vertex::Transformation::Results const& results,
+    grenade::common::Topology const& topology,
+    grenade::common::EdgeOnTopology const& edge_descriptor)
+{
+	auto const& edge = topology.get(edge_descriptor);
+	auto const source_port =
+	    topology.get(topology.source(edge_descriptor)).get_output_ports().at(edge.port_on_source);
+	if (edge.get_channels_on_source() == source_port.get_channels()) {
+		return signal_flow::vertex::Transformation::Dynamics(results.value);
+	}
+	return signal_flow::vertex::Transformation::Dynamics(
+	    results
+	        .get_section(
+	            *grenade::common::CuboidMultiIndexSequence({source_port.get_channels().size()})
+	                 .related_sequence_subset_restriction(
+	                     source_port.get_channels(), edge.get_channels_on_source()))
+	        ->value);
+}
+
+} // namespace grenade::vx::execution::detail
@@ -659,6 +659,67 @@ void perform_periodic_read()
 		sources.push_back("void perform_periodic_read() {}");
 	}
 
+	// snapshot of symbols into buffer in external DRAM
+	if (has_snapshot) {
+		// clang-format off
+		std::string source_template = R"grenadeTemplate(
+#include "grenade/vx/ppu/detail/snapshot.h"
+#include "grenade/vx/ppu/detail/uninitialized.h"
+#include "libnux/vx/dls.h"
+#include <array>
+#include <cstdint>
+
+extern volatile libnux::vx::PPUOnDLS ppu;
+
+// input: regions of memory to copy into the snapshot buffer
+volatile grenade::vx::ppu::detail::SnapshotRegion snapshot_regions[grenade::vx::ppu::detail::max_num_snapshot_regions];
+// input: number of regions to copy into the snapshot buffer
+volatile uint32_t snapshot_num_regions = 0;
+// input and output: byte offset in snapshot buffer at which to place the next snapshot, advanced
+// past each snapshot
+volatile uint32_t snapshot_offset = 0;
+
+typedef std::array<uint32_t, {{num_words}}> SnapshotBuffer;
+
+grenade::vx::ppu::detail::uninitialized<SnapshotBuffer> snapshot_buffer_top __attribute__((section("ext_dram.data")));
+grenade::vx::ppu::detail::uninitialized<SnapshotBuffer> snapshot_buffer_bot __attribute__((section("ext_dram.data")));
+
+void perform_snapshot() ATTRIB_LINK_TO_INTERNAL;
+
+void perform_snapshot()
+{
+	using namespace libnux::vx;
+
+	auto& local_snapshot_buffer = grenade::vx::ppu::detail::uninitialized_cast<SnapshotBuffer>(
+	    ppu == libnux::vx::PPUOnDLS::bottom ? snapshot_buffer_bot : snapshot_buffer_top);
+
+	size_t offset = snapshot_offset / sizeof(uint32_t);
+	for (size_t i = 0; i < snapshot_num_regions; ++i) {
+		auto const source = reinterpret_cast<uint32_t const volatile*>(snapshot_regions[i].address);
+		size_t const size = snapshot_regions[i].size / sizeof(uint32_t);
+		for (size_t j = 0; j < size && offset < local_snapshot_buffer.size(); ++j) {
+			local_snapshot_buffer[offset] = source[j];
+			offset++;
+		}
+	}
+	snapshot_offset = offset * sizeof(uint32_t);
+
+	asm volatile(
+	    "fxvinx 0, %[b0], %[i]\n"
+	    "sync\n"
+	    :: [b0] "r"(dls_extmem_dram_base), [i] "r"(uint32_t(0))
+	    : "qv0", "memory"
+	);
+})grenadeTemplate";
+		// clang-format on
+
+		inja::json parameters;
+		parameters["num_words"] = snapshot_buffer_size / sizeof(uint32_t);
+		sources.push_back(inja::render(source_template, parameters));
+	} else {
+		sources.push_back("void perform_snapshot() {}");
+	}
+
 	{
 		std::ifstream fs(get_program_base_source());
 		std::stringstream ss;
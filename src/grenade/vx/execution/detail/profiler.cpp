@@ -0,0 +1,110 @@
+#include "grenade/vx/execution/detail/profiler.h"
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <utility>
+
+namespace grenade::vx::execution::detail {
+
+namespace {
+
+/**
+ * Source of unique profiler identifiers.
+ * Identifiers are never reused, so that stale entries of destroyed profilers in the thread-local
+ * buffer lookup are never matched.
+ */
+std::atomic<size_t> next_profiler_id{0};
+
+} // namespace
+
+Profiler::Scope::Scope(Profiler* const profiler, ExecutionProfile::Span span) :
+    m_profiler(profiler && profiler->get_enabled() ? profiler : nullptr),
+    m_span(std::move(span)),
+    m_begin()
+{
+	if (m_profiler) {
+		m_begin = clock_type::now();
+	}
+}
+
+Profiler::Scope::~Scope()
+{
+	if (m_profiler) {
+		m_profiler->record(std::move(m_span), m_begin, clock_type::now());
+	}
+}
+
+Profiler::Profiler() :
+    m_id(next_profiler_id++),
+    m_enabled(false),
+    m_epoch(clock_type::now()),
+    m_buffers_mutex(),
+    m_buffers()
+{}
+
+Profiler::~Profiler() {}
+
+void Profiler::set_enabled(bool const value)
+{
+	m_enabled = value;
+}
+
+bool Profiler::get_enabled() const
+{
+	return m_enabled;
+}
+
+Profiler::Buffer& Profiler::get_buffer()
+{
+	thread_local std::map<size_t, Buffer*> buffers;
+	if (auto const it = buffers.find(m_id); it != buffers.end()) {
+		return *(it->second);
+	}
+	std::lock_guard lock(m_buffers_mutex);
+	m_buffers.push_back(std::make_unique<Buffer>(Buffer{m_buffers.size(), {}}));
+	buffers[m_id] = m_buffers.back().get();
+	return *m_buffers.back();
+}
+
+void Profiler::record(
+    ExecutionProfile::Span span,
+    clock_type::time_point const& begin,
+    clock_type::time_point const& end)
+{
+	if (!get_enabled()) {
+		return;
+	}
+	auto& buffer = get_buffer();
+	span.begin = std::chrono::duration_cast<std::chrono::nanoseconds>(begin - m_epoch);
+	span.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
+	span.thread = buffer.thread;
+	buffer.spans.push_back(std::move(span));
+}
+
+ExecutionProfile Profiler::get_profile() const
+{
+	ExecutionProfile profile;
+	{
+		std::lock_guard lock(m_buffers_mutex);
+		for (auto const& buffer : m_buffers) {
+			profile.spans.insert(profile.spans.end(), buffer->spans.begin(), buffer->spans.end());
+		}
+	}
+	std::stable_sort(
+	    profile.spans.begin(), profile.spans.end(), [](auto const& lhs, auto const& rhs) {
+		    return std::tie(lhs.begin, lhs.thread) < std::tie(rhs.begin, rhs.thread);
+	    });
+	return profile;
+}
+
+void Profiler::clear()
+{
+	std::lock_guard lock(m_buffers_mutex);
+	for (auto& buffer : m_buffers) {
+		buffer->spans.clear();
+	}
+	m_epoch = clock_type::now();
+}
+
+} // namespace grenade::vx::execution::detail
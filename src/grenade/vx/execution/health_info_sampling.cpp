@@ -0,0 +1,72 @@
+#include "grenade/vx/execution/health_info_sampling.h"
+
+#include <stdexcept>
+
+namespace grenade::vx::execution {
+
+HealthInfoSampling::HealthInfoSampling(Mode const mode, size_t const period) :
+    mode(mode), period(period)
+{
+	if (!valid()) {
+		throw std::invalid_argument("Health info sampling period is zero.");
+	}
+}
+
+bool HealthInfoSampling::valid() const
+{
+	return mode != Mode::every_nth || period != 0;
+}
+
+bool HealthInfoSampling::is_sampled(size_t const chunk, size_t const num_chunks) const
+{
+	switch (mode) {
+		case Mode::every_chunk:
+			return true;
+		case Mode::first_and_last:
+			return chunk == 0 || chunk + 1 == num_chunks;
+		case Mode::every_nth:
+			if (!valid()) {
+				throw std::invalid_argument("Health info sampling period is zero.");
+			}
+			return chunk % period == 0;
+		case Mode::off:
+			return false;
+		default:
+			throw std::logic_error("Given health info sampling mode not implemented.");
+	}
+}
+
+bool HealthInfoSampling::operator==(HealthInfoSampling const& other) const
+{
+	return mode == other.mode && period == other.period;
+}
+
+bool HealthInfoSampling::operator!=(HealthInfoSampling const& other) const
+{
+	return !(*this == other);
+}
+
+std::ostream& operator<<(std::ostream& os, HealthInfoSampling const& value)
+{
+	os << "HealthInfoSampling(";
+	switch (value.mode) {
+		case HealthInfoSampling::Mode::every_chunk:
+			os << "every chunk";
+			break;
+		case HealthInfoSampling::Mode::first_and_last:
+			os << "first and last chunk";
+			break;
+		case HealthInfoSampling::Mode::every_nth:
+			os << "every " << value.period << "-th chunk";
+			break;
+		case HealthInfoSampling::Mode::off:
+			os << "off";
+			break;
+		default:
+			throw std::logic_error("Ostream operator to given HealthInfoSampling not implemented.");
+	}
+	os << ")";
+	return os;
+}
+
+} // namespace grenade::vx::execution
@@ -7,6 +7,7 @@
 #include "hate/timer.h"
 #include "hxcomm/vx/connection_from_env.h"
 #include <map>
+#include <memory>
 #include <stdexcept>
 #include <boost/range/adaptor/map.hpp>
 #include <log4cxx/logger.h>
@@ -14,7 +15,7 @@
 namespace grenade::vx::execution {
 
 JITGraphExecutor::JITGraphExecutor(bool const enable_differential_config, size_t connection_size) :
-    m_connections()
+    m_connections(), m_health_info_sampling(), m_profiler(std::make_unique<detail::Profiler>())
 {
 	auto hxcomm_connections = hxcomm::vx::get_connection_list_from_env(connection_size);
 	for (size_t i = 0; i < hxcomm_connections.size(); ++i) {
@@ -30,7 +31,9 @@ JITGraphExecutor::JITGraphExecutor(bool const enable_differential_config, size_t
 
 JITGraphExecutor::JITGraphExecutor(
     std::map<grenade::common::ConnectionOnExecutor, backend::StatefulConnection>&& connections) :
-    m_connections(std::move(connections))
+    m_connections(std::move(connections)),
+    m_health_info_sampling(),
+    m_profiler(std::make_unique<detail::Profiler>())
 {
 }
 
@@ -168,4 +171,37 @@ void JITGraphExecutor::check(grenade::common::Topology const& topology)
 	    "check(): Checked fit of graph, input list and connection in " << timer.print() << ".");
 }
 
+void JITGraphExecutor::set_health_info_sampling(HealthInfoSampling const& value)
+{
+	if (!value.valid()) {
+		throw std::invalid_argument("Health info sampling period is zero.");
+	}
+	m_health_info_sampling = value;
+}
+
+HealthInfoSampling const& JITGraphExecutor::get_health_info_sampling() const
+{
+	return m_health_info_sampling;
+}
+
+void JITGraphExecutor::set_enable_profiling(bool const value)
+{
+	m_profiler->set_enabled(value);
+}
+
+bool JITGraphExecutor::get_enable_profiling() const
+{
+	return m_profiler->get_enabled();
+}
+
+ExecutionProfile JITGraphExecutor::get_profile() const
+{
+	return m_profiler->get_profile();
+}
+
+void JITGraphExecutor::clear_profile()
+{
+	m_profiler->clear();
+}
+
 } // namespace grenade::vx::execution
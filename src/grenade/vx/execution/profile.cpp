@@ -0,0 +1,239 @@
+#include "grenade/vx/execution/profile.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace grenade::vx::execution {
+
+namespace {
+
+/**
+ * Format duration in microseconds as used by the Chrome trace-event format.
+ */
+std::string to_microseconds(std::chrono::nanoseconds const& value)
+{
+	std::stringstream ss;
+	ss << std::fixed << std::setprecision(3) << (static_cast<double>(value.count()) / 1000.);
+	return ss.str();
+}
+
+/**
+ * Escape string for use in a JSON string literal.
+ */
+std::string escape_json(std::string const& value)
+{
+	std::stringstream ss;
+	for (char const c : value) {
+		switch (c) {
+			case '"':
+				ss << "\\\"";
+				break;
+			case '\\':
+				ss << "\\\\";
+				break;
+			case '\n':
+				ss << "\\n";
+				break;
+			case '\t':
+				ss << "\\t";
+				break;
+			default:
+				if (static_cast<unsigned char>(c) < 0x20) {
+					ss << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+					   << static_cast<int>(c) << std::dec << std::setfill(' ');
+				} else {
+					ss << c;
+				}
+		}
+	}
+	return ss.str();
+}
+
+template <typename T>
+std::string to_string(T const& value)
+{
+	std::stringstream ss;
+	ss << value;
+	return ss.str();
+}
+
+} // namespace
+
+std::ostream& operator<<(std::ostream& os, ExecutionProfile::Phase const& value)
+{
+	switch (value) {
+		case ExecutionProfile::Phase::rewrite:
+			return os << "rewrite";
+		case ExecutionProfile::Phase::program_build:
+			return os << "program_build";
+		case ExecutionProfile::Phase::ppu_compile:
+			return os << "ppu_compile";
+		case ExecutionProfile::Phase::encode:
+			return os << "encode";
+		case ExecutionProfile::Phase::transfer:
+			return os << "transfer";
+		case ExecutionProfile::Phase::wait:
+			return os << "wait";
+		case ExecutionProfile::Phase::decode:
+			return os << "decode";
+		case ExecutionProfile::Phase::post_process:
+			return os << "post_process";
+		case ExecutionProfile::Phase::merge:
+			return os << "merge";
+		default:
+			throw std::logic_error("Ostream operator to given phase not implemented.");
+	}
+}
+
+bool ExecutionProfile::Span::operator==(Span const& other) const
+{
+	return phase == other.phase && execution_instance == other.execution_instance &&
+	       chip == other.chip && snippet == other.snippet && chunk == other.chunk &&
+	       begin == other.begin && duration == other.duration && thread == other.thread &&
+	       synthesized == other.synthesized;
+}
+
+bool ExecutionProfile::Span::operator!=(Span const& other) const
+{
+	return !(*this == other);
+}
+
+std::ostream& operator<<(std::ostream& os, ExecutionProfile::Span const& value)
+{
+	os << "Span(" << value.phase;
+	if (value.execution_instance) {
+		os << ", " << *value.execution_instance;
+	}
+	if (value.chip) {
+		os << ", " << *value.chip;
+	}
+	if (value.snippet) {
+		os << ", snippet: " << *value.snippet;
+	}
+	if (value.chunk) {
+		os << ", chunk: " << *value.chunk;
+	}
+	os << ", begin: " << value.begin.count() << " ns, duration: " << value.duration.count()
+	   << " ns, thread: " << value.thread;
+	if (value.synthesized) {
+		os << ", synthesized";
+	}
+	os << ")";
+	return os;
+}
+
+bool ExecutionProfile::Summary::Entry::operator==(Entry const& other) const
+{
+	return count == other.count && total == other.total && min == other.min && max == other.max;
+}
+
+bool ExecutionProfile::Summary::Entry::operator!=(Entry const& other) const
+{
+	return !(*this == other);
+}
+
+bool ExecutionProfile::Summary::operator==(Summary const& other) const
+{
+	return phases == other.phases;
+}
+
+bool ExecutionProfile::Summary::operator!=(Summary const& other) const
+{
+	return !(*this == other);
+}
+
+std::ostream& operator<<(std::ostream& os, ExecutionProfile::Summary const& value)
+{
+	os << "Summary(\n";
+	for (auto const& [phase, entry] : value.phases) {
+		os << "\t" << phase << ": count: " << entry.count << ", total: " << entry.total.count()
+		   << " ns, min: " << entry.min.count() << " ns, max: " << entry.max.count() << " ns\n";
+	}
+	os << ")";
+	return os;
+}
+
+ExecutionProfile::Summary ExecutionProfile::get_summary() const
+{
+	Summary summary;
+	for (auto const& span : spans) {
+		auto [it, inserted] = summary.phases.emplace(span.phase, Summary::Entry());
+		auto& entry = it->second;
+		if (inserted) {
+			entry.min = span.duration;
+			entry.max = span.duration;
+		} else {
+			entry.min = std::min(entry.min, span.duration);
+			entry.max = std::max(entry.max, span.duration);
+		}
+		entry.count++;
+		entry.total += span.duration;
+	}
+	return summary;
+}
+
+std::string ExecutionProfile::to_chrome_trace() const
+{
+	std::stringstream ss;
+	ss << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+	for (size_t i = 0; auto const& span : spans) {
+		if (span.synthesized) {
+			continue;
+		}
+		if (i != 0) {
+			ss << ",";
+		}
+		ss << "\n{\"name\":\"" << span.phase << "\",\"cat\":\"grenade\",\"ph\":\"X\",\"ts\":"
+		   << to_microseconds(span.begin) << ",\"dur\":" << to_microseconds(span.duration)
+		   << ",\"pid\":0,\"tid\":" << span.thread << ",\"args\":{";
+		std::vector<std::string> args;
+		if (span.execution_instance) {
+			args.push_back(
+			    "\"execution_instance\":\"" + escape_json(to_string(*span.execution_instance)) +
+			    "\"");
+		}
+		if (span.chip) {
+			args.push_back("\"chip\":" + std::to_string(span.chip->value()));
+		}
+		if (span.snippet) {
+			args.push_back("\"snippet\":" + std::to_string(*span.snippet));
+		}
+		if (span.chunk) {
+			args.push_back("\"chunk\":" + std::to_string(*span.chunk));
+		}
+		for (size_t j = 0; j < args.size(); ++j) {
+			if (j != 0) {
+				ss << ",";
+			}
+			ss << args.at(j);
+		}
+		ss << "}}";
+		i++;
+	}
+	ss << "\n]}\n";
+	return ss.str();
+}
+
+bool ExecutionProfile::operator==(ExecutionProfile const& other) const
+{
+	return spans == other.spans;
+}
+
+bool ExecutionProfile::operator!=(ExecutionProfile const& other) const
+{
+	return !(*this == other);
+}
+
+std::ostream& operator<<(std::ostream& os, ExecutionProfile const& value)
+{
+	os << "ExecutionProfile(\n";
+	for (auto const& span : value.spans) {
+		os << "\t" << span << "\n";
+	}
+	os << ")";
+	return os;
+}
+
+} // namespace grenade::vx::execution
@@ -8,11 +8,14 @@
 #include "grenade/common/topology_rewrite/strong_component_invariant.h"
 #include "grenade/vx/execution/backend/initialized_connection.h"
 #include "grenade/vx/execution/detail/execution_instance_node.h"
+#include "grenade/vx/execution/detail/host_execution.h"
+#include "grenade/vx/execution/detail/profiler.h"
 #include "grenade/vx/network/abstract/execution_instance_global.h"
 #include "grenade/vx/network/abstract/executor_global.h"
 #include "grenade/vx/signal_flow/vertex/entity_on_chip.h"
 #include "halco/hicann-dls/vx/v3/chip.h"
 #include "hate/timer.h"
+#include <algorithm>
 #include <chrono>
 #include <map>
 #include <memory>
@@ -56,6 +59,30 @@ std::vector<grenade::common::OutputData> run(
 	using namespace halco::hicann_dls::vx::v3;
 	hate::Timer const timer;
 
+	// topologies consisting solely of transformations don't require hardware and are evaluated
+	// directly without construction of execution instance topologies and playback programs
+	if (hooks.empty() &&
+	    std::all_of(topologies.begin(), topologies.end(), [](auto const& topology) {
+		    assert(topology);
+		    return detail::is_host_only(*topology);
+	    })) {
+		std::vector<grenade::common::OutputData> results;
+		for (size_t i = 0; i < topologies.size(); ++i) {
+			results.push_back(detail::run_host_only(*topologies.at(i), data.at(i)));
+		}
+		std::chrono::nanoseconds execution_duration(timer.get_ns());
+		for (auto& result : results) {
+			network::abstract::ExecutorGlobal executor_global;
+			executor_global.execution_duration = execution_duration;
+			result.set_executor(executor_global);
+		}
+		auto logger = log4cxx::Logger::getLogger("grenade.JITGraphExecutor");
+		LOG4CXX_DEBUG(
+		    logger,
+		    "run(): Executed host-only graph in " << hate::to_string(execution_duration) << ".");
+		return results;
+	}
+
 	// construct linked topology per topology to execute, which contains vertices per strong
 	// component invariant and their dependencies as edges
 	std::vector<std::shared_ptr<grenade::common::LinkedTopology>> execution_instance_topologies;
@@ -63,9 +90,14 @@ std::vector<grenade::common::OutputData> run(
 		execution_instance_topologies.emplace_back(
 		    std::make_shared<grenade::common::LinkedTopology>(graph));
 	}
-	for (auto& execution_instance_topology : execution_instance_topologies) {
-		grenade::common::StrongComponentInvariantRewrite rewrite(execution_instance_topology);
-		rewrite();
+	{
+		ExecutionProfile::Span span;
+		span.phase = ExecutionProfile::Phase::rewrite;
+		detail::Profiler::Scope const profiler_scope(executor.m_profiler.get(), std::move(span));
+		for (auto& execution_instance_topology : execution_instance_topologies) {
+			grenade::common::StrongComponentInvariantRewrite rewrite(execution_instance_topology);
+			rewrite();
+		}
 	}
 
 	std::map<
@@ -139,7 +171,8 @@ std::vector<grenade::common::OutputData> run(
 		detail::ExecutionInstanceNode node_body(
 		    results, results_mutex, execution_instance_topologies, execution_instance_on_executor,
 		    data, executor.m_connections.at(execution_instance_on_executor.connection_on_executor),
-		    *(hooks.at(execution_instance_on_executor)), execution_instance_vertex_descriptors);
+		    *(hooks.at(execution_instance_on_executor)), execution_instance_vertex_descriptors,
+		    executor.m_health_info_sampling, *executor.m_profiler);
 		nodes.insert(std::make_pair(
 		    execution_instance_on_executor,
 		    tbb::flow::continue_node<tbb::flow::continue_msg>(execution_graph, node_body)));
@@ -0,0 +1,622 @@
+#include "grenade/vx/network/abstract/data_archive.h"
+
+#include "grenade/cerealization.h"
+#include "grenade/vx/network/abstract/clock_cycle_time_domain_runtimes.h"
+#include "grenade/vx/network/abstract/population_cell/external_source.h"
+#include "grenade/vx/network/abstract/recorder/cadc.h"
+#include "grenade/vx/network/abstract/recorder/madc.h"
+#include "grenade/vx/network/abstract/recorder/spike.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <cereal/archives/portable_binary.hpp>
+#include <cereal/types/memory.hpp>
+#include <cereal/types/optional.hpp>
+#include <cereal/types/polymorphic.hpp>
+#include <cereal/types/vector.hpp>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <tbb/parallel_for.h>
+#include <unistd.h>
+
+namespace grenade::vx::network::abstract {
+
+namespace {
+
+/**
+ * Identifier at the beginning of every archive.
+ */
+constexpr char archive_magic[16] = "grenade-archive";
+
+/**
+ * Version of the archive format.
+ * Increment on any change of the layout of the header, the index or the columns.
+ */
+constexpr uint32_t archive_version = 1;
+
+/**
+ * Marker to detect archives written with different byte order.
+ */
+constexpr uint32_t byte_order_mark = 0x01020304;
+
+/**
+ * Alignment of columns in bytes.
+ */
+constexpr size_t alignment = 64;
+
+/**
+ * Number of elements buffered before writing a column to file.
+ */
+constexpr size_t column_buffer_size = size_t(1) << 16;
+
+struct Header
+{
+	char magic[16];
+	uint32_t version;
+	uint32_t byte_order_mark;
+	uint64_t index_offset;
+	uint64_t index_size;
+	char padding[24];
+};
+static_assert(sizeof(Header) == alignment);
+
+struct Column
+{
+	uint64_t offset;
+	uint64_t size;
+
+	template <typename Archive>
+	void serialize(Archive& ar)
+	{
+		ar(offset, size);
+	}
+};
+
+struct Entry
+{
+	uint64_t vertex;
+	uint64_t port;
+	uint8_t type;
+	uint64_t outer_size;
+	uint64_t inner_size;
+	std::vector<Column> columns;
+
+	grenade::common::PortOnTopology get_port() const
+	{
+		return {grenade::common::VertexOnTopology(vertex), port};
+	}
+
+	template <typename Archive>
+	void serialize(Archive& ar)
+	{
+		ar(vertex, port, type, outer_size, inner_size, columns);
+	}
+};
+
+/**
+ * Time-domain runtimes of input data, which are stored in the index.
+ */
+struct RuntimesEntry
+{
+	uint64_t time_domain;
+	std::vector<std::optional<DataArchive::TimeValue>> values;
+	DataArchive::TimeValue inter_batch_entry_wait;
+	bool inter_batch_entry_routing_disabled;
+
+	template <typename Archive>
+	void serialize(Archive& ar)
+	{
+		ar(time_domain, values, inter_batch_entry_wait, inter_batch_entry_routing_disabled);
+	}
+};
+
+/**
+ * Get inner size of nested events with shape (outer, inner, #events).
+ * @throws std::runtime_error On inner size not being homogeneous
+ */
+template <typename Nested>
+size_t get_inner_size(Nested const& nested)
+{
+	if (nested.empty()) {
+		return 0;
+	}
+	size_t const inner_size = nested.front().size();
+	if (std::ranges::any_of(nested, [&](auto const& inner) {
+		    return inner.size() != inner_size;
+	    })) {
+		throw std::runtime_error("Data archive only supports events of homogeneous shape.");
+	}
+	return inner_size;
+}
+
+} // namespace
+
+struct DataArchiveWriter::Impl
+{
+	std::ofstream file;
+	uint64_t position = 0;
+	std::vector<Entry> entries;
+	std::set<grenade::common::PortOnTopology> ports;
+	std::vector<RuntimesEntry> runtimes;
+	bool closed = false;
+
+	void append(void const* data, size_t size)
+	{
+		file.write(static_cast<char const*>(data), size);
+		if (!file) {
+			throw std::runtime_error("Writing to data archive failed.");
+		}
+		position += size;
+	}
+
+	uint64_t begin_column()
+	{
+		static constexpr char zeros[alignment] = {};
+		append(zeros, (alignment - position % alignment) % alignment);
+		return position;
+	}
+
+	Column end_column(uint64_t begin) const
+	{
+		return {begin, position - begin};
+	}
+
+	/**
+	 * Write column of projected elements of nested events.
+	 */
+	template <typename T, typename Nested, typename Projection>
+	Column write_column(Nested const& nested, Projection const& projection)
+	{
+		auto const begin = begin_column();
+		std::vector<T> buffer;
+		buffer.reserve(column_buffer_size);
+		for (auto const& inner : nested) {
+			for (auto const& events : inner) {
+				for (auto const& event : events) {
+					buffer.push_back(projection(event));
+					if (buffer.size() == column_buffer_size) {
+						append(buffer.data(), buffer.size() * sizeof(T));
+						buffer.clear();
+					}
+				}
+			}
+		}
+		append(buffer.data(), buffer.size() * sizeof(T));
+		return end_column(begin);
+	}
+
+	/**
+	 * Write column of offsets of nested events.
+	 */
+	template <typename Nested>
+	Column write_offsets(Nested const& nested)
+	{
+		std::vector<uint64_t> offsets{0};
+		for (auto const& inner : nested) {
+			for (auto const& events : inner) {
+				offsets.push_back(offsets.back() + events.size());
+			}
+		}
+		auto const begin = begin_column();
+		append(offsets.data(), offsets.size() * sizeof(uint64_t));
+		return end_column(begin);
+	}
+
+	/**
+	 * Write nested events with shape (outer, inner, #events).
+	 */
+	template <typename Nested, typename GetTime>
+	void write_events(Entry& entry, Nested const& nested, GetTime const& get_time)
+	{
+		entry.outer_size = nested.size();
+		entry.inner_size = get_inner_size(nested);
+		entry.columns.push_back(write_offsets(nested));
+		entry.columns.push_back(write_column<DataArchive::TimeValue>(nested, get_time));
+	}
+};
+
+DataArchiveWriter::DataArchiveWriter(std::string const& path) : m_impl(std::make_unique<Impl>())
+{
+	m_impl->file.open(path, std::ios::binary | std::ios::trunc);
+	if (!m_impl->file) {
+		throw std::runtime_error("Could not open data archive " + path + " for writing.");
+	}
+	// header is completed on close, an archive without index is invalid
+	Header header{};
+	std::memcpy(header.magic, archive_magic, sizeof(archive_magic));
+	header.version = archive_version;
+	header.byte_order_mark = byte_order_mark;
+	m_impl->append(&header, sizeof(header));
+}
+
+DataArchiveWriter::~DataArchiveWriter()
+{
+	if (m_impl && !m_impl->closed) {
+		try {
+			close();
+		} catch (...) {
+		}
+	}
+}
+
+void DataArchiveWriter::write(
+    grenade::common::PortOnTopology const& port, grenade::common::PortData const& data)
+{
+	assert(m_impl);
+	if (m_impl->closed) {
+		throw std::runtime_error("Data archive is already closed.");
+	}
+	if (m_impl->ports.contains(port)) {
+		throw std::runtime_error("Data archive already contains data of port.");
+	}
+
+	Entry entry{port.first.value(), port.second, 0, 0, 0, {}};
+
+	auto const get_time = [](auto const& event) { return event.first.value(); };
+
+	if (auto const spikes = dynamic_cast<SpikeRecorder::Results const*>(&data); spikes) {
+		entry.type = static_cast<uint8_t>(DataArchive::Type::spike_recorder_results);
+		m_impl->write_events(
+		    entry, spikes->spikes, [](grenade::vx::common::Time const& time) {
+			    return time.value();
+		    });
+	} else if (auto const madc = dynamic_cast<MADCRecorder::Results const*>(&data); madc) {
+		entry.type = static_cast<uint8_t>(DataArchive::Type::madc_recorder_results);
+		m_impl->write_events(entry, madc->samples, get_time);
+		entry.columns.push_back(m_impl->write_column<DataArchive::MADCValue>(
+		    madc->samples, [](auto const& sample) { return sample.second.value(); }));
+	} else if (auto const cadc = dynamic_cast<CADCRecorder::Results const*>(&data); cadc) {
+		entry.type = static_cast<uint8_t>(DataArchive::Type::cadc_recorder_results);
+		m_impl->write_events(entry, cadc->samples, get_time);
+		entry.columns.push_back(m_impl->write_column<DataArchive::CADCValue>(
+		    cadc->samples, [](auto const& sample) { return sample.second.value(); }));
+	} else if (auto const external_source = dynamic_cast<ExternalSourceNeuron::Dynamics const*>(
+	               &data);
+	           external_source) {
+		entry.type = static_cast<uint8_t>(DataArchive::Type::external_source_dynamics);
+		m_impl->write_events(
+		    entry, external_source->spike_times, [](grenade::vx::common::Time const& time) {
+			    return time.value();
+		    });
+	} else {
+		entry.type = static_cast<uint8_t>(DataArchive::Type::cereal);
+		std::ostringstream ss;
+		{
+			cereal::PortableBinaryOutputArchive ar(ss);
+			std::unique_ptr<grenade::common::PortData> const copy = data.copy();
+			ar(copy);
+		}
+		auto const serialized = ss.str();
+		auto const begin = m_impl->begin_column();
+		m_impl->append(serialized.data(), serialized.size());
+		entry.columns.push_back(m_impl->end_column(begin));
+	}
+
+	m_impl->entries.push_back(std::move(entry));
+	m_impl->ports.insert(port);
+}
+
+void DataArchiveWriter::write(grenade::common::InputData const& data)
+{
+	assert(m_impl);
+	std::vector<RuntimesEntry> runtimes;
+	for (auto const& [time_domain, time_domain_runtimes] : data.time_domain_runtimes) {
+		auto const clock_cycle_runtimes =
+		    dynamic_cast<ClockCycleTimeDomainRuntimes const*>(&time_domain_runtimes);
+		if (!clock_cycle_runtimes) {
+			throw std::runtime_error(
+			    "Data archive only supports clock cycle time-domain runtimes.");
+		}
+		if (std::ranges::any_of(m_impl->runtimes, [&](auto const& entry) {
+			    return entry.time_domain == time_domain.value();
+		    })) {
+			throw std::runtime_error("Data archive already contains runtimes of time domain.");
+		}
+		RuntimesEntry entry{
+		    time_domain.value(),
+		    {},
+		    clock_cycle_runtimes->inter_batch_entry_wait.value(),
+		    clock_cycle_runtimes->inter_batch_entry_routing_disabled};
+		for (auto const& value : clock_cycle_runtimes->values) {
+			entry.values.push_back(
+			    value ? std::optional<DataArchive::TimeValue>(value->value()) : std::nullopt);
+		}
+		runtimes.push_back(std::move(entry));
+	}
+
+	write(static_cast<grenade::common::Data const&>(data));
+	std::ranges::move(runtimes, std::back_inserter(m_impl->runtimes));
+}
+
+void DataArchiveWriter::write(grenade::common::Data const& data)
+{
+	for (auto const& [port, port_data] : data.ports) {
+		write(port, port_data);
+	}
+}
+
+void DataArchiveWriter::close()
+{
+	assert(m_impl);
+	if (m_impl->closed) {
+		return;
+	}
+
+	std::ostringstream ss;
+	{
+		cereal::PortableBinaryOutputArchive ar(ss);
+		ar(m_impl->entries, m_impl->runtimes);
+	}
+	auto const index = ss.str();
+	auto const index_offset = m_impl->begin_column();
+	m_impl->append(index.data(), index.size());
+
+	Header header{};
+	std::memcpy(header.magic, archive_magic, sizeof(archive_magic));
+	header.version = archive_version;
+	header.byte_order_mark = byte_order_mark;
+	header.index_offset = index_offset;
+	header.index_size = index.size();
+	m_impl->file.seekp(0);
+	m_impl->file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+	m_impl->file.close();
+	m_impl->closed = true;
+	if (!m_impl->file) {
+		throw std::runtime_error("Closing data archive failed.");
+	}
+}
+
+
+struct DataArchiveReader::Impl
+{
+	int fd = -1;
+	void* data = MAP_FAILED;
+	size_t size = 0;
+	std::vector<Entry> entries;
+	std::map<grenade::common::PortOnTopology, size_t> entry_on_port;
+	std::vector<RuntimesEntry> runtimes;
+
+	~Impl()
+	{
+		if (data != MAP_FAILED) {
+			munmap(data, size);
+		}
+		if (fd != -1) {
+			::close(fd);
+		}
+	}
+
+	char const* get(uint64_t offset, uint64_t length) const
+	{
+		if (offset > size || length > size - offset) {
+			throw std::runtime_error("Data archive column exceeds file.");
+		}
+		return static_cast<char const*>(data) + offset;
+	}
+
+	template <typename T>
+	std::span<T const> get_column(Entry const& entry, size_t index) const
+	{
+		auto const& column = entry.columns.at(index);
+		if (column.size % sizeof(T) != 0 || column.offset % alignof(T) != 0) {
+			throw std::runtime_error("Data archive column is malformed.");
+		}
+		return {
+		    reinterpret_cast<T const*>(get(column.offset, column.size)), column.size / sizeof(T)};
+	}
+
+	Entry const& get_entry(grenade::common::PortOnTopology const& port) const
+	{
+		return entries.at(entry_on_port.at(port));
+	}
+};
+
+DataArchiveReader::DataArchiveReader(std::string const& path) : m_impl(std::make_unique<Impl>())
+{
+	m_impl->fd = ::open(path.c_str(), O_RDONLY);
+	if (m_impl->fd == -1) {
+		throw std::runtime_error("Could not open data archive " + path + " for reading.");
+	}
+	struct stat file_stat;
+	if (fstat(m_impl->fd, &file_stat) != 0 ||
+	    static_cast<size_t>(file_stat.st_size) < sizeof(Header)) {
+		throw std::runtime_error("Data archive " + path + " is too small.");
+	}
+	m_impl->size = file_stat.st_size;
+	m_impl->data = mmap(nullptr, m_impl->size, PROT_READ, MAP_SHARED, m_impl->fd, 0);
+	if (m_impl->data == MAP_FAILED) {
+		throw std::runtime_error("Could not memory-map data archive " + path + ".");
+	}
+
+	Header header;
+	std::memcpy(&header, m_impl->data, sizeof(header));
+	if (std::memcmp(header.magic, archive_magic, sizeof(archive_magic)) != 0 ||
+	    header.version != archive_version || header.byte_order_mark != byte_order_mark) {
+		throw std::runtime_error("Data archive " + path + " has unsupported format.");
+	}
+	if (header.index_offset == 0) {
+		throw std::runtime_error("Data archive " + path + " was not closed.");
+	}
+
+	std::istringstream ss(std::string(
+	    m_impl->get(header.index_offset, header.index_size), header.index_size));
+	cereal::PortableBinaryInputArchive ar(ss);
+	ar(m_impl->entries, m_impl->runtimes);
+	for (size_t i = 0; i < m_impl->entries.size(); ++i) {
+		m_impl->entry_on_port.emplace(m_impl->entries.at(i).get_port(), i);
+	}
+}
+
+DataArchiveReader::~DataArchiveReader() = default;
+
+std::vector<grenade::common::PortOnTopology> DataArchiveReader::get_ports() const
+{
+	assert(m_impl);
+	std::vector<grenade::common::PortOnTopology> ret;
+	for (auto const& entry : m_impl->entries) {
+		ret.push_back(entry.get_port());
+	}
+	return ret;
+}
+
+DataArchive::Type DataArchiveReader::get_type(grenade::common::PortOnTopology const& port) const
+{
+	assert(m_impl);
+	return static_cast<DataArchive::Type>(m_impl->get_entry(port).type);
+}
+
+DataArchive::Events DataArchiveReader::get_events(
+    grenade::common::PortOnTopology const& port) const
+{
+	assert(m_impl);
+	auto const& entry = m_impl->get_entry(port);
+	auto const type = static_cast<DataArchive::Type>(entry.type);
+	if (type == DataArchive::Type::cereal) {
+		throw std::runtime_error("Data of port is not stored as event columns.");
+	}
+
+	DataArchive::Events events{
+	    entry.outer_size,
+	    entry.inner_size,
+	    m_impl->get_column<uint64_t>(entry, 0),
+	    m_impl->get_column<DataArchive::TimeValue>(entry, 1),
+	    {},
+	    {}};
+	if (type == DataArchive::Type::madc_recorder_results) {
+		events.madc_values = m_impl->get_column<DataArchive::MADCValue>(entry, 2);
+		if (events.madc_values.size() != events.times.size()) {
+			throw std::runtime_error("Data archive value column is malformed.");
+		}
+	} else if (type == DataArchive::Type::cadc_recorder_results) {
+		events.cadc_values = m_impl->get_column<DataArchive::CADCValue>(entry, 2);
+		if (events.cadc_values.size() != events.times.size()) {
+			throw std::runtime_error("Data archive value column is malformed.");
+		}
+	}
+
+	if (events.offsets.size() != events.outer_size * events.inner_size + 1 ||
+	    events.offsets.front() != 0 || events.offsets.back() != events.times.size() ||
+	    !std::ranges::is_sorted(events.offsets)) {
+		throw std::runtime_error("Data archive offset column is malformed.");
+	}
+	return events;
+}
+
+namespace {
+
+/**
+ * Construct nested events with shape (outer, inner, #events) from columns.
+ */
+template <typename T, typename GetEvent>
+std::vector<std::vector<std::vector<T>>> get_nested(
+    DataArchive::Events const& events, GetEvent const& get_event)
+{
+	std::vector<std::vector<std::vector<T>>> nested(
+	    events.outer_size, std::vector<std::vector<T>>(events.inner_size));
+	tbb::parallel_for(size_t(0), events.outer_size, [&](size_t const outer) {
+		for (size_t inner = 0; inner < events.inner_size; ++inner) {
+			size_t const index = outer * events.inner_size + inner;
+			auto& local_nested = nested[outer][inner];
+			local_nested.reserve(events.offsets[index + 1] - events.offsets[index]);
+			for (size_t i = events.offsets[index]; i < events.offsets[index + 1]; ++i) {
+				local_nested.push_back(get_event(i));
+			}
+		}
+	});
+	return nested;
+}
+
+} // namespace
+
+std::unique_ptr<grenade::common::PortData> DataArchiveReader::read(
+    grenade::common::PortOnTopology const& port) const
+{
+	assert(m_impl);
+	auto const& entry = m_impl->get_entry(port);
+	switch (static_cast<DataArchive::Type>(entry.type)) {
+		case DataArchive::Type::spike_recorder_results: {
+			auto const events = get_events(port);
+			return std::make_unique<SpikeRecorder::Results>(
+			    get_nested<grenade::vx::common::Time>(events, [&](size_t const i) {
+				    return grenade::vx::common::Time(events.times[i]);
+			    }));
+		}
+		case DataArchive::Type::madc_recorder_results: {
+			auto const events = get_events(port);
+			return std::make_unique<MADCRecorder::Results>(get_nested<std::pair<
+			        grenade::vx::common::Time, signal_flow::MADCSampleFromChip::Value>>(
+			    events, [&](size_t const i) {
+				    return std::pair{
+				        grenade::vx::common::Time(events.times[i]),
+				        signal_flow::MADCSampleFromChip::Value(events.madc_values[i])};
+			    }));
+		}
+		case DataArchive::Type::cadc_recorder_results: {
+			auto const events = get_events(port);
+			return std::make_unique<CADCRecorder::Results>(
+			    get_nested<std::pair<grenade::vx::common::Time, signal_flow::Int8>>(
+			        events, [&](size_t const i) {
+				        return std::pair{
+				            grenade::vx::common::Time(events.times[i]),
+				            signal_flow::Int8(events.cadc_values[i])};
+			        }));
+		}
+		case DataArchive::Type::external_source_dynamics: {
+			auto const events = get_events(port);
+			return std::make_unique<ExternalSourceNeuron::Dynamics>(
+			    get_nested<grenade::vx::common::Time>(events, [&](size_t const i) {
+				    return grenade::vx::common::Time(events.times[i]);
+			    }));
+		}
+		case DataArchive::Type::cereal: {
+			auto const& column = entry.columns.at(0);
+			std::istringstream ss(
+			    std::string(m_impl->get(column.offset, column.size), column.size));
+			cereal::PortableBinaryInputArchive ar(ss);
+			std::unique_ptr<grenade::common::PortData> ret;
+			ar(ret);
+			return ret;
+		}
+		default: {
+			throw std::runtime_error("Data archive entry type not supported.");
+		}
+	}
+}
+
+void DataArchiveReader::read(grenade::common::InputData& data) const
+{
+	assert(m_impl);
+	read(static_cast<grenade::common::Data&>(data));
+	for (auto const& entry : m_impl->runtimes) {
+		std::vector<std::optional<grenade::vx::common::Time>> values;
+		for (auto const& value : entry.values) {
+			values.push_back(
+			    value ? std::optional<grenade::vx::common::Time>(grenade::vx::common::Time(*value))
+			          : std::nullopt);
+		}
+		data.time_domain_runtimes.set(
+		    grenade::common::TimeDomainOnTopology(entry.time_domain),
+		    ClockCycleTimeDomainRuntimes(
+		        std::move(values), grenade::vx::common::Time(entry.inter_batch_entry_wait),
+		        entry.inter_batch_entry_routing_disabled));
+	}
+}
+
+void DataArchiveReader::read(grenade::common::Data& data) const
+{
+	assert(m_impl);
+	for (auto const& entry : m_impl->entries) {
+		auto const port = entry.get_port();
+		data.ports.set(port, std::move(*read(port)));
+	}
+}
+
+} // namespace grenade::vx::network::abstract
@@ -682,19 +682,28 @@ void RoutingRewrite::operator()() const
 					}
 				}
 
+				// the recorded neuron of each read-out column is assigned once here, so that
+				// mapping the recorded samples doesn't need to look up the placement
 				std::map<
 				    halco::hicann_dls::vx::v3::SynramOnDLS,
 				    signal_flow::vertex::CADCMembraneReadoutView::Columns>
 				    columns_per_synram;
-				for (auto const& an : atomic_neurons) {
-					columns_per_synram[an.toNeuronRowOnDLS().toSynramOnDLS()].push_back(
+				std::map<halco::hicann_dls::vx::v3::SynramOnDLS, std::vector<size_t>>
+				    slots_per_synram;
+				for (size_t i = 0; auto const& an : atomic_neurons) {
+					auto const synram = an.toNeuronRowOnDLS().toSynramOnDLS();
+					columns_per_synram[synram].push_back(
 					    an.toNeuronColumnOnDLS().toSynapseOnSynapseRow());
+					slots_per_synram[synram].push_back(i);
+					i++;
 				}
 
 				time_domain = partitioned_vertex.get_time_domain().value();
 
 				std::vector<grenade::common::VertexOnTopology> mapped_vertex_descriptors;
+				CADCRecorderMapping::Slots slots;
 				for (auto const& [synram, columns] : columns_per_synram) {
+					slots.push_back(std::move(slots_per_synram.at(synram)));
 					mapped_vertex_descriptors.push_back(
 					    get_topology().add_vertex(signal_flow::vertex::CADCMembraneReadoutView(
 					        columns, synram,
@@ -706,7 +715,7 @@ void RoutingRewrite::operator()() const
 				}
 				get_topology().add_inter_graph_hyper_edge(
 				    mapped_vertex_descriptors, {partitioned_vertex_descriptor},
-				    CADCRecorderMapping());
+				    CADCRecorderMapping(std::move(slots)));
 
 			} else if (auto const partitioned_madc_recorder =
 			               dynamic_cast<MADCRecorder const*>(&partitioned_vertex);
@@ -1485,9 +1494,6 @@ void RoutingRewrite::operator()() const
 				        partitioned_plasticity->recording, partitioned_plasticity->id,
 				        common::ChipOnConnection(), m_time_domains.at(execution_instance),
 				        execution_instance));
-				get_topology().add_inter_graph_hyper_edge(
-				    {mapped_vertex_descriptor}, {partitioned_vertex_descriptor},
-				    PlasticityRuleMapping());
 				// add in-edges
 				for (auto const& in_edge :
 				     get_topology().get_reference().in_edges(partitioned_vertex_descriptor)) {
@@ -1537,6 +1543,13 @@ void RoutingRewrite::operator()() const
 						}
 					}
 				}
+				// the mapping generates its translation of recording locations from the in-edges
+				// added above
+				get_topology().add_inter_graph_hyper_edge(
+				    {mapped_vertex_descriptor}, {partitioned_vertex_descriptor},
+				    PlasticityRuleMapping(
+				        {mapped_vertex_descriptor}, {partitioned_vertex_descriptor},
+				        get_topology()));
 			}
 		}
 	}
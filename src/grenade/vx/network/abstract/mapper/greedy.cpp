@@ -1,10 +1,17 @@
 #include "grenade/vx/network/abstract/mapper/greedy.h"
 
+#include "cereal/types/grenade/common/graph.h"
+#include "cereal/types/halco/common/geometry.h"
+#include "grenade/cerealization.h"
 #include "grenade/common/edge_on_topology.h"
 #include "grenade/common/execution_instance_id.h"
 #include "grenade/common/input_data.h"
+#include "grenade/common/inter_topology_hyper_edge/identity.h"
+#include "grenade/common/inter_topology_hyper_edge/projection.h"
 #include "grenade/common/linked_topology.h"
+#include "grenade/common/multi_index_sequence/cuboid.h"
 #include "grenade/common/population.h"
+#include "grenade/common/projection.h"
 #include "grenade/common/projection_connector/static.h"
 #include "grenade/common/topology_rewrite/add_linked_topology.h"
 #include "grenade/common/topology_rewrite/execution_instance.h"
@@ -18,6 +25,8 @@
 #include "grenade/vx/network/abstract/clock_cycle_time_domain_runtimes.h"
 #include "grenade/vx/network/abstract/mapped_topology_rewrite/placement.h"
 #include "grenade/vx/network/abstract/mapped_topology_rewrite/routing.h"
+#include "grenade/vx/network/abstract/mapping/uncalibrated_signed_synapse.h"
+#include "grenade/vx/network/abstract/mapping/uncalibrated_synapse.h"
 #include "grenade/vx/network/abstract/multicompartment/placement/algorithm_ruleset.h"
 #include "grenade/vx/network/abstract/plasticity_rule.h"
 #include "grenade/vx/network/abstract/population_cell/delay.h"
@@ -43,29 +52,629 @@
 #include "halco/hicann-dls/vx/v3/neuron.h"
 #include "halco/hicann-dls/vx/v3/padi.h"
 #include "hate/indent.h"
+#include "hate/join.h"
+#include "hate/math.h"
 #include "hate/timer.h"
+#include "lola/vx/v3/synapse.h"
 #include "pyhxcomm/vx/connection_handle.h"
 #include <Python.h>
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <set>
 #include <sstream>
+#include <string>
+#include <typeinfo>
+#include <vector>
 #include <boost/range/iterator_range_core.hpp>
+#include <cereal/archives/portable_binary.hpp>
+#include <cereal/types/memory.hpp>
+#include <cereal/types/polymorphic.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
 #include <log4cxx/logger.h>
 #include <pybind11/embed.h>
+#include <tbb/parallel_invoke.h>
 
 namespace grenade::vx::network::abstract {
 
+namespace {
+
+/**
+ * Check whether two topologies are equal up to optionally the parameter spaces of their
+ * populations and optionally the synapse parameter spaces of their projections.
+ * Descriptors of vertices and edges are required to match.
+ * @param topology Topology to compare
+ * @param other Other topology to compare
+ * @param ignore_population_parameter_spaces Whether to ignore parameter spaces of populations
+ * @param ignore_synapse_parameter_spaces Whether to ignore synapse parameter spaces of projections
+ */
+bool equal_up_to_parameter_spaces(
+    grenade::common::Topology const& topology,
+    grenade::common::Topology const& other,
+    bool ignore_population_parameter_spaces,
+    bool ignore_synapse_parameter_spaces)
+{
+	using namespace grenade::common;
+	if ((topology.num_vertices() != other.num_vertices()) ||
+	    (topology.num_edges() != other.num_edges())) {
+		return false;
+	}
+	for (auto const& vertex_descriptor : topology.vertices()) {
+		if (!other.contains(vertex_descriptor)) {
+			return false;
+		}
+		auto const& vertex = topology.get(vertex_descriptor);
+		auto const& other_vertex = other.get(vertex_descriptor);
+		if (vertex == other_vertex) {
+			continue;
+		}
+		// Parameter spaces are only valid for matching cell/synapse and shape/connector, so we
+		// compare these before replacing the parameter space in a copy.
+		if (auto const population_ptr = dynamic_cast<Population const*>(&vertex);
+		    population_ptr && ignore_population_parameter_spaces) {
+			auto const other_population_ptr = dynamic_cast<Population const*>(&other_vertex);
+			if (!other_population_ptr ||
+			    population_ptr->get_cell() != other_population_ptr->get_cell() ||
+			    population_ptr->get_shape() != other_population_ptr->get_shape()) {
+				return false;
+			}
+			Population population(*population_ptr);
+			population.set_parameter_space(other_population_ptr->get_parameter_space());
+			if (population != *other_population_ptr) {
+				return false;
+			}
+		} else if (auto const projection_ptr = dynamic_cast<Projection const*>(&vertex);
+		           projection_ptr && ignore_synapse_parameter_spaces) {
+			auto const other_projection_ptr = dynamic_cast<Projection const*>(&other_vertex);
+			if (!other_projection_ptr ||
+			    projection_ptr->get_synapse() != other_projection_ptr->get_synapse() ||
+			    projection_ptr->get_connector() != other_projection_ptr->get_connector()) {
+				return false;
+			}
+			Projection projection(*projection_ptr);
+			projection.set_synapse_parameter_space(
+			    other_projection_ptr->get_synapse_parameter_space());
+			if (projection != *other_projection_ptr) {
+				return false;
+			}
+		} else {
+			return false;
+		}
+	}
+	for (auto const& edge_descriptor : topology.edges()) {
+		if (!other.contains(edge_descriptor) ||
+		    (topology.source(edge_descriptor) != other.source(edge_descriptor)) ||
+		    (topology.target(edge_descriptor) != other.target(edge_descriptor)) ||
+		    (topology.get(edge_descriptor) != other.get(edge_descriptor))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Get number of hardware synapse circuits required per synapse parameterization.
+ * A weight larger than configurable using a single synapse circuit is spread using multiple
+ * circuits.
+ * @param parameter_space Synapse parameter space of projection
+ * @return Number of synapse circuits or std::nullopt for synapse types of unknown realization
+ */
+std::optional<std::vector<size_t>> get_num_synapse_circuits(
+    grenade::common::Projection::Synapse::ParameterSpace const& parameter_space)
+{
+	std::vector<size_t> num_synapse_circuits;
+	auto const add = [&num_synapse_circuits](uintmax_t const max_weight) {
+		num_synapse_circuits.push_back(std::max(
+		    hate::math::round_up_integer_division(
+		        max_weight, lola::vx::v3::SynapseMatrix::Weight::max),
+		    static_cast<size_t>(1)));
+	};
+	if (auto const uncalibrated_parameter_space =
+	        dynamic_cast<UncalibratedSynapse::ParameterSpace const*>(&parameter_space);
+	    uncalibrated_parameter_space) {
+		for (auto const& max_weight : uncalibrated_parameter_space->max_weights) {
+			add(max_weight.value());
+		}
+	} else if (auto const uncalibrated_signed_parameter_space =
+	               dynamic_cast<UncalibratedSignedSynapse::ParameterSpace const*>(
+	                   &parameter_space);
+	           uncalibrated_signed_parameter_space) {
+		for (auto const& max_weight : uncalibrated_signed_parameter_space->max_weights) {
+			add(std::max(UncalibratedSignedSynapse::Weight(0), max_weight).value());
+		}
+	} else {
+		return std::nullopt;
+	}
+	return num_synapse_circuits;
+}
+
+/**
+ * Check whether the projections of two topologies, which are equal up to synapse parameter
+ * spaces, require the same number of hardware synapse circuits.
+ * @param topology Topology to compare
+ * @param other Other topology to compare
+ */
+bool equal_num_synapse_circuits(
+    grenade::common::Topology const& topology, grenade::common::Topology const& other)
+{
+	using namespace grenade::common;
+	for (auto const& vertex_descriptor : topology.vertices()) {
+		auto const projection = dynamic_cast<Projection const*>(&topology.get(vertex_descriptor));
+		if (!projection) {
+			continue;
+		}
+		auto const& parameter_space = projection->get_synapse_parameter_space();
+		auto const& other_parameter_space =
+		    dynamic_cast<Projection const&>(other.get(vertex_descriptor))
+		        .get_synapse_parameter_space();
+		if (parameter_space == other_parameter_space) {
+			continue;
+		}
+		auto const num_synapse_circuits = get_num_synapse_circuits(parameter_space);
+		if (!num_synapse_circuits ||
+		    (num_synapse_circuits != get_num_synapse_circuits(other_parameter_space))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Split synapse parameter space of reference projection of inter-topology hyper edge onto its
+ * linked vertices.
+ * This reproduces the split performed by the topology rewrite, which generated the hyper edge.
+ * @param topology Linked topology containing the hyper edge
+ * @param descriptor Descriptor of hyper edge
+ * @param reference_projection Reference projection with synapse parameter space to split
+ * @return Synapse parameter space per linked vertex, nullptr for linked vertices without synapse
+ * parameter space, or std::nullopt for hyper edges of unknown split
+ */
+std::optional<std::vector<std::unique_ptr<grenade::common::Projection::Synapse::ParameterSpace>>>
+split_synapse_parameter_space(
+    grenade::common::LinkedTopology const& topology,
+    grenade::common::InterTopologyHyperEdgeOnLinkedTopology const& descriptor,
+    grenade::common::Projection const& reference_projection)
+{
+	using namespace grenade::common;
+	auto const& inter_topology_hyper_edge = topology.get(descriptor);
+	auto const& links = topology.links(descriptor);
+	auto const& parameter_space = reference_projection.get_synapse_parameter_space();
+
+	std::vector<std::unique_ptr<Projection::Synapse::ParameterSpace>> ret;
+	if (dynamic_cast<IdentityInterTopologyHyperEdge const*>(&inter_topology_hyper_edge)) {
+		for (size_t i = 0; i < links.size(); ++i) {
+			ret.push_back(parameter_space.copy());
+		}
+	} else if (dynamic_cast<ProjectionInterTopologyHyperEdge const*>(
+	               &inter_topology_hyper_edge)) {
+		for (auto const& link : links) {
+			auto const& link_connector =
+			    dynamic_cast<Projection const&>(topology.get(link)).get_connector();
+			auto const link_sequence = link_connector.get_input_sequence()->cartesian_product(
+			    *link_connector.get_output_sequence());
+			ret.push_back(parameter_space.get_section(
+			    *CuboidMultiIndexSequence({parameter_space.size()})
+			         .subset_restriction(
+			             *link_connector.get_synapse_parameterization_indices(*link_sequence))));
+		}
+	} else if (dynamic_cast<UncalibratedSignedSynapseMapping const*>(
+	               &inter_topology_hyper_edge)) {
+		auto const& signed_parameter_space =
+		    dynamic_cast<UncalibratedSignedSynapse::ParameterSpace const&>(parameter_space);
+		std::vector<UncalibratedSynapse::Weight> max_weights;
+		for (auto const& max_weight : signed_parameter_space.max_weights) {
+			max_weights.push_back(UncalibratedSynapse::Weight(
+			    std::max(UncalibratedSignedSynapse::Weight(0), max_weight)));
+		}
+		for (size_t i = 0; i < links.size(); ++i) {
+			ret.push_back(std::make_unique<UncalibratedSynapse::ParameterSpace>(max_weights));
+		}
+	} else if (dynamic_cast<UncalibratedSynapseMapping const*>(&inter_topology_hyper_edge)) {
+		// The synapse circuits only depend on their number per synapse parameterization.
+		ret.resize(links.size());
+	} else {
+		return std::nullopt;
+	}
+	return ret;
+}
+
+/**
+ * Copy mapped topology onto a new root topology, which only differs from the root topology of the
+ * mapped topology in synapse parameter spaces of projections.
+ * The changed synapse parameter spaces are split onto the linked projections layer by layer.
+ * @param mapped_topology Mapped topology to copy
+ * @param old_root Root topology the mapped topology was generated for
+ * @param root New root topology
+ * @return Copied mapped topology or nullptr, if a synapse parameter space can't be split or the
+ * number of required hardware synapse circuits changes
+ */
+std::shared_ptr<grenade::common::LinkedTopology> rebase_synapse_parameter_spaces(
+    grenade::common::LinkedTopology const& mapped_topology,
+    grenade::common::Topology const& old_root,
+    std::shared_ptr<grenade::common::Topology const> root)
+{
+	using namespace grenade::common;
+	std::shared_ptr<Topology const> reference;
+	Topology const* old_reference = nullptr;
+	if (auto const linked_reference =
+	        dynamic_cast<LinkedTopology const*>(&mapped_topology.get_reference());
+	    linked_reference) {
+		reference = rebase_synapse_parameter_spaces(*linked_reference, old_root, std::move(root));
+		if (!reference) {
+			return nullptr;
+		}
+		old_reference = linked_reference;
+	} else {
+		reference = std::move(root);
+		old_reference = &old_root;
+	}
+
+	auto ret = std::make_shared<LinkedTopology>(reference);
+	static_cast<LinkedTopology::LinkedGraph&>(*ret) = mapped_topology;
+	ret->inter_topology_time_domain_edges = mapped_topology.inter_topology_time_domain_edges;
+
+	for (auto const& vertex_descriptor : reference->vertices()) {
+		auto const reference_projection =
+		    dynamic_cast<Projection const*>(&reference->get(vertex_descriptor));
+		if (!reference_projection) {
+			continue;
+		}
+		auto const& old_parameter_space =
+		    dynamic_cast<Projection const&>(old_reference->get(vertex_descriptor))
+		        .get_synapse_parameter_space();
+		if (reference_projection->get_synapse_parameter_space() == old_parameter_space) {
+			continue;
+		}
+		auto const num_synapse_circuits =
+		    get_num_synapse_circuits(reference_projection->get_synapse_parameter_space());
+		if (!num_synapse_circuits ||
+		    (num_synapse_circuits != get_num_synapse_circuits(old_parameter_space))) {
+			return nullptr;
+		}
+		for (auto const& descriptor :
+		     mapped_topology.inter_graph_hyper_edges_by_reference(vertex_descriptor)) {
+			auto const parameter_spaces =
+			    split_synapse_parameter_space(mapped_topology, descriptor, *reference_projection);
+			if (!parameter_spaces) {
+				return nullptr;
+			}
+			auto const& links = mapped_topology.links(descriptor);
+			for (size_t i = 0; i < links.size(); ++i) {
+				if (!parameter_spaces->at(i)) {
+					continue;
+				}
+				Projection projection(dynamic_cast<Projection const&>(ret->get(links.at(i))));
+				projection.set_synapse_parameter_space(*parameter_spaces->at(i));
+				ret->set(links.at(i), std::move(projection));
+			}
+		}
+	}
+	return ret;
+}
+
+/**
+ * Serialize topology into key of persistent cache.
+ * A topology, of which all vertex types support serialization, is serialized as a whole.
+ * Otherwise, the descriptors and edges are serialized element-wise and vertices of types without
+ * serialization support enter by their printed representation.
+ */
+void serialize_key(
+    cereal::PortableBinaryOutputArchive& ar, grenade::common::Topology const& topology)
+{
+	using namespace grenade::common;
+	{
+		std::ostringstream ss;
+		try {
+			{
+				cereal::PortableBinaryOutputArchive topology_ar(ss);
+				topology_ar(topology);
+			}
+			ar(true, ss.str());
+			return;
+		} catch (cereal::Exception const&) {
+		}
+	}
+	ar(false);
+	for (auto const& descriptor : topology.vertices()) {
+		std::ostringstream ss;
+		bool serialized = true;
+		try {
+			cereal::PortableBinaryOutputArchive vertex_ar(ss);
+			std::unique_ptr<Vertex> const vertex = topology.get(descriptor).copy();
+			vertex_ar(vertex);
+		} catch (cereal::Exception const&) {
+			serialized = false;
+		}
+		if (!serialized) {
+			ss.str("");
+			ss << topology.get(descriptor);
+		}
+		ar(descriptor, serialized, ss.str());
+	}
+	for (auto const& descriptor : topology.edges()) {
+		ar(descriptor, topology.source(descriptor), topology.target(descriptor),
+		   topology.get(descriptor));
+	}
+}
+
+/**
+ * Key of placement result in persistent cache.
+ * The placement result is fully determined by the partitioned topology and the mode and
+ * permutations of the placer.
+ */
+std::string get_placement_key(
+    GreedyPlacer const& placer, grenade::common::Topology const& partitioned_topology)
+{
+	std::ostringstream ss;
+	{
+		cereal::PortableBinaryOutputArchive ar(ss);
+		ar(std::string("placement"), static_cast<int>(placer.get_mode()));
+		std::vector<size_t> neuron_permutation;
+		for (auto const& neuron : placer.get_neuron_permutation()) {
+			neuron_permutation.push_back(neuron.toEnum().value());
+		}
+		std::vector<size_t> background_source_permutation;
+		for (auto const& padi_bus : placer.get_background_source_permutation()) {
+			background_source_permutation.push_back(padi_bus.value());
+		}
+		ar(neuron_permutation, background_source_permutation);
+		serialize_key(ar, partitioned_topology);
+	}
+	return ss.str();
+}
+
+/**
+ * Key of routing result in persistent cache.
+ * The routing result is determined by the partitioned topology, the placed hardware topology
+ * including calibration and the router including its options.
+ * Only the options of the GreedyRouter are known, for other routers no key is generated and
+ * their results are not cached persistently.
+ */
+std::optional<std::string> get_routing_key(
+    routing::Router const& router,
+    grenade::common::Topology const& partitioned_topology,
+    grenade::common::Topology const& placed_topology)
+{
+	auto const greedy_router = dynamic_cast<routing::GreedyRouter const*>(&router);
+	if (!greedy_router) {
+		return std::nullopt;
+	}
+	std::ostringstream ss;
+	{
+		cereal::PortableBinaryOutputArchive ar(ss);
+		std::ostringstream options;
+		options << greedy_router->get_options();
+		ar(std::string("routing"), std::string(typeid(router).name()), options.str());
+		serialize_key(ar, partitioned_topology);
+		serialize_key(ar, placed_topology);
+	}
+	return ss.str();
+}
+
+/**
+ * Validate connectum of hardware network against expected connectum of abstract network by
+ * comparison of the sorted full connectums.
+ * On mismatch, the differing connections are logged and an exception is thrown.
+ * @return Number of compared connections
+ */
+size_t validate_full_connectum(
+    grenade::common::LinkedTopology const& topology,
+    ConnectumSourceFilter const& source_filter,
+    log4cxx::LoggerPtr const& logger)
+{
+	auto connectum_from_abstract_network =
+	    generate_connectum_from_abstract_network(topology, source_filter);
+	auto connectum_from_hardware_network =
+	    generate_connectum_from_hardware_network(topology, source_filter);
+	std::sort(connectum_from_abstract_network.begin(), connectum_from_abstract_network.end());
+	std::sort(connectum_from_hardware_network.begin(), connectum_from_hardware_network.end());
+	if (connectum_from_abstract_network != connectum_from_hardware_network) {
+		std::vector<ConnectumConnection> missing_in_hardware_network;
+		std::set_difference(
+		    connectum_from_hardware_network.begin(), connectum_from_hardware_network.end(),
+		    connectum_from_abstract_network.begin(), connectum_from_abstract_network.end(),
+		    std::back_inserter(missing_in_hardware_network));
+		std::vector<ConnectumConnection> missing_in_abstract_network;
+		std::set_difference(
+		    connectum_from_abstract_network.begin(), connectum_from_abstract_network.end(),
+		    connectum_from_hardware_network.begin(), connectum_from_hardware_network.end(),
+		    std::back_inserter(missing_in_abstract_network));
+		if (missing_in_hardware_network.empty() && missing_in_abstract_network.empty()) {
+			throw std::logic_error("Size difference in abstract and hardware connectum but no "
+			                       "element difference found.");
+		}
+		LOG4CXX_ERROR(
+		    logger, "Size mismatch between abstract and hardware connectum: abstract("
+		                << connectum_from_abstract_network.size() << "), hardware("
+		                << connectum_from_hardware_network.size() << ").");
+		if (!missing_in_hardware_network.empty()) {
+			std::stringstream ss;
+			hate::IndentingOstream iss(ss);
+			iss << "Abstract network connectum missing in hardware network:\n";
+			iss << hate::Indentation("\t\t");
+			iss << hate::join(missing_in_hardware_network, "\n");
+			LOG4CXX_ERROR(logger, ss.str());
+		}
+		if (!missing_in_abstract_network.empty()) {
+			std::stringstream ss;
+			hate::IndentingOstream iss(ss);
+			iss << hate::Indentation("\t\t");
+			iss << "Hardware network connectum missing in abstract network:\n";
+			iss << hate::join(missing_in_abstract_network, "\n");
+			LOG4CXX_ERROR(logger, ss.str());
+		}
+		throw std::runtime_error("Found mapping invalid.");
+	}
+	return connectum_from_abstract_network.size();
+}
+
+/**
+ * Validate connectum of hardware network against expected connectum of abstract network by
+ * comparison of digests of their fragments, which are generated concurrently.
+ * Only on mismatch, the full connectums of the mismatching source populations are generated to
+ * report the differing connections.
+ * @return Number of compared connections
+ */
+size_t validate_connectum_digest(
+    grenade::common::LinkedTopology const& topology,
+    ConnectumSourceFilter const& source_filter,
+    log4cxx::LoggerPtr const& logger)
+{
+	ConnectumDigest digest_from_abstract_network;
+	ConnectumDigest digest_from_hardware_network;
+	tbb::parallel_invoke(
+	    [&]() {
+		    digest_from_abstract_network =
+		        generate_connectum_digest_from_abstract_network(topology, source_filter);
+	    },
+	    [&]() {
+		    digest_from_hardware_network =
+		        generate_connectum_digest_from_hardware_network(topology, source_filter);
+	    });
+	if (digest_from_abstract_network == digest_from_hardware_network) {
+		return digest_from_abstract_network.size();
+	}
+
+	auto const mismatching_fragments =
+	    digest_from_abstract_network.get_mismatching_fragments(digest_from_hardware_network);
+	std::stringstream ss;
+	std::set<grenade::common::VertexOnTopology> mismatching_source_populations;
+	for (auto const& [source_population, projection] : mismatching_fragments) {
+		ss << "(" << source_population << ", " << projection << ") ";
+		mismatching_source_populations.insert(source_population);
+	}
+	LOG4CXX_ERROR(
+	    logger, "Digest mismatch between abstract and hardware connectum in "
+	                << mismatching_fragments.size()
+	                << " fragments of (source population, projection): " << ss.str());
+	validate_full_connectum(
+	    topology,
+	    [&mismatching_source_populations](auto const& source_population) {
+		    return mismatching_source_populations.contains(source_population);
+	    },
+	    logger);
+	throw std::logic_error(
+	    "Digest difference in abstract and hardware connectum but no element difference found.");
+}
+
+} // namespace
+
+bool GreedyMapper::ConnectumValidation::contains(
+    grenade::common::VertexOnTopology const& source_population) const
+{
+	if (sampling_fraction >= 1.) {
+		return true;
+	}
+	// splitmix64 finalizer to uniformly distribute the descriptor and seed
+	uint64_t value = source_population.value() ^ (sampling_seed * 0x9e3779b97f4a7c15ull);
+	value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+	value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+	value = value ^ (value >> 31);
+	// map upper 53 bits to [0, 1)
+	return static_cast<double>(value >> 11) * 0x1.0p-53 < sampling_fraction;
+}
+
+struct GreedyMapper::Cache
+{
+	std::mutex mutex;
+
+	/**
+	 * Partitioned topology and placement result found for it.
+	 */
+	std::shared_ptr<grenade::common::Topology const> partitioned_topology;
+	std::optional<PlacementResult> placement_result;
+
+	/**
+	 * Partitioned topology, placed hardware topology before routing and routing result found for
+	 * them.
+	 */
+	std::shared_ptr<grenade::common::Topology const> routed_partitioned_topology;
+	std::shared_ptr<grenade::common::Topology const> placed_topology;
+	std::optional<RoutingResult> routing_result;
+
+	/**
+	 * Model topology, calibration and executor and mapped topology found for them.
+	 * The calibration and executor are only compared by identity and never accessed.
+	 */
+	std::shared_ptr<grenade::common::Topology const> model_topology;
+	Calibration const* calibration = nullptr;
+	grenade::vx::execution::JITGraphExecutor const* executor = nullptr;
+	std::shared_ptr<grenade::common::LinkedTopology const> mapped_topology;
+
+	CacheStatistics statistics;
+};
+
 GreedyMapper::GreedyMapper() :
     m_placer(),
     m_router(std::make_shared<routing::GreedyRouter>()),
-    m_logger(log4cxx::Logger::getLogger("grenade.network.abstract.GreedyMapper"))
+    m_logger(log4cxx::Logger::getLogger("grenade.network.abstract.GreedyMapper")),
+    m_cache(std::make_unique<Cache>())
 {
 }
 
+GreedyMapper::GreedyMapper(GreedyMapper const& other) :
+    m_placer(other.m_placer),
+    m_router(other.m_router),
+    m_connectum_validation(other.m_connectum_validation),
+    m_logger(other.m_logger),
+    m_persistent_cache(other.m_persistent_cache),
+    m_cache(std::make_unique<Cache>())
+{
+}
+
+GreedyMapper& GreedyMapper::operator=(GreedyMapper const& other)
+{
+	if (this != &other) {
+		m_placer = other.m_placer;
+		m_router = other.m_router;
+		m_connectum_validation = other.m_connectum_validation;
+		m_persistent_cache = other.m_persistent_cache;
+		clear_cache();
+	}
+	return *this;
+}
+
+GreedyMapper::~GreedyMapper() {}
+
+void GreedyMapper::clear_cache()
+{
+	std::lock_guard lock(m_cache->mutex);
+	m_cache->partitioned_topology.reset();
+	m_cache->placement_result.reset();
+	m_cache->routed_partitioned_topology.reset();
+	m_cache->placed_topology.reset();
+	m_cache->routing_result.reset();
+	m_cache->model_topology.reset();
+	m_cache->calibration = nullptr;
+	m_cache->executor = nullptr;
+	m_cache->mapped_topology.reset();
+	m_cache->statistics = CacheStatistics();
+}
+
+GreedyMapper::CacheStatistics GreedyMapper::get_cache_statistics() const
+{
+	std::lock_guard lock(m_cache->mutex);
+	return m_cache->statistics;
+}
+
+void GreedyMapper::set_persistent_cache(std::shared_ptr<PersistentMappingCache> cache)
+{
+	m_persistent_cache = std::move(cache);
+}
+
+std::shared_ptr<PersistentMappingCache> GreedyMapper::get_persistent_cache() const
+{
+	return m_persistent_cache;
+}
+
 void GreedyMapper::set_neuron_permutation(NeuronPermutation value)
 {
 	m_placer.set_neuron_permutation(std::move(value));
+	clear_cache();
 }
 
 GreedyMapper::NeuronPermutation const& GreedyMapper::get_neuron_permutation() const
@@ -76,6 +685,7 @@ GreedyMapper::NeuronPermutation const& GreedyMapper::get_neuron_permutation() co
 void GreedyMapper::set_background_source_permutation(BackgroundSourcePermutation value)
 {
 	m_placer.set_background_source_permutation(std::move(value));
+	clear_cache();
 }
 
 GreedyMapper::BackgroundSourcePermutation const& GreedyMapper::get_background_source_permutation()
@@ -84,9 +694,36 @@ GreedyMapper::BackgroundSourcePermutation const& GreedyMapper::get_background_so
 	return m_placer.get_background_source_permutation();
 }
 
+GreedyPlacer::Mode GreedyMapper::get_placement_mode() const
+{
+	return m_placer.get_mode();
+}
+
+void GreedyMapper::set_placement_mode(GreedyPlacer::Mode value)
+{
+	m_placer.set_mode(value);
+	clear_cache();
+}
+
+GreedyMapper::ConnectumValidation const& GreedyMapper::get_connectum_validation() const
+{
+	return m_connectum_validation;
+}
+
+void GreedyMapper::set_connectum_validation(ConnectumValidation value)
+{
+	m_connectum_validation = std::move(value);
+}
+
 void GreedyMapper::set_router(std::shared_ptr<routing::Router> router)
 {
 	m_router = std::move(router);
+	std::lock_guard lock(m_cache->mutex);
+	m_cache->routed_partitioned_topology.reset();
+	m_cache->placed_topology.reset();
+	m_cache->routing_result.reset();
+	m_cache->model_topology.reset();
+	m_cache->mapped_topology.reset();
 }
 
 
@@ -96,9 +733,45 @@ grenade::common::LinkedTopology GreedyMapper::operator()(
     grenade::vx::execution::JITGraphExecutor& executor) const
 {
 	using namespace grenade::common;
-	auto mapped_topology = std::make_shared<LinkedTopology>(topology);
 	assert(topology);
 
+	// reuse mapped topology of previous invocation for a model topology, which only differs in
+	// synapse parameter spaces not altering the number of required hardware synapse circuits
+	{
+		hate::Timer reuse_timer;
+		std::shared_ptr<Topology const> cached_model_topology;
+		std::shared_ptr<LinkedTopology const> cached_mapped_topology;
+		{
+			std::lock_guard lock(m_cache->mutex);
+			if ((m_cache->calibration == &calibration) && (m_cache->executor == &executor)) {
+				cached_model_topology = m_cache->model_topology;
+				cached_mapped_topology = m_cache->mapped_topology;
+			}
+		}
+		if (cached_mapped_topology &&
+		    equal_up_to_parameter_spaces(*cached_model_topology, *topology, false, true)) {
+			if (auto const mapped_topology = rebase_synapse_parameter_spaces(
+			        *cached_mapped_topology, *cached_model_topology, topology);
+			    mapped_topology) {
+				{
+					std::lock_guard lock(m_cache->mutex);
+					m_cache->model_topology = std::make_shared<Topology const>(*topology);
+					m_cache->mapped_topology = mapped_topology;
+					m_cache->statistics.num_reused_placements++;
+					m_cache->statistics.num_reused_routings++;
+					m_cache->statistics.num_reused_mappings++;
+				}
+				LOG4CXX_DEBUG(
+				    m_logger, "Reused cached mapped topology with split synapse parameter spaces "
+				              "in "
+				                  << reuse_timer.print() << ".");
+				return *mapped_topology;
+			}
+		}
+	}
+
+	auto mapped_topology = std::make_shared<LinkedTopology>(topology);
+
 	// partitioning-compatibility topology between model and partitioned topology
 	//
 	// This linked topology implements a mapping from parts of the model topology which can't be
@@ -224,7 +897,44 @@ grenade::common::LinkedTopology GreedyMapper::operator()(
 
 	// back end topology
 	hate::Timer mapping_timer;
-	auto placement_result = m_placer(*mapped_topology);
+	auto const partitioned_topology =
+	    std::make_shared<Topology const>(static_cast<Topology const&>(*mapped_topology));
+	std::optional<PlacementResult> cached_placement_result;
+	{
+		std::lock_guard lock(m_cache->mutex);
+		if (m_cache->partitioned_topology &&
+		    equal_up_to_parameter_spaces(
+		        *m_cache->partitioned_topology, *partitioned_topology, true, true)) {
+			cached_placement_result = m_cache->placement_result;
+			m_cache->statistics.num_reused_placements++;
+		}
+	}
+	PlacementResult placement_result;
+	if (cached_placement_result) {
+		placement_result = std::move(*cached_placement_result);
+		placement_result.timing_statistics = PlacementResult::TimingStatistics{};
+		LOG4CXX_DEBUG(m_logger, "Reusing cached placement result.");
+	} else {
+		std::optional<std::string> persistent_placement_key;
+		std::optional<PlacementResult> persistent_placement_result;
+		if (m_persistent_cache) {
+			persistent_placement_key = get_placement_key(m_placer, *partitioned_topology);
+			persistent_placement_result =
+			    m_persistent_cache->load_placement(*persistent_placement_key);
+		}
+		if (persistent_placement_result) {
+			placement_result = std::move(*persistent_placement_result);
+			LOG4CXX_DEBUG(m_logger, "Reusing persistently cached placement result.");
+		} else {
+			placement_result = m_placer(*mapped_topology);
+			if (m_persistent_cache) {
+				m_persistent_cache->store_placement(*persistent_placement_key, placement_result);
+			}
+		}
+		std::lock_guard lock(m_cache->mutex);
+		m_cache->partitioned_topology = partitioned_topology;
+		m_cache->placement_result = placement_result;
+	}
 
 	{
 		AddLinkedTopologyRewrite add_linked_topology(mapped_topology);
@@ -246,11 +956,52 @@ grenade::common::LinkedTopology GreedyMapper::operator()(
 	if (!m_router) {
 		throw std::logic_error("Unexpected access to moved-from router.");
 	}
-	auto routing_result = (*m_router)(*mapped_topology);
+	auto const placed_topology =
+	    std::make_shared<Topology const>(static_cast<Topology const&>(*mapped_topology));
+	std::optional<RoutingResult> routing_result;
+	{
+		std::lock_guard lock(m_cache->mutex);
+		if (m_cache->routing_result && (*m_cache->placed_topology == *placed_topology) &&
+		    equal_up_to_parameter_spaces(
+		        *m_cache->routed_partitioned_topology, *partitioned_topology, true, true) &&
+		    equal_num_synapse_circuits(
+		        *m_cache->routed_partitioned_topology, *partitioned_topology)) {
+			routing_result = m_cache->routing_result;
+			routing_result->timing_statistics = RoutingResult::TimingStatistics{};
+			m_cache->statistics.num_reused_routings++;
+		}
+	}
+	// The connectum only depends on the structure of the partitioned and hardware topology,
+	// which for a reused routing result is unchanged to the already validated mapping.
+	bool const validate_connectum = !routing_result;
+	if (routing_result) {
+		LOG4CXX_DEBUG(m_logger, "Reusing cached routing result.");
+	} else {
+		std::optional<std::string> persistent_routing_key;
+		if (m_persistent_cache) {
+			persistent_routing_key =
+			    get_routing_key(*m_router, *partitioned_topology, *placed_topology);
+		}
+		if (persistent_routing_key) {
+			routing_result = m_persistent_cache->load_routing(*persistent_routing_key);
+		}
+		if (routing_result) {
+			LOG4CXX_DEBUG(m_logger, "Reusing persistently cached routing result.");
+		} else {
+			routing_result = (*m_router)(*mapped_topology);
+			if (persistent_routing_key) {
+				m_persistent_cache->store_routing(*persistent_routing_key, *routing_result);
+			}
+		}
+		std::lock_guard lock(m_cache->mutex);
+		m_cache->routed_partitioned_topology = partitioned_topology;
+		m_cache->placed_topology = placed_topology;
+		m_cache->routing_result = routing_result;
+	}
 	LOG4CXX_TRACE(m_logger, "Routed network in " << network_routing_timer.print() << ".");
 
 	hate::Timer network_graph_timer;
-	RoutingRewrite routing_rewrite(std::move(routing_result), mapped_topology);
+	RoutingRewrite routing_rewrite(std::move(*routing_result), mapped_topology);
 	routing_rewrite();
 	LOG4CXX_TRACE(
 	    m_logger, "Constructed mapped topology in " << network_graph_timer.print() << ".");
@@ -263,57 +1014,42 @@ grenade::common::LinkedTopology GreedyMapper::operator()(
 	}
 
 	// check that connectum of hardware network matches expected connectum of abstract network
-	try {
-		auto connectum_from_abstract_network =
-		    generate_connectum_from_abstract_network(*mapped_topology);
-		auto connectum_from_hardware_network =
-		    generate_connectum_from_hardware_network(*mapped_topology);
-		std::sort(connectum_from_abstract_network.begin(), connectum_from_abstract_network.end());
-		std::sort(connectum_from_hardware_network.begin(), connectum_from_hardware_network.end());
-		if (connectum_from_abstract_network != connectum_from_hardware_network) {
-			std::vector<ConnectumConnection> missing_in_hardware_network;
-			std::set_difference(
-			    connectum_from_hardware_network.begin(), connectum_from_hardware_network.end(),
-			    connectum_from_abstract_network.begin(), connectum_from_abstract_network.end(),
-			    std::back_inserter(missing_in_hardware_network));
-			std::vector<ConnectumConnection> missing_in_abstract_network;
-			std::set_difference(
-			    connectum_from_abstract_network.begin(), connectum_from_abstract_network.end(),
-			    connectum_from_hardware_network.begin(), connectum_from_hardware_network.end(),
-			    std::back_inserter(missing_in_abstract_network));
-			if (missing_in_hardware_network.empty() && missing_in_abstract_network.empty()) {
-				throw std::logic_error("Size difference in abstract and hardware connectum but no "
-				                       "element difference found.");
+	if (validate_connectum &&
+	    (m_connectum_validation.mode != ConnectumValidation::Mode::disabled)) {
+		ConnectumSourceFilter source_filter;
+		if (m_connectum_validation.sampling_fraction < 1.) {
+			source_filter = [this](auto const& source_population) {
+				return m_connectum_validation.contains(source_population);
+			};
+		}
+		try {
+			size_t num_validated_connections = 0;
+			if (m_connectum_validation.mode == ConnectumValidation::Mode::full) {
+				num_validated_connections =
+				    validate_full_connectum(*mapped_topology, source_filter, m_logger);
+			} else {
+				num_validated_connections =
+				    validate_connectum_digest(*mapped_topology, source_filter, m_logger);
 			}
+			LOG4CXX_DEBUG(
+			    m_logger, "Validated connectum of " << num_validated_connections
+			                                        << " connections.");
+		} catch (InvalidNetworkGraph const& error) {
 			LOG4CXX_ERROR(
-			    m_logger, "Size mismatch between abstract and hardware connectum: abstract("
-			                  << connectum_from_abstract_network.size() << "), hardware("
-			                  << connectum_from_hardware_network.size() << ").");
-			if (!missing_in_hardware_network.empty()) {
-				std::stringstream ss;
-				hate::IndentingOstream iss(ss);
-				iss << "Abstract network connectum missing in hardware network:\n";
-				iss << hate::Indentation("\t\t");
-				iss << hate::join(missing_in_hardware_network, "\n");
-				LOG4CXX_ERROR(m_logger, ss.str());
-			}
-			if (!missing_in_abstract_network.empty()) {
-				std::stringstream ss;
-				hate::IndentingOstream iss(ss);
-				iss << hate::Indentation("\t\t");
-				iss << "Hardware network connectum missing in abstract network:\n";
-				iss << hate::join(missing_in_abstract_network, "\n");
-				LOG4CXX_ERROR(m_logger, ss.str());
-			}
-			throw std::runtime_error("Found mapping invalid.");
+			    m_logger, "Error during generation of connectum to validate: " << error.what());
 		}
-	} catch (InvalidNetworkGraph const& error) {
-		LOG4CXX_ERROR(
-		    m_logger, "Error during generation of connectum to validate: " << error.what());
 	}
 
 	LOG4CXX_TRACE(m_logger, "Checked validity of found mapping in " << valid_timer.print() << ".");
 
+	{
+		std::lock_guard lock(m_cache->mutex);
+		m_cache->model_topology = std::make_shared<Topology const>(*topology);
+		m_cache->calibration = &calibration;
+		m_cache->executor = &executor;
+		m_cache->mapped_topology = std::make_shared<LinkedTopology const>(*mapped_topology);
+	}
+
 	return std::move(*mapped_topology);
 }
 
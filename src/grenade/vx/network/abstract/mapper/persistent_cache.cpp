@@ -0,0 +1,280 @@
+#include "grenade/vx/network/abstract/mapper/persistent_cache.h"
+
+#include "cereal/types/grenade/vx/network/placement_result.h"
+#include "cereal/types/grenade/vx/network/routing_result.h"
+#include "grenade/cerealization.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <cereal/archives/portable_binary.hpp>
+#include <cereal/types/string.hpp>
+#include <log4cxx/logger.h>
+#include <unistd.h>
+
+namespace grenade::vx::network::abstract {
+
+namespace {
+
+/**
+ * Identifier at the beginning of every entry.
+ */
+constexpr char entry_magic[] = "grenade-persistent-mapping-cache";
+
+/**
+ * Version of the entry format.
+ * Increment on any change of the serialized representation of the entries.
+ */
+constexpr uint32_t entry_version = 0;
+
+constexpr char placement_extension[] = ".placement";
+constexpr char routing_extension[] = ".routing";
+
+/**
+ * FNV-1a hash of data with given offset basis.
+ * This hash is stable across processes and platforms as opposed to std::hash.
+ */
+uint64_t fnv1a(std::string const& data, uint64_t offset_basis = 14695981039346656037ull)
+{
+	uint64_t hash = offset_basis;
+	for (auto const c : data) {
+		hash ^= static_cast<uint64_t>(static_cast<unsigned char>(c));
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+/**
+ * Digest of key consisting of two hashes and the key size.
+ * The first hash is used as file name.
+ */
+typedef std::tuple<uint64_t, uint64_t, uint64_t> KeyDigest;
+
+KeyDigest digest(std::string const& key)
+{
+	auto const first = fnv1a(key);
+	return {first, fnv1a(key, first ^ 0x9e3779b97f4a7c15ull), key.size()};
+}
+
+std::filesystem::path entry_path(
+    std::string const& directory, KeyDigest const& key_digest, std::string const& extension)
+{
+	std::stringstream ss;
+	ss << std::hex;
+	ss.width(16);
+	ss.fill('0');
+	ss << std::get<0>(key_digest);
+	return std::filesystem::path(directory) / (ss.str() + extension);
+}
+
+bool is_entry(std::filesystem::directory_entry const& entry)
+{
+	auto const extension = entry.path().extension().string();
+	return entry.is_regular_file() &&
+	       (extension == placement_extension || extension == routing_extension);
+}
+
+} // namespace
+
+PersistentMappingCache::PersistentMappingCache(std::string directory, size_t max_size_in_bytes) :
+    m_directory(std::move(directory)),
+    m_max_size_in_bytes(max_size_in_bytes),
+    m_logger(log4cxx::Logger::getLogger("grenade.network.abstract.PersistentMappingCache"))
+{
+	std::filesystem::create_directories(m_directory);
+}
+
+std::string const& PersistentMappingCache::get_directory() const
+{
+	return m_directory;
+}
+
+size_t PersistentMappingCache::get_max_size_in_bytes() const
+{
+	return m_max_size_in_bytes;
+}
+
+template <typename T>
+std::optional<T> PersistentMappingCache::load(
+    std::string const& key, std::string const& extension) const
+{
+	auto const key_digest = digest(key);
+	auto const path = entry_path(m_directory, key_digest, extension);
+
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		return std::nullopt;
+	}
+
+	try {
+		cereal::PortableBinaryInputArchive ar(file);
+		std::string magic;
+		uint32_t version;
+		KeyDigest stored_key_digest;
+		ar(magic, version, std::get<0>(stored_key_digest), std::get<1>(stored_key_digest),
+		   std::get<2>(stored_key_digest));
+		if (magic != entry_magic || version != entry_version) {
+			throw std::runtime_error("Unsupported entry format.");
+		}
+		if (stored_key_digest != key_digest) {
+			// hash collision of file name or stale entry, the entry is valid but not for this key
+			LOG4CXX_DEBUG(m_logger, "Entry " << path << " does not match key.");
+			return std::nullopt;
+		}
+		std::string payload;
+		uint64_t payload_hash;
+		ar(payload, payload_hash);
+		if (fnv1a(payload) != payload_hash) {
+			throw std::runtime_error("Payload hash mismatch.");
+		}
+		std::istringstream payload_stream(payload);
+		cereal::PortableBinaryInputArchive payload_ar(payload_stream);
+		T value;
+		payload_ar(value);
+
+		// mark as recently used for eviction
+		std::error_code ec;
+		std::filesystem::last_write_time(
+		    path, std::filesystem::file_time_type::clock::now(), ec);
+
+		LOG4CXX_DEBUG(m_logger, "Loaded entry " << path << ".");
+		return value;
+	} catch (std::exception const& error) {
+		LOG4CXX_WARN(
+		    m_logger, "Removing invalid entry " << path << ": " << error.what() << ".");
+		std::error_code ec;
+		std::filesystem::remove(path, ec);
+		return std::nullopt;
+	}
+}
+
+template <typename T>
+void PersistentMappingCache::store(
+    std::string const& key, std::string const& extension, T const& value) const
+{
+	auto const key_digest = digest(key);
+	auto const path = entry_path(m_directory, key_digest, extension);
+
+	std::ostringstream payload_stream;
+	{
+		cereal::PortableBinaryOutputArchive payload_ar(payload_stream);
+		payload_ar(value);
+	}
+	auto const payload = payload_stream.str();
+
+	// write to unique temporary file and rename afterwards, which is atomic on POSIX systems
+	std::stringstream tmp_suffix;
+	tmp_suffix << ".tmp." << getpid() << "."
+	           << std::hash<std::thread::id>{}(std::this_thread::get_id());
+	auto const tmp_path = std::filesystem::path(path.string() + tmp_suffix.str());
+	{
+		std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+		if (!file) {
+			LOG4CXX_WARN(m_logger, "Could not open " << tmp_path << " for writing.");
+			return;
+		}
+		cereal::PortableBinaryOutputArchive ar(file);
+		ar(std::string(entry_magic), entry_version, std::get<0>(key_digest),
+		   std::get<1>(key_digest), std::get<2>(key_digest), payload, fnv1a(payload));
+	}
+	std::error_code ec;
+	std::filesystem::rename(tmp_path, path, ec);
+	if (ec) {
+		LOG4CXX_WARN(m_logger, "Could not store entry " << path << ": " << ec.message() << ".");
+		std::filesystem::remove(tmp_path, ec);
+		return;
+	}
+	LOG4CXX_DEBUG(m_logger, "Stored entry " << path << ".");
+
+	evict();
+}
+
+void PersistentMappingCache::evict() const
+{
+	std::vector<std::tuple<std::filesystem::file_time_type, size_t, std::filesystem::path>>
+	    entries;
+	size_t accumulated_size = 0;
+	std::error_code ec;
+	for (auto const& entry : std::filesystem::directory_iterator(m_directory, ec)) {
+		if (!is_entry(entry)) {
+			continue;
+		}
+		// entries might be removed concurrently by other processes
+		auto const size = entry.file_size(ec);
+		if (ec) {
+			continue;
+		}
+		auto const time = entry.last_write_time(ec);
+		if (ec) {
+			continue;
+		}
+		entries.emplace_back(time, size, entry.path());
+		accumulated_size += size;
+	}
+	if (accumulated_size <= m_max_size_in_bytes) {
+		return;
+	}
+	std::sort(entries.begin(), entries.end());
+	for (auto const& [_, size, path] : entries) {
+		if (accumulated_size <= m_max_size_in_bytes) {
+			break;
+		}
+		std::filesystem::remove(path, ec);
+		accumulated_size -= size;
+		LOG4CXX_DEBUG(m_logger, "Evicted entry " << path << ".");
+	}
+}
+
+std::optional<PlacementResult> PersistentMappingCache::load_placement(std::string const& key) const
+{
+	return load<PlacementResult>(key, placement_extension);
+}
+
+void PersistentMappingCache::store_placement(
+    std::string const& key, PlacementResult const& value) const
+{
+	store(key, placement_extension, value);
+}
+
+std::optional<RoutingResult> PersistentMappingCache::load_routing(std::string const& key) const
+{
+	return load<RoutingResult>(key, routing_extension);
+}
+
+void PersistentMappingCache::store_routing(std::string const& key, RoutingResult const& value) const
+{
+	store(key, routing_extension, value);
+}
+
+void PersistentMappingCache::clear() const
+{
+	std::error_code ec;
+	for (auto const& entry : std::filesystem::directory_iterator(m_directory, ec)) {
+		if (is_entry(entry)) {
+			std::filesystem::remove(entry.path(), ec);
+		}
+	}
+}
+
+size_t PersistentMappingCache::size_in_bytes() const
+{
+	size_t accumulated_size = 0;
+	std::error_code ec;
+	for (auto const& entry : std::filesystem::directory_iterator(m_directory, ec)) {
+		if (is_entry(entry)) {
+			auto const size = entry.file_size(ec);
+			if (!ec) {
+				accumulated_size += size;
+			}
+		}
+	}
+	return accumulated_size;
+}
+
+} // namespace grenade::vx::network::abstract
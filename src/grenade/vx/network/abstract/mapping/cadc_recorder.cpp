@@ -14,10 +14,14 @@
 #include "grenade/vx/network/abstract/recorder/cadc.h"
 #include "grenade/vx/signal_flow/vertex/cadc_membrane_readout_view.h"
 #include "grenade/vx/signal_flow/vertex/neuron_view.h"
+#include "hate/indent.h"
+#include "hate/join.h"
+#include <stdexcept>
+#include <tbb/parallel_for.h>
 
 namespace grenade::vx::network::abstract {
 
-CADCRecorderMapping::CADCRecorderMapping() {}
+CADCRecorderMapping::CADCRecorderMapping(Slots slots) : slots(std::move(slots)) {}
 
 bool CADCRecorderMapping::valid(
     grenade::common::InterGraphHyperEdgeVertexDescriptors<grenade::common::VertexOnTopology> const&
@@ -41,6 +45,23 @@ bool CADCRecorderMapping::valid(
 	             .get_reference()
 	             .get(reference_vertex_descriptors.at(0)));
 	    recorder) {
+		if (slots.size() != linked_vertex_descriptors.size()) {
+			return false;
+		}
+		for (size_t i = 0; auto const& linked_vertex_descriptor : linked_vertex_descriptors) {
+			auto const& linked_vertex =
+			    dynamic_cast<signal_flow::vertex::CADCMembraneReadoutView const&>(
+			        topology.get(linked_vertex_descriptor));
+			if (slots.at(i).size() != linked_vertex.get_columns().size()) {
+				return false;
+			}
+			for (auto const slot : slots.at(i)) {
+				if (slot >= recorder->get_shape().size()) {
+					return false;
+				}
+			}
+			i++;
+		}
 		return true;
 	}
 	return false;
@@ -64,14 +85,6 @@ CADCRecorderMapping::map_output_data(
 	                              linked_vertex_output_data.at(0).at(0).value().get())
 	                              .batch_size();
 
-	auto const& partitioned_vertex = dynamic_cast<CADCRecorder const&>(
-	    topology.get_reference().get(reference_vertex_descriptors.at(0)));
-
-	CADCRecorder::Results::Samples model_samples(batch_size);
-	for (auto& batch_entry : model_samples) {
-		batch_entry.resize(partitioned_vertex.get_shape().size());
-	}
-
 	std::vector<std::reference_wrapper<
 	    grenade::vx::signal_flow::vertex::CADCMembraneReadoutView::Results const>>
 	    mapped_cadc_results;
@@ -81,163 +94,42 @@ CADCRecorderMapping::map_output_data(
 		        mapped_vertex_result.at(0).value().get())));
 	}
 
-	std::vector<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> atomic_neurons;
-	std::map<
-	    grenade::common::VertexOnTopology,
-	    std::pair<grenade::common::Edge, grenade::common::EdgeOnTopology>>
-	    mapped_edges;
-
-	for (auto const in_edge_descriptor :
-	     topology.get_reference().in_edges(reference_vertex_descriptors.at(0))) {
-		auto const source_vertex_descriptor = topology.get_reference().source(in_edge_descriptor);
-		auto const& in_edge = topology.get_reference().get(in_edge_descriptor);
-		auto const& partitioned_source_population =
-		    dynamic_cast<grenade::common::Population const&>(
-		        topology.get_reference().get(source_vertex_descriptor));
-		auto const target_channels_on_recorder =
-		    grenade::common::CuboidMultiIndexSequence({partitioned_vertex.get_input_ports()
-		                                                   .at(in_edge.port_on_target)
-		                                                   .get_channels()
-		                                                   .size()})
-		        .related_sequence_subset_restriction(
-		            partitioned_vertex.get_input_ports().at(in_edge.port_on_target).get_channels(),
-		            in_edge.get_channels_on_target())
-		        ->get_elements();
-		auto const& internal_source_neuron =
-		    dynamic_cast<LocallyPlacedNeuron const&>(partitioned_source_population.get_cell());
-
-		std::set<size_t> cell_on_population_dimensions;
-		std::set<size_t> compartment_on_neuron_dimensions;
-		std::set<size_t> atomic_neuron_on_compartment_dimensions;
-		for (size_t i = 0;
-		     auto const& dimension_unit : in_edge.get_channels_on_source().get_dimension_units()) {
-			if (dimension_unit &&
-			    dynamic_cast<grenade::common::CellOnPopulationDimensionUnit const*>(
-			        &(*dimension_unit))) {
-				cell_on_population_dimensions.insert(i);
-			} else if (
-			    dimension_unit &&
-			    dynamic_cast<grenade::common::CompartmentOnNeuronDimensionUnit const*>(
-			        &(*dimension_unit))) {
-				compartment_on_neuron_dimensions.insert(i);
-			} else {
-				atomic_neuron_on_compartment_dimensions.insert(i);
-			}
-			i++;
-		}
+	size_t const size = dynamic_cast<CADCRecorder const&>(
+	                        topology.get_reference().get(reference_vertex_descriptors.at(0)))
+	                        .get_shape()
+	                        .size();
 
-		assert(cell_on_population_dimensions.size() == 1);
-		assert(compartment_on_neuron_dimensions.size() == 1);
-		assert(atomic_neuron_on_compartment_dimensions.size() == 1);
-		size_t const neuron_on_population_dimension = *cell_on_population_dimensions.begin();
-		size_t const compartment_on_neuron_dimension = *compartment_on_neuron_dimensions.begin();
-		size_t const atomic_neuron_on_compartment_dimension =
-		    *atomic_neuron_on_compartment_dimensions.begin();
-
-		std::optional<grenade::common::InterTopologyHyperEdgeOnLinkedTopology>
-		    population_inter_topology_hyper_edge_descriptor;
-		for (auto const& inter_topology_hyper_edge_descriptor :
-		     topology.inter_graph_hyper_edges_by_reference(source_vertex_descriptor)) {
-			if (auto const population_inter_topology_hyper_edge =
-			        dynamic_cast<LocallyPlacedNeuronMapping const*>(
-			            &topology.get(inter_topology_hyper_edge_descriptor));
-			    population_inter_topology_hyper_edge) {
-				population_inter_topology_hyper_edge_descriptor =
-				    inter_topology_hyper_edge_descriptor;
+	CADCRecorder::Results::Samples model_samples(batch_size);
+	tbb::parallel_for(size_t(0), batch_size, [&](size_t const b) {
+		auto& model_samples_batch_entry = model_samples.at(b);
+		model_samples_batch_entry.resize(size);
+
+		// reserve exact number of samples per recorded neuron to gather without reallocation
+		std::vector<size_t> num_samples(size, 0);
+		for (size_t i = 0; i < mapped_cadc_results.size(); ++i) {
+			size_t const num_mapped_samples = mapped_cadc_results.at(i).get().samples.at(b).size();
+			for (auto const slot : slots.at(i)) {
+				num_samples[slot] += num_mapped_samples;
 			}
 		}
-
-		auto const& population_inter_topology_hyper_edge =
-		    dynamic_cast<LocallyPlacedNeuronMapping const&>(
-		        topology.get(population_inter_topology_hyper_edge_descriptor.value()));
-
-		auto const& mapped_neuron_views =
-		    topology.links(population_inter_topology_hyper_edge_descriptor.value());
-
-		// This maps neurons on the source population to their index on the population,
-		// wich might differ (due to previous splitting of a larger population).
-		std::map<size_t, size_t> neuron_indices;
-		for (size_t neuron_index = 0; auto const& neuron_on_population :
-		                              partitioned_source_population.get_output_ports()
-		                                  .at(in_edge.port_on_source)
-		                                  .get_channels()
-		                                  .distinct_projection(cell_on_population_dimensions)
-		                                  ->get_elements()) {
-			neuron_indices[neuron_on_population.value.at(0)] = neuron_index;
-			neuron_index++;
+		for (size_t slot = 0; slot < size; ++slot) {
+			model_samples_batch_entry[slot].reserve(num_samples[slot]);
 		}
 
-		auto const& in_edge_channels_on_source = in_edge.get_channels_on_source();
-		for (size_t population_atomic_neuron_index = 0;
-		     auto const& in_edge_channel : in_edge_channels_on_source.get_elements()) {
-			auto const& neuron_on_population =
-			    in_edge_channel.value.at(neuron_on_population_dimension);
-			halco::hicann_dls::vx::v3::CompartmentOnLogicalNeuron compartment_on_neuron(
-			    in_edge_channel.value.at(compartment_on_neuron_dimension));
-			auto const atomic_neuron_on_compartment =
-			    in_edge_channel.value.at(atomic_neuron_on_compartment_dimension);
-
-			auto const atomic_neuron =
-			    halco::hicann_dls::vx::v3::LogicalNeuronOnDLS(
-			        internal_source_neuron.shape, population_inter_topology_hyper_edge.anchors
-			                                          .at(neuron_indices.at(neuron_on_population))
-			                                          .second)
-			        .get_placed_compartments()
-			        .at(compartment_on_neuron)
-			        .at(atomic_neuron_on_compartment);
-			atomic_neurons.push_back(atomic_neuron);
-
-			auto const& mapped_neuron_view_descriptor = mapped_neuron_views.at(
-			    std::min(mapped_neuron_views.size() - 1, atomic_neuron.toNeuronRowOnDLS().value()));
-			auto const& mapped_neuron_view = dynamic_cast<signal_flow::vertex::NeuronView const&>(
-			    topology.get(mapped_neuron_view_descriptor));
-			size_t const column = std::distance(
-			    mapped_neuron_view.get_columns().begin(),
-			    std::find(
-			        mapped_neuron_view.get_columns().begin(),
-			        mapped_neuron_view.get_columns().end(), atomic_neuron.toNeuronColumnOnDLS()));
-			assert(column < mapped_neuron_view.get_columns().size());
-			mapped_edges.emplace(
-			    mapped_neuron_view_descriptor,
-			    std::pair{
-			        grenade::common::Edge(
-			            grenade::common::ListMultiIndexSequence(
-			                {grenade::common::MultiIndex({column})}),
-			            grenade::common::ListMultiIndexSequence(
-			                {grenade::common::MultiIndex({population_atomic_neuron_index})})),
-			        in_edge_descriptor});
-			population_atomic_neuron_index++;
-		}
-	}
-
-	std::map<
-	    halco::hicann_dls::vx::v3::SynramOnDLS,
-	    std::map<signal_flow::vertex::CADCMembraneReadoutView::Columns::value_type, size_t>>
-	    reverse_lookup;
-	for (size_t i = 0; auto const& an : atomic_neurons) {
-		reverse_lookup[an.toNeuronRowOnDLS().toSynramOnDLS()]
-		              [an.toNeuronColumnOnDLS().toSynapseOnSynapseRow()] = i;
-		i++;
-	}
-
-	for (size_t i = 0; i < linked_vertex_descriptors.size(); ++i) {
-		auto const& linked_vertex =
-		    dynamic_cast<signal_flow::vertex::CADCMembraneReadoutView const&>(
-		        topology.get(linked_vertex_descriptors.at(i)));
-		auto const& local_reverse_lookup = reverse_lookup.at(linked_vertex.get_synram());
-		auto const& mapped_cadc_result = mapped_cadc_results.at(i).get();
-		for (size_t b = 0; b < batch_size; ++b) {
-			auto& model_samples_batch_entry = model_samples.at(b);
-			auto const& mapped_samples_batch_entry = mapped_cadc_result.samples.at(b);
-			for (auto const& mapped_sample : mapped_samples_batch_entry) {
+		for (size_t i = 0; i < mapped_cadc_results.size(); ++i) {
+			auto const& local_slots = slots.at(i);
+			for (auto const& mapped_sample : mapped_cadc_results.at(i).get().samples.at(b)) {
+				if (mapped_sample.data.size() > local_slots.size()) {
+					throw std::out_of_range(
+					    "CADC sample contains more values than read-out columns.");
+				}
 				for (size_t j = 0; j < mapped_sample.data.size(); ++j) {
-					model_samples_batch_entry
-					    .at(local_reverse_lookup.at(linked_vertex.get_columns().at(j)))
-					    .push_back(std::make_pair(mapped_sample.time, mapped_sample.data.at(j)));
+					model_samples_batch_entry[local_slots[j]].emplace_back(
+					    mapped_sample.time, mapped_sample.data[j]);
 				}
 			}
 		}
-	}
+	});
 
 	std::vector<std::vector<std::unique_ptr<grenade::common::PortData>>> ret(1);
 	ret.back().emplace_back(std::make_unique<CADCRecorder::Results>(std::move(model_samples)));
@@ -256,12 +148,19 @@ std::unique_ptr<grenade::common::InterTopologyHyperEdge> CADCRecorderMapping::mo
 
 std::ostream& CADCRecorderMapping::print(std::ostream& os) const
 {
-	return os << "CADCRecorderMapping()";
+	hate::IndentingOstream ios(os);
+	ios << "CADCRecorderMapping(\n";
+	ios << hate::Indentation("\t");
+	for (auto const& local_slots : slots) {
+		ios << "[" << hate::join(local_slots, ", ") << "]\n";
+	}
+	ios << hate::Indentation() << ")";
+	return os;
 }
 
 bool CADCRecorderMapping::is_equal_to(InterTopologyHyperEdge const& other) const
 {
-	return InterTopologyHyperEdge::is_equal_to(other);
+	return slots == static_cast<CADCRecorderMapping const&>(other).slots;
 }
 
 } // namespace grenade::vx::network::abstract
@@ -1,6 +1,7 @@
 #include "grenade/vx/network/abstract/mapping/plasticity_rule.h"
 
 #include "grenade/common/linked_topology.h"
+#include "grenade/common/population.h"
 #include "grenade/common/projection.h"
 #include "grenade/common/vertex_on_topology.h"
 #include "grenade/vx/network/abstract/mapping/locally_placed_neuron.h"
@@ -8,15 +9,20 @@
 #include "grenade/vx/network/abstract/plasticity_rule.h"
 #include "grenade/vx/network/abstract/population_cell/locally_placed.h"
 #include "grenade/vx/signal_flow/types.h"
+#include "grenade/vx/signal_flow/vertex/neuron_view.h"
 #include "grenade/vx/signal_flow/vertex/plasticity_rule.h"
 #include "grenade/vx/signal_flow/vertex/synapse_array_view_sparse.h"
 #include "hate/variant.h"
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <tbb/parallel_for.h>
 
 
 namespace grenade::vx::network::abstract {
 
-PlasticityRuleMapping::PlasticityRuleMapping() {}
-
 bool PlasticityRuleMapping::valid(
     grenade::common::InterGraphHyperEdgeVertexDescriptors<grenade::common::VertexOnTopology> const&
         linked_vertex_descriptors,
@@ -45,102 +51,338 @@ bool PlasticityRuleMapping::valid(
 
 namespace {
 
+/**
+ * Location of a recorded value in the hardware recording data.
+ */
+struct HardwareLocation
+{
+	/**
+	 * Index of entry in recording data of the hardware plasticity rule, i.e. port of the synapse
+	 * or neuron view.
+	 */
+	size_t port;
+	/**
+	 * Index of value in the samples of the entry.
+	 */
+	size_t index;
+};
+
+/**
+ * Translation of hardware recording data to data per logical synapse of a projection.
+ */
+struct SynapseTranslation
+{
+	size_t projection_index;
+	size_t num_synapses;
+	/**
+	 * Entry used for the sample times.
+	 */
+	size_t time_port;
+	/**
+	 * Logical synapse and hardware location of each recorded value in order of appearance.
+	 */
+	std::vector<std::pair<size_t, HardwareLocation>> locations;
+	/**
+	 * Number of recorded values per logical synapse.
+	 */
+	std::vector<size_t> num_recordings;
+};
+
+/**
+ * Translation of hardware recording data to data per logical neuron of a population.
+ */
+struct NeuronTranslation
+{
+	size_t population_index;
+	/**
+	 * Entry used for the sample times.
+	 */
+	std::optional<size_t> time_port;
+	/**
+	 * Compartments and their number of atomic neurons per logical neuron.
+	 */
+	std::vector<
+	    std::vector<std::pair<halco::hicann_dls::vx::v3::CompartmentOnLogicalNeuron, size_t>>>
+	    compartments;
+	/**
+	 * Hardware location of each atomic neuron in order of logical neuron, compartment and atomic
+	 * neuron on compartment.
+	 */
+	std::vector<HardwareLocation> locations;
+};
+
 template <typename T>
-void extract_plasticity_rule_recording_data_per_synapse(
-    std::map<size_t, PlasticityRule::Results::TimedData::EntryPerSynapse>& local_logical_data,
-    grenade::common::VertexOnTopology const& descriptor,
-    size_t projection_index,
-    grenade::common::Topology const& partitioned_topology,
-    size_t const batch_size,
-    size_t const hardware_index,
-    size_t const index,
-    std::vector<common::TimedDataSequence<std::vector<T>>> const& local_hardware_data)
+using HardwareData = std::vector<common::TimedDataSequence<std::vector<T>>>;
+
+template <typename T>
+std::vector<HardwareData<T> const*> get_hardware_data(
+    std::vector<signal_flow::vertex::PlasticityRule::TimedRecordingData::Entry> const& entries,
+    std::vector<HardwareLocation> const& locations)
 {
-	if (!local_logical_data.contains(projection_index)) {
-		std::vector<common::TimedDataSequence<std::vector<std::vector<T>>>>
-		    logical_local_hardware_data(batch_size);
-		for (size_t b = 0; b < logical_local_hardware_data.size(); ++b) {
-			auto& batch = logical_local_hardware_data.at(b);
-			batch.resize(local_hardware_data.at(b).size());
-			auto const& connector = dynamic_cast<grenade::common::Projection const&>(
-			                            partitioned_topology.get(descriptor))
-			                            .get_connector();
-			for (auto& sample : batch) {
-				sample.data.resize(
-				    connector.get_num_synapses(*connector.get_input_sequence()->cartesian_product(
-				        *connector.get_output_sequence())));
-			}
-			for (size_t s = 0; s < local_hardware_data.at(b).size(); ++s) {
-				batch.at(s).time = local_hardware_data.at(b).at(s).time;
-			}
-		}
-		local_logical_data[projection_index] = logical_local_hardware_data;
-	}
-	auto& logical_local_hardware_data =
-	    std::get<std::vector<common::TimedDataSequence<std::vector<std::vector<T>>>>>(
-	        local_logical_data.at(projection_index));
-	for (size_t b = 0; b < local_hardware_data.size(); ++b) {
-		for (size_t s = 0; s < local_hardware_data.at(b).size(); ++s) {
-			auto& local_logical_local_hardware_data = logical_local_hardware_data.at(b).at(s);
-			auto const& local_local_hardware_data = local_hardware_data.at(b).at(s);
-			local_logical_local_hardware_data.data.at(index).push_back(
-			    local_local_hardware_data.data.at(hardware_index));
+	std::vector<HardwareData<T> const*> ret(entries.size(), nullptr);
+	for (auto const& location : locations) {
+		if (!ret.at(location.port)) {
+			ret.at(location.port) = &std::get<HardwareData<T>>(entries.at(location.port));
 		}
 	}
+	return ret;
 }
 
 template <typename T>
-void extract_plasticity_rule_recording_data_per_neuron(
-    std::map<size_t, PlasticityRule::Results::TimedData::EntryPerNeuron>& local_logical_data,
-    size_t population_index,
-    size_t const batch_size,
-    std::vector<std::map<
-        halco::hicann_dls::vx::v3::CompartmentOnLogicalNeuron,
-        std::vector<std::pair<grenade::common::VertexOnTopology, size_t>>>> const&
-        neuron_translation,
-    std::vector<common::TimedDataSequence<std::vector<T>>> const& dd)
+PlasticityRule::Results::TimedData::EntryPerSynapse
+extract_plasticity_rule_recording_data_per_synapse(
+    SynapseTranslation const& translation,
+    std::vector<signal_flow::vertex::PlasticityRule::TimedRecordingData::Entry> const& entries,
+    size_t const batch_size)
 {
-	if (!local_logical_data.contains(population_index)) {
-		// dimension (outer to inner): batch, time, cell_on_population, compartment_on_neuron,
-		// atomic_neuron_on_compartment
-		std::vector<common::TimedDataSequence<std::vector<
-		    std::map<halco::hicann_dls::vx::v3::CompartmentOnLogicalNeuron, std::vector<T>>>>>
-		    logical_dd(batch_size);
-		for (size_t b = 0; b < logical_dd.size(); ++b) {
-			auto& batch = logical_dd.at(b);
-			batch.resize(dd.at(b).size());
-			for (auto& sample : batch) {
-				sample.data.resize(neuron_translation.size());
+	std::vector<HardwareLocation> locations;
+	locations.reserve(translation.locations.size() + 1);
+	locations.push_back({translation.time_port, 0});
+	for (auto const& [_, location] : translation.locations) {
+		locations.push_back(location);
+	}
+	auto const hardware_data = get_hardware_data<T>(entries, locations);
+
+	// dimension (outer to inner): batch, time, synapse_on_projection, recording
+	std::vector<common::TimedDataSequence<std::vector<std::vector<T>>>> logical_data(batch_size);
+	tbb::parallel_for(size_t(0), batch_size, [&](size_t const b) {
+		auto const& times = hardware_data.at(translation.time_port)->at(b);
+		std::vector<common::TimedDataSequence<std::vector<T>> const*> local_hardware_data(
+		    hardware_data.size(), nullptr);
+		for (size_t port = 0; port < hardware_data.size(); ++port) {
+			if (hardware_data[port]) {
+				local_hardware_data[port] = &hardware_data[port]->at(b);
+				if (local_hardware_data[port]->size() < times.size()) {
+					throw std::out_of_range("Plasticity rule recording contains too few samples.");
+				}
+			}
+		}
+
+		auto& batch = logical_data.at(b);
+		batch.resize(times.size());
+		for (size_t s = 0; s < times.size(); ++s) {
+			auto& sample = batch[s];
+			sample.time = times[s].time;
+			sample.data.resize(translation.num_synapses);
+			for (size_t i = 0; i < translation.num_synapses; ++i) {
+				sample.data[i].reserve(translation.num_recordings[i]);
 			}
-			for (size_t s = 0; s < dd.at(b).size(); ++s) {
-				batch.at(s).time = dd.at(b).at(s).time;
+			for (auto const& [synapse, location] : translation.locations) {
+				sample.data[synapse].push_back(
+				    (*local_hardware_data[location.port])[s].data.at(location.index));
 			}
 		}
-		local_logical_data[population_index] = logical_dd;
+	});
+	return logical_data;
+}
+
+template <typename T>
+PlasticityRule::Results::TimedData::EntryPerNeuron
+extract_plasticity_rule_recording_data_per_neuron(
+    NeuronTranslation const& translation,
+    std::vector<signal_flow::vertex::PlasticityRule::TimedRecordingData::Entry> const& entries,
+    size_t const batch_size)
+{
+	// dimension (outer to inner): batch, time, cell_on_population, compartment_on_neuron,
+	// atomic_neuron_on_compartment
+	std::vector<common::TimedDataSequence<std::vector<
+	    std::map<halco::hicann_dls::vx::v3::CompartmentOnLogicalNeuron, std::vector<T>>>>>
+	    logical_data(batch_size);
+	if (!translation.time_port) {
+		return logical_data;
 	}
-	auto& logical_dd = std::get<std::vector<common::TimedDataSequence<std::vector<
-	    std::map<halco::hicann_dls::vx::v3::CompartmentOnLogicalNeuron, std::vector<T>>>>>>(
-	    local_logical_data.at(population_index));
-	for (size_t b = 0; b < dd.size(); ++b) {
-		for (size_t s = 0; s < dd.at(b).size(); ++s) {
-			auto& local_logical_dd = logical_dd.at(b).at(s);
-			auto& local_dd = dd.at(b).at(s);
-			for (size_t neuron = 0; neuron < neuron_translation.size(); ++neuron) {
-				auto& neuron_data = local_logical_dd.data.at(neuron);
-				for (auto const& [compartment, atomic_neuron_indices] :
-				     neuron_translation.at(neuron)) {
-					auto& compartment_data = neuron_data[compartment];
-					for (auto const& [_, atomic_neuron_index] : atomic_neuron_indices) {
-						compartment_data.push_back(local_dd.data.at(atomic_neuron_index));
+
+	std::vector<HardwareLocation> locations = translation.locations;
+	locations.push_back({*translation.time_port, 0});
+	auto const hardware_data = get_hardware_data<T>(entries, locations);
+
+	tbb::parallel_for(size_t(0), batch_size, [&](size_t const b) {
+		auto const& times = hardware_data.at(*translation.time_port)->at(b);
+		std::vector<common::TimedDataSequence<std::vector<T>> const*> local_hardware_data(
+		    hardware_data.size(), nullptr);
+		for (size_t port = 0; port < hardware_data.size(); ++port) {
+			if (hardware_data[port]) {
+				local_hardware_data[port] = &hardware_data[port]->at(b);
+				if (local_hardware_data[port]->size() < times.size()) {
+					throw std::out_of_range("Plasticity rule recording contains too few samples.");
+				}
+			}
+		}
+
+		auto& batch = logical_data.at(b);
+		batch.resize(times.size());
+		for (size_t s = 0; s < times.size(); ++s) {
+			auto& sample = batch[s];
+			sample.time = times[s].time;
+			sample.data.resize(translation.compartments.size());
+			auto location = translation.locations.begin();
+			for (size_t neuron = 0; neuron < translation.compartments.size(); ++neuron) {
+				auto& neuron_data = sample.data[neuron];
+				for (auto const& [compartment, num_atomic_neurons] :
+				     translation.compartments[neuron]) {
+					auto& compartment_data =
+					    neuron_data.emplace_hint(neuron_data.end(), compartment, std::vector<T>())
+					        ->second;
+					compartment_data.reserve(num_atomic_neurons);
+					for (size_t i = 0; i < num_atomic_neurons; ++i, ++location) {
+						compartment_data.push_back(
+						    (*local_hardware_data[location->port])[s].data.at(location->index));
 					}
 				}
 			}
 		}
-	}
+	});
+	return logical_data;
 }
 
 } // namespace
 
+struct PlasticityRuleMapping::Table
+{
+	std::vector<SynapseTranslation> synapses;
+	std::vector<NeuronTranslation> neurons;
+};
+
+PlasticityRuleMapping::PlasticityRuleMapping(
+    grenade::common::InterGraphHyperEdgeVertexDescriptors<grenade::common::VertexOnTopology> const&
+        linked_vertex_descriptors,
+    grenade::common::InterGraphHyperEdgeVertexDescriptors<grenade::common::VertexOnTopology> const&
+        reference_vertex_descriptors,
+    grenade::common::LinkedTopology const& topology)
+{
+	auto const& partitioned_topology =
+	    dynamic_cast<grenade::common::LinkedTopology const&>(topology.get_reference());
+
+	auto const& partitioned_vertex = dynamic_cast<PlasticityRule const&>(
+	    partitioned_topology.get(reference_vertex_descriptors.at(0)));
+
+	// create location lookup for data_per_synapse map<VertexOnTopology, IndexOnVertexData>
+	std::map<grenade::common::VertexOnTopology, size_t> data_per_synapse_lookup_table;
+	std::map<grenade::common::VertexOnTopology, size_t> data_per_neuron_lookup_table;
+	size_t num_synapse_vertices = 0;
+	for (auto const& in_edge : topology.in_edges(linked_vertex_descriptors.at(0))) {
+		auto const source = topology.source(in_edge);
+		if (dynamic_cast<signal_flow::vertex::SynapseArrayViewSparse const*>(
+		        &topology.get(source)) == nullptr) {
+			continue;
+		}
+		num_synapse_vertices++;
+		data_per_synapse_lookup_table[source] = topology.get(in_edge).port_on_target;
+	}
+	for (auto const& in_edge : topology.in_edges(linked_vertex_descriptors.at(0))) {
+		auto const source = topology.source(in_edge);
+		if (dynamic_cast<signal_flow::vertex::SynapseArrayViewSparse const*>(
+		        &topology.get(source)) == nullptr) {
+			data_per_neuron_lookup_table[source] =
+			    topology.get(in_edge).port_on_target - num_synapse_vertices;
+		}
+	}
+
+	Table table;
+	std::map<size_t, SynapseTranslation> synapse_translations;
+	size_t const num_projections = partitioned_vertex.get_projection_shapes().size();
+	for (auto const in_edge : partitioned_topology.in_edges(reference_vertex_descriptors.at(0))) {
+		auto const source = partitioned_topology.source(in_edge);
+		size_t const port_on_target = partitioned_topology.get(in_edge).port_on_target;
+		if (auto const projection =
+		        dynamic_cast<grenade::common::Projection const*>(&partitioned_topology.get(source));
+		    projection) {
+			size_t const projection_index = port_on_target;
+			auto const& connector = projection->get_connector();
+			size_t const num_synapses = connector.get_num_synapses(
+			    *connector.get_input_sequence()->cartesian_product(
+			        *connector.get_output_sequence()));
+			for (auto const& inter_topology_hyper_edge_descriptor :
+			     topology.inter_graph_hyper_edges_by_reference(source)) {
+				auto const uncalibrated_synapse_mapping =
+				    dynamic_cast<UncalibratedSynapseMapping const*>(
+				        &topology.get(inter_topology_hyper_edge_descriptor));
+				if (!uncalibrated_synapse_mapping) {
+					continue;
+				}
+				std::vector<size_t> ports;
+				for (auto const& link : topology.links(inter_topology_hyper_edge_descriptor)) {
+					ports.push_back(data_per_synapse_lookup_table.at(link));
+				}
+				for (auto const& [synapse_on_partitioned_vertex, synapses_on_mapped_vertices] :
+				     uncalibrated_synapse_mapping->translation) {
+					for (size_t mapped_vertex_descriptor_index = 0;
+					     mapped_vertex_descriptor_index < synapses_on_mapped_vertices.size();
+					     ++mapped_vertex_descriptor_index) {
+						size_t const port = ports.at(mapped_vertex_descriptor_index);
+						for (auto const& synapse_on_mapped_vertex :
+						     synapses_on_mapped_vertices.at(mapped_vertex_descriptor_index)) {
+							if (!synapse_translations.contains(projection_index)) {
+								auto& translation = synapse_translations[projection_index];
+								translation.projection_index = projection_index;
+								translation.num_synapses = num_synapses;
+								translation.time_port = port;
+								translation.num_recordings.resize(translation.num_synapses);
+							}
+							auto& translation = synapse_translations.at(projection_index);
+							translation.locations.emplace_back(
+							    synapse_on_partitioned_vertex,
+							    HardwareLocation{port, synapse_on_mapped_vertex});
+							translation.num_recordings.at(synapse_on_partitioned_vertex)++;
+						}
+					}
+				}
+			}
+		} else if (auto const population = dynamic_cast<grenade::common::Population const*>(
+		               &partitioned_topology.get(source));
+		           population) {
+			auto const& shape =
+			    dynamic_cast<LocallyPlacedNeuron const&>(population->get_cell()).shape;
+			NeuronTranslation translation;
+			translation.population_index = port_on_target - num_projections;
+			for (auto const& inter_topology_hyper_edge_descriptor :
+			     topology.inter_graph_hyper_edges_by_reference(source)) {
+				auto const locally_placed_neuron_mapping =
+				    dynamic_cast<LocallyPlacedNeuronMapping const*>(
+				        &topology.get(inter_topology_hyper_edge_descriptor));
+				if (!locally_placed_neuron_mapping) {
+					continue;
+				}
+				// each atomic neuron is read from the neuron view it is recorded by
+				std::map<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS, HardwareLocation>
+				    mapped_neuron_translation;
+				for (auto const& link : topology.links(inter_topology_hyper_edge_descriptor)) {
+					auto const& neuron_view =
+					    dynamic_cast<signal_flow::vertex::NeuronView const&>(topology.get(link));
+					size_t const port = data_per_neuron_lookup_table.at(link);
+					// TODO: make array over hemispheres
+					translation.time_port = port;
+					for (size_t c = 0; auto const& column : neuron_view.get_columns()) {
+						mapped_neuron_translation.emplace(
+						    halco::hicann_dls::vx::v3::AtomicNeuronOnDLS(column, neuron_view.row),
+						    HardwareLocation{port, c});
+						c++;
+					}
+				}
+				for (auto const& [_, anchor] : locally_placed_neuron_mapping->anchors) {
+					halco::hicann_dls::vx::v3::LogicalNeuronOnDLS logical_neuron_on_dls(
+					    shape, anchor.second);
+					auto& compartments = translation.compartments.emplace_back();
+					for (auto const& [compartment_on_neuron, atomic_neurons] :
+					     logical_neuron_on_dls.get_placed_compartments()) {
+						compartments.emplace_back(compartment_on_neuron, atomic_neurons.size());
+						for (auto const& atomic_neuron : atomic_neurons) {
+							translation.locations.push_back(
+							    mapped_neuron_translation.at(atomic_neuron));
+						}
+					}
+				}
+			}
+			table.neurons.push_back(std::move(translation));
+		}
+	}
+	for (auto& [_, translation] : synapse_translations) {
+		table.synapses.push_back(std::move(translation));
+	}
+
+	m_table = std::make_shared<Table const>(std::move(table));
+}
+
 std::vector<std::vector<std::unique_ptr<grenade::common::PortData>>>
 PlasticityRuleMapping::map_output_data(
     std::vector<
@@ -193,168 +435,35 @@ PlasticityRuleMapping::map_output_data(
 	    std::get<signal_flow::vertex::PlasticityRule::TimedRecordingData>(
 	        mapped_plasticity_results.data);
 
+	if (!m_table) {
+		throw std::logic_error("Unexpected access to moved-from plasticity rule mapping.");
+	}
+	auto const& table = *m_table;
+
 	PlasticityRule::Results::TimedData logical_data;
 	logical_data.data_array = mapped_plasticity_results_data.data_array;
 
-	// create location lookup for data_per_synapse map<VertexOnTopology, IndexOnVertexData>
-	std::map<grenade::common::VertexOnTopology, size_t> data_per_synapse_lookup_table;
-	std::map<grenade::common::VertexOnTopology, size_t> data_per_neuron_lookup_table;
-	std::vector<grenade::common::VertexOnTopology> synapse_vertices;
-	std::vector<grenade::common::VertexOnTopology> neuron_vertices;
-	for (auto const& in_edge : topology.in_edges(linked_vertex_descriptors.at(0))) {
-		auto const source = topology.source(in_edge);
-		if (dynamic_cast<signal_flow::vertex::SynapseArrayViewSparse const*>(
-		        &topology.get(source)) == nullptr) {
-			continue;
-		}
-		synapse_vertices.push_back(source);
-		data_per_synapse_lookup_table[source] = topology.get(in_edge).port_on_target;
-	}
-	for (auto const& in_edge : topology.in_edges(linked_vertex_descriptors.at(0))) {
-		auto const source = topology.source(in_edge);
-		if (dynamic_cast<signal_flow::vertex::SynapseArrayViewSparse const*>(
-		        &topology.get(source)) == nullptr) {
-			neuron_vertices.push_back(source);
-			data_per_neuron_lookup_table[source] =
-			    topology.get(in_edge).port_on_target - synapse_vertices.size();
-			continue;
-		}
-	}
-
 	auto const extract_observable_per_synapse = [&](auto const& type, auto const& name) {
 		typedef typename std::decay_t<decltype(type)>::ElementType ElementType;
-		for (auto const in_edge :
-		     partitioned_topology.in_edges(reference_vertex_descriptors.at(0))) {
-			auto const source = partitioned_topology.source(in_edge);
-			size_t const projection_index = partitioned_topology.get(in_edge).port_on_target;
-			if (auto const projection = dynamic_cast<grenade::common::Projection const*>(
-			        &partitioned_topology.get(source));
-			    projection != nullptr) {
-				for (auto const& inter_topology_hyper_edge_descriptor :
-				     topology.inter_graph_hyper_edges_by_reference(source)) {
-					if (auto const uncalibrated_synapse_mapping =
-					        dynamic_cast<UncalibratedSynapseMapping const*>(
-					            &topology.get(inter_topology_hyper_edge_descriptor));
-					    uncalibrated_synapse_mapping) {
-						auto const& links = topology.links(inter_topology_hyper_edge_descriptor);
-						for (
-						    auto const& [synapse_on_partitioned_vertex, synapses_on_mapped_vertices] :
-						    uncalibrated_synapse_mapping->translation) {
-							for (size_t mapped_vertex_descriptor_index = 0;
-							     mapped_vertex_descriptor_index <
-							     synapses_on_mapped_vertices.size();
-							     ++mapped_vertex_descriptor_index) {
-								auto const& link_synapse_view_descriptor =
-								    links.at(mapped_vertex_descriptor_index);
-
-								for (auto const& synapse_on_mapped_vertex :
-								     synapses_on_mapped_vertices.at(
-								         mapped_vertex_descriptor_index)) {
-									auto const& local_result = std::get<std::vector<
-									    common::TimedDataSequence<std::vector<ElementType>>>>(
-									    mapped_plasticity_results_data.data_per_synapse.at(name).at(
-									        data_per_synapse_lookup_table.at(
-									            link_synapse_view_descriptor)));
-									extract_plasticity_rule_recording_data_per_synapse(
-									    logical_data.data_per_synapse[name], source,
-									    projection_index, partitioned_topology, batch_size,
-									    synapse_on_mapped_vertex, synapse_on_partitioned_vertex,
-									    local_result);
-								}
-							}
-						}
-					}
-				}
-			}
+		auto& local_logical_data = logical_data.data_per_synapse[name];
+		for (auto const& translation : table.synapses) {
+			local_logical_data.emplace(
+			    translation.projection_index,
+			    extract_plasticity_rule_recording_data_per_synapse<ElementType>(
+			        translation, mapped_plasticity_results_data.data_per_synapse.at(name),
+			        batch_size));
 		}
 	};
 
 	auto const extract_observable_per_neuron = [&](auto const& type, auto const& name) {
 		typedef typename std::decay_t<decltype(type)>::ElementType ElementType;
-		for (auto const in_edge :
-		     partitioned_topology.in_edges(reference_vertex_descriptors.at(0))) {
-			auto const source = partitioned_topology.source(in_edge);
-			size_t const population_index = partitioned_topology.get(in_edge).port_on_target -
-			                                partitioned_vertex.get_projection_shapes().size();
-			if (auto const population = dynamic_cast<grenade::common::Population const*>(
-			        &partitioned_topology.get(source));
-			    population != nullptr) {
-				std::vector<common::TimedDataSequence<std::vector<ElementType>>> local_record;
-				std::vector<std::map<
-				    halco::hicann_dls::vx::v3::CompartmentOnLogicalNeuron,
-				    std::vector<std::pair<grenade::common::VertexOnTopology, size_t>>>>
-				    neuron_translation;
-				for (auto const& inter_topology_hyper_edge_descriptor :
-				     topology.inter_graph_hyper_edges_by_reference(source)) {
-					if (auto const locally_placed_neuron_mapping =
-					        dynamic_cast<LocallyPlacedNeuronMapping const*>(
-					            &topology.get(inter_topology_hyper_edge_descriptor));
-					    locally_placed_neuron_mapping) {
-						std::map<
-						    halco::hicann_dls::vx::v3::AtomicNeuronOnDLS,
-						    std::pair<grenade::common::VertexOnTopology, size_t>>
-						    mapped_neuron_translation;
-						size_t neuron_view_offset = 0;
-						for (auto const& mapped_vertex_descriptor :
-						     topology.links(inter_topology_hyper_edge_descriptor)) {
-							auto const& local_result = std::get<
-							    std::vector<common::TimedDataSequence<std::vector<ElementType>>>>(
-							    mapped_plasticity_results_data.data_per_neuron.at(name).at(
-							        data_per_neuron_lookup_table.at(mapped_vertex_descriptor)));
-							local_record.resize(local_result.size());
-							for (size_t i = 0; i < local_record.size(); ++i) {
-								local_record.at(i).resize(local_result.at(i).size());
-								for (size_t s = 0; s < local_record.at(i).size(); ++s) {
-									// TODO: make array over hemispheres
-									local_record.at(i).at(s).time = local_result.at(i).at(s).time;
-									local_record.at(i).at(s).data.resize(
-									    population->get_shape().size());
-									for (size_t c = 0; c < local_result.at(i).at(s).data.size();
-									     ++c) {
-										local_record.at(i).at(s).data.at(c + neuron_view_offset) =
-										    local_result.at(i).at(s).data.at(c);
-									}
-								}
-							}
-							if (local_result.size() && local_result.at(0).size()) {
-								neuron_view_offset += local_result.at(0).at(0).data.size();
-							}
-							auto const& mapped_vertex =
-							    dynamic_cast<signal_flow::vertex::NeuronView const&>(
-							        topology.get(mapped_vertex_descriptor));
-							for (size_t c = 0; auto const& column : mapped_vertex.get_columns()) {
-								mapped_neuron_translation.emplace(
-								    halco::hicann_dls::vx::v3::AtomicNeuronOnDLS(
-								        column, mapped_vertex.row),
-								    std::pair{mapped_vertex_descriptor, c});
-								c++;
-							}
-						}
-						for (auto const& [_, anchor] : locally_placed_neuron_mapping->anchors) {
-							std::map<
-							    halco::hicann_dls::vx::v3::CompartmentOnLogicalNeuron,
-							    std::vector<std::pair<grenade::common::VertexOnTopology, size_t>>>
-							    local_neuron_translation;
-							halco::hicann_dls::vx::v3::LogicalNeuronOnDLS logical_neuron_on_dls(
-							    dynamic_cast<LocallyPlacedNeuron const&>(population->get_cell())
-							        .shape,
-							    anchor.second);
-							for (auto const& [compartment_on_neuron, atomic_neurons] :
-							     logical_neuron_on_dls.get_placed_compartments()) {
-								for (auto const& atomic_neuron : atomic_neurons) {
-									local_neuron_translation[compartment_on_neuron].push_back(
-									    mapped_neuron_translation.at(atomic_neuron));
-								}
-							}
-
-							neuron_translation.push_back(local_neuron_translation);
-						}
-					}
-				}
-				extract_plasticity_rule_recording_data_per_neuron(
-				    logical_data.data_per_neuron[name], population_index, batch_size,
-				    neuron_translation, local_record);
-			}
+		auto& local_logical_data = logical_data.data_per_neuron[name];
+		for (auto const& translation : table.neurons) {
+			local_logical_data.emplace(
+			    translation.population_index,
+			    extract_plasticity_rule_recording_data_per_neuron<ElementType>(
+			        translation, mapped_plasticity_results_data.data_per_neuron.at(name),
+			        batch_size));
 		}
 	};
 
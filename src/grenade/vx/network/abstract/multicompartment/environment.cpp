@@ -1,6 +1,10 @@
 #include "grenade/vx/network/abstract/multicompartment/environment.h"
 #include "dapr/property_holder.h"
+#include "grenade/vx/network/abstract/multicompartment/mechanism_environment/synaptic_input.h"
 #include "grenade/vx/network/abstract/multicompartment/mechanism_on_compartment.h"
+#include "hate/indent.h"
+#include <typeinfo>
+#include <boost/functional/hash.hpp>
 
 namespace grenade::vx::network::abstract {
 
@@ -62,5 +66,49 @@ std::map<MechanismOnCompartment, dapr::PropertyHolder<MechanismEnvironment>> Env
 	return m_synaptic_connections.at(compartment);
 }
 
+size_t Environment::hash() const
+{
+	size_t ret = 0;
+	for (auto const& [compartment_on_neuron, mechanisms] : m_synaptic_connections) {
+		boost::hash_combine(ret, compartment_on_neuron.value());
+		for (auto const& [mechanism_on_compartment, mechanism_environment] : mechanisms) {
+			boost::hash_combine(ret, mechanism_on_compartment.value());
+			boost::hash_combine(ret, typeid(*mechanism_environment).hash_code());
+			if (auto const synaptic_input_environment =
+			        dynamic_cast<SynapticInputEnvironment const*>(&*mechanism_environment);
+			    synaptic_input_environment) {
+				auto const& number_of_inputs = synaptic_input_environment->number_of_inputs;
+				boost::hash_combine(ret, number_of_inputs.number_total);
+				boost::hash_combine(ret, number_of_inputs.number_top);
+				boost::hash_combine(ret, number_of_inputs.number_bottom);
+			}
+		}
+	}
+	for (auto const& [compartment_a, compartment_b] : recordable_pairs) {
+		boost::hash_combine(ret, compartment_a.value());
+		boost::hash_combine(ret, compartment_b.value());
+	}
+	return ret;
+}
+
+std::ostream& operator<<(std::ostream& os, Environment const& value)
+{
+	hate::IndentingOstream ios(os);
+	ios << "Environment(\n";
+	ios << hate::Indentation("\t");
+	for (auto const& [compartment_on_neuron, mechanisms] : value.m_synaptic_connections) {
+		for (auto const& [mechanism_on_compartment, mechanism_environment] : mechanisms) {
+			ios << compartment_on_neuron << ", " << mechanism_on_compartment << ": "
+			    << mechanism_environment << "\n";
+		}
+	}
+	for (auto const& [compartment_a, compartment_b] : value.recordable_pairs) {
+		ios << "recordable: " << compartment_a << ", " << compartment_b << "\n";
+	}
+	ios << hate::Indentation();
+	ios << ")";
+	return os;
+}
+
 
 } // namespace grenade::vx::network::abstract
\ No newline at end of file
@@ -9,6 +9,7 @@ std::ostream& operator<<(std::ostream& os, EvolutionaryParameters const& paramet
 	   << "Time limit:                          " << parameters.time_limit << std::endl
 	   << "Run limit:                           " << parameters.run_limit << std::endl
 	   << "x_max:                               " << parameters.x_max << std::endl
+	   << "Memoized fitness:                    " << parameters.memoize_fitness << std::endl
 	   << "Population size:                     " << parameters.population_size << std::endl
 	   << "Number in Hall of Fame:              " << parameters.number_hall_of_fame << std::endl
 	   << "Number of Tournament contestants:    " << parameters.tournament_contestants << std::endl
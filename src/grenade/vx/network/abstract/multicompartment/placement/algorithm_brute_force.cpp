@@ -1,9 +1,248 @@
 #include "grenade/vx/network/abstract/multicompartment/placement/algorithm_brute_force.h"
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <optional>
 #include <sstream>
 #include <log4cxx/logger.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
 
 namespace grenade::vx::network::abstract {
 
+namespace {
+
+/**
+ * All valid switch configurations of a single neuron circuit in iteration order.
+ */
+std::vector<UnplacedNeuronCircuit> get_states()
+{
+	std::vector<UnplacedNeuronCircuit> states;
+	UnplacedNeuronCircuit state;
+	do {
+		states.push_back(state);
+	} while (++state);
+	return states;
+}
+
+/**
+ * Check column of coordinate system for empty and double connections.
+ * The check depends on the configuration of the column and its direct neighbours, see
+ * CoordinateSystem::has_empty_connections and CoordinateSystem::has_double_connections.
+ * @param coordinate_system Coordinate system to check.
+ * @param x Column to check.
+ */
+bool column_valid(CoordinateSystem const& coordinate_system, size_t x)
+{
+	for (size_t y = 0; y < 2; y++) {
+		auto const& row = coordinate_system.coordinate_system[y];
+		bool const on_shared_line = row[x].switch_circuit_shared ||
+		                            row[x].switch_circuit_shared_conductance;
+		bool const shared_line_left = x != 0 && row[x - 1].switch_shared_right;
+		bool const shared_line_right =
+		    x + 1 < row.size() &&
+		    (row[x + 1].switch_circuit_shared || row[x + 1].switch_circuit_shared_conductance ||
+		     row[x + 1].switch_shared_right);
+		// Top Bottom only connected from one side
+		if (row[x].switch_top_bottom &&
+		    !coordinate_system.coordinate_system[1 - y][x].switch_top_bottom) {
+			return false;
+		}
+		// Connected to shared line but shared line not connected to left or right
+		if (on_shared_line && !(row[x].switch_shared_right || shared_line_left)) {
+			return false;
+		}
+		// Shared line goes to empty
+		if (row[x].switch_shared_right &&
+		    (!shared_line_right || !(on_shared_line || shared_line_left))) {
+			return false;
+		}
+		// Double connection
+		if (coordinate_system.connected_right(x, y) &&
+		    coordinate_system.connected_right_shared(x, y)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Branch-and-bound search over all configurations of a given width.
+ * Configurations are identified by the sequence of state indices of the neuron circuits, iterated
+ * column by column with the top row first. Results are ordered by this sequence, extended by
+ * whether the configuration was mirrored.
+ */
+struct BranchAndBound
+{
+	typedef std::vector<size_t> Key;
+
+	// Number of neuron circuits up to which subtrees are spawned as separate tasks.
+	constexpr static size_t spawn_depth = 3;
+
+	BranchAndBound(
+	    std::vector<UnplacedNeuronCircuit> const& states,
+	    size_t width,
+	    std::function<bool(AlgorithmResult&)> validate,
+	    std::atomic<bool>& terminate,
+	    hate::Timer const& timer,
+	    size_t timeout) :
+	    states(states),
+	    width(width),
+	    validate(std::move(validate)),
+	    terminate(terminate),
+	    timer(timer),
+	    timeout(timeout)
+	{
+	}
+
+	void operator()()
+	{
+		tbb::task_group tasks;
+		auto coordinate_system = std::make_unique<CoordinateSystem>();
+		Key key;
+		explore(tasks, *coordinate_system, key, true);
+		tasks.wait();
+	}
+
+	std::vector<UnplacedNeuronCircuit> const& states;
+	size_t width;
+	std::function<bool(AlgorithmResult&)> validate;
+	std::atomic<bool>& terminate;
+	hate::Timer const& timer;
+	size_t timeout;
+
+	std::atomic<bool> found = false;
+	std::mutex best_mutex;
+	Key best_key;
+	std::optional<AlgorithmResult> best_result;
+
+private:
+	/**
+	 * Check whether all configurations starting with the given key succeed the best result.
+	 */
+	bool exceeds_best(Key const& key)
+	{
+		if (!found) {
+			return false;
+		}
+		std::lock_guard lock(best_mutex);
+		return std::lexicographical_compare(
+		    best_key.begin(), best_key.begin() + key.size(), key.begin(), key.end());
+	}
+
+	/**
+	 * Record valid configuration, if it precedes the best one found so far.
+	 * All configurations are of equal width, ties are therefore broken by the lexicographic order
+	 * of their keys, which is unique per configuration.
+	 */
+	void record(Key key, bool mirrored, AlgorithmResult const& result)
+	{
+		key.push_back(mirrored);
+		std::lock_guard lock(best_mutex);
+		if (!best_result || std::lexicographical_compare(
+		                        key.begin(), key.end(), best_key.begin(), best_key.end())) {
+			best_key = std::move(key);
+			best_result = result;
+			found = true;
+		}
+	}
+
+	void leaf(CoordinateSystem const& coordinate_system, Key const& key, bool tied)
+	{
+		if (static_cast<size_t>(timer.get_s()) > timeout) {
+			terminate = true;
+			return;
+		}
+
+		AlgorithmResult result;
+		result.coordinate_system = coordinate_system;
+		if (validate(result)) {
+			record(key, false, result);
+			return;
+		}
+
+		// A configuration equal to its mirror image was already checked
+		if (tied) {
+			return;
+		}
+		result = AlgorithmResult();
+		for (size_t x = 0; x < width; x++) {
+			for (size_t y = 0; y < 2; y++) {
+				result.coordinate_system.set_config(
+				    x, y, coordinate_system.get_config(x, 1 - y));
+			}
+		}
+		if (validate(result)) {
+			record(key, true, result);
+		}
+	}
+
+	/**
+	 * Explore all configurations starting with the given key.
+	 * @param tasks Task group to spawn subtrees in
+	 * @param coordinate_system Coordinate system configured according to the key
+	 * @param key Sequence of states of already configured neuron circuits
+	 * @param tied Whether the configuration so far equals its mirror image, in which case only
+	 * configurations are considered whose top row precedes the bottom row
+	 */
+	void explore(tbb::task_group& tasks, CoordinateSystem& coordinate_system, Key& key, bool tied)
+	{
+		if (terminate) {
+			return;
+		}
+
+		size_t const index = key.size();
+		if (index == 2 * width) {
+			leaf(coordinate_system, key, tied);
+			return;
+		}
+
+		size_t const x = index / 2;
+		size_t const y = index % 2;
+		for (size_t state = 0; state < states.size(); state++) {
+			bool child_tied = tied;
+			if (y == 1) {
+				// Symmetry breaking over rows
+				if (tied && state < key.back()) {
+					continue;
+				}
+				child_tied = tied && (state == key.back());
+				// Symmetry breaking over translation and unique width
+				if (state == 0 && key.back() == 0 && (x == 0 || x + 1 == width)) {
+					continue;
+				}
+			}
+
+			key.push_back(state);
+			if (exceeds_best(key)) {
+				key.pop_back();
+				break;
+			}
+			coordinate_system.set_config(x, y, states.at(state));
+
+			// Completed columns left of the current column are fixed
+			if (y == 0 || x == 0 || column_valid(coordinate_system, x - 1)) {
+				if (index < spawn_depth) {
+					tasks.run([this, &tasks, key, child_tied]() mutable {
+						auto coordinate_system = std::make_unique<CoordinateSystem>();
+						for (size_t i = 0; i < key.size(); i++) {
+							coordinate_system->set_config(i / 2, i % 2, states.at(key.at(i)));
+						}
+						explore(tasks, *coordinate_system, key, child_tied);
+					});
+				} else {
+					explore(tasks, coordinate_system, key, child_tied);
+				}
+			}
+			key.pop_back();
+		}
+		coordinate_system.set_config(x, y, states.at(0));
+	}
+};
+
+} // namespace
+
 PlacementAlgorithmBruteForce::PlacementAlgorithmBruteForce() :
     m_logger(log4cxx::Logger::getLogger("grenade.MC.Placement.BruteForce"))
 {
@@ -14,17 +253,17 @@ PlacementAlgorithmBruteForce::PlacementAlgorithmBruteForce(size_t timeout) :
 }
 
 bool PlacementAlgorithmBruteForce::valid(
-    size_t result_index, size_t x_max, Neuron const& neuron, ResourceManager const& resources)
+    AlgorithmResult& result,
+    size_t x_max,
+    Neuron const& neuron,
+    ResourceManager const& resources) const
 {
 	if (x_max > 128) {
 		throw std::invalid_argument("x_max > 128, invalid");
 	}
 
-	// Final result to assign compartments
-	AlgorithmResult& result = m_results.at(result_index);
 	// Temporary result to perform tests on
-	AlgorithmResult& result_temp = m_results_temp.at(result_index);
-	result_temp = result;
+	AlgorithmResult result_temp = result;
 
 	// Check for empty Connections, double connections (intern + extern) and short circuiting of two
 	// compartments via the shared line
@@ -119,43 +358,12 @@ bool PlacementAlgorithmBruteForce::valid(
 
 
 AlgorithmResult PlacementAlgorithmBruteForce::run(
-    CoordinateSystem const& coordinate_system,
-    Neuron const& neuron,
-    ResourceManager const& resources)
+    CoordinateSystem const&, Neuron const& neuron, ResourceManager const& resources)
 {
 	LOG4CXX_INFO(m_logger, "Starting Brute Force Algorithm Run");
 	hate::Timer timer_total;
-	m_results.push_back(AlgorithmResult());
-	m_results_temp.push_back(AlgorithmResult());
-	AlgorithmResult& result = m_results.at(0);
-	result.coordinate_system = coordinate_system;
-
-
-	// If Parallel Runs requested
-	if (parallel_runs != 0) {
-		LOG4CXX_DEBUG(m_logger, "Parallel Run");
-		run_parallel(neuron, resources, parallel_runs, x_limit, 5);
-		for (auto temp_result : m_results) {
-			if (temp_result.finished) {
-				std::stringstream msg;
-				msg << "Final Result";
-				for (size_t x = 0; x < 20; x++) {
-					msg << temp_result.coordinate_system.coordinate_system[0][x].get_status()
-					    << ",";
-				}
-				msg << "\n";
-				for (size_t x = 0; x < 20; x++) {
-					msg << temp_result.coordinate_system.coordinate_system[1][x].get_status()
-					    << ",";
-				}
-				msg << "\n";
-				LOG4CXX_TRACE(m_logger, msg.str());
-				return temp_result;
-			}
-		}
-		return result;
-	}
-	LOG4CXX_DEBUG(m_logger, "Single Thread Run");
+	m_termintate_parallel = false;
+	AlgorithmResult result;
 
 	// Hard Coded Case: 1 compartment with 1 neuron circuit
 	if (neuron.num_compartments() == 1 &&
@@ -163,54 +371,41 @@ AlgorithmResult PlacementAlgorithmBruteForce::run(
 		result.coordinate_system.coordinate_system[0][0].compartment =
 		    *(neuron.compartments().begin());
 		result.finished = true;
-		m_results.push_back(result);
-		m_results_temp.push_back(result);
 		return result;
 	}
 
-	// Put pointer to SwitchConfigs in iterable order
-	std::vector<UnplacedNeuronCircuit*> config_pointers;
-	for (size_t x = 0; x < 256; x++) {
-		for (size_t y = 0; y < 2; y++) {
-			config_pointers.push_back(&result.coordinate_system.coordinate_system[y][x]);
-		}
-	}
-
-
-	size_t loop_counter = 0;
-	size_t index_max = 0;
-	while (!valid(0, (index_max / 2) + 2, neuron, resources)) {
-		loop_counter++;
-		// Increment first smallest Element till maximum than Increment second smallest and go
-		// through smallest again
-		size_t index = 0;
-		while (index < config_pointers.size()) {
-			if (++(*(config_pointers.at(index)))) {
-				index = 0;
-				break;
-			} else {
-				*(config_pointers.at(index)) = UnplacedNeuronCircuit();
-				index++;
-				if (index >= index_max) {
-					index_max++;
-				}
-			}
-		}
-		if (static_cast<size_t>(timer_total.get_s()) > m_timeout) {
-			LOG4CXX_INFO(m_logger, "Time limit reached: Brute Force Terminated");
-			result.finished = true;
-			result.coordinate_system = CoordinateSystem();
+	auto const states = get_states();
+	tbb::task_arena arena(static_cast<int>(std::max(parallel_runs, size_t(1))));
+
+	// Each neuron circuit can be allocated to at most one compartment
+	size_t const width_min = std::max((resources.get_total().number_total + 1) / 2, size_t(1));
+	size_t const width_max = std::min(x_limit, size_t(127));
+	size_t width = width_min;
+	for (; width <= width_max && !m_termintate_parallel; width++) {
+		LOG4CXX_DEBUG(m_logger, "Searching configurations of width " << width);
+		BranchAndBound search(
+		    states, width,
+		    [this, width, &neuron, &resources](AlgorithmResult& candidate) {
+			    return valid(candidate, width + 1, neuron, resources);
+		    },
+		    m_termintate_parallel, timer_total, m_timeout);
+		arena.execute([&search]() { search(); });
+		// An interrupted search might have missed preceding configurations
+		if (search.best_result && !m_termintate_parallel) {
+			result = *search.best_result;
 			break;
 		}
 	}
 
 	std::stringstream msg_final;
-	msg_final << "____________________Finished: Number of Iterations:" << loop_counter
+	msg_final << "____________________Finished: Width: " << width
 	          << " in Time: " << timer_total.get_ms() << "[ms]____________________" << std::endl;
 
-
-	if (!m_results.back().finished) {
-		m_results.back().coordinate_system = CoordinateSystem();
+	if (!result.finished) {
+		result.coordinate_system = CoordinateSystem();
+		if (m_termintate_parallel) {
+			LOG4CXX_INFO(m_logger, "Time limit reached: Brute Force Terminated");
+		}
 		msg_final << "\nFail" << std::endl;
 	} else {
 		msg_final << "\nSuccess" << std::endl;
@@ -218,7 +413,7 @@ AlgorithmResult PlacementAlgorithmBruteForce::run(
 
 	LOG4CXX_INFO(m_logger, msg_final.str());
 
-	return m_results.back();
+	return result;
 }
 
 std::unique_ptr<PlacementAlgorithm> PlacementAlgorithmBruteForce::clone() const
@@ -233,179 +428,7 @@ std::unique_ptr<PlacementAlgorithm> PlacementAlgorithmBruteForce::clone() const
 
 void PlacementAlgorithmBruteForce::reset()
 {
-	m_results.clear();
-	m_results_temp.clear();
 	m_termintate_parallel = false;
 }
 
-AlgorithmResult PlacementAlgorithmBruteForce::run_parallel(
-    Neuron const& neuron,
-    ResourceManager const& resources,
-    size_t parallel,
-    size_t x_max,
-    size_t index_min)
-{
-	// Prepare starting states for parallel brute force
-	AlgorithmResult result;
-
-	// create new configuration
-	result.coordinate_system = CoordinateSystem();
-	result.finished = false;
-
-	// Put pointer to SwitchConfigs in iterable order
-	std::vector<UnplacedNeuronCircuit*> config_pointers;
-	for (size_t x = 0; x < 256; x++) {
-		for (size_t y = 0; y < 2; y++) {
-			config_pointers.push_back(&result.coordinate_system.coordinate_system[y][x]);
-		}
-	}
-
-	size_t index_max = 0;
-	size_t outer_loop_counter = 0;
-
-	/**
-	 * Outer While loop creates #parallel threads that run parallel and waits for them to finish.
-	 * If a result is found, the search area is covered or the time limit is reached the loop
-	 * repeats.
-	 */
-	hate::Timer timer_outer_loop;
-	while (!m_termintate_parallel) {
-		std::stringstream msg;
-		msg << "----------------------------------------Loop "
-		       "Iteration----------------------------------------"
-		    << outer_loop_counter << std::endl;
-		LOG4CXX_DEBUG(m_logger, msg.str());
-		// Loop over all starting configurations
-		for (size_t i = 0; i < parallel; i++) {
-			std::stringstream msg_outer;
-			msg_outer << "Building starting State " << i;
-			LOG4CXX_DEBUG(m_logger, msg_outer.str());
-
-			// Iterate Starting State
-			size_t index = index_min;
-			while ((index < x_max * 2 + 1) && (index < config_pointers.size())) {
-				if (++(*(config_pointers.at(index)))) {
-					std::stringstream msg_inner;
-					msg_inner << "Iterate at index: " << index << "\n";
-					LOG4CXX_TRACE(m_logger, msg_inner.str());
-					index = index_min;
-					break;
-				} else {
-					*(config_pointers.at(index)) = UnplacedNeuronCircuit();
-					index++;
-					if (index >= index_max) {
-						index_max++;
-					}
-					LOG4CXX_TRACE(m_logger, "Increment Index");
-				}
-			}
-			if (result.coordinate_system == m_results.back().coordinate_system) {
-				throw std::invalid_argument("No new coordinate system created: Duplicate");
-			}
-
-			// Put starting states in result vector
-			if (outer_loop_counter == 0) {
-				m_results.push_back(result);
-			} else {
-				m_results.at(i) = result;
-			}
-		}
-
-		// Calculate Number of iterations for each thread
-		size_t loop_limit = pow(24, index_min - 1); // Loop over first cicuits
-
-		// Declare lambda_function for parallelisation call
-		auto const lamda_function = [this](
-		                                Neuron const* neuron, ResourceManager const* resources,
-		                                size_t i, size_t loop_limit) {
-			this->run_partial(*neuron, *resources, i, loop_limit);
-		};
-
-		std::vector<std::future<void>> void_results;
-		// TO-DO: Run Algorithms
-		for (size_t i = 0; i < parallel; i++) {
-			void_results.push_back(
-			    std::async(std::launch::async, lamda_function, &neuron, &resources, i, loop_limit));
-		}
-
-		for (auto& void_result : void_results) {
-			void_result.wait();
-		}
-
-
-		// Time Limit
-		if (static_cast<size_t>(timer_outer_loop.get_s()) > m_timeout) {
-			m_termintate_parallel = true;
-			break;
-		}
-		outer_loop_counter++;
-	}
-	for (auto temp_result : m_results) {
-		if (temp_result.finished) {
-			return temp_result;
-		}
-	}
-	result.coordinate_system = CoordinateSystem();
-	result.finished = false;
-	return result;
-}
-
-void PlacementAlgorithmBruteForce::run_partial(
-    Neuron const& neuron, ResourceManager const& resources, size_t result_index, size_t loop_limit)
-{
-	AlgorithmResult& result = m_results.at(result_index);
-
-	// Put pointer to SwitchConfigs in iterable order
-	std::vector<UnplacedNeuronCircuit*> config_pointers;
-	for (size_t x = 0; x < 256; x++) {
-		for (size_t y = 0; y < 2; y++) {
-			config_pointers.push_back(&result.coordinate_system.coordinate_system[y][x]);
-		}
-	}
-
-	// Hard Coded Case: 1 compartment with 1 neuron circuit
-	if (neuron.num_compartments() == 1 &&
-	    resources.get_config(*(neuron.compartments().begin())).number_total == 1) {
-		result.coordinate_system.coordinate_system[0][0].compartment =
-		    *(neuron.compartments().begin());
-		result.finished = true;
-		m_results.push_back(result); // TO-DO Remove?
-	}
-
-
-	size_t index_max = 0;
-	size_t loop_counter = 0;
-	while (!valid(result_index, (index_max / 2) + 2, neuron, resources)) {
-		loop_counter++;
-		// Increment first smallest Element till maximum than Increment second smallest and go
-		// through smallest again
-		size_t index = 0;
-		while (index < config_pointers.size()) {
-			if (++(*(config_pointers.at(index)))) {
-				index = 0;
-				break;
-			} else {
-				*(config_pointers.at(index)) = UnplacedNeuronCircuit();
-				index++;
-				if (index >= index_max) {
-					index_max++;
-				}
-			}
-		}
-
-
-		if (loop_counter > loop_limit) {
-			result.finished = false;
-			result.coordinate_system = CoordinateSystem();
-			break;
-		}
-	}
-	if (m_results.at(result_index).finished) {
-		std::stringstream msg;
-		msg << "Thread: " << result_index << " found valid result";
-		LOG4CXX_DEBUG(m_logger, msg.str());
-	}
-}
-
-
-} // namespace grenade::vx::network::abstract
\ No newline at end of file
+} // namespace grenade::vx::network::abstract
@@ -1,10 +1,124 @@
 #include "grenade/vx/network/abstract/multicompartment/placement/algorithm_evolutionary.h"
+
+#include <algorithm>
+#include <functional>
 #include <log4cxx/logger.h>
+#include <tbb/concurrent_unordered_map.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
 namespace grenade::vx::network::abstract {
 
+namespace {
+
+/**
+ * Canonical representation of the state of a coordinate system up to x_max.
+ * Contains all switches of both rows, which fully determines the constructed neuron.
+ */
+std::vector<bool> get_switch_configuration(CoordinateSystem const& coordinate_system, size_t x_max)
+{
+	std::vector<bool> configuration;
+	configuration.reserve(2 * 5 * x_max);
+	for (size_t x = 0; x < x_max; ++x) {
+		for (size_t y = 0; y < 2; ++y) {
+			auto const& neuron_circuit = coordinate_system.coordinate_system[y][x];
+			configuration.push_back(neuron_circuit.switch_shared_right);
+			configuration.push_back(neuron_circuit.switch_right);
+			configuration.push_back(neuron_circuit.switch_top_bottom);
+			configuration.push_back(neuron_circuit.switch_circuit_shared);
+			configuration.push_back(neuron_circuit.switch_circuit_shared_conductance);
+		}
+	}
+	return configuration;
+}
+
+/**
+ * Canonical representation of the structure of a constructed neuron.
+ * Contains the resources of all compartments and the connections between them, which fully
+ * determines the result of the isomorphism to the target neuron. The connections are normalized,
+ * since the compartment graph is undirected.
+ */
+std::vector<size_t> get_structure(NeuronPlacementResult const& placement_result)
+{
+	std::vector<size_t> structure;
+	structure.push_back(placement_result.resources_build.size());
+	for (auto const& [compartment, resources] : placement_result.resources_build) {
+		structure.push_back(compartment.value());
+		structure.push_back(resources.number_total);
+		structure.push_back(resources.number_top);
+		structure.push_back(resources.number_bottom);
+	}
+	std::vector<std::pair<size_t, size_t>> connections;
+	for (auto const& connection : placement_result.neuron_build.compartment_connections()) {
+		auto const source = placement_result.neuron_build.source(connection).value();
+		auto const target = placement_result.neuron_build.target(connection).value();
+		connections.emplace_back(std::min(source, target), std::max(source, target));
+	}
+	std::sort(connections.begin(), connections.end());
+	for (auto const& [source, target] : connections) {
+		structure.push_back(source);
+		structure.push_back(target);
+	}
+	return structure;
+}
+
+struct StructureHash
+{
+	size_t operator()(std::vector<size_t> const& value) const
+	{
+		size_t seed = value.size();
+		for (auto const& element : value) {
+			seed ^= std::hash<size_t>{}(element) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+		}
+		return seed;
+	}
+};
+
+} // namespace
+
+struct PlacementAlgorithmEvolutionary::Impl
+{
+	/**
+	 * Maximal number of memoized entries per table.
+	 * Tables are cleared in between generations when exceeding the limit to bound memory usage.
+	 */
+	constexpr static size_t max_cache_size = 1 << 20;
+
+	/**
+	 * Arena for parallel fitness evaluation persisting across generations and runs.
+	 * Recreated when the number of parallel threads changes.
+	 */
+	std::unique_ptr<tbb::task_arena> arena;
+
+	/**
+	 * Fitness by canonical switch configuration of the coordinate system.
+	 */
+	tbb::concurrent_unordered_map<std::vector<bool>, double> fitness;
+
+	/**
+	 * Isomorphism fitness by structure of the constructed neuron.
+	 */
+	tbb::concurrent_unordered_map<std::vector<size_t>, double, StructureHash> isomorphism;
+
+	tbb::task_arena& get_arena(size_t parallel_threads)
+	{
+		auto const max_concurrency = static_cast<int>(std::max(parallel_threads, size_t(1)));
+		if (!arena || arena->max_concurrency() != max_concurrency) {
+			arena = std::make_unique<tbb::task_arena>(max_concurrency);
+		}
+		return *arena;
+	}
+
+	void clear()
+	{
+		fitness.clear();
+		isomorphism.clear();
+	}
+};
+
 PlacementAlgorithmEvolutionary::PlacementAlgorithmEvolutionary() :
-    m_logger(log4cxx::Logger::getLogger("grenade.MC.PlacementAlgorithmEvolutionary"))
+    m_logger(log4cxx::Logger::getLogger("grenade.MC.PlacementAlgorithmEvolutionary")),
+    m_impl(std::make_unique<Impl>())
 {
 	// Run
 	m_run_parameters.seed = 0;
@@ -47,7 +161,9 @@ PlacementAlgorithmEvolutionary::PlacementAlgorithmEvolutionary() :
 
 PlacementAlgorithmEvolutionary::PlacementAlgorithmEvolutionary(
     EvolutionaryParameters run_parameters) :
-    m_run_parameters(run_parameters)
+    m_run_parameters(run_parameters),
+    m_logger(log4cxx::Logger::getLogger("grenade.MC.PlacementAlgorithmEvolutionary")),
+    m_impl(std::make_unique<Impl>())
 {
 	if (run_parameters.x_max > 127) {
 		throw std::range_error("Too large value for x_max. Must be smaller than 128.");
@@ -55,6 +171,37 @@ PlacementAlgorithmEvolutionary::PlacementAlgorithmEvolutionary(
 	m_placement_results.resize(m_run_parameters.population_size);
 }
 
+PlacementAlgorithmEvolutionary::PlacementAlgorithmEvolutionary(
+    PlacementAlgorithmEvolutionary const& other) :
+    m_run_parameters(other.m_run_parameters),
+    m_terminate_parallel(other.m_terminate_parallel.load()),
+    m_best_in_pop(other.m_best_in_pop),
+    m_fitness_best_in_pop(other.m_fitness_best_in_pop),
+    m_result_final(other.m_result_final),
+    m_placement_results(other.m_placement_results),
+    m_logger(other.m_logger),
+    m_impl(std::make_unique<Impl>())
+{
+}
+
+PlacementAlgorithmEvolutionary& PlacementAlgorithmEvolutionary::operator=(
+    PlacementAlgorithmEvolutionary const& other)
+{
+	if (this != &other) {
+		m_run_parameters = other.m_run_parameters;
+		m_terminate_parallel = other.m_terminate_parallel.load();
+		m_best_in_pop = other.m_best_in_pop;
+		m_fitness_best_in_pop = other.m_fitness_best_in_pop;
+		m_result_final = other.m_result_final;
+		m_placement_results = other.m_placement_results;
+		m_logger = other.m_logger;
+		m_impl = std::make_unique<Impl>();
+	}
+	return *this;
+}
+
+PlacementAlgorithmEvolutionary::~PlacementAlgorithmEvolutionary() {}
+
 void PlacementAlgorithmEvolutionary::construct_neuron(
     NeuronPlacementResult& parallel_result, size_t x_max)
 {
@@ -272,36 +419,28 @@ void PlacementAlgorithmEvolutionary::build_coordinate_system(
 
 	size_t y = 0;
 	for (size_t i = 0; i < x_max; i++) {
-		result.coordinate_system.coordinate_system[0][i].switch_top_bottom =
-		    switch_configuration[9 * i];
-		result.coordinate_system.coordinate_system[1][i].switch_top_bottom =
-		    switch_configuration[9 * i];
+		result.coordinate_system[0][i].switch_top_bottom = switch_configuration[9 * i];
+		result.coordinate_system[1][i].switch_top_bottom = switch_configuration[9 * i];
 
-		result.coordinate_system.coordinate_system[y][i].switch_right =
-		    switch_configuration[9 * i + 1];
+		result.coordinate_system[y][i].switch_right = switch_configuration[9 * i + 1];
 
-		result.coordinate_system.coordinate_system[y][i].switch_circuit_shared =
-		    switch_configuration[9 * i + 2];
+		result.coordinate_system[y][i].switch_circuit_shared = switch_configuration[9 * i + 2];
 
-		result.coordinate_system.coordinate_system[y][i].switch_circuit_shared_conductance =
+		result.coordinate_system[y][i].switch_circuit_shared_conductance =
 		    (switch_configuration[9 * i + 3] && !switch_configuration[9 * i + 2]);
 
-		result.coordinate_system.coordinate_system[y][i].switch_shared_right =
-		    switch_configuration[9 * i + 4];
+		result.coordinate_system[y][i].switch_shared_right = switch_configuration[9 * i + 4];
 
 		y = 1 - y; // Switch row
 
-		result.coordinate_system.coordinate_system[y][i].switch_right =
-		    switch_configuration[9 * i + 5];
+		result.coordinate_system[y][i].switch_right = switch_configuration[9 * i + 5];
 
-		result.coordinate_system.coordinate_system[y][i].switch_circuit_shared =
-		    switch_configuration[9 * i + 6];
+		result.coordinate_system[y][i].switch_circuit_shared = switch_configuration[9 * i + 6];
 
-		result.coordinate_system.coordinate_system[y][i].switch_circuit_shared_conductance =
+		result.coordinate_system[y][i].switch_circuit_shared_conductance =
 		    (switch_configuration[9 * i + 7] && !switch_configuration[9 * i + 6]);
 
-		result.coordinate_system.coordinate_system[y][i].switch_shared_right =
-		    switch_configuration[9 * i + 8];
+		result.coordinate_system[y][i].switch_shared_right = switch_configuration[9 * i + 8];
 	}
 	result.coordinate_system.clear_invalid_connections(x_max);
 }
@@ -321,7 +460,18 @@ double PlacementAlgorithmEvolutionary::fitness(
 
 	double fitness_resources = fitness_resources_total(parallel_result, resources);
 
-	double fitness_isomorphic = fitness_isomorphism(parallel_result, neuron, resources);
+	double fitness_isomorphic;
+	if (m_run_parameters.memoize_fitness) {
+		auto structure = get_structure(parallel_result);
+		if (auto const it = m_impl->isomorphism.find(structure); it != m_impl->isomorphism.end()) {
+			fitness_isomorphic = it->second;
+		} else {
+			fitness_isomorphic = fitness_isomorphism(parallel_result, neuron, resources);
+			m_impl->isomorphism.emplace(std::move(structure), fitness_isomorphic);
+		}
+	} else {
+		fitness_isomorphic = fitness_isomorphism(parallel_result, neuron, resources);
+	}
 
 	double fitness_recordable = fitness_recording(parallel_result, resources);
 
@@ -368,6 +518,9 @@ AlgorithmResult PlacementAlgorithmEvolutionary::run(
 	    m_run_parameters.together_add_remove, m_run_parameters.lower_limit_add_remove,
 	    m_run_parameters.upper_limit_add_remove, gen);
 
+	// Memoized fitness values are only valid for the current target neuron
+	m_impl->clear();
+
 	// Setting up initial population of chromes
 	Population population;
 	for (size_t i = 0; i < m_run_parameters.population_size; i++) {
@@ -419,28 +572,39 @@ AlgorithmResult PlacementAlgorithmEvolutionary::run(
 			}
 			hall_of_fame_population.clear();
 
-			auto lambda_fitness = [this, &population, &neuron, &resources](size_t index) -> void {
-				for (size_t i = index; i < index + m_run_parameters.parallel_threads; i++) {
+			// Calculating the fitness of each chrom in the population, reusing memoized values of
+			// equal coordinate systems
+			if (m_placement_results.size() < population.size()) {
+				m_placement_results.resize(population.size());
+			}
+			if (m_impl->fitness.size() > Impl::max_cache_size ||
+			    m_impl->isomorphism.size() > Impl::max_cache_size) {
+				m_impl->clear();
+			}
+			m_impl->get_arena(m_run_parameters.parallel_threads).execute([&]() {
+				tbb::parallel_for(size_t(0), population.size(), [&](size_t const i) {
 					NeuronPlacementResult& parallel_result = m_placement_results.at(i);
 
 					build_coordinate_system(
 					    parallel_result, m_run_parameters.x_max, population.at(i));
-					double temp_fitness =
+					if (!m_run_parameters.memoize_fitness) {
+						population[i].fitness(
+						    fitness(parallel_result, m_run_parameters.x_max, neuron, resources));
+						return;
+					}
+					auto configuration = get_switch_configuration(
+					    parallel_result.result.coordinate_system, m_run_parameters.x_max);
+					if (auto const it = m_impl->fitness.find(configuration);
+					    it != m_impl->fitness.end()) {
+						population[i].fitness(it->second);
+						return;
+					}
+					double const temp_fitness =
 					    fitness(parallel_result, m_run_parameters.x_max, neuron, resources);
+					m_impl->fitness.emplace(std::move(configuration), temp_fitness);
 					population[i].fitness(temp_fitness);
-				}
-			};
-
-			// Calculating the fitness of each chrom in the population
-			std::vector<std::future<void>> void_results;
-			for (size_t i = 0; i < population.size() / m_run_parameters.parallel_threads; i++) {
-				void_results.push_back(std::async(
-				    std::launch::async, lambda_fitness, m_run_parameters.parallel_threads * i));
-			}
-
-			for (auto& void_result : void_results) {
-				void_result.wait();
-			}
+				});
+			});
 
 			// Find best element and validate in loop
 			build_coordinate_system(
@@ -492,6 +656,7 @@ void PlacementAlgorithmEvolutionary::reset()
 	m_result_final = AlgorithmResult();
 	m_placement_results.clear();
 	m_placement_results.resize(m_run_parameters.population_size);
+	m_impl->clear();
 }
 
 
@@ -517,7 +682,7 @@ bool PlacementAlgorithmEvolutionary::valid(
 	std::map<grenade::common::CompartmentOnNeuron, NumberTopBottom> resources_constructed;
 	for (size_t x = 0; x < x_max; x++) {
 		for (size_t y = 0; y < 2; y++) {
-			if (best_result.coordinate_system.coordinate_system[y][x].compartment ==
+			if (best_result.coordinate_system[y][x].compartment ==
 			        grenade::common::CompartmentOnNeuron() &&
 			    best_result.coordinate_system.connected(x, y)) {
 				// Add Compartment to Neuron
@@ -546,12 +711,12 @@ bool PlacementAlgorithmEvolutionary::valid(
 		for (size_t y = 0; y < 2; y++) {
 			if (best_result.coordinate_system.connected_right_shared(x, y) &&
 			    !neuron_constructed.neighbour(
-			        best_result.coordinate_system.coordinate_system[y][x].compartment.value(),
-			        best_result.coordinate_system.coordinate_system[y][x + 1]
+			        best_result.coordinate_system[y][x].compartment.value(),
+			        best_result.coordinate_system[y][x + 1]
 			            .compartment.value())) {
 				neuron_constructed.add_compartment_connection(
-				    best_result.coordinate_system.coordinate_system[y][x].compartment.value(),
-				    best_result.coordinate_system.coordinate_system[y][x + 1].compartment.value(),
+				    best_result.coordinate_system[y][x].compartment.value(),
+				    best_result.coordinate_system[y][x + 1].compartment.value(),
 				    connection_temp);
 			}
 		}
@@ -591,11 +756,11 @@ bool PlacementAlgorithmEvolutionary::valid(
 	// Assinging correct compartment-IDs to coordinate system
 	for (size_t x = 0; x < x_max + 2; x++) {
 		for (size_t y = 0; y < 2; y++) {
-			if (!best_result.coordinate_system.coordinate_system[y][x].compartment) {
+			if (!best_result.coordinate_system[y][x].compartment) {
 				continue;
 			}
-			best_result.coordinate_system.coordinate_system[y][x].compartment =
-			    isomorphism.second[best_result.coordinate_system.coordinate_system[y][x]
+			best_result.coordinate_system[y][x].compartment =
+			    isomorphism.second[best_result.coordinate_system[y][x]
 			                           .compartment.value()];
 		}
 	}
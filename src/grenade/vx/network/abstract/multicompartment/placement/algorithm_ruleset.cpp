@@ -469,10 +469,10 @@ void PlacementAlgorithmRuleset::add_bridge(
 	connect_self(coordinates, compartment);
 
 	// Connect circuits
-	coordinates.coordinate_system.at(spot.y).at(spot.x_parent).switch_circuit_shared = true;
-	coordinates.coordinate_system.at(spot.y).at(spot.x).switch_circuit_shared = true;
+	coordinates[spot.y].at(spot.x_parent).switch_circuit_shared = true;
+	coordinates[spot.y].at(spot.x).switch_circuit_shared = true;
 	for (size_t x = std::min(spot.x, spot.x_parent); x < std::max(spot.x, spot.x_parent); x++) {
-		coordinates.coordinate_system.at(spot.y).at(x).switch_shared_right = true;
+		coordinates[spot.y].at(x).switch_shared_right = true;
 	}
 }
 
@@ -830,11 +830,11 @@ void PlacementAlgorithmRuleset::connect_self(
 		// Connection right
 		if (X < coordinates.coordinate_system.at(Y).size() &&
 		    coordinates.get_compartment(X + 1, Y) == compartment) {
-			coordinates.coordinate_system.at(Y).at(X).switch_right = true;
+			coordinates[Y].at(X).switch_right = true;
 		}
 		// Connection top bottom
 		if (coordinates.get_compartment(X, 1 - Y) == compartment) {
-			coordinates.coordinate_system.at(Y).at(X).switch_top_bottom = true;
+			coordinates[Y].at(X).switch_top_bottom = true;
 		}
 	}
 }
@@ -1,10 +1,14 @@
 #include "grenade/vx/network/abstract/multicompartment/placement/coordinate_system.h"
+
+#include "grenade/vx/network/abstract/multicompartment/placement/coordinate_system_bitboard.h"
 #include <iostream>
+#include <map>
 
 namespace grenade::vx::network::abstract {
 
 void CoordinateSystem::set(size_t x, size_t y, NeuronCircuit const& neuron_circuit)
 {
+	invalidate_bitboard();
 	coordinate_system[y][x] = neuron_circuit;
 }
 
@@ -24,6 +28,7 @@ void CoordinateSystem::set_compartment(
 void CoordinateSystem::set_config(
     size_t x, size_t y, UnplacedNeuronCircuit const& neuron_circuit_config_in)
 {
+	invalidate_bitboard();
 	coordinate_system[y][x].switch_shared_right = neuron_circuit_config_in.switch_shared_right;
 	coordinate_system[y][x].switch_right = neuron_circuit_config_in.switch_right;
 	coordinate_system[y][x].switch_top_bottom = neuron_circuit_config_in.switch_top_bottom;
@@ -137,61 +142,24 @@ bool CoordinateSystem::connected_left(size_t x, size_t y) const
 }
 bool CoordinateSystem::has_empty_connections(size_t x_max) const
 {
-	for (size_t x = 0; x < x_max; x++) {
-		for (size_t y = 0; y < 2; y++) {
-			// Top Bottom Only connected from one side
-			if ((coordinate_system[y][x].switch_top_bottom &&
-			     !coordinate_system[1 - y][x].switch_top_bottom)
-			    // Connected to shared Line but shared line not connected to left or right
-			    || ((coordinate_system[y][x].switch_circuit_shared ||
-			         coordinate_system[y][x].switch_circuit_shared_conductance) &&
-			        !(coordinate_system[y][x].switch_shared_right ||
-			          (x != 0 && coordinate_system[y][x - 1].switch_shared_right)))
-			    // Shared line goes to empty
-			    || (coordinate_system[y][x].switch_shared_right &&
-			        // No connection on the right
-			        (!(coordinate_system[y][x + 1].switch_circuit_shared ||
-			           coordinate_system[y][x + 1].switch_circuit_shared_conductance ||
-			           coordinate_system[y][x + 1].switch_shared_right) ||
-			         // No connection on the left
-			         !(coordinate_system[y][x].switch_circuit_shared ||
-			           coordinate_system[y][x].switch_circuit_shared_conductance ||
-			           ((x != 0) && coordinate_system[y][x - 1].switch_shared_right))))) {
-				return true;
-			}
-		}
-	}
-	return false;
+	return get_bitboard()->has_empty_connections(x_max);
 }
 bool CoordinateSystem::has_double_connections(size_t x_max) const
 {
-	for (size_t x = 0; x < x_max; x++) {
-		for (size_t y = 0; y < 2; y++) {
-			if (connected_right(x, y) && connected_right_shared(x, y)) {
-				return true;
-			}
-		}
-	}
-	return false;
+	return get_bitboard()->has_double_connections(x_max);
 }
 
 
 bool CoordinateSystem::double_switch(size_t x_max) const
 {
-	for (size_t y = 0; y < 2; y++) {
-		for (size_t x = 0; x < x_max; x++) {
-			if (coordinate_system[y][x].switch_circuit_shared &&
-			    coordinate_system[y][x].switch_circuit_shared_conductance) {
-				return true;
-			}
-		}
-	}
-	return false;
+	return get_bitboard()->double_switch(x_max);
 }
 
 
 void CoordinateSystem::clear_empty_connections(size_t x_max)
 {
+	invalidate_bitboard();
+
 	// Deleting empty shared lines from right to left
 	for (size_t x = x_max; x > 0; x--) {
 		for (size_t y = 0; y < 2; y++) {
@@ -276,23 +244,36 @@ void CoordinateSystem::clear_invalid_connections(size_t x_max)
 
 bool CoordinateSystem::short_circuit(size_t x_max) const
 {
+	auto const bitboard = get_bitboard();
 	for (size_t y = 0; y < 2; y++) {
-		for (size_t x = 0; x < x_max; x++) {
-			if (coordinate_system[y][x].switch_circuit_shared) {
-				if (!coordinate_system[y][x].compartment) {
-					continue;
-				}
-				grenade::common::CompartmentOnNeuron temp_compartment =
-				    coordinate_system[y][x].compartment.value();
-				size_t x_temp = x;
-				while (coordinate_system[y][x_temp].switch_shared_right) {
-					if (coordinate_system[y][x_temp].switch_circuit_shared &&
-					    coordinate_system[y][x_temp].compartment &&
-					    coordinate_system[y][x_temp].compartment.value() != temp_compartment) {
-						return true;
-					}
-					x_temp++;
-				}
+		// Neuron circuits directly connected to the shared line per compartment
+		std::map<grenade::common::CompartmentOnNeuron, CoordinateSystemBitboard::Row> shared;
+		for (size_t x = 0; x < coordinate_system[y].size(); x++) {
+			if (coordinate_system[y][x].switch_circuit_shared &&
+			    coordinate_system[y][x].compartment) {
+				shared[coordinate_system[y][x].compartment.value()].set(x);
+			}
+		}
+		if (shared.size() < 2) {
+			continue;
+		}
+
+		// Short circuit if a shared line segment starting at a neuron circuit of one compartment
+		// reaches a neuron circuit of another compartment with closed shared line switch
+		CoordinateSystemBitboard::Row starting_range;
+		for (size_t x = 0; x < x_max && x < starting_range.size(); x++) {
+			starting_range.set(x);
+		}
+		auto const& shared_right = bitboard->switch_shared_right[y];
+		CoordinateSystemBitboard::Row all_shared;
+		for (auto const& [_, circuits] : shared) {
+			all_shared |= circuits;
+		}
+		for (auto const& [_, circuits] : shared) {
+			auto const reached =
+			    CoordinateSystemBitboard::fill(circuits & starting_range, shared_right, true);
+			if ((reached & shared_right & all_shared & ~circuits).any()) {
+				return true;
 			}
 		}
 	}
@@ -501,6 +482,7 @@ std::set<grenade::common::CompartmentOnNeuron> CoordinateSystem::odd_parity() co
 
 void CoordinateSystem::connect_shared(size_t x_source, size_t x_target, size_t y)
 {
+	invalidate_bitboard();
 	coordinate_system[y][x_source].switch_circuit_shared = true;
 	coordinate_system[y][x_target].switch_circuit_shared_conductance = true;
 
@@ -560,15 +542,15 @@ void CoordinateSystem::assign_compartments()
 	// First remove all assigned compartments
 	clear_compartments();
 	grenade::common::CompartmentOnNeuron compartment;
-	for (size_t y = 0; y < coordinate_system.size(); y++) {
-		for (size_t x = 0; x < coordinate_system[0].size(); x++) {
-			if (!coordinate_system[y][x].compartment &&
-			    (connected_to_shared_line(x, y) || connected_right(x, y) ||
-			     connected_top_bottom(x, y))) {
-				assign_compartment_direct(x, y, compartment);
-				compartment += grenade::common::CompartmentOnNeuron(1);
+	for (auto const& component : get_bitboard()->components(true)) {
+		for (size_t y = 0; y < coordinate_system.size(); y++) {
+			for (size_t x = 0; x < coordinate_system[0].size(); x++) {
+				if (component[y].test(x)) {
+					coordinate_system[y][x].compartment = compartment;
+				}
 			}
 		}
+		compartment += grenade::common::CompartmentOnNeuron(1);
 	}
 }
 
@@ -658,10 +640,11 @@ CoordinateSystem::construct_logical_neuron_compartments() const
 	coordinate_system_copy.align_left();
 
 	// check that results fits on hardware
+	auto const connected_circuits = coordinate_system_copy.get_bitboard()->connected();
 	int right_most_used_circuit = 0;
 	for (int y = coordinate_system_copy.coordinate_system.size() - 1; y >= 0; y--) {
 		for (int x = coordinate_system_copy.coordinate_system[0].size() - 1; x >= 0; x--) {
-			if (coordinate_system_copy.connected(x, y)) {
+			if (connected_circuits[y].test(x)) {
 				right_most_used_circuit = std::max(x, right_most_used_circuit);
 				break;
 			}
@@ -695,10 +678,11 @@ CoordinateSystem::construct_logical_neuron_compartments() const
 
 void CoordinateSystem::align_left()
 {
+	auto const connected_circuits = get_bitboard()->connected();
 	size_t left_most_used_circuit = coordinate_system[0].size();
 	for (size_t y = 0; y < coordinate_system.size(); y++) {
 		for (size_t x = 0; x < coordinate_system[0].size(); x++) {
-			if (connected(x, y)) {
+			if (connected_circuits[y].test(x)) {
 				left_most_used_circuit = std::min(x, left_most_used_circuit);
 				break;
 			}
@@ -721,11 +705,12 @@ void CoordinateSystem::align_left()
 
 size_t CoordinateSystem::get_extent() const
 {
+	auto const connected_circuits = get_bitboard()->connected();
 	bool used_circuit_found = false;
 	size_t left_most_used_circuit = coordinate_system[0].size();
 	for (size_t y = 0; y < coordinate_system.size(); y++) {
 		for (size_t x = 0; x < coordinate_system[0].size(); x++) {
-			if (connected(x, y)) {
+			if (connected_circuits[y].test(x)) {
 				left_most_used_circuit = std::min(x, left_most_used_circuit);
 				used_circuit_found = true;
 				break;
@@ -741,7 +726,7 @@ size_t CoordinateSystem::get_extent() const
 	size_t right_most_used_circuit = 0;
 	for (size_t y = 0; y < coordinate_system.size(); y++) {
 		for (size_t x = coordinate_system[0].size(); x-- > 0;) {
-			if (connected(x, y)) {
+			if (connected_circuits[y].test(x)) {
 				right_most_used_circuit = std::max(x, right_most_used_circuit);
 				break;
 			}
@@ -753,6 +738,7 @@ size_t CoordinateSystem::get_extent() const
 
 void CoordinateSystem::clear()
 {
+	invalidate_bitboard();
 	for (size_t y = 0; y < 2; y++) {
 		for (size_t x = 0; x < coordinate_system[y].size(); x++) {
 			coordinate_system[y][x] = NeuronCircuit();
@@ -763,8 +749,19 @@ void CoordinateSystem::clear()
 
 std::array<NeuronCircuit, 256>& CoordinateSystem::operator[](size_t y)
 {
+	invalidate_bitboard();
 	return coordinate_system[y];
 }
 
+std::shared_ptr<CoordinateSystemBitboard const> CoordinateSystem::get_bitboard() const
+{
+	return m_bitboard.get(m_generation, [this](size_t) { return CoordinateSystemBitboard(*this); });
+}
+
+void CoordinateSystem::invalidate_bitboard()
+{
+	m_generation++;
+}
+
 
 } // namespace grenade::vx::network::abstract
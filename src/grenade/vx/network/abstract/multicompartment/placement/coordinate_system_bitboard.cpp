@@ -0,0 +1,210 @@
+#include "grenade/vx/network/abstract/multicompartment/placement/coordinate_system_bitboard.h"
+
+#include "grenade/vx/network/abstract/multicompartment/placement/coordinate_system.h"
+
+namespace grenade::vx::network::abstract {
+
+namespace {
+
+/**
+ * Mask of all columns smaller than x_max.
+ */
+CoordinateSystemBitboard::Row get_range(size_t x_max)
+{
+	CoordinateSystemBitboard::Row range;
+	if (x_max == 0) {
+		return range;
+	}
+	range.set();
+	if (x_max < range.size()) {
+		range >>= range.size() - x_max;
+	}
+	return range;
+}
+
+/**
+ * Mask of all columns except for the last, which has no right neighbour.
+ */
+CoordinateSystemBitboard::Row get_not_last()
+{
+	CoordinateSystemBitboard::Row not_last;
+	not_last.set();
+	not_last.reset(not_last.size() - 1);
+	return not_last;
+}
+
+} // namespace
+
+CoordinateSystemBitboard::CoordinateSystemBitboard(CoordinateSystem const& coordinate_system)
+{
+	for (size_t y = 0; y < 2; ++y) {
+		for (size_t x = 0; x < Row().size(); ++x) {
+			auto const& neuron_circuit = coordinate_system.coordinate_system[y][x];
+			switch_shared_right[y][x] = neuron_circuit.switch_shared_right;
+			switch_right[y][x] = neuron_circuit.switch_right;
+			switch_top_bottom[y][x] = neuron_circuit.switch_top_bottom;
+			switch_circuit_shared[y][x] = neuron_circuit.switch_circuit_shared;
+			switch_circuit_shared_conductance[y][x] =
+			    neuron_circuit.switch_circuit_shared_conductance;
+		}
+	}
+}
+
+CoordinateSystemBitboard::Row CoordinateSystemBitboard::fill(
+    Row const& seeds, Row const& links, bool right)
+{
+	// Kogge-Stone-like prefix propagation: after the step with shift s, all neuron circuits
+	// reachable within less than 2s steps are found.
+	Row reached = seeds;
+	if (right) {
+		Row propagate = links << 1;
+		for (size_t shift = 1; shift < reached.size(); shift <<= 1) {
+			reached |= propagate & (reached << shift);
+			propagate &= propagate << shift;
+		}
+	} else {
+		Row propagate = links;
+		for (size_t shift = 1; shift < reached.size(); shift <<= 1) {
+			reached |= propagate & (reached >> shift);
+			propagate &= propagate >> shift;
+		}
+	}
+	return reached;
+}
+
+CoordinateSystemBitboard::Row CoordinateSystemBitboard::connected_right_shared(size_t y) const
+{
+	auto const& shared = switch_circuit_shared[y];
+	auto const& conductance = switch_circuit_shared_conductance[y];
+	return switch_shared_right[y] & ((shared & ~conductance & ~(shared >> 1) & (conductance >> 1)) |
+	                                 (~shared & conductance & (shared >> 1) & ~(conductance >> 1)));
+}
+
+CoordinateSystemBitboard::Row CoordinateSystemBitboard::on_segment_with(
+    size_t y, Row const& mask) const
+{
+	auto const& links = switch_shared_right[y];
+	// start one step away from the mask to exclude the masked neuron circuits themselves
+	return fill((mask >> 1) & links, links, false) | fill((mask & links) << 1, links, true);
+}
+
+CoordinateSystemBitboard::Board CoordinateSystemBitboard::connected() const
+{
+	auto const not_last = get_not_last();
+	auto const top_bottom = switch_top_bottom[0] & switch_top_bottom[1];
+
+	Board ret;
+	for (size_t y = 0; y < 2; ++y) {
+		auto const& shared = switch_circuit_shared[y];
+		auto const& conductance = switch_circuit_shared_conductance[y];
+		auto const right_shared = connected_right_shared(y);
+		auto const on_segment_with_shared = on_segment_with(y, shared);
+		ret[y] = right_shared | (right_shared << 1) | top_bottom | (switch_right[y] & not_last) |
+		         (switch_right[y] << 1) | (shared & on_segment_with_shared) |
+		         (shared & on_segment_with(y, conductance)) |
+		         (~shared & conductance & on_segment_with_shared);
+	}
+	return ret;
+}
+
+bool CoordinateSystemBitboard::has_empty_connections(size_t x_max) const
+{
+	auto const range = get_range(x_max);
+	for (size_t y = 0; y < 2; ++y) {
+		auto const& shared_right = switch_shared_right[y];
+		auto const on_shared_line =
+		    switch_circuit_shared[y] | switch_circuit_shared_conductance[y];
+		// Top Bottom only connected from one side
+		auto const top_bottom = switch_top_bottom[y] & ~switch_top_bottom[1 - y];
+		// Connected to shared line but shared line not connected to left or right
+		auto const shared = on_shared_line & ~(shared_right | (shared_right << 1));
+		// Shared line goes to empty on the right or on the left
+		auto const shared_line =
+		    shared_right &
+		    (~((on_shared_line | shared_right) >> 1) | ~(on_shared_line | (shared_right << 1)));
+		if (((top_bottom | shared | shared_line) & range).any()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool CoordinateSystemBitboard::has_double_connections(size_t x_max) const
+{
+	auto const range = get_range(x_max);
+	auto const not_last = get_not_last();
+	for (size_t y = 0; y < 2; ++y) {
+		if ((switch_right[y] & not_last & connected_right_shared(y) & range).any()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool CoordinateSystemBitboard::double_switch(size_t x_max) const
+{
+	auto const range = get_range(x_max);
+	for (size_t y = 0; y < 2; ++y) {
+		if ((switch_circuit_shared[y] & switch_circuit_shared_conductance[y] & range).any()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+std::vector<CoordinateSystemBitboard::Board> CoordinateSystemBitboard::components(
+    bool via_shared_line) const
+{
+	auto const not_last = get_not_last();
+	auto const top_bottom = switch_top_bottom[0] & switch_top_bottom[1];
+
+	Board links;
+	Board unassigned;
+	for (size_t y = 0; y < 2; ++y) {
+		links[y] = switch_right[y] & not_last;
+		unassigned[y] = switch_circuit_shared[y] | switch_circuit_shared_conductance[y] |
+		                links[y] | top_bottom;
+	}
+
+	std::vector<Board> ret;
+	for (size_t y = 0; y < 2; ++y) {
+		for (size_t x = 0; x < Row().size(); ++x) {
+			if (!unassigned[y].test(x)) {
+				continue;
+			}
+
+			// Flood fill until no further neuron circuits are reached
+			Board component;
+			component[y].set(x);
+			Board previous;
+			do {
+				previous = component;
+				for (size_t yy = 0; yy < 2; ++yy) {
+					component[yy] = fill(component[yy], links[yy], true) |
+					                fill(component[yy], links[yy], false);
+				}
+				component[0] |= component[1] & top_bottom;
+				component[1] |= component[0] & top_bottom;
+				if (via_shared_line) {
+					for (size_t yy = 0; yy < 2; ++yy) {
+						auto const shared = component[yy] & switch_circuit_shared[yy];
+						if (shared.none()) {
+							continue;
+						}
+						component[yy] |= switch_circuit_shared[yy] &
+						                 (fill(shared, switch_shared_right[yy], true) |
+						                  fill(shared, switch_shared_right[yy], false));
+					}
+				}
+			} while (component != previous);
+
+			for (size_t yy = 0; yy < 2; ++yy) {
+				unassigned[yy] &= ~component[yy];
+			}
+			ret.push_back(component);
+		}
+	}
+	return ret;
+}
+
+} // namespace grenade::vx::network::abstract
@@ -5,6 +5,7 @@
 #include "grenade/common/input_data.h"
 #include "grenade/common/linked_topology.h"
 #include "grenade/common/population.h"
+#include "grenade/common/projection.h"
 #include "grenade/common/projection_connector/static.h"
 #include "grenade/common/vertex_on_topology.h"
 #include "grenade/vx/execution/jit_graph_executor.h"
@@ -25,7 +26,10 @@
 #include "grenade/vx/network/abstract/resource_estimator/population.h"
 #include "grenade/vx/network/connectum.h"
 #include "grenade/vx/network/exception.h"
+#include "grenade/vx/network/routing/greedy/resource_set.h"
+#include "grenade/vx/network/routing/greedy/routing_constraints.h"
 #include "grenade/vx/network/routing/portfolio_router.h"
+#include "halco/common/typed_array.h"
 #include "halco/hicann-dls/vx/v3/background.h"
 #include "halco/hicann-dls/vx/v3/neuron.h"
 #include "halco/hicann-dls/vx/v3/padi.h"
@@ -33,9 +37,14 @@
 #include "hate/timer.h"
 #include "pyhxcomm/vx/connection_handle.h"
 #include <Python.h>
+#include <algorithm>
+#include <cassert>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <numeric>
 #include <optional>
+#include <set>
 #include <sstream>
 #include <boost/range/iterator_range_core.hpp>
 #include <log4cxx/logger.h>
@@ -43,9 +52,330 @@
 
 namespace grenade::vx::network::abstract {
 
+namespace {
+
+typedef routing::greedy::ResourceSet<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> NeuronCircuits;
+
+/**
+ * Neuron circuits occupied by a logical neuron of a given shape per anchor or std::nullopt if the
+ * logical neuron can't be constructed with the anchor.
+ */
+typedef halco::common::
+    typed_array<std::optional<NeuronCircuits>, halco::hicann_dls::vx::v3::AtomicNeuronOnDLS>
+        AnchorTable;
+
+AnchorTable get_anchor_table(halco::hicann_dls::vx::v3::LogicalNeuronCompartments const& shape)
+{
+	AnchorTable ret;
+	for (auto const anchor :
+	     halco::common::iter_all<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS>()) {
+		try {
+			halco::hicann_dls::vx::v3::LogicalNeuronOnDLS logical_neuron(shape, anchor);
+			auto const atomic_neurons = logical_neuron.get_atomic_neurons();
+			ret[anchor].emplace(atomic_neurons.begin(), atomic_neurons.end());
+		} catch (std::runtime_error const&) {
+			// this can happen if we can't construct the logical neuron coordinate with the given
+			// anchor, for example when the neuron then overlaps across the two neuron blocks with
+			// internal inter-neuron-circuit connectivity
+		}
+	}
+	return ret;
+}
+
+/**
+ * Neuron circuits available for placement on an execution instance.
+ */
+struct AvailableNeuronCircuits
+{
+	explicit AvailableNeuronCircuits(GreedyPlacer::NeuronPermutation const& permutation) :
+	    permutation(permutation),
+	    circuits(permutation.begin(), permutation.end()),
+	    first_available(0)
+	{
+	}
+
+	/**
+	 * Place logical neuron at first anchor in order of the permutation for which all its neuron
+	 * circuits are available.
+	 * @param anchor_table Occupied neuron circuits per anchor of the shape of the logical neuron
+	 * @return Anchor or std::nullopt if none is available
+	 */
+	std::optional<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> place(
+	    AnchorTable const& anchor_table)
+	{
+		for (size_t i = first_available; i < permutation.size(); ++i) {
+			auto const& anchor = permutation[i];
+			if (available(anchor, anchor_table)) {
+				occupy(anchor, anchor_table);
+				return anchor;
+			}
+		}
+		return std::nullopt;
+	}
+
+	/**
+	 * Get first anchor in order of the permutation for which all neuron circuits of the logical
+	 * neuron are available per PADI-bus of the anchor.
+	 * @param anchor_table Occupied neuron circuits per anchor of the shape of the logical neuron
+	 * @param padi_buses PADI-bus per anchor
+	 * @return Anchors in order of the permutation
+	 */
+	std::vector<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> get_first_anchor_per_padi_bus(
+	    AnchorTable const& anchor_table,
+	    halco::common::typed_array<
+	        halco::hicann_dls::vx::v3::PADIBusOnDLS,
+	        halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> const& padi_buses) const
+	{
+		std::vector<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> ret;
+		routing::greedy::ResourceSet<halco::hicann_dls::vx::v3::PADIBusOnDLS> found;
+		for (size_t i = first_available;
+		     i < permutation.size() && found.size() < halco::hicann_dls::vx::v3::PADIBusOnDLS::size;
+		     ++i) {
+			auto const& anchor = permutation[i];
+			if (!found.contains(padi_buses[anchor]) && available(anchor, anchor_table)) {
+				found.insert(padi_buses[anchor]);
+				ret.push_back(anchor);
+			}
+		}
+		return ret;
+	}
+
+	/**
+	 * Occupy neuron circuits of logical neuron at anchor.
+	 * @param anchor Anchor of logical neuron, required to be available
+	 * @param anchor_table Occupied neuron circuits per anchor of the shape of the logical neuron
+	 */
+	void occupy(
+	    halco::hicann_dls::vx::v3::AtomicNeuronOnDLS const& anchor, AnchorTable const& anchor_table)
+	{
+		assert(available(anchor, anchor_table));
+		circuits -= *anchor_table[anchor];
+		while (first_available < permutation.size() &&
+		       !circuits.contains(permutation[first_available])) {
+			first_available++;
+		}
+	}
+
+private:
+	bool available(
+	    halco::hicann_dls::vx::v3::AtomicNeuronOnDLS const& anchor,
+	    AnchorTable const& anchor_table) const
+	{
+		auto const& occupied = anchor_table[anchor];
+		return circuits.contains(anchor) && occupied && circuits.includes(*occupied);
+	}
+
+	GreedyPlacer::NeuronPermutation const& permutation;
+	NeuronCircuits circuits;
+	/**
+	 * Index of first available neuron circuit in permutation, all prior ones are occupied.
+	 */
+	size_t first_available;
+};
+
+/**
+ * Get PADI-bus onto which the events of a source neuron at the given anchor are forwarded for
+ * target neurons in the same hemisphere as modelled by the routing constraints.
+ */
+halco::hicann_dls::vx::v3::PADIBusOnDLS get_padi_bus(
+    halco::hicann_dls::vx::v3::AtomicNeuronOnDLS const& anchor)
+{
+	routing::greedy::RoutingConstraints::InternalConnection connection{};
+	connection.source = anchor;
+	connection.target = anchor;
+	return connection.toPADIBusOnDLS();
+}
+
+/**
+ * Estimate of the number of synapse rows required per PADI-bus on an execution instance.
+ * Connections between populations are assumed to be distributed homogeneously with the average
+ * connection density between the populations.
+ */
+struct SynapseRowEstimate
+{
+	typedef halco::common::typed_array<double, halco::hicann_dls::vx::v3::PADIBusOnDLS> Rows;
+
+	SynapseRowEstimate()
+	{
+		m_rows.fill(0.);
+	}
+
+	/**
+	 * Target populations with average number of connections from a single source neuron to a
+	 * single target neuron per source population.
+	 */
+	std::map<
+	    grenade::common::VertexOnTopology,
+	    std::map<grenade::common::VertexOnTopology, double>>
+	    connection_densities;
+
+	/**
+	 * Get estimated number of synapse rows after placing a neuron of the population at an anchor
+	 * on the given PADI-bus.
+	 * @param population Population of the neuron
+	 * @param padi_bus PADI-bus of the anchor
+	 */
+	Rows get_rows(
+	    grenade::common::VertexOnTopology const& population,
+	    halco::hicann_dls::vx::v3::PADIBusOnDLS const& padi_bus) const
+	{
+		using namespace halco::hicann_dls::vx::v3;
+
+		auto ret = m_rows;
+		auto const padi_bus_on_block = padi_bus.toPADIBusOnPADIBusBlock();
+		auto const padi_bus_block_of_population = padi_bus.toPADIBusBlockOnDLS();
+		if (connection_densities.contains(population)) {
+			for (auto const& [target, density] : connection_densities.at(population)) {
+				auto const in_degree = get_in_degree(target, padi_bus_on_block) + density;
+				for (auto const padi_bus_block : halco::common::iter_all<PADIBusBlockOnDLS>()) {
+					if (m_populations[padi_bus_block].contains(target) ||
+					    (target == population && padi_bus_block == padi_bus_block_of_population)) {
+						auto& rows = ret[PADIBusOnDLS(padi_bus_on_block, padi_bus_block)];
+						rows = std::max(rows, in_degree);
+					}
+				}
+			}
+		}
+		if (!m_populations[padi_bus_block_of_population].contains(population)) {
+			for (auto const other_padi_bus_on_block :
+			     halco::common::iter_all<PADIBusOnPADIBusBlock>()) {
+				auto& rows =
+				    ret[PADIBusOnDLS(other_padi_bus_on_block, padi_bus_block_of_population)];
+				rows = std::max(rows, get_in_degree(population, other_padi_bus_on_block));
+			}
+		}
+		return ret;
+	}
+
+	/**
+	 * Place neuron of the population at an anchor on the given PADI-bus.
+	 * @param population Population of the neuron
+	 * @param padi_bus PADI-bus of the anchor
+	 */
+	void place(
+	    grenade::common::VertexOnTopology const& population,
+	    halco::hicann_dls::vx::v3::PADIBusOnDLS const& padi_bus)
+	{
+		m_rows = get_rows(population, padi_bus);
+		if (connection_densities.contains(population)) {
+			for (auto const& [target, density] : connection_densities.at(population)) {
+				auto [in_degree, inserted] = m_in_degrees.try_emplace(target);
+				if (inserted) {
+					in_degree->second.fill(0.);
+				}
+				in_degree->second[padi_bus.toPADIBusOnPADIBusBlock()] += density;
+			}
+		}
+		m_populations[padi_bus.toPADIBusBlockOnDLS()].insert(population);
+	}
+
+private:
+	double get_in_degree(
+	    grenade::common::VertexOnTopology const& population,
+	    halco::hicann_dls::vx::v3::PADIBusOnPADIBusBlock const& padi_bus) const
+	{
+		if (!m_in_degrees.contains(population)) {
+			return 0.;
+		}
+		return m_in_degrees.at(population)[padi_bus];
+	}
+
+	/**
+	 * Accumulated in-degree of a single neuron of the target population per PADI-bus.
+	 */
+	std::map<
+	    grenade::common::VertexOnTopology,
+	    halco::common::typed_array<double, halco::hicann_dls::vx::v3::PADIBusOnPADIBusBlock>>
+	    m_in_degrees;
+
+	/**
+	 * Populations with neurons placed per PADI-bus block.
+	 */
+	halco::common::typed_array<
+	    std::set<grenade::common::VertexOnTopology>,
+	    halco::hicann_dls::vx::v3::PADIBusBlockOnDLS>
+	    m_populations;
+
+	/**
+	 * Estimated number of synapse rows per PADI-bus.
+	 */
+	Rows m_rows;
+};
+
+/**
+ * Get synapse row estimates per execution instance with the connection densities between
+ * locally placed neuron populations on the same execution instance.
+ */
+std::map<grenade::common::ExecutionInstanceOnExecutor, SynapseRowEstimate>
+get_synapse_row_estimates(grenade::common::LinkedTopology const& topology)
+{
+	using namespace grenade::common;
+
+	auto const get_locally_placed_population =
+	    [&topology](VertexOnTopology const& descriptor) -> Population const* {
+		auto const population = dynamic_cast<Population const*>(&topology.get(descriptor));
+		if (!population || !dynamic_cast<LocallyPlacedNeuron const*>(&population->get_cell())) {
+			return nullptr;
+		}
+		return population;
+	};
+
+	std::map<ExecutionInstanceOnExecutor, SynapseRowEstimate> ret;
+	for (auto const vertex_descriptor : topology.vertices()) {
+		auto const projection = dynamic_cast<Projection const*>(&topology.get(vertex_descriptor));
+		if (!projection) {
+			continue;
+		}
+		std::set<VertexOnTopology> sources;
+		for (auto const in_edge_descriptor : topology.in_edges(vertex_descriptor)) {
+			auto const source = topology.source(in_edge_descriptor);
+			if (get_locally_placed_population(source)) {
+				sources.insert(source);
+			}
+		}
+		std::set<VertexOnTopology> targets;
+		for (auto const out_edge_descriptor : topology.out_edges(vertex_descriptor)) {
+			auto const target = topology.target(out_edge_descriptor);
+			if (get_locally_placed_population(target)) {
+				targets.insert(target);
+			}
+		}
+		if (sources.empty() || targets.empty()) {
+			continue;
+		}
+
+		auto const& connector = projection->get_connector();
+		auto const section =
+		    connector.get_input_sequence()->cartesian_product(*connector.get_output_sequence());
+		double const num_synapses = connector.get_num_synapses(*section);
+
+		for (auto const& source : sources) {
+			auto const& source_population = *get_locally_placed_population(source);
+			for (auto const& target : targets) {
+				auto const& target_population = *get_locally_placed_population(target);
+				if (source_population.get_execution_instance_on_executor() !=
+				    target_population.get_execution_instance_on_executor()) {
+					continue;
+				}
+				double const num_neuron_pairs =
+				    source_population.get_shape().size() * target_population.get_shape().size();
+				if (num_neuron_pairs == 0) {
+					continue;
+				}
+				ret[*source_population.get_execution_instance_on_executor()]
+				    .connection_densities[source][target] += num_synapses / num_neuron_pairs;
+			}
+		}
+	}
+	return ret;
+}
+
+} // namespace
+
 GreedyPlacer::GreedyPlacer() :
     m_neuron_permutation(),
     m_background_source_permutation(),
+    m_mode(Mode::permutation),
     m_logger(log4cxx::Logger::getLogger("grenade.network.abstract.GreedyPlacer"))
 {
 	for (auto const atomic_neuron :
@@ -86,21 +416,46 @@ GreedyPlacer::BackgroundSourcePermutation const& GreedyPlacer::get_background_so
 	return m_background_source_permutation;
 }
 
+GreedyPlacer::Mode GreedyPlacer::get_mode() const
+{
+	return m_mode;
+}
+
+void GreedyPlacer::set_mode(Mode value)
+{
+	m_mode = value;
+}
+
 PlacementResult GreedyPlacer::operator()(grenade::common::LinkedTopology const& topology) const
 {
 	hate::Timer mapping_timer;
 	using namespace grenade::common;
 
-	std::map<
-	    grenade::common::ExecutionInstanceOnExecutor,
-	    std::vector<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS>>
+	std::map<grenade::common::ExecutionInstanceOnExecutor, AvailableNeuronCircuits>
 	    available_neuron_circuits;
 
+	// anchor tables are shared across execution instances and only computed once per shape
+	std::vector<std::pair<halco::hicann_dls::vx::v3::LogicalNeuronCompartments, AnchorTable>>
+	    anchor_tables;
+
 	std::map<
 	    grenade::common::ExecutionInstanceOnExecutor,
 	    std::vector<halco::hicann_dls::vx::v3::PADIBusOnPADIBusBlock>>
 	    available_background_circuits;
 
+	std::map<grenade::common::ExecutionInstanceOnExecutor, SynapseRowEstimate>
+	    synapse_row_estimates;
+	halco::common::typed_array<
+	    halco::hicann_dls::vx::v3::PADIBusOnDLS, halco::hicann_dls::vx::v3::AtomicNeuronOnDLS>
+	    padi_buses;
+	if (m_mode == Mode::connectivity_aware) {
+		synapse_row_estimates = get_synapse_row_estimates(topology);
+		for (auto const anchor :
+		     halco::common::iter_all<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS>()) {
+			padi_buses[anchor] = get_padi_bus(anchor);
+		}
+	}
+
 	PlacementResult placement_result;
 
 	for (auto const vertex_descriptor : topology.vertices()) {
@@ -115,56 +470,57 @@ PlacementResult GreedyPlacer::operator()(grenade::common::LinkedTopology const&
 			if (auto const neuron_ptr =
 			        dynamic_cast<LocallyPlacedNeuron const*>(&(population_ptr->get_cell()));
 			    neuron_ptr) {
-				if (!available_neuron_circuits.contains(
-				        population_ptr->get_execution_instance_on_executor().value())) {
-					available_neuron_circuits[population_ptr->get_execution_instance_on_executor()
-					                              .value()] = m_neuron_permutation;
+				auto& local_available_neuron_circuits =
+				    available_neuron_circuits
+				        .try_emplace(
+				            *population_ptr->get_execution_instance_on_executor(),
+				            m_neuron_permutation)
+				        .first->second;
+
+				auto anchor_table_it = std::find_if(
+				    anchor_tables.begin(), anchor_tables.end(),
+				    [neuron_ptr](auto const& entry) { return entry.first == neuron_ptr->shape; });
+				if (anchor_table_it == anchor_tables.end()) {
+					anchor_table_it = anchor_tables.insert(
+					    anchor_tables.end(),
+					    {neuron_ptr->shape, get_anchor_table(neuron_ptr->shape)});
 				}
-				auto& local_available_neuron_circuits = available_neuron_circuits.at(
-				    *population_ptr->get_execution_instance_on_executor());
+				auto const& anchor_table = anchor_table_it->second;
 
 				auto const& sequence = population_ptr->get_shape();
 
 				for (size_t i = 0; i < sequence.size(); ++i) {
-					bool placed = false;
-					for (auto const& anchor : local_available_neuron_circuits) {
-						try {
-							halco::hicann_dls::vx::v3::LogicalNeuronOnDLS logical_neuron(
-							    neuron_ptr->shape, anchor);
-
-
-							auto const atomic_neurons = logical_neuron.get_atomic_neurons();
-							if (!std::all_of(
-							        atomic_neurons.begin(), atomic_neurons.end(),
-							        [local_available_neuron_circuits](auto const& atomic_neuron) {
-								        return std::find(
-								                   local_available_neuron_circuits.begin(),
-								                   local_available_neuron_circuits.end(),
-								                   atomic_neuron) !=
-								               local_available_neuron_circuits.end();
-							        })) {
-								continue;
+					std::optional<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> anchor;
+					if (m_mode == Mode::connectivity_aware) {
+						auto& synapse_row_estimate = synapse_row_estimates[
+						    *population_ptr->get_execution_instance_on_executor()];
+						// choose PADI-bus with smallest resulting maximal and then total number
+						// of synapse rows, ties are resolved by the order of the permutation
+						std::optional<std::pair<double, double>> min_cost;
+						for (auto const& candidate :
+						     local_available_neuron_circuits.get_first_anchor_per_padi_bus(
+						         anchor_table, padi_buses)) {
+							auto const rows = synapse_row_estimate.get_rows(
+							    vertex_descriptor, padi_buses[candidate]);
+							std::pair<double, double> const cost{
+							    *std::max_element(rows.begin(), rows.end()),
+							    std::accumulate(rows.begin(), rows.end(), 0.)};
+							if (!min_cost || cost < *min_cost) {
+								min_cost = cost;
+								anchor = candidate;
 							}
-
-							placement_result.neuron_anchors[vertex_descriptor].push_back(anchor);
-							for (auto const& atomic_neuron : atomic_neurons) {
-								local_available_neuron_circuits.erase(std::find(
-								    local_available_neuron_circuits.begin(),
-								    local_available_neuron_circuits.end(), atomic_neuron));
-							}
-							placed = true;
-							break;
-						} catch (std::runtime_error const&) {
-							// this can happen if we can't construct the logical neuron coordinate
-							// with the given anchor, for example when the neuron then overlaps
-							// across the two neuron blocks with internal inter-neuron-circuit
-							// connectivity
-							continue;
 						}
+						if (anchor) {
+							local_available_neuron_circuits.occupy(*anchor, anchor_table);
+							synapse_row_estimate.place(vertex_descriptor, padi_buses[*anchor]);
+						}
+					} else {
+						anchor = local_available_neuron_circuits.place(anchor_table);
 					}
-					if (!placed) {
+					if (!anchor) {
 						throw std::runtime_error("Placement unsuccessful.");
 					}
+					placement_result.neuron_anchors[vertex_descriptor].push_back(*anchor);
 				}
 			} else if (auto const neuron_ptr =
 			               dynamic_cast<PoissonSourceNeuron const*>(&(population_ptr->get_cell()));
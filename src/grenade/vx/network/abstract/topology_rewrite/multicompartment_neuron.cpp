@@ -40,15 +40,92 @@
 #include "hate/math.h"
 #include "lola/vx/v3/neuron.h"
 #include <boost/bimap.hpp>
+#include <boost/functional/hash.hpp>
 #include <log4cxx/logger.h>
+#include <tbb/parallel_for.h>
+#include <tuple>
+#include <typeinfo>
+#include <unordered_map>
 
 namespace grenade::vx::network::abstract {
 
+namespace {
+
+/**
+ * Construct lookup of position of first occurrence of each element in sequence.
+ */
+std::map<grenade::common::MultiIndex, size_t> get_index_lookup(
+    std::vector<grenade::common::MultiIndex> const& elements)
+{
+	std::map<grenade::common::MultiIndex, size_t> ret;
+	for (size_t i = 0; i < elements.size(); ++i) {
+		ret.emplace(elements[i], i);
+	}
+	return ret;
+}
+
+/**
+ * Get position of element in sequence or the sequence size if it is not contained.
+ */
+size_t get_index(
+    std::map<grenade::common::MultiIndex, size_t> const& lookup,
+    grenade::common::MultiIndex const& element,
+    size_t size)
+{
+	auto const it = lookup.find(element);
+	return it == lookup.end() ? size : it->second;
+}
+
+/**
+ * Hash of neuron model, which is equal for models with equal neuron, parameter space and
+ * environment.
+ * Only the structure and types of the elements are hashed, the parameter values are compared
+ * for equality on hash collision.
+ */
+size_t get_model_hash(
+    Neuron const& neuron,
+    Neuron::ParameterSpace const& parameter_space,
+    Environment const& environment)
+{
+	size_t ret = environment.hash();
+	boost::hash_combine(ret, neuron.num_compartments());
+	boost::hash_combine(ret, neuron.num_compartment_connections());
+	for (auto const& compartment_on_neuron : neuron.compartments()) {
+		boost::hash_combine(ret, compartment_on_neuron.value());
+		for (auto const& [mechanism_on_compartment, mechanism] :
+		     neuron.get(compartment_on_neuron).mechanisms) {
+			boost::hash_combine(ret, mechanism_on_compartment.value());
+			boost::hash_combine(ret, typeid(mechanism).hash_code());
+		}
+	}
+	for (auto const& compartment_connection_on_neuron : neuron.compartment_connections()) {
+		boost::hash_combine(ret, neuron.source(compartment_connection_on_neuron).value());
+		boost::hash_combine(ret, neuron.target(compartment_connection_on_neuron).value());
+	}
+	for (auto const& [compartment_on_neuron, compartment] : parameter_space.compartments) {
+		boost::hash_combine(ret, compartment_on_neuron.value());
+		for (auto const& [mechanism_on_compartment, mechanism] : compartment.mechanisms) {
+			boost::hash_combine(ret, mechanism_on_compartment.value());
+			boost::hash_combine(ret, typeid(mechanism).hash_code());
+		}
+	}
+	for (auto const& [compartment_connection_on_neuron, compartment_connection] :
+	     parameter_space.compartment_connections) {
+		boost::hash_combine(ret, compartment_connection_on_neuron.value());
+		boost::hash_combine(ret, typeid(compartment_connection).hash_code());
+	}
+	return ret;
+}
+
+} // namespace
+
 MulticompartmentNeuronRewrite::MulticompartmentNeuronRewrite(
     std::shared_ptr<grenade::common::LinkedTopology> topology,
-    std::unique_ptr<PlacementAlgorithm> placement_algorithm) :
+    std::unique_ptr<PlacementAlgorithm> placement_algorithm,
+    bool deduplicate_models) :
     TopologyRewrite(std::move(topology)),
     m_placement_algorithm(std::move(placement_algorithm)),
+    m_deduplicate_models(deduplicate_models),
     m_logger(log4cxx::Logger::getLogger(
         "grenade.network.abstract.topology_rewrite.MulticompartmentNeuronRewrite"))
 {
@@ -205,19 +282,19 @@ Environment MulticompartmentNeuronRewrite::construct_environment(
 					        .projection({compartment_dimension, mechanism_dimension})
 					        ->get_elements();
 					auto const output_port_elements = output_port.get_channels().get_elements();
+					auto const output_on_connector_lookup =
+					    get_index_lookup(connector_output_sequence_elements);
+					auto const channel_index_on_edge_lookup =
+					    get_index_lookup(channels_on_source_elements);
 					for (auto const& synapse_on_edge : synapses_on_edge_elements) {
-						size_t output_on_connector = std::distance(
-						    connector_output_sequence_elements.begin(),
-						    std::find(
-						        connector_output_sequence_elements.begin(),
-						        connector_output_sequence_elements.end(),
-						        synapse_output_location_elements.at(synapse_on_edge.value.at(0))));
-						size_t channel_index_on_edge = std::distance(
-						    channels_on_source_elements.begin(),
-						    std::find(
-						        channels_on_source_elements.begin(),
-						        channels_on_source_elements.end(),
-						        output_port_elements.at(output_on_connector)));
+						size_t const output_on_connector = get_index(
+						    output_on_connector_lookup,
+						    synapse_output_location_elements.at(synapse_on_edge.value.at(0)),
+						    connector_output_sequence_elements.size());
+						size_t const channel_index_on_edge = get_index(
+						    channel_index_on_edge_lookup,
+						    output_port_elements.at(output_on_connector),
+						    channels_on_source_elements.size());
 						auto const& channel_on_target =
 						    channels_on_target_elements.at(channel_index_on_edge);
 
@@ -1209,72 +1286,144 @@ void MulticompartmentNeuronRewrite::replace_vertex(
 
 void MulticompartmentNeuronRewrite::operator()() const
 {
-	// create copy of vertex descriptors because they are modified (invalidating iterators)
-	std::vector<grenade::common::VertexOnTopology> vertices(
-	    get_topology().vertices().begin(), get_topology().vertices().end());
-	// iterate over all vertices, performing rewrite when encountering unplaced multi-compartment
-	// neuron
-	for (auto const& vertex_on_topology : vertices) {
+	// collect unplaced multi-compartment neuron populations up-front, because the vertex
+	// descriptors are modified during replacement (invalidating iterators)
+	std::vector<grenade::common::VertexOnTopology> vertices;
+	for (auto const& vertex_on_topology : get_topology().vertices()) {
 		if (auto const model_population = dynamic_cast<grenade::common::Population const*>(
 		        &get_topology().get(vertex_on_topology));
-		    model_population) {
-			if (auto const model_neuron =
-			        dynamic_cast<Neuron const*>(&model_population->get_cell());
-			    model_neuron) {
-				auto const& model_parameter_space = dynamic_cast<Neuron::ParameterSpace const&>(
-				    model_population->get_parameter_space());
-
-				// construct environment
-				auto const environment =
-				    construct_environment(vertex_on_topology, *model_population);
-
-				// perform local placement
-				CoordinateSystem coordinate_system;
-				ResourceManager resource_manager;
-				resource_manager.add_config(*model_neuron, model_parameter_space, environment);
-				assert(m_placement_algorithm);
-				m_placement_algorithm->reset();
-				auto tmp_local_placement =
-				    m_placement_algorithm->run(coordinate_system, *model_neuron, resource_manager);
-
-				// remove unused circuits on the left (this is done internally by
-				// construct_logical_neuron_compartments; in order to later track unplaced neuron
-				// circuit and logical neuron circuits, we remove them also here).
-				tmp_local_placement.coordinate_system.align_left();
-				auto const local_placement = tmp_local_placement;
-				auto logical_neuron_compartments =
-				    local_placement.coordinate_system.construct_logical_neuron_compartments();
-
-				// check that all parameter space intervals only have one value
-				check_is_single_operation_point(model_parameter_space);
-
-				// construct CalibratedNeuron
-				auto
-				    [calibrated_neuron, mechanism_on_atomic_neuron_placement,
-				     mechanism_readout_placement] =
-				        construct_calibrated_neuron(
-				            logical_neuron_compartments, *model_neuron, model_parameter_space,
-				            environment);
-
-				// construct CalibratedNeuron::ParameterSpace
-				auto calibrated_neuron_parameter_space =
-				    construct_calibrated_neuron_parameter_space(
-				        calibrated_neuron, logical_neuron_compartments, local_placement,
-				        *model_neuron, model_parameter_space, mechanism_on_atomic_neuron_placement);
-
-				// construct mapping
-				auto mapping = construct_mapping(
-				    *model_neuron, model_population->size(), logical_neuron_compartments,
-				    mechanism_readout_placement);
-
-				// replace unplaced neuron with locally-placed calibrated neuron population in
-				// topology
-				replace_vertex(
-				    vertex_on_topology, *model_population, mechanism_on_atomic_neuron_placement,
-				    std::move(calibrated_neuron), std::move(calibrated_neuron_parameter_space),
-				    std::move(mapping));
+		    model_population && dynamic_cast<Neuron const*>(&model_population->get_cell())) {
+			vertices.push_back(vertex_on_topology);
+		}
+	}
+
+	// construct environments, they only depend on the in-edges from projections, which are not
+	// altered by replacement of other populations
+	std::vector<Environment> environments(vertices.size());
+	std::vector<size_t> hashes(vertices.size());
+	tbb::parallel_for(size_t(0), vertices.size(), [&](size_t const i) {
+		auto const& model_population =
+		    dynamic_cast<grenade::common::Population const&>(get_topology().get(vertices.at(i)));
+		environments.at(i) = construct_environment(vertices.at(i), model_population);
+		hashes.at(i) = get_model_hash(
+		    dynamic_cast<Neuron const&>(model_population.get_cell()),
+		    dynamic_cast<Neuron::ParameterSpace const&>(model_population.get_parameter_space()),
+		    environments.at(i));
+	});
+
+	// deduplicate structurally identical neuron models, for which placement and mechanism
+	// assignment is identical, if enabled
+	auto const get_model = [&](size_t const i) {
+		auto const& model_population =
+		    dynamic_cast<grenade::common::Population const&>(get_topology().get(vertices.at(i)));
+		return std::tie(
+		    model_population.get_cell(), model_population.get_parameter_space(),
+		    environments.at(i));
+	};
+	std::vector<size_t> model_on_vertex(vertices.size());
+	std::vector<size_t> models;
+	std::unordered_map<size_t, std::vector<size_t>> models_by_hash;
+	for (size_t i = 0; i < vertices.size(); ++i) {
+		if (m_deduplicate_models) {
+			auto& candidates = models_by_hash[hashes.at(i)];
+			auto const it = std::ranges::find_if(candidates, [&](size_t const model) {
+				return get_model(models.at(model)) == get_model(i);
+			});
+			if (it != candidates.end()) {
+				model_on_vertex.at(i) = *it;
+				continue;
 			}
+			candidates.push_back(models.size());
 		}
+		model_on_vertex.at(i) = models.size();
+		models.push_back(i);
+	}
+	LOG4CXX_DEBUG(
+	    m_logger, "Found " << models.size() << " distinct neuron model(s) in " << vertices.size()
+	                       << " population(s).");
+
+	struct LocalPlacement
+	{
+		halco::hicann_dls::vx::v3::LogicalNeuronCompartments logical_neuron_compartments;
+		CalibratedNeuron calibrated_neuron;
+		CalibratedNeuron::ParameterSpace calibrated_neuron_parameter_space;
+		std::map<
+		    grenade::common::CompartmentOnNeuron,
+		    std::map<MechanismOnCompartment, std::set<size_t>>>
+		    mechanism_on_atomic_neuron_placement;
+		std::map<grenade::common::CompartmentOnNeuron, std::map<size_t, MechanismOnCompartment>>
+		    mechanism_readout_placement;
+	};
+
+	// perform local placement and construct calibrated neuron once per distinct neuron model
+	assert(m_placement_algorithm);
+	std::vector<std::unique_ptr<LocalPlacement>> local_placements(models.size());
+	tbb::parallel_for(size_t(0), models.size(), [&](size_t const m) {
+		size_t const i = models.at(m);
+		auto const& model_population =
+		    dynamic_cast<grenade::common::Population const&>(get_topology().get(vertices.at(i)));
+		auto const& model_neuron = dynamic_cast<Neuron const&>(model_population.get_cell());
+		auto const& model_parameter_space =
+		    dynamic_cast<Neuron::ParameterSpace const&>(model_population.get_parameter_space());
+		auto const& environment = environments.at(i);
+
+		// perform local placement
+		CoordinateSystem coordinate_system;
+		ResourceManager resource_manager;
+		resource_manager.add_config(model_neuron, model_parameter_space, environment);
+		auto const placement_algorithm = m_placement_algorithm->clone();
+		placement_algorithm->reset();
+		auto tmp_local_placement =
+		    placement_algorithm->run(coordinate_system, model_neuron, resource_manager);
+
+		// remove unused circuits on the left (this is done internally by
+		// construct_logical_neuron_compartments; in order to later track unplaced neuron
+		// circuit and logical neuron circuits, we remove them also here).
+		tmp_local_placement.coordinate_system.align_left();
+		auto const local_placement = tmp_local_placement;
+		auto logical_neuron_compartments =
+		    local_placement.coordinate_system.construct_logical_neuron_compartments();
+
+		// check that all parameter space intervals only have one value
+		check_is_single_operation_point(model_parameter_space);
+
+		// construct CalibratedNeuron
+		auto
+		    [calibrated_neuron, mechanism_on_atomic_neuron_placement,
+		     mechanism_readout_placement] =
+		        construct_calibrated_neuron(
+		            logical_neuron_compartments, model_neuron, model_parameter_space,
+		            environment);
+
+		// construct CalibratedNeuron::ParameterSpace
+		auto calibrated_neuron_parameter_space = construct_calibrated_neuron_parameter_space(
+		    calibrated_neuron, logical_neuron_compartments, local_placement, model_neuron,
+		    model_parameter_space, mechanism_on_atomic_neuron_placement);
+
+		local_placements.at(m) = std::make_unique<LocalPlacement>(LocalPlacement{
+		    std::move(logical_neuron_compartments), std::move(calibrated_neuron),
+		    std::move(calibrated_neuron_parameter_space),
+		    std::move(mechanism_on_atomic_neuron_placement),
+		    std::move(mechanism_readout_placement)});
+	});
+
+	for (size_t i = 0; i < vertices.size(); ++i) {
+		auto const& model_population =
+		    dynamic_cast<grenade::common::Population const&>(get_topology().get(vertices.at(i)));
+		auto const& model_neuron = dynamic_cast<Neuron const&>(model_population.get_cell());
+		auto const& local_placement = *local_placements.at(model_on_vertex.at(i));
+
+		// construct mapping
+		auto mapping = construct_mapping(
+		    model_neuron, model_population.size(), local_placement.logical_neuron_compartments,
+		    local_placement.mechanism_readout_placement);
+
+		// replace unplaced neuron with locally-placed calibrated neuron population in topology
+		replace_vertex(
+		    vertices.at(i), model_population, local_placement.mechanism_on_atomic_neuron_placement,
+		    CalibratedNeuron(local_placement.calibrated_neuron),
+		    CalibratedNeuron::ParameterSpace(local_placement.calibrated_neuron_parameter_space),
+		    std::move(mapping));
 	}
 }
 
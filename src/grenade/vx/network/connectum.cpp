@@ -29,6 +29,7 @@
 #include <functional>
 #include <ostream>
 #include <log4cxx/logger.h>
+#include <tbb/parallel_for.h>
 
 namespace grenade::vx::network {
 
@@ -64,11 +65,135 @@ std::ostream& operator<<(std::ostream& os, ConnectumConnection const& config)
 }
 
 
-std::vector<ConnectumConnection> generate_connectum_from_abstract_network(
-    grenade::common::LinkedTopology const& topology)
+namespace {
+
+/**
+ * Mix bits of value to yield a uniformly distributed hash (splitmix64 finalizer).
+ */
+uint64_t mix(uint64_t value)
+{
+	value += 0x9e3779b97f4a7c15ull;
+	value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+	value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+	return value ^ (value >> 31);
+}
+
+uint64_t hash(ConnectumConnection const& connection)
+{
+	uint64_t ret = 0;
+	auto const combine = [&ret](uint64_t const value) { ret = mix(ret ^ value); };
+	combine(std::get<0>(connection.source).value());
+	combine(std::get<1>(connection.source));
+	combine(std::hash<halco::hicann_dls::vx::v3::CompartmentOnLogicalNeuron>{}(
+	    std::get<2>(connection.source)));
+	combine(std::hash<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS>{}(connection.target));
+	combine(static_cast<uint64_t>(connection.receptor_type));
+	combine(connection.projection.value());
+	combine(connection.connection_on_projection);
+	return ret;
+}
+
+} // namespace
+
+bool ConnectumDigest::Fragment::operator==(Fragment const& other) const
+{
+	return std::tie(size, hash_sum) == std::tie(other.size, other.hash_sum);
+}
+
+bool ConnectumDigest::Fragment::operator!=(Fragment const& other) const
+{
+	return !(*this == other);
+}
+
+void ConnectumDigest::insert(ConnectumConnection const& connection)
+{
+	auto& fragment = fragments[std::pair{std::get<0>(connection.source), connection.projection}];
+	fragment.size++;
+	fragment.hash_sum += hash(connection);
+}
+
+void ConnectumDigest::merge(ConnectumDigest const& other)
+{
+	for (auto const& [descriptor, other_fragment] : other.fragments) {
+		auto& fragment = fragments[descriptor];
+		fragment.size += other_fragment.size;
+		fragment.hash_sum += other_fragment.hash_sum;
+	}
+}
+
+size_t ConnectumDigest::size() const
+{
+	size_t ret = 0;
+	for (auto const& [_, fragment] : fragments) {
+		ret += fragment.size;
+	}
+	return ret;
+}
+
+std::vector<ConnectumDigest::FragmentOnConnectum> ConnectumDigest::get_mismatching_fragments(
+    ConnectumDigest const& other) const
+{
+	std::vector<FragmentOnConnectum> ret;
+	for (auto const& [descriptor, fragment] : fragments) {
+		if (!other.fragments.contains(descriptor) ||
+		    other.fragments.at(descriptor) != fragment) {
+			ret.push_back(descriptor);
+		}
+	}
+	for (auto const& [descriptor, _] : other.fragments) {
+		if (!fragments.contains(descriptor)) {
+			ret.push_back(descriptor);
+		}
+	}
+	std::sort(ret.begin(), ret.end());
+	return ret;
+}
+
+bool ConnectumDigest::operator==(ConnectumDigest const& other) const
+{
+	return fragments == other.fragments;
+}
+
+bool ConnectumDigest::operator!=(ConnectumDigest const& other) const
+{
+	return !(*this == other);
+}
+
+
+namespace {
+
+void insert(std::vector<ConnectumConnection>& connectum, ConnectumConnection const& connection)
+{
+	connectum.push_back(connection);
+}
+
+void insert(ConnectumDigest& connectum, ConnectumConnection const& connection)
+{
+	connectum.insert(connection);
+}
+
+void merge(std::vector<ConnectumConnection>& connectum, std::vector<ConnectumConnection>&& other)
+{
+	connectum.insert(
+	    connectum.end(), std::make_move_iterator(other.begin()),
+	    std::make_move_iterator(other.end()));
+}
+
+void merge(ConnectumDigest& connectum, ConnectumDigest&& other)
 {
-	std::vector<ConnectumConnection> connectum;
+	connectum.merge(other);
+}
 
+/**
+ * Generate connectum of abstract network, where the connectum type is either a vector of
+ * connections or a digest thereof.
+ * Connections are generated per execution instance in parallel and merged in order of the
+ * execution instances.
+ */
+template <typename Connectum>
+Connectum generate_connectum_from_abstract_network_impl(
+    grenade::common::LinkedTopology const& topology, ConnectumSourceFilter const& source_filter)
+{
 	std::map<
 	    grenade::common::ExecutionInstanceOnExecutor,
 	    std::vector<grenade::common::VertexOnTopology>>
@@ -82,34 +207,65 @@ std::vector<ConnectumConnection> generate_connectum_from_abstract_network(
 		        .push_back(vertex_descriptor);
 	}
 
-	for (auto const& [execution_instance_on_executor, partitioned_vertex_descriptors] :
-	     partitioned_vertices_per_execution_instance) {
+	std::vector<std::vector<grenade::common::VertexOnTopology>> partitioned_vertex_descriptors;
+	for (auto& [_, descriptors] : partitioned_vertices_per_execution_instance) {
+		partitioned_vertex_descriptors.push_back(std::move(descriptors));
+	}
+
+	std::vector<Connectum> connectum_per_execution_instance(partitioned_vertex_descriptors.size());
+	tbb::parallel_for(size_t(0), partitioned_vertex_descriptors.size(), [&](size_t const i) {
+		auto& connectum = connectum_per_execution_instance.at(i);
 		auto const connection_routing =
-		    build_connection_routing(topology, partitioned_vertex_descriptors);
+		    build_connection_routing(topology, partitioned_vertex_descriptors.at(i));
 		routing::greedy::RoutingConstraints constraints(
-		    topology, partitioned_vertex_descriptors, connection_routing);
+		    topology, partitioned_vertex_descriptors.at(i), connection_routing);
+
+		auto const add = [&connectum, &source_filter](auto const& connection) {
+			if (source_filter && !source_filter(std::get<0>(connection.source_descriptor))) {
+				return;
+			}
+			insert(
+			    connectum, ConnectumConnection{
+			                   connection.source_descriptor, connection.target,
+			                   connection.receptor_type, connection.descriptor.first,
+			                   connection.descriptor.second});
+		};
 
 		for (auto const& connection : constraints.get_external_connections()) {
-			connectum.push_back(ConnectumConnection{
-			    connection.source_descriptor, connection.target, connection.receptor_type,
-			    connection.descriptor.first, connection.descriptor.second});
+			add(connection);
 		}
 
 		for (auto const& connection : constraints.get_background_connections()) {
-			connectum.push_back(ConnectumConnection{
-			    connection.source_descriptor, connection.target, connection.receptor_type,
-			    connection.descriptor.first, connection.descriptor.second});
+			add(connection);
 		}
 
 		for (auto const& connection : constraints.get_internal_connections()) {
-			connectum.push_back(ConnectumConnection{
-			    connection.source_descriptor, connection.target, connection.receptor_type,
-			    connection.descriptor.first, connection.descriptor.second});
+			add(connection);
 		}
+	});
+
+	Connectum connectum;
+	for (auto& local_connectum : connectum_per_execution_instance) {
+		merge(connectum, std::move(local_connectum));
 	}
 	return connectum;
 }
 
+} // namespace
+
+std::vector<ConnectumConnection> generate_connectum_from_abstract_network(
+    grenade::common::LinkedTopology const& topology, ConnectumSourceFilter const& source_filter)
+{
+	return generate_connectum_from_abstract_network_impl<std::vector<ConnectumConnection>>(
+	    topology, source_filter);
+}
+
+ConnectumDigest generate_connectum_digest_from_abstract_network(
+    grenade::common::LinkedTopology const& topology, ConnectumSourceFilter const& source_filter)
+{
+	return generate_connectum_from_abstract_network_impl<ConnectumDigest>(topology, source_filter);
+}
+
 namespace {
 
 struct HardwareConnectionPath
@@ -155,10 +311,15 @@ std::vector<halco::hicann_dls::vx::v3::SpikeLabel> iterate_with_mask(uintmax_t b
 }
 
 
-} // namespace
-
-std::vector<ConnectumConnection> generate_connectum_from_hardware_network(
-    grenade::common::LinkedTopology const& topology)
+/**
+ * Generate connectum of hardware network, where the connectum type is either a vector of
+ * connections or a digest thereof.
+ * Connections are generated per execution instance in parallel and merged in order of the
+ * execution instances.
+ */
+template <typename Connectum>
+Connectum generate_connectum_from_hardware_network_impl(
+    grenade::common::LinkedTopology const& topology, ConnectumSourceFilter const& source_filter)
 {
 	using namespace halco::common;
 	using namespace halco::hicann_dls::vx::v3;
@@ -184,6 +345,9 @@ std::vector<ConnectumConnection> generate_connectum_from_hardware_network(
 			if (!population->get_time_domain()) {
 				continue;
 			}
+			if (source_filter && !source_filter(descriptor)) {
+				continue;
+			}
 			if (auto const external_source =
 			        dynamic_cast<abstract::ExternalSourceNeuron const*>(&population->get_cell());
 			    external_source) {
@@ -330,7 +494,6 @@ std::vector<ConnectumConnection> generate_connectum_from_hardware_network(
 	LOG4CXX_TRACE(
 	    logger, "Collected local labels of sources in " << timer_build_labels.print() << ".");
 
-	std::vector<ConnectumConnection> connectum;
 	std::map<
 	    grenade::common::ExecutionInstanceOnExecutor,
 	    std::vector<grenade::common::VertexOnTopology>>
@@ -346,7 +509,24 @@ std::vector<ConnectumConnection> generate_connectum_from_hardware_network(
 		}
 	}
 
-	for (auto const& [id, mapped_vertices] : mapped_vertices_per_execution_instance) {
+	std::vector<std::pair<
+	    grenade::common::ExecutionInstanceOnExecutor,
+	    std::vector<grenade::common::VertexOnTopology>>>
+	    mapped_vertices_per_execution_instance_list;
+	for (auto& [id, mapped_vertices] : mapped_vertices_per_execution_instance) {
+		// ensure presence of all execution instances for concurrent lookup below
+		external_populations_per_execution_instance[id];
+		internal_populations_per_execution_instance[id];
+		background_populations_per_execution_instance[id];
+		mapped_vertices_per_execution_instance_list.emplace_back(id, std::move(mapped_vertices));
+	}
+
+	size_t const num_execution_instances = mapped_vertices_per_execution_instance_list.size();
+	std::vector<Connectum> connectum_per_execution_instance(num_execution_instances);
+	tbb::parallel_for(size_t(0), num_execution_instances, [&](size_t const i) {
+		auto const& [id, mapped_vertices] = mapped_vertices_per_execution_instance_list.at(i);
+		auto& connectum = connectum_per_execution_instance.at(i);
+
 		hate::Timer timer_extract_vertex_properties;
 		std::vector<std::reference_wrapper<signal_flow::vertex::CrossbarNode const>> crossbar_nodes;
 		std::vector<
@@ -583,15 +763,19 @@ std::vector<ConnectumConnection> generate_connectum_from_hardware_network(
 			    auto const row_on_synapse_driver = row.toSynapseRowOnSynapseDriver();
 			    switch (path.synapse_driver_parameterization.row_modes[row_on_synapse_driver]) {
 				    case SynapseDriverConfig::RowMode::excitatory: {
-					    connectum.push_back(ConnectumConnection{
-					        descriptor, neuron, Receptor::Type::excitatory, projection,
-					        connection_on_projection});
+					    insert(
+					        connectum,
+					        ConnectumConnection{
+					            descriptor, neuron, Receptor::Type::excitatory, projection,
+					            connection_on_projection});
 					    break;
 				    }
 				    case SynapseDriverConfig::RowMode::inhibitory: {
-					    connectum.push_back(ConnectumConnection{
-					        descriptor, neuron, Receptor::Type::inhibitory, projection,
-					        connection_on_projection});
+					    insert(
+					        connectum,
+					        ConnectumConnection{
+					            descriptor, neuron, Receptor::Type::inhibitory, projection,
+					            connection_on_projection});
 					    break;
 				    }
 				    case SynapseDriverConfig::RowMode::excitatory_and_inhibitory: {
@@ -699,7 +883,7 @@ std::vector<ConnectumConnection> generate_connectum_from_hardware_network(
 			    hardware_connection_path.crossbar_node.coordinate.toCrossbarInputOnDLS()
 			        .toNeuronEventOutputOnDLS();
 			if (spl1_address) { // crossbar node from L2
-				for (auto const& pop_index : external_populations_per_execution_instance[id]) {
+				for (auto const& pop_index : external_populations_per_execution_instance.at(id)) {
 					for (auto const& [index_pre, local_labels] :
 					     external_population_labels.at(pop_index).get()) {
 						for (auto const& spike_label : local_labels) {
@@ -720,7 +904,7 @@ std::vector<ConnectumConnection> generate_connectum_from_hardware_network(
 				if (!active_neuron_event_outputs.contains(*neuron_event_output)) {
 					continue;
 				}
-				for (auto const& pop_index : internal_populations_per_execution_instance[id]) {
+				for (auto const& pop_index : internal_populations_per_execution_instance.at(id)) {
 					for (auto const& [index_pre, labels_on_neuron] :
 					     internal_population_labels.at(pop_index)) {
 						for (auto const& [compartment_on_neuron, local_label] : labels_on_neuron) {
@@ -747,7 +931,7 @@ std::vector<ConnectumConnection> generate_connectum_from_hardware_network(
 						continue;
 					}
 					for (auto const& pop_index :
-					     background_populations_per_execution_instance[id]) {
+					     background_populations_per_execution_instance.at(id)) {
 						for (size_t index_pre = 0; auto const& local_label :
 						                           background_population_labels.at(pop_index).at(
 						                               background_spike_source.get().coordinate)) {
@@ -766,6 +950,11 @@ std::vector<ConnectumConnection> generate_connectum_from_hardware_network(
 		LOG4CXX_TRACE(
 		    logger, "Built connectum from hardware connection paths in "
 		                << timer_build_connectum.print() << ".");
+	});
+
+	Connectum connectum;
+	for (auto& local_connectum : connectum_per_execution_instance) {
+		merge(connectum, std::move(local_connectum));
 	}
 
 	LOG4CXX_DEBUG(
@@ -775,4 +964,19 @@ std::vector<ConnectumConnection> generate_connectum_from_hardware_network(
 	return connectum;
 }
 
+} // namespace
+
+std::vector<ConnectumConnection> generate_connectum_from_hardware_network(
+    grenade::common::LinkedTopology const& topology, ConnectumSourceFilter const& source_filter)
+{
+	return generate_connectum_from_hardware_network_impl<std::vector<ConnectumConnection>>(
+	    topology, source_filter);
+}
+
+ConnectumDigest generate_connectum_digest_from_hardware_network(
+    grenade::common::LinkedTopology const& topology, ConnectumSourceFilter const& source_filter)
+{
+	return generate_connectum_from_hardware_network_impl<ConnectumDigest>(topology, source_filter);
+}
+
 } // namespace grenade::vx::network
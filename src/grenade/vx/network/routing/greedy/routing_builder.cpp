@@ -14,6 +14,7 @@
 #include "grenade/vx/network/abstract/recorder/spike.h"
 #include "grenade/vx/network/build_connection_weight_split.h"
 #include "grenade/vx/network/exception.h"
+#include "grenade/vx/network/routing/greedy/resource_set.h"
 #include "grenade/vx/network/routing/greedy/routing_constraints.h"
 #include "grenade/vx/network/routing/greedy/synapse_driver_on_dls_manager.h"
 #include "grenade/vx/signal_flow/vertex/background_spike_source.h"
@@ -28,6 +29,7 @@
 #include "hate/timer.h"
 #include "hate/variant.h"
 #include <map>
+#include <optional>
 #include <set>
 #include <unordered_set>
 #include <boost/range/adaptor/reversed.hpp>
@@ -46,20 +48,24 @@ void RoutingBuilder::route_internal_crossbar(
     typed_array<RoutingConstraints::PADIBusConstraints, PADIBusOnDLS>& padi_bus_constraints,
     Result& result) const
 {
-	auto const& neuron_event_outputs_per_padi_bus =
+	auto const neuron_event_outputs_per_padi_bus =
 	    constraints.get_neuron_event_outputs_on_padi_bus();
 
+	typed_array<ResourceSet<AtomicNeuronOnDLS>, NeuronEventOutputOnDLS> neurons_on_event_output;
+	for (auto const neuron : iter_all<AtomicNeuronOnDLS>()) {
+		neurons_on_event_output[neuron.toNeuronColumnOnDLS().toNeuronEventOutputOnDLS()].insert(
+		    neuron);
+	}
+
 	// Disable crossbar node(s) to PADI-bus(ses), where no source neurons from the event output are
 	// required.
 	// Remove neuron sources which are then not present anymore on the PADI-bus.
 	for (auto const padi_bus : iter_all<PADIBusOnDLS>()) {
-		std::set<AtomicNeuronOnDLS> neurons_on_padi_bus;
-		std::set<AtomicNeuronOnDLS> only_recorded_neurons_on_padi_bus;
+		ResourceSet<AtomicNeuronOnDLS> neurons_on_enabled_event_outputs;
 		for (auto const neuron_backend_block : iter_all<NeuronBackendConfigBlockOnDLS>()) {
 			NeuronEventOutputOnDLS neuron_event_output(
 			    NeuronEventOutputOnNeuronBackendBlock(padi_bus.value()), neuron_backend_block);
-			if (!neuron_event_outputs_per_padi_bus.contains(padi_bus) ||
-			    !neuron_event_outputs_per_padi_bus.at(padi_bus).contains(neuron_event_output)) {
+			if (!neuron_event_outputs_per_padi_bus[padi_bus].contains(neuron_event_output)) {
 				result.crossbar_nodes[CrossbarNodeOnDLS(
 				    neuron_event_output.toCrossbarInputOnDLS(), padi_bus.toCrossbarOutputOnDLS())] =
 				    haldls::vx::v3::CrossbarNode::drop_all;
@@ -69,22 +75,11 @@ void RoutingBuilder::route_internal_crossbar(
 				    m_logger, "route_internal_crossbar(): Disabled crossbar node for "
 				                  << neuron_event_output << " onto " << padi_bus << ".");
 			} else {
-				for (auto const& neuron : padi_bus_constraints[padi_bus].neuron_sources) {
-					if (neuron.toNeuronColumnOnDLS().toNeuronEventOutputOnDLS() ==
-					    neuron_event_output) {
-						neurons_on_padi_bus.insert(neuron);
-					}
-				}
-				for (auto const& neuron : padi_bus_constraints[padi_bus].only_recorded_neurons) {
-					if (neuron.toNeuronColumnOnDLS().toNeuronEventOutputOnDLS() ==
-					    neuron_event_output) {
-						only_recorded_neurons_on_padi_bus.insert(neuron);
-					}
-				}
+				neurons_on_enabled_event_outputs |= neurons_on_event_output[neuron_event_output];
 			}
 		}
-		padi_bus_constraints[padi_bus].neuron_sources = neurons_on_padi_bus;
-		padi_bus_constraints[padi_bus].only_recorded_neurons = only_recorded_neurons_on_padi_bus;
+		padi_bus_constraints[padi_bus].neuron_sources &= neurons_on_enabled_event_outputs;
+		padi_bus_constraints[padi_bus].only_recorded_neurons &= neurons_on_enabled_event_outputs;
 	}
 }
 
@@ -99,35 +94,28 @@ RoutingBuilder::get_internal_sources(
 {
 	// All neurons which are present at the PADI-bus are to be added.
 	std::vector<SourceOnPADIBusManager::InternalSource> internal_sources;
+	// index of neuron in internal sources
+	typed_array<std::optional<size_t>, AtomicNeuronOnDLS> internal_source_index;
+	auto const add_internal_source = [&](AtomicNeuronOnDLS const& neuron) {
+		if (!internal_source_index[neuron]) {
+			SourceOnPADIBusManager::InternalSource source;
+			source.neuron = neuron;
+			internal_source_index[neuron] = internal_sources.size();
+			internal_sources.push_back(source);
+		}
+	};
 	for (auto const padi_bus : iter_all<PADIBusOnDLS>()) {
 		auto const& local_padi_bus_constraints = padi_bus_constraints[padi_bus];
 		for (auto const& neuron : local_padi_bus_constraints.neuron_sources) {
-			SourceOnPADIBusManager::InternalSource source;
-			source.neuron = neuron;
-			if (std::find_if(
-			        internal_sources.begin(), internal_sources.end(), [&neuron](auto const& s) {
-				        return s.neuron == neuron;
-			        }) == internal_sources.end()) {
-				internal_sources.push_back(source);
-			}
+			add_internal_source(neuron);
 		}
 		for (auto const& neuron : local_padi_bus_constraints.only_recorded_neurons) {
-			SourceOnPADIBusManager::InternalSource source;
-			source.neuron = neuron;
-			if (std::find_if(
-			        internal_sources.begin(), internal_sources.end(), [&neuron](auto const& s) {
-				        return s.neuron == neuron;
-			        }) == internal_sources.end()) {
-				internal_sources.push_back(source);
-			}
+			add_internal_source(neuron);
 		}
 		// calculate out-degree per target
 		for (auto const& connection : local_padi_bus_constraints.internal_connections) {
-			auto source_it = std::find_if(
-			    internal_sources.begin(), internal_sources.end(),
-			    [&connection](auto const& a) { return a.neuron == connection.source; });
-			assert(source_it != internal_sources.end());
-			auto& source = *source_it;
+			assert(internal_source_index[connection.source]);
+			auto& source = internal_sources.at(*internal_source_index[connection.source]);
 			if (!source.out_degree.contains(connection.receptor_type)) {
 				source.out_degree[connection.receptor_type].fill(0);
 			}
@@ -139,12 +127,20 @@ RoutingBuilder::get_internal_sources(
 	std::vector<std::tuple<grenade::common::VertexOnTopology, size_t, CompartmentOnLogicalNeuron>>
 	    descriptors(internal_sources.size());
 	auto const internal_source_neurons = constraints.get_internal_sources();
+	typed_array<
+	    std::optional<
+	        std::tuple<grenade::common::VertexOnTopology, size_t, CompartmentOnLogicalNeuron>>,
+	    AtomicNeuronOnDLS>
+	    descriptor_per_neuron;
+	for (auto const& [descriptor, neuron] : internal_source_neurons) {
+		// the first descriptor in order of the map is used for each neuron
+		if (!descriptor_per_neuron[neuron]) {
+			descriptor_per_neuron[neuron] = descriptor;
+		}
+	}
 	for (size_t i = 0; auto& internal_source : internal_sources) {
-		auto source_it = std::find_if(
-		    internal_source_neurons.begin(), internal_source_neurons.end(),
-		    [internal_source](auto const& a) { return a.second == internal_source.neuron; });
-		assert(source_it != internal_source_neurons.end());
-		descriptors.at(i) = source_it->first;
+		assert(descriptor_per_neuron[internal_source.neuron]);
+		descriptors.at(i) = *descriptor_per_neuron[internal_source.neuron];
 		i++;
 	}
 	LOG4CXX_DEBUG(
@@ -835,6 +831,9 @@ RoutingBuilder::place_routed_connections(
 {
 	std::map<std::pair<grenade::common::VertexOnTopology, size_t>, std::vector<PlacedConnection>>
 	    ret;
+	// constraints are independent of the partition, build them once instead of per PADI-bus
+	auto const padi_bus_constraints = constraints.get_padi_bus_constraints();
+	auto const external_connections = constraints.get_external_connections();
 	for (size_t i = 0; i < partition.size(); ++i) {
 		auto const& local_allocation = padi_bus_allocations.at(i + offset);
 		auto const& local_sources = partition.at(i).sources;
@@ -921,10 +920,6 @@ RoutingBuilder::place_routed_connections(
 					}
 				}
 			}
-			auto const padi_bus_constraints = constraints.get_padi_bus_constraints();
-			auto internal_connections = padi_bus_constraints[padi_bus].internal_connections;
-			auto background_connections = padi_bus_constraints[padi_bus].background_connections;
-
 			auto const filter = [&](auto const& connections) {
 				auto ret = connections;
 				ret.clear();
@@ -942,8 +937,7 @@ RoutingBuilder::place_routed_connections(
 			    filter(padi_bus_constraints[padi_bus].internal_connections), rows));
 			ret.merge(place_routed_connections(
 			    filter(padi_bus_constraints[padi_bus].background_connections), rows));
-			ret.merge(
-			    place_routed_connections(filter(constraints.get_external_connections()), rows));
+			ret.merge(place_routed_connections(filter(external_connections), rows));
 		}
 	}
 	return ret;
@@ -1336,7 +1336,7 @@ RoutingConstraints::get_neurons_on_event_output() const
 
 	auto const anchors = get_anchors();
 
-	std::set<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> neurons;
+	ResourceSet<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> neurons;
 	using namespace halco::hicann_dls::vx::v3;
 	for (auto const& partitioned_vertex_descriptor : m_partitioned_vertex_descriptors) {
 		if (auto const* recorder = dynamic_cast<abstract::SpikeRecorder const*>(
@@ -1451,10 +1451,10 @@ RoutingConstraints::get_neurons_on_event_output() const
 	return ret;
 }
 
-std::set<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS>
+ResourceSet<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS>
 RoutingConstraints::get_neither_recorded_nor_source_neurons() const
 {
-	std::set<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> ret;
+	ResourceSet<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> ret;
 
 	// get all atomic neurons by iterating partitioned and mapped vertices
 	for (auto const& partitioned_vertex_descriptor : m_partitioned_vertex_descriptors) {
@@ -1492,23 +1492,23 @@ RoutingConstraints::get_neither_recorded_nor_source_neurons() const
 
 	// remove all neurons present in `get_neurons_on_event_output()`
 	auto const neurons_on_event_output = get_neurons_on_event_output();
+	ResourceSet<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS> neurons_with_event_output;
 	for (auto const& [_, neurons] : neurons_on_event_output) {
-		for (auto const& neuron : neurons) {
-			ret.erase(neuron);
-		}
+		neurons_with_event_output.insert(neurons.begin(), neurons.end());
 	}
+	ret -= neurons_with_event_output;
 
 	return ret;
 }
 
-std::map<
-    halco::hicann_dls::vx::v3::PADIBusOnDLS,
-    std::set<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS>>
+halco::common::typed_array<
+    ResourceSet<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS>,
+    halco::hicann_dls::vx::v3::PADIBusOnDLS>
 RoutingConstraints::get_neurons_on_padi_bus() const
 {
-	std::map<
-	    halco::hicann_dls::vx::v3::PADIBusOnDLS,
-	    std::set<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS>>
+	halco::common::typed_array<
+	    ResourceSet<halco::hicann_dls::vx::v3::AtomicNeuronOnDLS>,
+	    halco::hicann_dls::vx::v3::PADIBusOnDLS>
 	    ret;
 
 	for (auto const& connection : get_internal_connections()) {
@@ -1546,17 +1546,16 @@ RoutingConstraints::get_num_background_sources_on_padi_bus() const
 	return ret;
 }
 
-std::map<
-    halco::hicann_dls::vx::v3::PADIBusOnDLS,
-    std::set<halco::hicann_dls::vx::v3::NeuronEventOutputOnDLS>>
+halco::common::typed_array<
+    ResourceSet<halco::hicann_dls::vx::v3::NeuronEventOutputOnDLS>,
+    halco::hicann_dls::vx::v3::PADIBusOnDLS>
 RoutingConstraints::get_neuron_event_outputs_on_padi_bus() const
 {
-	auto const internal_connections = get_internal_connections();
-	std::map<
-	    halco::hicann_dls::vx::v3::PADIBusOnDLS,
-	    std::set<halco::hicann_dls::vx::v3::NeuronEventOutputOnDLS>>
+	halco::common::typed_array<
+	    ResourceSet<halco::hicann_dls::vx::v3::NeuronEventOutputOnDLS>,
+	    halco::hicann_dls::vx::v3::PADIBusOnDLS>
 	    ret;
-	for (auto const& connection : internal_connections) {
+	for (auto const& connection : get_internal_connections()) {
 		ret[connection.toPADIBusOnDLS()].insert(
 		    connection.source.toNeuronColumnOnDLS().toNeuronEventOutputOnDLS());
 	}
@@ -1572,29 +1571,23 @@ halco::common::
 	auto const num_background_sources_on_padi_bus = get_num_background_sources_on_padi_bus();
 	auto const neurons_on_padi_bus = get_neurons_on_padi_bus();
 	auto const neurons_on_event_output = get_neurons_on_event_output();
-	auto const internal_connections = get_internal_connections();
-	auto const background_connections = get_background_connections();
+
+	// distribute connections onto their PADI-busses in a single pass, which keeps their order
+	for (auto const& connection : get_internal_connections()) {
+		padi_bus_constraints[connection.toPADIBusOnDLS()].internal_connections.push_back(
+		    connection);
+	}
+	for (auto const& connection : get_background_connections()) {
+		padi_bus_constraints[connection.toPADIBusOnDLS()].background_connections.push_back(
+		    connection);
+	}
 
 	for (auto const padi_bus : iter_all<PADIBusOnDLS>()) {
 		auto& constraints = padi_bus_constraints[padi_bus];
 
 		constraints.num_background_spike_sources = num_background_sources_on_padi_bus[padi_bus];
 
-		for (auto const& connection : internal_connections) {
-			if (connection.toPADIBusOnDLS() == padi_bus) {
-				constraints.internal_connections.push_back(connection);
-			}
-		}
-		for (auto const& connection : background_connections) {
-			if (connection.toPADIBusOnDLS() == padi_bus) {
-				constraints.background_connections.push_back(connection);
-			}
-		}
-
-		if (neurons_on_padi_bus.contains(padi_bus)) {
-			auto const& neuron_sources = neurons_on_padi_bus.at(padi_bus);
-			constraints.neuron_sources = {neuron_sources.begin(), neuron_sources.end()};
-		}
+		constraints.neuron_sources = neurons_on_padi_bus[padi_bus];
 
 		for (auto const neuron_event_output_block : iter_all<NeuronBackendConfigBlockOnDLS>()) {
 			NeuronEventOutputOnDLS neuron_event_output(
@@ -1604,9 +1597,7 @@ halco::common::
 				constraints.only_recorded_neurons.insert(neurons.begin(), neurons.end());
 			}
 		}
-		for (auto const& neuron : constraints.neuron_sources) {
-			constraints.only_recorded_neurons.erase(neuron);
-		}
+		constraints.only_recorded_neurons -= constraints.neuron_sources;
 	}
 
 	return padi_bus_constraints;
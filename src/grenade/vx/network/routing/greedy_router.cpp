@@ -40,6 +40,14 @@ GreedyRouter::GreedyRouter(Options const& options) : m_impl(std::make_unique<Imp
 
 GreedyRouter::~GreedyRouter() {}
 
+GreedyRouter::Options const& GreedyRouter::get_options() const
+{
+	if (!m_impl) {
+		throw std::logic_error("Unexpected access to moved-from object.");
+	}
+	return m_impl->m_options;
+}
+
 RoutingResult GreedyRouter::operator()(grenade::common::LinkedTopology const& topology)
 {
 	if (!m_impl) {
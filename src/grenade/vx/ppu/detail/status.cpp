@@ -28,6 +28,8 @@ std::ostream& operator<<(std::ostream& os, Status const& value)
 			return os << "stop";
 		case Status::scheduler:
 			return os << "scheduler";
+		case Status::snapshot:
+			return os << "snapshot";
 		default:
 			break;
 	}
@@ -29,6 +29,8 @@ void scheduling();
 
 void perform_periodic_read() ATTRIB_LINK_TO_INTERNAL;
 
+void perform_snapshot() ATTRIB_LINK_TO_INTERNAL;
+
 int start() ATTRIB_LINK_TO_INTERNAL;
 
 int start()
@@ -81,6 +83,11 @@ int start()
 				status = Status::idle;
 				break;
 			}
+			case Status::snapshot: {
+				perform_snapshot();
+				status = Status::idle;
+				break;
+			}
 			case Status::scheduler: {
 				mailbox_write_string("bef\n");
 				scheduling();
@@ -129,6 +129,8 @@ ExecutionHealthInfo::ExecutionInstance& ExecutionHealthInfo::ExecutionInstance::
 	for (auto& [chip_on_connection, chip] : chips) {
 		chip += rhs.chips.at(chip_on_connection);
 	}
+	num_sampled_chunks += rhs.num_sampled_chunks;
+	num_chunks += rhs.num_chunks;
 
 	return *this;
 }
@@ -139,6 +141,7 @@ std::ostream& operator<<(std::ostream& os, ExecutionHealthInfo::ExecutionInstanc
 	hate::IndentingOstream ios(os);
 	ios << "ExecutionInstance(\n";
 	ios << hate::Indentation("\t");
+	ios << "sampled chunks: " << info.num_sampled_chunks << " of " << info.num_chunks << "\n";
 	for (auto const& [chip_on_connection, chip] : info.chips) {
 		ios << chip_on_connection << ": " << chip << "\n";
 	}
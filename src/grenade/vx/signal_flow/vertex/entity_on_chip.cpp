@@ -18,6 +18,11 @@ std::optional<grenade::common::TimeDomainOnTopology> EntityOnChip::get_time_doma
 	return m_time_domain;
 }
 
+void EntityOnChip::set_time_domain(grenade::common::TimeDomainOnTopology const& value)
+{
+	m_time_domain = value;
+}
+
 bool EntityOnChip::is_equal_to(Vertex const& other) const
 {
 	return chip_on_connection == static_cast<EntityOnChip const&>(other).chip_on_connection &&
@@ -0,0 +1,89 @@
+#include "benchmark.h"
+
+#include "grenade/common/execution_instance_on_executor.h"
+#include "grenade/common/input_data.h"
+#include "grenade/common/time_domain_on_topology.h"
+#include "grenade/common/topology.h"
+#include "grenade/vx/common/chip_on_connection.h"
+#include "grenade/vx/signal_flow/event.h"
+#include "grenade/vx/signal_flow/vertex/crossbar_l2_input.h"
+#include "halco/hicann-dls/vx/v3/event.h"
+#include "haldls/vx/v3/event.h"
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace grenade::vx::benchmark {
+
+using namespace halco::hicann_dls::vx::v3;
+
+namespace {
+
+signal_flow::vertex::CrossbarL2Input::Dynamics get_dynamics(
+    size_t const num_spikes, size_t const label_value)
+{
+	SpikeLabel label;
+	label.set_spl1_address(SPL1Address(label_value % SPL1Address::size));
+	signal_flow::TimedSpikeToChipSequence spikes;
+	spikes.reserve(num_spikes);
+	for (size_t i = 0; i < num_spikes; ++i) {
+		spikes.push_back(signal_flow::TimedSpikeToChip{
+		    common::Time(static_cast<intmax_t>(i) * 10),
+		    signal_flow::TimedSpikeToChip::Data(haldls::vx::v3::SpikePack1ToChip({label}))});
+	}
+	return signal_flow::vertex::CrossbarL2Input::Dynamics({spikes});
+}
+
+} // namespace
+
+/**
+ * Build of a multi-snippet experiment as done by the Python experiment frontend.
+ * Each snippet starts as copy of the topology and input data of the previous snippet. Every other
+ * snippet changes the input data of a single vertex. The topology and input data of each snippet
+ * are compared to the snapshot of the previous snippet, which is replaced on change.
+ */
+static bool const experiment_build = register_benchmark(
+    {"experiment_build",
+     {{{"num_vertices", 100}, {"num_snippets", 20}},
+      {{"num_vertices", 10000}, {"num_snippets", 20}}},
+     [](State& state, Parameters const& parameters) {
+	     constexpr size_t num_spikes = 100;
+
+	     grenade::common::Topology topology;
+	     grenade::common::InputData input_data;
+	     std::vector<grenade::common::VertexOnTopology> vertices;
+	     for (size_t i = 0; i < parameters.at("num_vertices"); ++i) {
+		     vertices.push_back(topology.add_vertex(signal_flow::vertex::CrossbarL2Input(
+		         true, common::ChipOnConnection(), grenade::common::TimeDomainOnTopology(),
+		         grenade::common::ExecutionInstanceOnExecutor())));
+		     input_data.ports.set({vertices.back(), 0}, get_dynamics(num_spikes, 0));
+	     }
+
+	     state.set_items_per_iteration(parameters.at("num_snippets"));
+	     state.measure([&]() {
+		     std::vector<grenade::common::Topology> topologies{topology};
+		     std::vector<grenade::common::InputData> input_datas{input_data};
+		     std::optional<grenade::common::Topology> last_topology;
+		     std::optional<grenade::common::InputData> last_input_data;
+		     for (size_t i = 0; i < parameters.at("num_snippets"); ++i) {
+			     auto& snippet_input_data = input_datas.back();
+			     if (i % 2) {
+				     snippet_input_data.ports.set(
+				         {vertices.at(i % vertices.size()), 0}, get_dynamics(num_spikes, i));
+			     }
+			     if (!last_topology || *last_topology != topologies.back()) {
+				     last_topology = topologies.back();
+			     }
+			     if (!last_input_data || *last_input_data != snippet_input_data) {
+				     last_input_data = snippet_input_data;
+			     }
+			     topologies.push_back(topologies.back());
+			     input_datas.push_back(input_datas.back());
+		     }
+		     if (input_datas.back() != *last_input_data) {
+			     throw std::logic_error("Input data snapshot doesn't match last snippet.");
+		     }
+	     });
+     }});
+
+} // namespace grenade::vx::benchmark
@@ -0,0 +1,46 @@
+#include "benchmark.h"
+#include "helper.h"
+
+#include "grenade/build-config.h"
+#include "grenade/vx/compute/mac.h"
+#include "grenade/vx/signal_flow/types.h"
+#include "lola/vx/v3/chip.h"
+#include <memory>
+#include <vector>
+
+namespace grenade::vx::benchmark {
+
+#ifdef WITH_GRENADE_PPU_SUPPORT
+/**
+ * Inference of a batch of input activations through a single MAC operation prepared for a static
+ * chip configuration.
+ */
+static bool const mac = register_benchmark(
+    {"mac",
+     {{{"num_rows", 128}, {"num_columns", 256}, {"batch_size", 1}},
+      {{"num_rows", 128}, {"num_columns", 256}, {"batch_size", 100}},
+      {{"num_rows", 128}, {"num_columns", 512}, {"batch_size", 100}}},
+     [](State& state, Parameters const& parameters) {
+	     size_t const num_rows = parameters.at("num_rows");
+	     size_t const num_columns = parameters.at("num_columns");
+	     size_t const batch_size = parameters.at("batch_size");
+
+	     compute::MAC::Weights weights(
+	         num_rows, compute::MAC::Weights::value_type(num_columns, compute::MAC::Weight(0)));
+	     compute::MAC const mac(std::move(weights));
+
+	     std::vector<signal_flow::UInt5> input(num_rows);
+	     for (size_t i = 0; i < input.size(); ++i) {
+		     input.at(i) = signal_flow::UInt5(i % signal_flow::UInt5::size);
+	     }
+	     compute::MAC::Activations const inputs(batch_size, input);
+
+	     auto executor = get_zero_mock_executor();
+	     auto const chip = std::make_unique<lola::vx::v3::Chip>();
+	     auto prepared = mac.prepare(*chip);
+	     state.set_items_per_iteration(batch_size);
+	     state.measure([&]() { prepared.run(inputs, executor); });
+     }});
+#endif
+
+} // namespace grenade::vx::benchmark
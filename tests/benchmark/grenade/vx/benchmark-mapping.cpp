@@ -0,0 +1,146 @@
+#include "benchmark.h"
+#include "helper.h"
+
+#include "grenade/common/edge.h"
+#include "grenade/common/multi_index.h"
+#include "grenade/common/multi_index_sequence/cuboid.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/cell_on_population.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/compartment_on_neuron.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/receptor_on_compartment.h"
+#include "grenade/common/population.h"
+#include "grenade/common/projection.h"
+#include "grenade/common/projection_connector/sequence.h"
+#include "grenade/common/receptor_on_compartment.h"
+#include "grenade/common/time_domain_on_topology.h"
+#include "grenade/common/topology.h"
+#include "grenade/vx/network/abstract/calibration/fixture.h"
+#include "grenade/vx/network/abstract/mapper/greedy.h"
+#include "grenade/vx/network/abstract/population_cell/external_source.h"
+#include "grenade/vx/network/abstract/population_cell/uncalibrated.h"
+#include "grenade/vx/network/abstract/projection_synapse/uncalibrated_signed.h"
+#include "grenade/vx/network/receptor.h"
+#include <memory>
+
+namespace grenade::vx::benchmark {
+
+using namespace halco::hicann_dls::vx::v3;
+using namespace grenade::vx::network;
+
+namespace {
+
+grenade::common::Population get_neuron_population(size_t const size)
+{
+	return grenade::common::Population{
+	    abstract::UncalibratedNeuron{
+	        abstract::UncalibratedNeuron::Compartments{
+	            {grenade::common::CompartmentOnNeuron(),
+	             abstract::UncalibratedNeuron::Compartment{
+	                 abstract::UncalibratedNeuron::Compartment::SpikeMaster(0),
+	                 {{{grenade::common::ReceptorOnCompartment(0), Receptor::Type::excitatory},
+	                   {grenade::common::ReceptorOnCompartment(1), Receptor::Type::inhibitory}}}}}},
+	        LogicalNeuronCompartments(
+	            {{CompartmentOnLogicalNeuron(), {AtomicNeuronOnLogicalNeuron()}}})},
+	    grenade::common::CuboidMultiIndexSequence(
+	        {size}, grenade::common::MultiIndex({0}),
+	        {grenade::common::CellOnPopulationDimensionUnit()}),
+	    abstract::UncalibratedNeuron::ParameterSpace(
+	        size, {{grenade::common::CompartmentOnNeuron(), 1}}),
+	    grenade::common::TimeDomainOnTopology()};
+}
+
+/**
+ * Add all-to-all projection between the given populations to the topology.
+ */
+void add_projection(
+    grenade::common::Topology& topology,
+    grenade::common::VertexOnTopology const& source,
+    size_t const source_size,
+    grenade::common::VertexOnTopology const& target,
+    size_t const target_size)
+{
+	grenade::common::Projection projection(
+	    abstract::UncalibratedSignedSynapse{
+	        grenade::common::ReceptorOnCompartment(0), grenade::common::ReceptorOnCompartment(1)},
+	    abstract::UncalibratedSignedSynapse::ParameterSpace{std::vector(
+	        source_size * target_size, abstract::UncalibratedSignedSynapse::Weight(63))},
+	    grenade::common::SequenceConnector{
+	        grenade::common::CuboidMultiIndexSequence(
+	            {source_size}, {grenade::common::CellOnPopulationDimensionUnit()}),
+	        grenade::common::CuboidMultiIndexSequence(
+	            {target_size}, {grenade::common::CellOnPopulationDimensionUnit()}),
+	        grenade::common::CuboidMultiIndexSequence(
+	            {source_size, target_size}, {grenade::common::CellOnPopulationDimensionUnit(),
+	                                         grenade::common::CellOnPopulationDimensionUnit()})},
+	    grenade::common::TimeDomainOnTopology());
+
+	auto const projection_descriptor = topology.add_vertex(projection);
+	topology.add_edge(
+	    source, projection_descriptor,
+	    grenade::common::Edge(
+	        grenade::common::CuboidMultiIndexSequence(
+	            {source_size, 1}, grenade::common::MultiIndex({0, 0}),
+	            {grenade::common::CellOnPopulationDimensionUnit(),
+	             grenade::common::CompartmentOnNeuronDimensionUnit()}),
+	        grenade::common::CuboidMultiIndexSequence(
+	            {source_size}, {grenade::common::CellOnPopulationDimensionUnit()}),
+	        0, 0));
+	topology.add_edge(
+	    projection_descriptor, target,
+	    grenade::common::Edge(
+	        grenade::common::CuboidMultiIndexSequence(
+	            {target_size, 2}, {grenade::common::CellOnPopulationDimensionUnit(),
+	                               grenade::common::ReceptorOnCompartmentDimensionUnit()}),
+	        grenade::common::CuboidMultiIndexSequence(
+	            {target_size, 1, 2}, grenade::common::MultiIndex({0, 0, 0}),
+	            {grenade::common::CellOnPopulationDimensionUnit(),
+	             grenade::common::CompartmentOnNeuronDimensionUnit(),
+	             grenade::common::ReceptorOnCompartmentDimensionUnit()}),
+	        0, 0));
+}
+
+} // namespace
+
+/**
+ * Mapping of a feed-forward network with an input, a hidden and an output layer, which are
+ * connected all-to-all, onto a single chip.
+ */
+static bool const mapping = register_benchmark(
+    {"mapping",
+     {{{"num_inputs", 50}, {"num_hidden", 32}, {"num_outputs", 3}},
+      {{"num_inputs", 100}, {"num_hidden", 64}, {"num_outputs", 3}},
+      {{"num_inputs", 120}, {"num_hidden", 128}, {"num_outputs", 10}}},
+     [](State& state, Parameters const& parameters) {
+	     size_t const num_inputs = parameters.at("num_inputs");
+	     size_t const num_hidden = parameters.at("num_hidden");
+	     size_t const num_outputs = parameters.at("num_outputs");
+
+	     auto topology = std::make_shared<grenade::common::Topology>();
+
+	     grenade::common::Population population_input{
+	         abstract::ExternalSourceNeuron{},
+	         grenade::common::CuboidMultiIndexSequence(
+	             {num_inputs}, grenade::common::MultiIndex({0}),
+	             {grenade::common::CellOnPopulationDimensionUnit()}),
+	         abstract::ExternalSourceNeuron::ParameterSpace(num_inputs),
+	         grenade::common::TimeDomainOnTopology()};
+
+	     auto const population_input_descriptor = topology->add_vertex(population_input);
+	     auto const population_hidden_descriptor =
+	         topology->add_vertex(get_neuron_population(num_hidden));
+	     auto const population_output_descriptor =
+	         topology->add_vertex(get_neuron_population(num_outputs));
+
+	     add_projection(
+	         *topology, population_input_descriptor, num_inputs, population_hidden_descriptor,
+	         num_hidden);
+	     add_projection(
+	         *topology, population_hidden_descriptor, num_hidden, population_output_descriptor,
+	         num_outputs);
+
+	     auto executor = get_zero_mock_executor();
+	     abstract::FixtureCalibration const calibration;
+	     state.set_items_per_iteration(num_inputs * num_hidden + num_hidden * num_outputs);
+	     state.measure([&]() { abstract::GreedyMapper()(topology, calibration, executor); });
+     }});
+
+} // namespace grenade::vx::benchmark
@@ -0,0 +1,31 @@
+#include "benchmark.h"
+#include "helper.h"
+
+#include "grenade/vx/execution/run.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace grenade::vx::benchmark {
+
+/**
+ * Execution of an experiment consisting of multiple realtime snippets, which are executed
+ * back-to-back within each batch entry.
+ */
+static bool const multi_snippet = register_benchmark(
+    {"multi_snippet",
+     {{{"num_snippets", 1}, {"batch_size", 10}},
+      {{"num_snippets", 4}, {"batch_size", 10}},
+      {{"num_snippets", 16}, {"batch_size", 10}}},
+     [](State& state, Parameters const& parameters) {
+	     auto executor = get_zero_mock_executor();
+	     EventLoopback const loopback(parameters.at("batch_size"), 1000);
+	     std::vector<std::shared_ptr<grenade::common::Topology const>> topologies(
+	         parameters.at("num_snippets"), loopback.topology);
+	     std::vector<std::reference_wrapper<grenade::common::InputData const>> input_data(
+	         parameters.at("num_snippets"), std::cref(loopback.input_data));
+	     state.set_items_per_iteration(parameters.at("num_snippets") * parameters.at("batch_size"));
+	     state.measure([&]() { execution::run(executor, topologies, input_data); });
+     }});
+
+} // namespace grenade::vx::benchmark
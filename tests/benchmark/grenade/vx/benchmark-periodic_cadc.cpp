@@ -0,0 +1,126 @@
+#include "benchmark.h"
+#include "helper.h"
+
+#include "grenade/build-config.h"
+#include "grenade/common/compartment_on_neuron.h"
+#include "grenade/common/edge.h"
+#include "grenade/common/input_data.h"
+#include "grenade/common/linked_topology.h"
+#include "grenade/common/multi_index.h"
+#include "grenade/common/multi_index_sequence/cuboid.h"
+#include "grenade/common/multi_index_sequence/list.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/cell_on_population.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/compartment_on_neuron.h"
+#include "grenade/common/population.h"
+#include "grenade/common/receptor_on_compartment.h"
+#include "grenade/common/time_domain_on_topology.h"
+#include "grenade/common/topology.h"
+#include "grenade/vx/execution/run.h"
+#include "grenade/vx/network/abstract/calibration/fixture.h"
+#include "grenade/vx/network/abstract/clock_cycle_time_domain_runtimes.h"
+#include "grenade/vx/network/abstract/mapper/greedy.h"
+#include "grenade/vx/network/abstract/multi_index_sequence_dimension_unit/atomic_neuron_on_compartment.h"
+#include "grenade/vx/network/abstract/population_cell/uncalibrated.h"
+#include "grenade/vx/network/abstract/recorder/cadc.h"
+#include "grenade/vx/network/receptor.h"
+#include "halco/hicann-dls/vx/v3/neuron.h"
+#include "lola/vx/v3/chip.h"
+#include "lola/vx/v3/neuron.h"
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace grenade::vx::benchmark {
+
+#ifdef WITH_GRENADE_PPU_SUPPORT
+using namespace halco::hicann_dls::vx::v3;
+using namespace grenade::vx::network;
+
+/**
+ * Execution of periodic CADC recording of neuron membrane potentials in the PPU-local memory or
+ * the FPGA-attached DRAM.
+ * The zero-mock connection doesn't execute the PPU program, therefore no samples are recorded
+ * and the measured duration is dominated by the readout and decoding of the recording buffers.
+ */
+static bool const periodic_cadc = register_benchmark(
+    {"periodic_cadc",
+     {{{"batch_size", 1}, {"num_neurons", 4}, {"placement_in_dram", 0}},
+      {{"batch_size", 10}, {"num_neurons", 4}, {"placement_in_dram", 0}},
+      {{"batch_size", 10}, {"num_neurons", 4}, {"placement_in_dram", 1}},
+      {{"batch_size", 10}, {"num_neurons", 64}, {"placement_in_dram", 1}}},
+     [](State& state, Parameters const& parameters) {
+	     size_t const batch_size = parameters.at("batch_size");
+	     size_t const num_neurons = parameters.at("num_neurons");
+	     bool const placement_in_dram = parameters.at("placement_in_dram");
+
+	     auto executor = get_zero_mock_executor();
+
+	     auto topology = std::make_shared<grenade::common::Topology>();
+
+	     grenade::common::Population population{
+	         abstract::UncalibratedNeuron{
+	             abstract::UncalibratedNeuron::Compartments{
+	                 {grenade::common::CompartmentOnNeuron(),
+	                  abstract::UncalibratedNeuron::Compartment{
+	                      abstract::UncalibratedNeuron::Compartment::SpikeMaster(0),
+	                      {{{grenade::common::ReceptorOnCompartment(0),
+	                         Receptor::Type::excitatory}}}}}},
+	             LogicalNeuronCompartments(
+	                 {{CompartmentOnLogicalNeuron(), {AtomicNeuronOnLogicalNeuron()}}})},
+	         grenade::common::CuboidMultiIndexSequence(
+	             {NeuronColumnOnDLS::size}, grenade::common::MultiIndex({0}),
+	             {grenade::common::CellOnPopulationDimensionUnit()}),
+	         abstract::UncalibratedNeuron::ParameterSpace(
+	             NeuronColumnOnDLS::size, {{grenade::common::CompartmentOnNeuron(), 1}}),
+	         grenade::common::TimeDomainOnTopology()};
+	     abstract::UncalibratedNeuron::ParameterSpace::Parameterization population_input_data;
+	     population_input_data.configs.resize(
+	         NeuronColumnOnDLS::size,
+	         {{grenade::common::CompartmentOnNeuron(), {lola::vx::v3::AtomicNeuron()}}});
+	     std::vector<size_t> all_neurons;
+	     for (size_t i = 0; i < NeuronColumnOnDLS::size; ++i) {
+		     all_neurons.push_back(i);
+	     }
+	     population_input_data.base_configs.emplace_back(all_neurons, lola::vx::v3::Chip());
+
+	     auto const population_descriptor = topology->add_vertex(population);
+
+	     abstract::CADCRecorder cadc_recorder(
+	         grenade::common::CuboidMultiIndexSequence({num_neurons}), placement_in_dram,
+	         grenade::common::TimeDomainOnTopology());
+	     auto const cadc_recorder_descriptor = topology->add_vertex(cadc_recorder);
+
+	     std::vector<grenade::common::MultiIndex> recorded_neurons;
+	     for (size_t i = 0; i < num_neurons; ++i) {
+		     recorded_neurons.push_back(grenade::common::MultiIndex({i, 0, 0}));
+	     }
+	     topology->add_edge(
+	         population_descriptor, cadc_recorder_descriptor,
+	         grenade::common::Edge(
+	             grenade::common::ListMultiIndexSequence(
+	                 recorded_neurons, {grenade::common::CellOnPopulationDimensionUnit(),
+	                                    grenade::common::CompartmentOnNeuronDimensionUnit(),
+	                                    abstract::AtomicNeuronOnCompartmentDimensionUnit()}),
+	             grenade::common::CuboidMultiIndexSequence({num_neurons}), 1, 0));
+
+	     abstract::FixtureCalibration const calibration;
+	     auto const mapped_topology = std::make_shared<grenade::common::LinkedTopology>(
+	         abstract::GreedyMapper()(topology, calibration, executor));
+
+	     grenade::common::InputData input_data;
+	     input_data.time_domain_runtimes.set(
+	         grenade::common::TimeDomainOnTopology(),
+	         abstract::ClockCycleTimeDomainRuntimes(
+	             std::vector<std::optional<common::Time>>(
+	                 batch_size, common::Time(common::Time::fpga_clock_cycles_per_us * 100)),
+	             common::Time()));
+	     input_data.ports.set({population_descriptor, 1}, population_input_data);
+
+	     auto const mapped_input_data = mapped_topology->map_root_input_data(input_data);
+
+	     state.set_items_per_iteration(batch_size);
+	     state.measure([&]() { execution::run(executor, mapped_topology, mapped_input_data); });
+     }});
+#endif
+
+} // namespace grenade::vx::benchmark
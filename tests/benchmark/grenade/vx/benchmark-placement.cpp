@@ -0,0 +1,169 @@
+#include "benchmark.h"
+#include "helper.h"
+
+#include "grenade/common/edge.h"
+#include "grenade/common/multi_index.h"
+#include "grenade/common/multi_index_sequence/cuboid.h"
+#include "grenade/common/multi_index_sequence/list.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/cell_on_population.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/compartment_on_neuron.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/receptor_on_compartment.h"
+#include "grenade/common/population.h"
+#include "grenade/common/projection.h"
+#include "grenade/common/projection_connector/sequence.h"
+#include "grenade/common/receptor_on_compartment.h"
+#include "grenade/common/time_domain_on_topology.h"
+#include "grenade/common/topology.h"
+#include "grenade/vx/network/abstract/calibration/fixture.h"
+#include "grenade/vx/network/abstract/mapper/greedy.h"
+#include "grenade/vx/network/abstract/placement/greedy_placer.h"
+#include "grenade/vx/network/abstract/population_cell/uncalibrated.h"
+#include "grenade/vx/network/abstract/projection_synapse/uncalibrated.h"
+#include "grenade/vx/network/exception.h"
+#include "grenade/vx/network/receptor.h"
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace grenade::vx::benchmark {
+
+using namespace halco::hicann_dls::vx::v3;
+using namespace grenade::vx::network;
+
+namespace {
+
+/**
+ * Random network of equally-sized populations with sparse random projections between them.
+ */
+std::shared_ptr<grenade::common::Topology> get_random_network(
+    size_t const num_populations,
+    size_t const population_size,
+    double const projection_probability,
+    double const connection_probability,
+    std::mt19937& rng)
+{
+	auto topology = std::make_shared<grenade::common::Topology>();
+
+	std::vector<grenade::common::VertexOnTopology> populations;
+	for (size_t p = 0; p < num_populations; ++p) {
+		grenade::common::Population population{
+		    abstract::UncalibratedNeuron{
+		        abstract::UncalibratedNeuron::Compartments{
+		            {grenade::common::CompartmentOnNeuron(),
+		             abstract::UncalibratedNeuron::Compartment{
+		                 abstract::UncalibratedNeuron::Compartment::SpikeMaster(0),
+		                 {{{grenade::common::ReceptorOnCompartment(0),
+		                    Receptor::Type::excitatory}}}}}},
+		        LogicalNeuronCompartments(
+		            {{CompartmentOnLogicalNeuron(), {AtomicNeuronOnLogicalNeuron()}}})},
+		    grenade::common::CuboidMultiIndexSequence(
+		        {population_size}, grenade::common::MultiIndex({0}),
+		        {grenade::common::CellOnPopulationDimensionUnit()}),
+		    abstract::UncalibratedNeuron::ParameterSpace(
+		        population_size, {{grenade::common::CompartmentOnNeuron(), 1}}),
+		    grenade::common::TimeDomainOnTopology()};
+		populations.push_back(topology->add_vertex(population));
+	}
+
+	std::bernoulli_distribution projection_distribution(projection_probability);
+	std::bernoulli_distribution connection_distribution(connection_probability);
+	for (auto const& source : populations) {
+		for (auto const& target : populations) {
+			if (!projection_distribution(rng)) {
+				continue;
+			}
+			std::vector<grenade::common::MultiIndex> connections;
+			for (size_t i = 0; i < population_size; ++i) {
+				for (size_t j = 0; j < population_size; ++j) {
+					if (connection_distribution(rng)) {
+						connections.push_back(grenade::common::MultiIndex({i, j}));
+					}
+				}
+			}
+			if (connections.empty()) {
+				continue;
+			}
+			abstract::UncalibratedSynapse::ParameterSpace parameter_space{
+			    std::vector<abstract::UncalibratedSynapse::Weight>(
+			        connections.size(), abstract::UncalibratedSynapse::Weight(63))};
+			grenade::common::Projection projection(
+			    abstract::UncalibratedSynapse{}, std::move(parameter_space),
+			    grenade::common::SequenceConnector{
+			        grenade::common::CuboidMultiIndexSequence({population_size}),
+			        grenade::common::CuboidMultiIndexSequence({population_size}),
+			        grenade::common::ListMultiIndexSequence(std::move(connections))},
+			    grenade::common::TimeDomainOnTopology());
+			auto const projection_descriptor = topology->add_vertex(projection);
+
+			topology->add_edge(
+			    source, projection_descriptor,
+			    grenade::common::Edge(
+			        grenade::common::CuboidMultiIndexSequence(
+			            {population_size, 1}, grenade::common::MultiIndex({0, 0}),
+			            {grenade::common::CellOnPopulationDimensionUnit(),
+			             grenade::common::CompartmentOnNeuronDimensionUnit()}),
+			        grenade::common::CuboidMultiIndexSequence({population_size}), 0, 0));
+			topology->add_edge(
+			    projection_descriptor, target,
+			    grenade::common::Edge(
+			        grenade::common::CuboidMultiIndexSequence({population_size}),
+			        grenade::common::CuboidMultiIndexSequence(
+			            {population_size, 1, 1}, grenade::common::MultiIndex({0, 0, 0}),
+			            {grenade::common::CellOnPopulationDimensionUnit(),
+			             grenade::common::CompartmentOnNeuronDimensionUnit(),
+			             grenade::common::ReceptorOnCompartmentDimensionUnit()}),
+			        0, 0));
+		}
+	}
+	return topology;
+}
+
+} // namespace
+
+/**
+ * Mapping of large random networks onto a single chip with the given placement mode, 0 for
+ * permutation and 1 for connectivity-aware placement.
+ * The processed items are the successfully routed networks, the throughput therefore reflects
+ * both the routing success rate and the time spent on placement and routing.
+ */
+static bool const placement = register_benchmark(
+    {"placement",
+     {{{"mode", 0}, {"connection_permille", 100}},
+      {{"mode", 1}, {"connection_permille", 100}},
+      {{"mode", 0}, {"connection_permille", 150}},
+      {{"mode", 1}, {"connection_permille", 150}}},
+     [](State& state, Parameters const& parameters) {
+	     constexpr size_t num_networks = 5;
+
+	     auto const mode = parameters.at("mode") == 0
+	                           ? abstract::GreedyPlacer::Mode::permutation
+	                           : abstract::GreedyPlacer::Mode::connectivity_aware;
+	     double const connection_probability =
+	         static_cast<double>(parameters.at("connection_permille")) / 1000.;
+
+	     std::mt19937 rng(1234);
+	     std::vector<std::shared_ptr<grenade::common::Topology>> topologies;
+	     for (size_t n = 0; n < num_networks; ++n) {
+		     topologies.push_back(get_random_network(8, 48, 0.5, connection_probability, rng));
+	     }
+
+	     auto executor = get_zero_mock_executor();
+	     abstract::FixtureCalibration const calibration;
+	     size_t num_routed = 0;
+	     state.measure([&]() {
+		     num_routed = 0;
+		     for (auto const& topology : topologies) {
+			     // a new mapper per network and repetition prevents reuse of cached results
+			     abstract::GreedyMapper mapper;
+			     mapper.set_placement_mode(mode);
+			     try {
+				     mapper(topology, calibration, executor);
+				     num_routed++;
+			     } catch (UnsuccessfulRouting const&) {
+			     }
+		     }
+	     });
+	     state.set_items_per_iteration(num_routed);
+     }});
+
+} // namespace grenade::vx::benchmark
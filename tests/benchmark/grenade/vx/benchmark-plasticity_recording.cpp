@@ -0,0 +1,84 @@
+#include "benchmark.h"
+
+#include "grenade/common/execution_instance_on_executor.h"
+#include "grenade/common/time_domain_on_topology.h"
+#include "grenade/vx/common/chip_on_connection.h"
+#include "grenade/vx/common/timed_data.h"
+#include "grenade/vx/signal_flow/types.h"
+#include "grenade/vx/signal_flow/vertex/plasticity_rule.h"
+#include "halco/hicann-dls/vx/v3/neuron.h"
+#include "halco/hicann-dls/vx/v3/synapse.h"
+#include <vector>
+
+namespace grenade::vx::benchmark {
+
+using namespace halco::hicann_dls::vx::v3;
+
+/**
+ * Extraction of timed recording observables of a plasticity rule from raw recorded data.
+ * The raw data is synthesized, since the zero-mock connection doesn't execute the plasticity rule
+ * kernel.
+ */
+static bool const plasticity_recording = register_benchmark(
+    {"plasticity_recording",
+     {{{"batch_size", 1}, {"num_samples", 100}, {"num_rows", 64}, {"num_columns", 64}},
+      {{"batch_size", 10}, {"num_samples", 100}, {"num_rows", 64}, {"num_columns", 64}},
+      {{"batch_size", 10}, {"num_samples", 100}, {"num_rows", 256}, {"num_columns", 256}}},
+     [](State& state, Parameters const& parameters) {
+	     size_t const batch_size = parameters.at("batch_size");
+	     size_t const num_samples = parameters.at("num_samples");
+	     size_t const num_rows = parameters.at("num_rows");
+	     size_t const num_columns = parameters.at("num_columns");
+
+	     typedef signal_flow::vertex::PlasticityRule PlasticityRule;
+	     typedef PlasticityRule::TimedRecording TimedRecording;
+
+	     PlasticityRule::SynapseViewShape synapse_view_shape;
+	     synapse_view_shape.num_rows = num_rows;
+	     synapse_view_shape.hemisphere = HemisphereOnDLS::top;
+	     for (size_t i = 0; i < num_columns; ++i) {
+		     synapse_view_shape.columns.push_back(SynapseOnSynapseRow(i));
+	     }
+
+	     PlasticityRule::NeuronViewShape neuron_view_shape;
+	     neuron_view_shape.row = NeuronRowOnDLS::top;
+	     for (size_t i = 0; i < num_columns; ++i) {
+		     neuron_view_shape.columns.push_back(NeuronColumnOnDLS(i));
+	     }
+
+	     TimedRecording const recording(
+	         {{"synapse",
+	           TimedRecording::ObservablePerSynapse(
+	               TimedRecording::ObservablePerSynapse::Type::int8,
+	               TimedRecording::ObservablePerSynapse::LayoutPerRow::complete_rows)},
+	          {"neuron",
+	           TimedRecording::ObservablePerNeuron(
+	               TimedRecording::ObservablePerNeuron::Type::int8,
+	               TimedRecording::ObservablePerNeuron::Layout::complete_row)},
+	          {"array", TimedRecording::ObservableArray(
+	                        TimedRecording::ObservableArray::Type::uint16, 16)}},
+	         true);
+
+	     PlasticityRule const rule(
+	         {synapse_view_shape}, {neuron_view_shape}, recording, PlasticityRule::ID(),
+	         common::ChipOnConnection(), grenade::common::TimeDomainOnTopology(),
+	         grenade::common::ExecutionInstanceOnExecutor());
+
+	     auto const [begin, end] = rule.get_recorded_memory_data_interval();
+	     std::vector<signal_flow::Int8> sample(end - begin);
+	     for (size_t i = 0; i < sample.size(); ++i) {
+		     sample.at(i) = signal_flow::Int8(static_cast<int8_t>(i));
+	     }
+	     std::vector<common::TimedDataSequence<std::vector<signal_flow::Int8>>> data(batch_size);
+	     for (auto& batch_entry : data) {
+		     for (size_t i = 0; i < num_samples; ++i) {
+			     batch_entry.push_back(common::TimedData<std::vector<signal_flow::Int8>>(
+			         common::Time(static_cast<intmax_t>(i) * 1000), sample));
+		     }
+	     }
+
+	     state.set_items_per_iteration(batch_size * num_samples);
+	     state.measure([&]() { rule.extract_recording_data(data); });
+     }});
+
+} // namespace grenade::vx::benchmark
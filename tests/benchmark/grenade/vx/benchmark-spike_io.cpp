@@ -0,0 +1,26 @@
+#include "benchmark.h"
+#include "helper.h"
+
+#include "grenade/vx/execution/run.h"
+
+namespace grenade::vx::benchmark {
+
+/**
+ * Execution of an event loopback with large batches of input spikes, which is dominated by the
+ * encoding of the spike input and the decoding and post-processing of the recorded spikes.
+ */
+static bool const spike_io = register_benchmark(
+    {"spike_io",
+     {{{"batch_size", 1}, {"num_spikes", 10000}},
+      {{"batch_size", 10}, {"num_spikes", 10000}},
+      {{"batch_size", 100}, {"num_spikes", 1000}},
+      {{"batch_size", 100}, {"num_spikes", 10000}}},
+     [](State& state, Parameters const& parameters) {
+	     auto executor = get_zero_mock_executor();
+	     EventLoopback const loopback(parameters.at("batch_size"), parameters.at("num_spikes"));
+	     state.set_items_per_iteration(parameters.at("batch_size") * parameters.at("num_spikes"));
+	     state.measure(
+	         [&]() { execution::run(executor, loopback.topology, loopback.input_data); });
+     }});
+
+} // namespace grenade::vx::benchmark
@@ -0,0 +1,114 @@
+#include "benchmark.h"
+
+#include "hate/timer.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace grenade::vx::benchmark {
+
+State::State(size_t const repetitions) :
+    m_repetitions(repetitions), m_items_per_iteration(1), m_durations()
+{}
+
+void State::measure(std::function<void()> const& operation)
+{
+	operation();
+	for (size_t i = 0; i < m_repetitions; ++i) {
+		hate::Timer const timer;
+		operation();
+		m_durations.push_back(std::chrono::nanoseconds(timer.get_ns()));
+	}
+}
+
+void State::set_items_per_iteration(size_t const value)
+{
+	m_items_per_iteration = value;
+}
+
+std::vector<std::chrono::nanoseconds> const& State::get_durations() const
+{
+	return m_durations;
+}
+
+size_t State::get_items_per_iteration() const
+{
+	return m_items_per_iteration;
+}
+
+Result::Result(std::string name, Parameters parameters, State const& state) :
+    name(std::move(name)), parameters(std::move(parameters)), repetitions(0)
+{
+	auto durations = state.get_durations();
+	if (durations.empty()) {
+		throw std::runtime_error("Benchmark (" + this->name + ") didn't measure any durations.");
+	}
+	std::sort(durations.begin(), durations.end());
+	repetitions = durations.size();
+	min = durations.front();
+	max = durations.back();
+	median = durations.at(durations.size() / 2);
+	mean = std::accumulate(durations.begin(), durations.end(), std::chrono::nanoseconds(0)) /
+	       durations.size();
+	double variance = 0.;
+	for (auto const& duration : durations) {
+		variance += std::pow(static_cast<double>((duration - mean).count()), 2);
+	}
+	variance /= static_cast<double>(durations.size());
+	stddev = std::chrono::nanoseconds(static_cast<int64_t>(std::sqrt(variance)));
+	items_per_second = median.count() > 0
+	                       ? static_cast<double>(state.get_items_per_iteration()) * 1e9 /
+	                             static_cast<double>(median.count())
+	                       : 0.;
+}
+
+namespace {
+
+std::vector<Benchmark>& get_registry()
+{
+	static std::vector<Benchmark> registry;
+	return registry;
+}
+
+} // namespace
+
+bool register_benchmark(Benchmark benchmark)
+{
+	get_registry().push_back(std::move(benchmark));
+	return true;
+}
+
+std::vector<Benchmark> const& get_benchmarks()
+{
+	return get_registry();
+}
+
+void write_json(std::ostream& os, std::vector<Result> const& results)
+{
+	os << "{\n\t\"benchmarks\": [";
+	for (size_t i = 0; auto const& result : results) {
+		if (i != 0) {
+			os << ",";
+		}
+		os << "\n\t\t{\"name\": \"" << result.name << "\", \"parameters\": {";
+		for (size_t j = 0; auto const& [key, value] : result.parameters) {
+			if (j != 0) {
+				os << ", ";
+			}
+			os << "\"" << key << "\": " << value;
+			j++;
+		}
+		os << "}, \"repetitions\": " << result.repetitions
+		   << ", \"min_ns\": " << result.min.count() << ", \"max_ns\": " << result.max.count()
+		   << ", \"mean_ns\": " << result.mean.count()
+		   << ", \"median_ns\": " << result.median.count()
+		   << ", \"stddev_ns\": " << result.stddev.count()
+		   << ", \"items_per_second\": " << result.items_per_second << "}";
+		i++;
+	}
+	os << "\n\t]\n}\n";
+}
+
+} // namespace grenade::vx::benchmark
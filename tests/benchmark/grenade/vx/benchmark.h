@@ -0,0 +1,112 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace grenade::vx::benchmark {
+
+/**
+ * Parameters of a single benchmark case, e.g. the batch size.
+ */
+typedef std::map<std::string, size_t> Parameters;
+
+/**
+ * State of a running benchmark case.
+ * The benchmark body sets up its data and then times the operation under test via measure(),
+ * so that setup is not part of the measured durations.
+ */
+class State
+{
+public:
+	/**
+	 * Construct state.
+	 * @param repetitions Number of measured repetitions
+	 */
+	State(size_t repetitions);
+
+	/**
+	 * Measure duration of the operation under test.
+	 * The operation is performed once without measurement as warm-up and then once per
+	 * repetition.
+	 * @param operation Operation to measure
+	 */
+	void measure(std::function<void()> const& operation);
+
+	/**
+	 * Set number of items processed by a single invocation of the operation under test, which is
+	 * used to calculate the throughput.
+	 * @param value Number of items
+	 */
+	void set_items_per_iteration(size_t value);
+
+	std::vector<std::chrono::nanoseconds> const& get_durations() const;
+	size_t get_items_per_iteration() const;
+
+private:
+	size_t m_repetitions;
+	size_t m_items_per_iteration;
+	std::vector<std::chrono::nanoseconds> m_durations;
+};
+
+/**
+ * Statistics of a benchmark case.
+ */
+struct Result
+{
+	std::string name;
+	Parameters parameters;
+	size_t repetitions;
+	std::chrono::nanoseconds min;
+	std::chrono::nanoseconds max;
+	std::chrono::nanoseconds mean;
+	std::chrono::nanoseconds median;
+	std::chrono::nanoseconds stddev;
+	/** Processed items per second calculated from the median duration. */
+	double items_per_second;
+
+	/**
+	 * Calculate statistics of finished benchmark case.
+	 * @param name Name of benchmark
+	 * @param parameters Parameters of benchmark case
+	 * @param state State of finished benchmark case
+	 * @throws std::runtime_error On state without measured durations
+	 */
+	Result(std::string name, Parameters parameters, State const& state);
+};
+
+/**
+ * Benchmark with one case per set of parameters.
+ */
+struct Benchmark
+{
+	std::string name;
+	std::vector<Parameters> parameter_sets;
+	std::function<void(State&, Parameters const&)> function;
+};
+
+/**
+ * Register benchmark to be run by the benchmark executable.
+ * Intended to be used for initialization of a static variable in the translation unit of the
+ * benchmark.
+ * @param benchmark Benchmark to register
+ * @return Always true
+ */
+bool register_benchmark(Benchmark benchmark);
+
+/**
+ * Get all registered benchmarks.
+ */
+std::vector<Benchmark> const& get_benchmarks();
+
+/**
+ * Write results as JSON document with one entry per benchmark case.
+ * @param os Stream to write to
+ * @param results Results to write
+ */
+void write_json(std::ostream& os, std::vector<Result> const& results);
+
+} // namespace grenade::vx::benchmark
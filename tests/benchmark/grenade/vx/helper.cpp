@@ -0,0 +1,91 @@
+#include "helper.h"
+
+#include "grenade/common/connection_on_executor.h"
+#include "grenade/common/execution_instance_on_executor.h"
+#include "grenade/common/multi_index_sequence/cuboid.h"
+#include "grenade/common/time_domain_on_topology.h"
+#include "grenade/vx/common/chip_on_connection.h"
+#include "grenade/vx/execution/backend/initialized_connection.h"
+#include "grenade/vx/execution/backend/stateful_connection.h"
+#include "grenade/vx/network/abstract/clock_cycle_time_domain_runtimes.h"
+#include "grenade/vx/signal_flow/event.h"
+#include "grenade/vx/signal_flow/vertex/crossbar_l2_input.h"
+#include "grenade/vx/signal_flow/vertex/crossbar_l2_output.h"
+#include "grenade/vx/signal_flow/vertex/crossbar_node.h"
+#include "halco/hicann-dls/vx/v3/event.h"
+#include "haldls/vx/v3/event.h"
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace grenade::vx::benchmark {
+
+using namespace halco::hicann_dls::vx::v3;
+
+execution::JITGraphExecutor get_zero_mock_executor()
+{
+	std::map<grenade::common::ConnectionOnExecutor, execution::backend::StatefulConnection>
+	    connections;
+	connections.emplace(
+	    grenade::common::ConnectionOnExecutor(),
+	    execution::backend::StatefulConnection(
+	        execution::backend::InitializedConnection(
+	            hxcomm::MultiConnection<hxcomm::vx::ZeroMockConnection>()),
+	        {{true}}));
+	return execution::JITGraphExecutor(std::move(connections));
+}
+
+EventLoopback::EventLoopback(size_t const batch_size, size_t const num_spikes) :
+    topology(std::make_shared<grenade::common::Topology>()), input_data()
+{
+	grenade::common::ExecutionInstanceOnExecutor instance;
+
+	signal_flow::vertex::CrossbarL2Input crossbar_l2_input(
+	    true, common::ChipOnConnection(), grenade::common::TimeDomainOnTopology(), instance);
+
+	signal_flow::vertex::CrossbarNode crossbar_node(
+	    CrossbarNodeOnDLS(
+	        CrossbarInputOnDLS(8), CrossbarL2OutputOnDLS().toCrossbarOutputOnDLS()),
+	    common::ChipOnConnection(), grenade::common::TimeDomainOnTopology(), instance);
+
+	signal_flow::vertex::CrossbarL2Output crossbar_output(
+	    true, common::ChipOnConnection(), grenade::common::TimeDomainOnTopology(), instance);
+
+	auto const v1 = topology->add_vertex(crossbar_l2_input);
+	auto const v2 = topology->add_vertex(crossbar_node);
+	auto const v3 = topology->add_vertex(crossbar_output);
+
+	topology->add_edge(
+	    v1, v2,
+	    grenade::common::Edge(
+	        grenade::common::CuboidMultiIndexSequence({1}),
+	        grenade::common::CuboidMultiIndexSequence({1}), 0, 0));
+	topology->add_edge(
+	    v2, v3,
+	    grenade::common::Edge(
+	        grenade::common::CuboidMultiIndexSequence({1}),
+	        grenade::common::CuboidMultiIndexSequence({1}), 0, 0));
+
+	SpikeLabel label;
+	label.set_spl1_address(SPL1Address(0));
+	std::vector<signal_flow::TimedSpikeToChipSequence> inputs(batch_size);
+	for (auto& input : inputs) {
+		input.reserve(num_spikes);
+		for (size_t i = 0; i < num_spikes; ++i) {
+			input.push_back(signal_flow::TimedSpikeToChip{
+			    common::Time(static_cast<intmax_t>(i) * 10),
+			    signal_flow::TimedSpikeToChip::Data(haldls::vx::v3::SpikePack1ToChip({label}))});
+		}
+	}
+
+	input_data.ports.set({v1, 0}, signal_flow::vertex::CrossbarL2Input::Dynamics(inputs));
+	input_data.time_domain_runtimes.set(
+	    grenade::common::TimeDomainOnTopology(),
+	    network::abstract::ClockCycleTimeDomainRuntimes(
+	        std::vector<std::optional<common::Time>>(batch_size, std::nullopt), common::Time()));
+	input_data.ports.set(
+	    {v2, 1},
+	    signal_flow::vertex::CrossbarNode::Parameterization(haldls::vx::v3::CrossbarNode()));
+}
+
+} // namespace grenade::vx::benchmark
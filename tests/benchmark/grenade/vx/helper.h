@@ -0,0 +1,32 @@
+#pragma once
+#include "grenade/common/input_data.h"
+#include "grenade/common/topology.h"
+#include "grenade/vx/execution/jit_graph_executor.h"
+#include <cstddef>
+#include <memory>
+
+namespace grenade::vx::benchmark {
+
+/**
+ * Get executor with a single connection to a single zero-mock chip.
+ * All reads of the zero-mock connection return zero-valued data, no hardware is required.
+ */
+execution::JITGraphExecutor get_zero_mock_executor();
+
+/**
+ * Topology with input data of an event loopback via the crossbar.
+ */
+struct EventLoopback
+{
+	std::shared_ptr<grenade::common::Topology> topology;
+	grenade::common::InputData input_data;
+
+	/**
+	 * Construct event loopback.
+	 * @param batch_size Number of batch entries
+	 * @param num_spikes Number of spikes to send per batch entry
+	 */
+	EventLoopback(size_t batch_size, size_t num_spikes);
+};
+
+} // namespace grenade::vx::benchmark
@@ -0,0 +1,90 @@
+#include "benchmark.h"
+
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <log4cxx/logger.h>
+
+// logger include directory structure omits prefix
+#include "logger/log4cxx/logging_ctrl.h"
+
+using namespace grenade::vx::benchmark;
+
+int main(int argc, char* argv[])
+{
+	std::string loglevel;
+	std::string filter;
+	std::string output;
+	size_t repetitions;
+	namespace bpo = boost::program_options;
+	bpo::options_description desc("Options");
+	desc.add_options()("help", "print this help message")(
+	    "loglevel", bpo::value<std::string>(&loglevel)->default_value("warning"))(
+	    "filter", bpo::value<std::string>(&filter)->default_value(".*"),
+	    "regular expression of names of benchmarks to run")(
+	    "repetitions", bpo::value<size_t>(&repetitions)->default_value(10),
+	    "number of measured repetitions per benchmark case")(
+	    "output", bpo::value<std::string>(&output)->default_value(""),
+	    "path of JSON file to write results to, stdout if empty");
+
+	bpo::variables_map vm;
+	bpo::store(bpo::parse_command_line(argc, argv, desc), vm);
+	bpo::notify(vm);
+
+	if (vm.count("help")) {
+		std::cout << desc << std::endl;
+		return 0;
+	}
+
+	if (loglevel == "trace") {
+		logger_default_config(log4cxx::Level::getTrace());
+	} else if (loglevel == "debug") {
+		logger_default_config(log4cxx::Level::getDebug());
+	} else if (loglevel == "info") {
+		logger_default_config(log4cxx::Level::getInfo());
+	} else if (loglevel == "warning") {
+		logger_default_config(log4cxx::Level::getWarn());
+	} else if (loglevel == "error") {
+		logger_default_config(log4cxx::Level::getError());
+	} else if (loglevel == "fatal") {
+		logger_default_config(log4cxx::Level::getFatal());
+	} else {
+		throw std::runtime_error(
+		    "loglevel option has to be one of {trace,debug,info,warning,error,fatal}");
+	}
+
+	auto logger = log4cxx::Logger::getLogger("grenade.benchmark");
+	std::regex const filter_regex(filter);
+
+	std::vector<Result> results;
+	for (auto const& benchmark : get_benchmarks()) {
+		if (!std::regex_match(benchmark.name, filter_regex)) {
+			continue;
+		}
+		for (auto const& parameters : benchmark.parameter_sets) {
+			State state(repetitions);
+			benchmark.function(state, parameters);
+			results.emplace_back(benchmark.name, parameters, state);
+			LOG4CXX_INFO(
+			    logger, benchmark.name << ": median " << results.back().median.count()
+			                           << " ns, " << results.back().items_per_second
+			                           << " items/s.");
+		}
+	}
+
+	if (output.empty()) {
+		write_json(std::cout, results);
+	} else {
+		std::ofstream file(output);
+		if (!file.is_open()) {
+			throw std::runtime_error("Opening benchmark output file (" + output + ") failed.");
+		}
+		write_json(file, results);
+	}
+
+	return 0;
+}
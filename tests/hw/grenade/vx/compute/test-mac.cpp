@@ -45,6 +45,13 @@ TEST(MAC, Single)
 		auto const res = mac.run({inputs}, *chip, executor);
 		EXPECT_EQ(res.size(), 1);
 		EXPECT_EQ(res.at(0).size(), 512);
+
+		auto prepared = mac.prepare(*chip);
+		for (size_t i = 0; i < 2; ++i) {
+			auto const prepared_res = prepared.run({inputs, inputs}, executor);
+			EXPECT_EQ(prepared_res.size(), 2);
+			EXPECT_EQ(prepared_res.at(0).size(), 512);
+		}
 	}
 
 	{
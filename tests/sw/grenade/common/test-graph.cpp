@@ -667,6 +667,46 @@ TEST(UndirectedGraph, General)
 	EXPECT_THROW(graph.is_acyclic(), std::runtime_error);
 }
 
+TEST(Graph, CopyOnWrite)
+{
+	BidirectionalDummyGraph graph;
+
+	auto const vertex_on_graph_1 = graph.add_vertex(DummyVertex(1));
+	auto const vertex_on_graph_2 = graph.add_vertex(DummyVertex(2));
+	auto const edge_on_graph = graph.add_edge(vertex_on_graph_1, vertex_on_graph_2, DummyEdge(1));
+
+	BidirectionalDummyGraph graph_copy = graph;
+	EXPECT_EQ(graph_copy, graph);
+	EXPECT_TRUE(graph_copy.shares_storage_with(graph));
+
+	// modification of the copy doesn't alter the original
+	graph_copy.set(vertex_on_graph_1, DummyVertex(3));
+	EXPECT_FALSE(graph_copy.shares_storage_with(graph));
+	EXPECT_EQ(graph.get(vertex_on_graph_1), DummyVertex(1));
+	EXPECT_EQ(graph_copy.get(vertex_on_graph_1), DummyVertex(3));
+	EXPECT_NE(graph_copy, graph);
+
+	// modification of the original doesn't alter the copy
+	graph_copy = graph;
+	graph.remove_edge(edge_on_graph);
+	EXPECT_EQ(graph.num_edges(), 0);
+	EXPECT_EQ(graph_copy.num_edges(), 1);
+	EXPECT_EQ(graph_copy.source(edge_on_graph), vertex_on_graph_1);
+	EXPECT_EQ(graph_copy.target(edge_on_graph), vertex_on_graph_2);
+
+	// descriptors are preserved when modifying a shared graph
+	auto const vertex_on_graph_3 = graph_copy.add_vertex(DummyVertex(3));
+	EXPECT_EQ(graph.add_vertex(DummyVertex(3)), vertex_on_graph_3);
+
+	// modification via mutable reference isn't visible in copies made afterwards
+	auto& vertex = graph.get_mutable(vertex_on_graph_2);
+	graph_copy = graph;
+	EXPECT_FALSE(graph_copy.shares_storage_with(graph));
+	vertex.value = 4;
+	EXPECT_EQ(graph.get(vertex_on_graph_2), DummyVertex(4));
+	EXPECT_EQ(graph_copy.get(vertex_on_graph_2), DummyVertex(2));
+}
+
 TEST(Graph, Move)
 {
 	UndirectedDummyGraph graph;
@@ -179,3 +179,44 @@ TEST(InputData, General)
 	topology.set(vertex_descr, vertex);
 	EXPECT_FALSE(input_data.valid(topology));
 }
+
+TEST(InputData, CopyOnWrite)
+{
+	DummyDefaultVertex vertex{std::nullopt};
+
+	Topology topology;
+	auto const vertex_descr_0 = topology.add_vertex(vertex);
+	auto const vertex_descr_1 = topology.add_vertex(vertex);
+
+	InputData input_data;
+	input_data.ports.set(std::pair{vertex_descr_0, 0}, DummyDefaultVertex::InputData(1));
+	input_data.ports.set(std::pair{vertex_descr_1, 0}, DummyDefaultVertex::InputData(1));
+
+	// copies share the data of all ports
+	InputData input_data_copy = input_data;
+	EXPECT_EQ(input_data_copy, input_data);
+	EXPECT_EQ(
+	    &input_data_copy.ports.get(std::pair{vertex_descr_0, 0}),
+	    &input_data.ports.get(std::pair{vertex_descr_0, 0}));
+	EXPECT_EQ(
+	    &input_data_copy.ports.get(std::pair{vertex_descr_1, 0}),
+	    &input_data.ports.get(std::pair{vertex_descr_1, 0}));
+
+	// replacing the data of a port of the copy only detaches this port
+	input_data_copy.ports.set(std::pair{vertex_descr_1, 0}, DummyDefaultVertex::InputData(2));
+	EXPECT_EQ(
+	    &input_data_copy.ports.get(std::pair{vertex_descr_0, 0}),
+	    &input_data.ports.get(std::pair{vertex_descr_0, 0}));
+	EXPECT_NE(
+	    &input_data_copy.ports.get(std::pair{vertex_descr_1, 0}),
+	    &input_data.ports.get(std::pair{vertex_descr_1, 0}));
+	EXPECT_EQ(
+	    input_data.ports.get(std::pair{vertex_descr_1, 0}), DummyDefaultVertex::InputData(1));
+	EXPECT_NE(input_data_copy, input_data);
+
+	// equal data in distinct storage is compared by value
+	input_data_copy.ports.set(std::pair{vertex_descr_1, 0}, DummyDefaultVertex::InputData(1));
+	EXPECT_EQ(input_data_copy, input_data);
+	input_data_copy.ports.set(std::pair{vertex_descr_1, 1}, DummyDefaultVertex::InputData(1));
+	EXPECT_NE(input_data_copy, input_data);
+}
@@ -7,6 +7,7 @@
 #include "grenade/common/vertex.h"
 #include "grenade/common/vertex_port_type/empty.h"
 #include <stdexcept>
+#include <vector>
 #include <cereal/archives/json.hpp>
 #include <cereal/types/polymorphic.hpp>
 #include <gtest/gtest.h>
@@ -214,3 +215,68 @@ TEST(Topology, Cerealization)
 
 	ASSERT_EQ(obj2, obj);
 }
+
+/**
+ * Snapshots of the topology of each snippet of a multi-snippet experiment as taken by the Python
+ * experiment frontend.
+ */
+TEST(Topology, SnippetSnapshots)
+{
+	constexpr size_t num_vertices = 100;
+	constexpr size_t num_snippets = 20;
+
+	ListMultiIndexSequence channels_0({MultiIndex({1}), MultiIndex({2})});
+	DummyVertexPortType port_type_0;
+
+	Vertex::Port port_0(
+	    port_type_0, Vertex::Port::SumOrSplitSupport::no,
+	    Vertex::Port::ExecutionInstanceTransitionConstraint::supported,
+	    Vertex::Port::RequiresOrGeneratesData::no, channels_0);
+
+	ListMultiIndexSequence channels_1({MultiIndex({1}), MultiIndex({2}), MultiIndex({3})});
+
+	Vertex::Port port_1(
+	    port_type_0, Vertex::Port::SumOrSplitSupport::no,
+	    Vertex::Port::ExecutionInstanceTransitionConstraint::supported,
+	    Vertex::Port::RequiresOrGeneratesData::no, channels_1);
+
+	DummyDefaultVertex default_vertex{port_0, port_0};
+	DummyDefaultVertex changed_vertex{port_1, port_1};
+
+	Topology topology;
+	std::vector<VertexOnTopology> vertices;
+	for (size_t i = 0; i < num_vertices; ++i) {
+		vertices.push_back(topology.add_vertex(default_vertex));
+	}
+
+	std::vector<Topology> snapshots;
+	for (size_t i = 0; i < num_snippets; ++i) {
+		// change a single vertex every other snippet
+		if (i % 2) {
+			topology.set(vertices.at(i), changed_vertex);
+			// the modification detaches the topology from the previous snapshot
+			EXPECT_FALSE(topology.shares_storage_with(snapshots.back()));
+			EXPECT_NE(topology, snapshots.back());
+		} else if (!snapshots.empty()) {
+			EXPECT_TRUE(topology.shares_storage_with(snapshots.back()));
+			EXPECT_EQ(topology, snapshots.back());
+		}
+		snapshots.push_back(topology);
+		// the snapshot shares the storage until either is modified
+		EXPECT_TRUE(snapshots.back().shares_storage_with(topology));
+	}
+
+	// snapshots stay unchanged by the later modifications of their source
+	for (size_t i = 0; i < num_snippets; ++i) {
+		for (size_t v = 0; v < num_snippets; ++v) {
+			bool const changed = (v % 2) && (v <= i);
+			EXPECT_EQ(
+			    snapshots.at(i).get(vertices.at(v)), changed ? changed_vertex : default_vertex);
+		}
+	}
+
+	// snapshots without modification in between share their storage
+	for (size_t i = 1; i < num_snippets; ++i) {
+		EXPECT_EQ(snapshots.at(i).shares_storage_with(snapshots.at(i - 1)), !(i % 2));
+	}
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include "grenade/common/execution_instance_on_executor.h"
+#include "grenade/common/partitioned_vertex.h"
+#include "grenade/vx/compute/detail/fusable_operation.h"
+#include "grenade/vx/execution/detail/host_execution.h"
+#include "grenade/vx/network/abstract/clock_cycle_time_domain_runtimes.h"
+#include "grenade/vx/signal_flow/types.h"
+#include "grenade/vx/signal_flow/vertex/crossbar_l2_output.h"
+#include "grenade/vx/signal_flow/vertex/transformation.h"
+#include "grenade/vx/signal_flow/vertex/transformation/addition.h"
+#include "grenade/vx/signal_flow/vertex/transformation/converting_relu.h"
+#include "grenade/vx/signal_flow/vertex/transformation/relu.h"
+
+using namespace grenade::vx;
+using namespace grenade::vx::signal_flow::vertex;
+
+namespace {
+
+typedef std::vector<common::TimedDataSequence<std::vector<signal_flow::Int8>>> Values;
+
+Values get_values(std::vector<int> const& values)
+{
+	std::vector<signal_flow::Int8> data;
+	for (auto const& value : values) {
+		data.push_back(signal_flow::Int8(value));
+	}
+	return {{{common::Time(), data}}};
+}
+
+compute::detail::FusableOperation get_relu(size_t size)
+{
+	auto topology = std::make_shared<grenade::common::Topology>();
+	auto const vertex = topology->add_vertex(Transformation(
+	    transformation::ReLU(size), grenade::common::ExecutionInstanceOnExecutor()));
+	return {topology, {}, {vertex, 0}, {vertex, 0}};
+}
+
+compute::detail::FusableOperation get_addition(std::vector<int> const& other)
+{
+	auto topology = std::make_shared<grenade::common::Topology>();
+	auto const vertex = topology->add_vertex(Transformation(
+	    transformation::Addition(2, other.size()), grenade::common::ExecutionInstanceOnExecutor()));
+	grenade::common::InputData input_data;
+	input_data.ports.set({vertex, 1}, Transformation::Dynamics(get_values(other)));
+	return {topology, std::move(input_data), {vertex, 0}, {vertex, 0}};
+}
+
+compute::detail::FusableOperation get_converting_relu(size_t size)
+{
+	auto topology = std::make_shared<grenade::common::Topology>();
+	auto const vertex = topology->add_vertex(Transformation(
+	    transformation::ConvertingReLU(size, 1), grenade::common::ExecutionInstanceOnExecutor()));
+	return {topology, {}, {vertex, 0}, {vertex, 0}};
+}
+
+/**
+ * ReLU operation with an additional on-chip entity in the given time domain with given runtime.
+ */
+compute::detail::FusableOperation get_relu_on_time_domain(
+    size_t size, grenade::common::TimeDomainOnTopology const& time_domain, common::Time runtime)
+{
+	auto operation = get_relu(size);
+	auto topology = std::make_shared<grenade::common::Topology>(*operation.topology);
+	topology->add_vertex(CrossbarL2Output(
+	    false, common::ChipOnConnection(), time_domain,
+	    grenade::common::ExecutionInstanceOnExecutor()));
+	operation.topology = topology;
+	operation.input_data.time_domain_runtimes.set(
+	    time_domain, network::abstract::ClockCycleTimeDomainRuntimes({runtime}, common::Time()));
+	return operation;
+}
+
+} // namespace
+
+TEST(FusableOperation, Fuse)
+{
+	EXPECT_THROW(compute::detail::fuse({}), std::invalid_argument);
+
+	auto fused = compute::detail::fuse({get_relu(3), get_addition({-1, 2, 3}), get_relu(3)});
+
+	ASSERT_TRUE(fused.topology);
+	EXPECT_EQ(fused.topology->num_vertices(), 3);
+	EXPECT_EQ(fused.topology->num_edges(), 2);
+
+	// execution instances are disjoint and ordered like the operations
+	EXPECT_EQ(
+	    dynamic_cast<grenade::common::PartitionedVertex const&>(
+	        fused.topology->get(fused.input.first))
+	        .get_execution_instance_on_executor(),
+	    grenade::common::ExecutionInstanceOnExecutor(
+	        grenade::common::ExecutionInstanceID(0), grenade::common::ConnectionOnExecutor()));
+	EXPECT_EQ(
+	    dynamic_cast<grenade::common::PartitionedVertex const&>(
+	        fused.topology->get(fused.output.first))
+	        .get_execution_instance_on_executor(),
+	    grenade::common::ExecutionInstanceOnExecutor(
+	        grenade::common::ExecutionInstanceID(2), grenade::common::ConnectionOnExecutor()));
+
+	fused.input_data.ports.set(fused.input, Transformation::Dynamics(get_values({-5, 1, -2})));
+	auto const output_data =
+	    execution::detail::run_host_only(*fused.topology, fused.input_data);
+	EXPECT_EQ(output_data.ports.get(fused.output), Transformation::Results(get_values({0, 3, 3})));
+}
+
+TEST(FusableOperation, FuseMismatchingPorts)
+{
+	// size mismatch
+	EXPECT_THROW(compute::detail::fuse({get_relu(3), get_relu(4)}), std::invalid_argument);
+
+	// type mismatch, the converting ReLU yields UInt5 values
+	EXPECT_THROW(
+	    compute::detail::fuse({get_converting_relu(3), get_relu(3)}), std::invalid_argument);
+
+	EXPECT_NO_THROW(compute::detail::fuse({get_relu(3), get_converting_relu(3)}));
+}
+
+TEST(FusableOperation, FuseTimeDomains)
+{
+	auto const fused = compute::detail::fuse(
+	    {get_relu_on_time_domain(3, grenade::common::TimeDomainOnTopology(0), common::Time(10)),
+	     get_relu_on_time_domain(3, grenade::common::TimeDomainOnTopology(1), common::Time(20)),
+	     get_relu_on_time_domain(3, grenade::common::TimeDomainOnTopology(0), common::Time(30))});
+
+	// time domains are disjoint and ordered like the operations
+	std::vector<grenade::common::TimeDomainOnTopology> time_domains;
+	for (auto const& vertex_descriptor : fused.topology->vertices()) {
+		if (auto const time_domain = fused.topology->get(vertex_descriptor).get_time_domain();
+		    time_domain) {
+			time_domains.push_back(*time_domain);
+		}
+	}
+	EXPECT_EQ(
+	    time_domains,
+	    (std::vector<grenade::common::TimeDomainOnTopology>{
+	        grenade::common::TimeDomainOnTopology(0), grenade::common::TimeDomainOnTopology(2),
+	        grenade::common::TimeDomainOnTopology(3)}));
+
+	// each operation keeps its own runtimes
+	EXPECT_EQ(fused.input_data.time_domain_runtimes.size(), 3);
+	EXPECT_EQ(
+	    fused.input_data.time_domain_runtimes.get(grenade::common::TimeDomainOnTopology(0)),
+	    network::abstract::ClockCycleTimeDomainRuntimes({common::Time(10)}, common::Time()));
+	EXPECT_EQ(
+	    fused.input_data.time_domain_runtimes.get(grenade::common::TimeDomainOnTopology(2)),
+	    network::abstract::ClockCycleTimeDomainRuntimes({common::Time(20)}, common::Time()));
+	EXPECT_EQ(
+	    fused.input_data.time_domain_runtimes.get(grenade::common::TimeDomainOnTopology(3)),
+	    network::abstract::ClockCycleTimeDomainRuntimes({common::Time(30)}, common::Time()));
+}
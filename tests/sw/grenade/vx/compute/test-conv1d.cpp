@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include "grenade/common/connection_on_executor.h"
+#include "grenade/vx/compute/conv1d.h"
+#include "grenade/vx/compute/mac.h"
+#include "grenade/vx/execution/backend/initialized_connection.h"
+#include "grenade/vx/execution/backend/stateful_connection.h"
+#include "grenade/vx/execution/jit_graph_executor.h"
+#include "grenade/vx/signal_flow/types.h"
+#include "lola/vx/v3/chip.h"
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+using namespace grenade::vx;
+using namespace grenade::vx::compute;
+
+namespace {
+
+execution::JITGraphExecutor get_executor()
+{
+	std::map<grenade::common::ConnectionOnExecutor, execution::backend::StatefulConnection>
+	    connections;
+	connections.emplace(
+	    grenade::common::ConnectionOnExecutor(),
+	    execution::backend::StatefulConnection(
+	        execution::backend::InitializedConnection(
+	            hxcomm::MultiConnection<hxcomm::vx::ZeroMockConnection>()),
+	        {{true}}));
+	return execution::JITGraphExecutor(std::move(connections));
+}
+
+/**
+ * Weights of shape (out_channels = 3, in_channels = 2, size = 2).
+ */
+Conv1d::Weights get_weights()
+{
+	return {
+	    {{Conv1d::Weight(1), Conv1d::Weight(-2)}, {Conv1d::Weight(3), Conv1d::Weight(4)}},
+	    {{Conv1d::Weight(-5), Conv1d::Weight(6)}, {Conv1d::Weight(7), Conv1d::Weight(-8)}},
+	    {{Conv1d::Weight(9), Conv1d::Weight(10)}, {Conv1d::Weight(-11), Conv1d::Weight(63)}}};
+}
+
+/**
+ * Inputs of batch size 3 and two in_channels with five values each.
+ */
+Conv1d::Activations get_inputs()
+{
+	Conv1d::Activations inputs(3);
+	for (size_t b = 0; b < inputs.size(); ++b) {
+		for (size_t j = 0; j < 10; ++j) {
+			inputs.at(b).push_back(signal_flow::UInt5((b * 10 + j) % 32));
+		}
+	}
+	return inputs;
+}
+
+/**
+ * Conv1d implementation materializing all input windows before a single MAC run.
+ */
+std::vector<std::vector<signal_flow::Int8>> run_unchunked(
+    Conv1d::Weights const& weights,
+    size_t const input_size,
+    size_t const stride,
+    Conv1d::Activations const& inputs,
+    lola::vx::v3::Chip const& config,
+    execution::JITGraphExecutor& executor)
+{
+	size_t const out_channels = weights.size();
+	size_t const in_channels = weights.at(0).size();
+	size_t const kernel_size = weights.at(0).at(0).size();
+
+	MAC::Weights mac_weights(in_channels * kernel_size);
+	for (size_t i = 0; i < in_channels; ++i) {
+		for (size_t k = 0; k < kernel_size; ++k) {
+			auto& local = mac_weights.at(i * kernel_size + k);
+			local.resize(out_channels);
+			for (size_t o = 0; o < out_channels; ++o) {
+				local.at(o) = weights.at(o).at(i).at(k);
+			}
+		}
+	}
+	MAC const mac(std::move(mac_weights));
+
+	size_t const num = (input_size - kernel_size) / stride + 1;
+	MAC::Activations mac_inputs(inputs.size() * num);
+	for (size_t b = 0; b < inputs.size(); ++b) {
+		for (size_t n = 0; n < num; ++n) {
+			auto& local = mac_inputs.at(b * num + n);
+			local.resize(kernel_size * in_channels);
+			for (size_t i = 0; i < in_channels; ++i) {
+				for (size_t k = 0; k < kernel_size; ++k) {
+					local.at(i * kernel_size + k) =
+					    inputs.at(b).at(i * input_size + (n * stride) + k);
+				}
+			}
+		}
+	}
+
+	auto const mac_output = mac.run(mac_inputs, config, executor);
+
+	std::vector<std::vector<signal_flow::Int8>> output(inputs.size());
+	for (size_t b = 0; b < output.size(); ++b) {
+		auto& local = output.at(b);
+		local.resize(out_channels * num);
+		for (size_t n = 0; n < num; ++n) {
+			for (size_t o = 0; o < out_channels; ++o) {
+				local.at(n * out_channels + o) = mac_output.at(b * num + n).at(o);
+			}
+		}
+	}
+	return output;
+}
+
+} // namespace
+
+TEST(Conv1d, ChunkedEqualsUnchunked)
+{
+	auto executor = get_executor();
+	lola::vx::v3::Chip const config;
+	auto const inputs = get_inputs();
+
+	constexpr size_t input_size = 5;
+	constexpr size_t stride = 2;
+
+	auto const reference =
+	    run_unchunked(get_weights(), input_size, stride, inputs, config, executor);
+	ASSERT_EQ(reference.size(), inputs.size());
+
+	// chunks of single windows, chunks not aligned to batch entries, a chunk per batch entry and
+	// all windows in a single chunk
+	for (size_t const max_windows_per_run : {1, 2, 3, 4, 100}) {
+		Conv1d const conv1d(
+		    get_weights(), input_size, stride, 1, common::Time(25), false, max_windows_per_run);
+		EXPECT_EQ(conv1d.output_size(), 3 * 2);
+		EXPECT_EQ(conv1d.run(inputs, config, executor), reference) << max_windows_per_run;
+	}
+
+	EXPECT_THROW(
+	    Conv1d(get_weights(), input_size, stride, 1, common::Time(25), false, 0),
+	    std::runtime_error);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include "grenade/common/connection_on_executor.h"
+#include "grenade/vx/compute/mac.h"
+#include "grenade/vx/execution/backend/initialized_connection.h"
+#include "grenade/vx/execution/backend/stateful_connection.h"
+#include "grenade/vx/execution/jit_graph_executor.h"
+#include "grenade/vx/signal_flow/types.h"
+#include "lola/vx/v3/chip.h"
+#include <map>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace grenade::vx;
+using namespace grenade::vx::compute;
+
+namespace {
+
+execution::JITGraphExecutor get_executor()
+{
+	std::map<grenade::common::ConnectionOnExecutor, execution::backend::StatefulConnection>
+	    connections;
+	connections.emplace(
+	    grenade::common::ConnectionOnExecutor(),
+	    execution::backend::StatefulConnection(
+	        execution::backend::InitializedConnection(
+	            hxcomm::MultiConnection<hxcomm::vx::ZeroMockConnection>()),
+	        {{true}}));
+	return execution::JITGraphExecutor(std::move(connections));
+}
+
+MAC::Weights get_weights()
+{
+	return {
+	    {MAC::Weight(10), MAC::Weight(-20), MAC::Weight(0)},
+	    {MAC::Weight(-5), MAC::Weight(63), MAC::Weight(1)}};
+}
+
+MAC::Activations get_inputs()
+{
+	return {
+	    {signal_flow::UInt5(3), signal_flow::UInt5(31)},
+	    {signal_flow::UInt5(0), signal_flow::UInt5(7)},
+	    {signal_flow::UInt5(12), signal_flow::UInt5(1)}};
+}
+
+} // namespace
+
+TEST(MAC, PreparedEqualsRun)
+{
+	auto executor = get_executor();
+	lola::vx::v3::Chip const config;
+	auto const inputs = get_inputs();
+
+	auto const reference = MAC(get_weights()).run(inputs, config, executor);
+	ASSERT_EQ(reference.size(), inputs.size());
+	for (auto const& batch_entry : reference) {
+		EXPECT_EQ(batch_entry.size(), 3);
+	}
+
+	// prepared operation doesn't depend on the lifetime of the MAC it was prepared from
+	std::optional<MAC::Prepared> prepared;
+	{
+		MAC const mac(get_weights());
+		prepared.emplace(mac.prepare(config));
+	}
+	for (size_t i = 0; i < 3; ++i) {
+		EXPECT_EQ(prepared->run(inputs, executor), reference);
+	}
+
+	// repeated runs reuse the prepared operation
+	MAC mac(get_weights());
+	for (size_t i = 0; i < 3; ++i) {
+		EXPECT_EQ(mac.run(inputs, config, executor), reference);
+	}
+
+	// copies prepare their own operation
+	MAC const copy(mac);
+	EXPECT_EQ(copy.run(inputs, config, executor), reference);
+	mac = copy;
+	EXPECT_EQ(mac.run(inputs, config, executor), reference);
+
+	// input checks are applied to reused prepared operation
+	EXPECT_THROW(mac.run(MAC::Activations{}, config, executor), std::runtime_error);
+	EXPECT_THROW(
+	    mac.run(MAC::Activations{{signal_flow::UInt5(3)}}, config, executor), std::runtime_error);
+	EXPECT_EQ(mac.run(inputs, config, executor), reference);
+}
+
+TEST(MAC, ConcurrentRuns)
+{
+	auto const config = std::make_shared<lola::vx::v3::Chip const>();
+	auto const inputs = get_inputs();
+
+	MAC const mac(get_weights());
+	std::vector<std::vector<signal_flow::Int8>> reference;
+	{
+		auto executor = get_executor();
+		reference = mac.run(inputs, *config, executor);
+		// configuration given as shared object is reused without comparison in later runs
+		EXPECT_EQ(mac.run(inputs, config, executor), reference);
+		EXPECT_EQ(mac.run(inputs, config, executor), reference);
+	}
+
+	// runs of the same operation are not serialized and don't interfere
+	constexpr size_t num_threads = 4;
+	std::vector<std::vector<std::vector<signal_flow::Int8>>> results(num_threads);
+	std::vector<std::thread> threads;
+	for (size_t i = 0; i < num_threads; ++i) {
+		threads.emplace_back([&, i]() {
+			auto executor = get_executor();
+			results.at(i) = (i % 2) ? mac.run(inputs, config, executor)
+			                        : mac.run(inputs, *config, executor);
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	for (auto const& result : results) {
+		EXPECT_EQ(result, reference);
+	}
+}
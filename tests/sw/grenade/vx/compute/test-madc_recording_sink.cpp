@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include "grenade/vx/compute/madc_recording_sink.h"
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace grenade::vx;
+using namespace grenade::vx::compute;
+
+namespace {
+
+signal_flow::TimedMADCSampleFromChipSequence get_samples()
+{
+	typedef signal_flow::MADCSampleFromChip Sample;
+	return {
+	    {common::Time(10), Sample(Sample::Value(1), Sample::Channel(0))},
+	    {common::Time(20), Sample(Sample::Value(2), Sample::Channel(0))},
+	    {common::Time(30), Sample(Sample::Value(3), Sample::Channel(1))}};
+}
+
+std::vector<char> read_file(std::filesystem::path const& path)
+{
+	std::ifstream file(path, std::ios_base::binary);
+	return std::vector<char>(std::istreambuf_iterator<char>(file), {});
+}
+
+} // namespace
+
+TEST(TSVMADCRecordingSink, General)
+{
+	auto const path = std::filesystem::temp_directory_path() / "grenade-test-madc_recording.csv";
+	std::filesystem::remove(path);
+
+	for (size_t i = 0; i < 2; ++i) {
+		TSVMADCRecordingSink sink(path.string());
+		sink.write(grenade::common::ExecutionInstanceID(3), 1, get_samples());
+	}
+
+	std::ifstream file(path);
+	std::string const content(std::istreambuf_iterator<char>(file), {});
+	EXPECT_EQ(
+	    content, "ExecutionIndex\tbatch\ttime\tvalue\n"
+	             "3\t1\t10\t1\n3\t1\t20\t2\n3\t1\t30\t3\n"
+	             "3\t1\t10\t1\n3\t1\t20\t2\n3\t1\t30\t3\n");
+
+	std::filesystem::remove(path);
+}
+
+TEST(BinaryMADCRecordingSink, General)
+{
+	typedef BinaryMADCRecordingSink Sink;
+
+	auto const path = std::filesystem::temp_directory_path() / "grenade-test-madc_recording.bin";
+	std::filesystem::remove(path);
+
+	{
+		// small buffer size to exercise handing over multiple buffers to the writer thread
+		Sink sink(path.string(), 1);
+		sink.write(grenade::common::ExecutionInstanceID(3), 1, get_samples());
+		sink.flush();
+		EXPECT_EQ(
+		    read_file(path).size(),
+		    sizeof(Sink::FileHeader) + 2 * sizeof(Sink::BlockHeader) + 3 * sizeof(Sink::Record));
+		sink.write(grenade::common::ExecutionInstanceID(4), 0, get_samples());
+	}
+
+	// append to existing file
+	{
+		Sink sink(path.string());
+		sink.write(grenade::common::ExecutionInstanceID(5), 2, {});
+	}
+
+	auto const data = read_file(path);
+	ASSERT_EQ(
+	    data.size(),
+	    sizeof(Sink::FileHeader) + 4 * sizeof(Sink::BlockHeader) + 6 * sizeof(Sink::Record));
+
+	auto const* ptr = data.data();
+	auto const& header = *reinterpret_cast<Sink::FileHeader const*>(ptr);
+	EXPECT_EQ(std::string(header.magic), std::string(Sink::magic));
+	EXPECT_EQ(header.version, Sink::version);
+	EXPECT_EQ(header.byte_order_mark, Sink::byte_order_mark);
+	ptr += sizeof(Sink::FileHeader);
+
+	auto const& block_header = *reinterpret_cast<Sink::BlockHeader const*>(ptr);
+	EXPECT_EQ(block_header.execution_instance, 3);
+	EXPECT_EQ(block_header.batch_entry, 1);
+	EXPECT_EQ(block_header.channel, 0);
+	EXPECT_EQ(block_header.num_samples, 2);
+	ptr += sizeof(Sink::BlockHeader);
+
+	auto const& record = *reinterpret_cast<Sink::Record const*>(ptr);
+	EXPECT_EQ(record.time, 10);
+	EXPECT_EQ(record.value, 1);
+	ptr += 2 * sizeof(Sink::Record);
+
+	auto const& next_block_header = *reinterpret_cast<Sink::BlockHeader const*>(ptr);
+	EXPECT_EQ(next_block_header.channel, 1);
+	EXPECT_EQ(next_block_header.num_samples, 1);
+
+	// file with other content is not appended to
+	{
+		std::ofstream file(path);
+		file << "other content which is no MADC recording";
+	}
+	EXPECT_THROW(Sink(path.string()), std::runtime_error);
+
+	std::filesystem::remove(path);
+}
+
+TEST(BinaryMADCRecordingSink, Concurrent)
+{
+	typedef BinaryMADCRecordingSink Sink;
+
+	auto const path =
+	    std::filesystem::temp_directory_path() / "grenade-test-madc_recording_concurrent.bin";
+	std::filesystem::remove(path);
+
+	constexpr size_t num_threads = 4;
+	constexpr size_t num_writes = 100;
+	{
+		Sink sink(path.string(), 64);
+		std::vector<std::thread> threads;
+		for (size_t t = 0; t < num_threads; ++t) {
+			threads.emplace_back([&sink, t]() {
+				for (size_t i = 0; i < num_writes; ++i) {
+					sink.write(grenade::common::ExecutionInstanceID(t), i, get_samples());
+					if (i % 10 == 0) {
+						sink.flush();
+					}
+				}
+			});
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+		sink.flush();
+		EXPECT_EQ(
+		    read_file(path).size(),
+		    sizeof(Sink::FileHeader) +
+		        num_threads * num_writes *
+		            (2 * sizeof(Sink::BlockHeader) + 3 * sizeof(Sink::Record)));
+	}
+
+	std::filesystem::remove(path);
+}
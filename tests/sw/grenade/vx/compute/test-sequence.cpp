@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include "grenade/common/connection_on_executor.h"
+#include "grenade/vx/compute/sequence.h"
+#include "grenade/vx/execution/backend/initialized_connection.h"
+#include "grenade/vx/execution/backend/stateful_connection.h"
+#include "grenade/vx/execution/jit_graph_executor.h"
+#include "grenade/vx/signal_flow/types.h"
+#include "lola/vx/v3/chip.h"
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+using namespace grenade::vx;
+using namespace grenade::vx::compute;
+
+namespace {
+
+execution::JITGraphExecutor get_executor()
+{
+	std::map<grenade::common::ConnectionOnExecutor, execution::backend::StatefulConnection>
+	    connections;
+	connections.emplace(
+	    grenade::common::ConnectionOnExecutor(),
+	    execution::backend::StatefulConnection(
+	        execution::backend::InitializedConnection(
+	            hxcomm::MultiConnection<hxcomm::vx::ZeroMockConnection>()),
+	        {{true}}));
+	return execution::JITGraphExecutor(std::move(connections));
+}
+
+std::vector<signal_flow::Int8> get_values(std::vector<int> const& values)
+{
+	std::vector<signal_flow::Int8> ret;
+	for (auto const& value : values) {
+		ret.push_back(signal_flow::Int8(value));
+	}
+	return ret;
+}
+
+} // namespace
+
+TEST(Sequence, FusedEqualsUnfused)
+{
+	auto executor = get_executor();
+	lola::vx::v3::Chip const config;
+
+	Addition const addition_0(get_values({-3, 5, 10, -20}));
+	ReLU const relu(4);
+	Addition const addition_1(get_values({7, -1, -12, 4}));
+	ArgMax const argmax(4);
+	ConvertingReLU const converting_relu(4, 1);
+
+	std::vector<std::vector<signal_flow::Int8>> const inputs{
+	    get_values({1, 2, 3, 4}), get_values({-5, 100, -7, 8}), get_values({20, -30, 40, -50})};
+
+	// Int8 -> Int8 -> Int8 -> UInt32
+	{
+		Sequence sequence;
+		sequence.data.push_back(addition_0);
+		sequence.data.push_back(relu);
+		sequence.data.push_back(addition_1);
+		sequence.data.push_back(argmax);
+
+		auto const unfused = argmax.run(
+		    addition_1.run(
+		        relu.run(addition_0.run(inputs, config, executor), config, executor), config,
+		        executor),
+		    config, executor);
+
+		EXPECT_EQ(
+		    std::get<std::vector<std::vector<signal_flow::UInt32>>>(
+		        sequence.run(inputs, config, executor)),
+		    unfused);
+	}
+
+	// Int8 -> Int8 -> UInt5
+	{
+		Sequence sequence;
+		sequence.data.push_back(addition_0);
+		sequence.data.push_back(relu);
+		sequence.data.push_back(converting_relu);
+
+		auto const unfused = converting_relu.run(
+		    relu.run(addition_0.run(inputs, config, executor), config, executor), config,
+		    executor);
+
+		EXPECT_EQ(
+		    std::get<std::vector<std::vector<signal_flow::UInt5>>>(
+		        sequence.run(inputs, config, executor)),
+		    unfused);
+	}
+}
+
+TEST(Sequence, FusedInputChecks)
+{
+	auto executor = get_executor();
+	lola::vx::v3::Chip const config;
+
+	Sequence sequence;
+	sequence.data.push_back(Addition(get_values({1, 2, 3})));
+	sequence.data.push_back(ReLU(3));
+
+	EXPECT_NO_THROW(sequence.run(
+	    std::vector<std::vector<signal_flow::Int8>>{get_values({1, 2, 3})}, config, executor));
+
+	// empty input
+	EXPECT_THROW(
+	    sequence.run(std::vector<std::vector<signal_flow::Int8>>{}, config, executor),
+	    std::runtime_error);
+	// input size not matching the first entry
+	EXPECT_THROW(
+	    sequence.run(
+	        std::vector<std::vector<signal_flow::Int8>>{get_values({1, 2})}, config, executor),
+	    std::runtime_error);
+	// batch entries not sharing a common size
+	EXPECT_THROW(
+	    sequence.run(
+	        std::vector<std::vector<signal_flow::Int8>>{
+	            get_values({1, 2, 3}), get_values({1, 2})},
+	        config, executor),
+	    std::runtime_error);
+	// input type not matching the first entry
+	EXPECT_THROW(
+	    sequence.run(
+	        std::vector<std::vector<signal_flow::UInt5>>{
+	            {signal_flow::UInt5(1), signal_flow::UInt5(2), signal_flow::UInt5(3)}},
+	        config, executor),
+	    std::runtime_error);
+
+	// size of connected entries not matching
+	sequence.data.push_back(ReLU(4));
+	EXPECT_THROW(
+	    sequence.run(
+	        std::vector<std::vector<signal_flow::Int8>>{get_values({1, 2, 3})}, config, executor),
+	    std::invalid_argument);
+}
+
+TEST(Sequence, ReusedFusedOperation)
+{
+	auto executor = get_executor();
+	lola::vx::v3::Chip const config;
+
+	Addition const addition_0(get_values({-3, 5, 10, -20}));
+	ReLU const relu(4);
+	Addition const addition_1(get_values({7, -1, -12, 4}));
+
+	Sequence sequence;
+	sequence.data.push_back(addition_0);
+	sequence.data.push_back(relu);
+
+	std::vector<std::vector<std::vector<signal_flow::Int8>>> const inputs{
+	    {get_values({1, 2, 3, 4})},
+	    {get_values({-5, 100, -7, 8}), get_values({20, -30, 40, -50})},
+	    {get_values({20, -30, 40, -50})}};
+
+	// repeated runs with changing inputs and batch sizes equal unfused runs
+	for (auto const& input : inputs) {
+		auto const unfused = relu.run(addition_0.run(input, config, executor), config, executor);
+		EXPECT_EQ(
+		    std::get<std::vector<std::vector<signal_flow::Int8>>>(
+		        sequence.run(input, config, executor)),
+		    unfused);
+	}
+
+	// replaced entries are not run with the previously fused operation
+	sequence.data.front() = addition_1;
+	for (auto const& input : inputs) {
+		auto const unfused = relu.run(addition_1.run(input, config, executor), config, executor);
+		EXPECT_EQ(
+		    std::get<std::vector<std::vector<signal_flow::Int8>>>(
+		        sequence.run(input, config, executor)),
+		    unfused);
+	}
+}
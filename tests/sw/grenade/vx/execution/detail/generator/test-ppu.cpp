@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include "grenade/vx/execution/detail/generator/ppu.h"
+
+#include "grenade/vx/ppu/detail/snapshot.h"
+#include "halco/common/iter_all.h"
+#include "halco/hicann-dls/vx/v3/fpga.h"
+#include "halco/hicann-dls/vx/v3/ppu.h"
+#include "haldls/vx/v3/ppu.h"
+#include "lola/vx/v3/ppu.h"
+#include <cstdint>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace grenade::vx::execution::detail::generator;
+using namespace halco::hicann_dls::vx::v3;
+using namespace halco::common;
+
+namespace {
+
+typedef lola::vx::v3::PPUElfFile::symbols_type Symbols;
+typedef std::map<HemisphereOnDLS, haldls::vx::v3::PPUMemoryBlock> PPUMemoryBlocks;
+
+/**
+ * Get symbol located at the given coordinate.
+ */
+template <typename Coordinate>
+Symbols::mapped_type get_symbol(Coordinate const& coordinate)
+{
+	Symbols::mapped_type symbol;
+	symbol.coordinate = coordinate;
+	return symbol;
+}
+
+/**
+ * Get symbols featuring a snapshot buffer of the given size.
+ * @param buffer_size Size of snapshot buffer in bytes
+ */
+Symbols get_symbols(size_t buffer_size)
+{
+	Symbols symbols;
+	symbols.emplace(
+	    "snapshot_buffer_top",
+	    get_symbol(ExternalPPUDRAMMemoryBlockOnFPGA(
+	        ExternalPPUDRAMMemoryByteOnFPGA(0), ExternalPPUDRAMMemoryByteOnFPGA(buffer_size - 1))));
+	symbols.emplace(
+	    "snapshot_buffer_bot",
+	    get_symbol(ExternalPPUDRAMMemoryBlockOnFPGA(
+	        ExternalPPUDRAMMemoryByteOnFPGA(buffer_size),
+	        ExternalPPUDRAMMemoryByteOnFPGA(2 * buffer_size - 1))));
+	symbols.emplace(
+	    "a", get_symbol(PPUMemoryBlockOnPPU(PPUMemoryWordOnPPU(0), PPUMemoryWordOnPPU(1))));
+	symbols.emplace(
+	    "b", get_symbol(PPUMemoryBlockOnPPU(PPUMemoryWordOnPPU(10), PPUMemoryWordOnPPU(10))));
+	symbols.emplace(
+	    "c", get_symbol(ExternalPPUMemoryBlockOnFPGA(
+	             ExternalPPUMemoryByteOnFPGA(0), ExternalPPUMemoryByteOnFPGA(3))));
+	return symbols;
+}
+
+} // namespace
+
+TEST(PPUSnapshotLayout, General)
+{
+	auto const symbols = get_symbols(36);
+
+	PPUSnapshotLayout const layout({"a", "b", "c"}, symbols);
+
+	// only symbols in PPU-internal memory are part of the snapshot
+	ASSERT_EQ(layout.regions.size(), 2);
+	EXPECT_EQ(layout.regions.at(0).first, "a");
+	EXPECT_EQ(
+	    layout.regions.at(0).second,
+	    PPUMemoryBlockOnPPU(PPUMemoryWordOnPPU(0), PPUMemoryWordOnPPU(1)));
+	EXPECT_EQ(layout.regions.at(1).first, "b");
+	EXPECT_EQ(layout.size_in_bytes, 12);
+	EXPECT_EQ(layout.capacity, 3);
+	EXPECT_EQ(layout.remaining_symbol_names, std::set<std::string>{"c"});
+
+	// no symbol in PPU-internal memory
+	PPUSnapshotLayout const external_layout({"c"}, symbols);
+	EXPECT_TRUE(external_layout.regions.empty());
+	EXPECT_EQ(external_layout.size_in_bytes, 0);
+	EXPECT_EQ(external_layout.capacity, 0);
+	EXPECT_EQ(external_layout.remaining_symbol_names, std::set<std::string>{"c"});
+}
+
+TEST(PPUSnapshotLayout, Errors)
+{
+	// unknown symbol
+	EXPECT_THROW(PPUSnapshotLayout({"a", "d"}, get_symbols(36)), std::runtime_error);
+
+	// snapshot buffer doesn't fit a single snapshot
+	EXPECT_THROW(PPUSnapshotLayout({"a", "b"}, get_symbols(8)), std::runtime_error);
+	EXPECT_NO_THROW(PPUSnapshotLayout({"a", "b"}, get_symbols(12)));
+
+	// too many symbols
+	auto symbols = get_symbols(1024);
+	std::set<std::string> symbol_names;
+	for (size_t i = 0; i < grenade::vx::ppu::detail::max_num_snapshot_regions + 1; ++i) {
+		auto const name = "symbol_" + std::to_string(i);
+		symbols.emplace(
+		    name, get_symbol(PPUMemoryBlockOnPPU(PPUMemoryWordOnPPU(i), PPUMemoryWordOnPPU(i))));
+		symbol_names.insert(name);
+	}
+	EXPECT_THROW(PPUSnapshotLayout(symbol_names, symbols), std::runtime_error);
+	symbol_names.erase(symbol_names.begin());
+	EXPECT_NO_THROW(PPUSnapshotLayout(symbol_names, symbols));
+}
+
+TEST(PPUReadSnapshots, Evaluate)
+{
+	PPUSnapshotLayout const layout({"a", "b"}, get_symbols(36));
+
+	PPUReadSnapshots::Result result;
+	result.regions = layout.regions;
+	result.size_in_bytes = layout.size_in_bytes;
+	result.num_snapshots = 2;
+
+	typed_array<std::vector<uint8_t>, PPUOnDLS> bytes;
+	for (auto const ppu : iter_all<PPUOnDLS>()) {
+		for (size_t i = 0; i < result.num_snapshots * result.size_in_bytes; ++i) {
+			bytes[ppu].push_back(static_cast<uint8_t>(ppu.value() * 100 + i));
+		}
+	}
+
+	auto const snapshots = result.evaluate(bytes);
+	ASSERT_EQ(snapshots.size(), result.num_snapshots);
+
+	// bytes are placed in the order of the regions and words are decoded as big-endian
+	auto const get_word = [&](PPUOnDLS const& ppu, size_t const offset) {
+		uint32_t word = 0;
+		for (size_t i = 0; i < sizeof(uint32_t); ++i) {
+			word = (word << 8) | bytes[ppu].at(offset + i);
+		}
+		return word;
+	};
+	for (size_t s = 0; s < result.num_snapshots; ++s) {
+		size_t offset = s * result.size_in_bytes;
+		for (auto const& [name, coord] : result.regions) {
+			auto const& values = std::get<PPUMemoryBlocks>(snapshots.at(s).at(name));
+			ASSERT_EQ(values.size(), PPUOnDLS::size);
+			for (auto const ppu : iter_all<PPUOnDLS>()) {
+				auto const& block = values.at(HemisphereOnDLS(ppu.value()));
+				for (size_t w = 0; w < coord.toPPUMemoryBlockSize().value(); ++w) {
+					EXPECT_EQ(
+					    block.at(w).get_value().value(),
+					    get_word(ppu, offset + w * sizeof(uint32_t)));
+				}
+			}
+			offset += coord.toPPUMemoryBlockSize().value() * sizeof(uint32_t);
+		}
+	}
+
+	// explicit decoding of the first word of the first snapshot on the top PPU
+	EXPECT_EQ(
+	    std::get<PPUMemoryBlocks>(snapshots.at(0).at("a"))
+	        .at(HemisphereOnDLS(0))
+	        .at(0)
+	        .get_value()
+	        .value(),
+	    0x00010203);
+
+	// size not matching number of snapshots
+	bytes[PPUOnDLS(1)].pop_back();
+	EXPECT_THROW(result.evaluate(bytes), std::logic_error);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include "grenade/common/edge.h"
+#include "grenade/common/execution_instance_on_executor.h"
+#include "grenade/common/input_data.h"
+#include "grenade/common/multi_index.h"
+#include "grenade/common/multi_index_sequence/cuboid.h"
+#include "grenade/common/topology.h"
+#include "grenade/vx/execution/detail/host_execution.h"
+#include "grenade/vx/signal_flow/types.h"
+#include "grenade/vx/signal_flow/vertex/transformation.h"
+#include "grenade/vx/signal_flow/vertex/transformation/addition.h"
+#include "grenade/vx/signal_flow/vertex/transformation/relu.h"
+
+using namespace grenade::vx;
+using namespace grenade::vx::signal_flow::vertex;
+
+namespace {
+
+typedef std::vector<common::TimedDataSequence<std::vector<signal_flow::Int8>>> Values;
+
+Values get_values(std::vector<std::vector<int>> const& values)
+{
+	Values ret;
+	for (auto const& batch_entry : values) {
+		std::vector<signal_flow::Int8> data;
+		for (auto const& value : batch_entry) {
+			data.push_back(signal_flow::Int8(value));
+		}
+		ret.push_back({{common::Time(), data}});
+	}
+	return ret;
+}
+
+} // namespace
+
+TEST(HostExecution, ReLUAddition)
+{
+	constexpr size_t size = 3;
+
+	grenade::common::Topology topology;
+	auto const relu = topology.add_vertex(Transformation(
+	    transformation::ReLU(size), grenade::common::ExecutionInstanceOnExecutor()));
+	auto const addition = topology.add_vertex(Transformation(
+	    transformation::Addition(2, size), grenade::common::ExecutionInstanceOnExecutor()));
+	topology.add_edge(
+	    relu, addition,
+	    grenade::common::Edge(
+	        grenade::common::CuboidMultiIndexSequence({size}),
+	        grenade::common::CuboidMultiIndexSequence({size}), 0, 0));
+
+	EXPECT_TRUE(execution::detail::is_host_only(topology));
+
+	grenade::common::InputData input_data;
+	input_data.ports.set(
+	    {relu, 0}, Transformation::Dynamics(get_values({{-5, 0, 7}, {3, -1, -128}})));
+
+	// input of addition is missing
+	EXPECT_THROW(execution::detail::run_host_only(topology, input_data), std::runtime_error);
+
+	input_data.ports.set(
+	    {addition, 1}, Transformation::Dynamics(get_values({{1, 2, 3}, {-1, -2, -3}})));
+
+	auto const output_data = execution::detail::run_host_only(topology, input_data);
+	EXPECT_TRUE(output_data.execution_instances.contains(
+	    grenade::common::ExecutionInstanceOnExecutor()));
+	EXPECT_EQ(
+	    output_data.ports.get({relu, 0}),
+	    Transformation::Results(get_values({{0, 0, 7}, {3, 0, 0}})));
+	EXPECT_EQ(
+	    output_data.ports.get({addition, 0}),
+	    Transformation::Results(get_values({{1, 2, 10}, {2, -2, -3}})));
+}
+
+TEST(HostExecution, NotHostOnly)
+{
+	grenade::common::Topology topology;
+	topology.add_vertex(Transformation(transformation::ReLU(3)));
+
+	// no execution instance is assigned
+	EXPECT_FALSE(execution::detail::is_host_only(topology));
+
+	// edge restricts the channels of its target port
+	grenade::common::Topology restricted_topology;
+	auto const relu = restricted_topology.add_vertex(Transformation(
+	    transformation::ReLU(3), grenade::common::ExecutionInstanceOnExecutor()));
+	auto const addition = restricted_topology.add_vertex(Transformation(
+	    transformation::Addition(1, 5), grenade::common::ExecutionInstanceOnExecutor()));
+	restricted_topology.add_edge(
+	    relu, addition,
+	    grenade::common::Edge(
+	        grenade::common::CuboidMultiIndexSequence({3}),
+	        grenade::common::CuboidMultiIndexSequence({3}, grenade::common::MultiIndex({1})), 0,
+	        0));
+	EXPECT_FALSE(execution::detail::is_host_only(restricted_topology));
+}
+
+TEST(HostExecution, EdgeSection)
+{
+	grenade::common::Topology topology;
+	auto const relu = topology.add_vertex(Transformation(
+	    transformation::ReLU(5), grenade::common::ExecutionInstanceOnExecutor()));
+	auto const addition = topology.add_vertex(Transformation(
+	    transformation::Addition(1, 3), grenade::common::ExecutionInstanceOnExecutor()));
+	topology.add_edge(
+	    relu, addition,
+	    grenade::common::Edge(
+	        grenade::common::CuboidMultiIndexSequence({3}, grenade::common::MultiIndex({2})),
+	        grenade::common::CuboidMultiIndexSequence({3}), 0, 0));
+
+	EXPECT_TRUE(execution::detail::is_host_only(topology));
+
+	grenade::common::InputData input_data;
+	input_data.ports.set(
+	    {relu, 0}, Transformation::Dynamics(get_values({{-5, 0, 7, -3, 4}, {3, -1, 2, 1, -2}})));
+
+	auto const output_data = execution::detail::run_host_only(topology, input_data);
+	EXPECT_EQ(
+	    output_data.ports.get({addition, 0}),
+	    Transformation::Results(get_values({{7, 0, 4}, {2, 1, 0}})));
+}
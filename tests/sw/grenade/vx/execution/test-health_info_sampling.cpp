@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include "grenade/vx/execution/health_info_sampling.h"
+
+#include "grenade/common/connection_on_executor.h"
+#include "grenade/vx/execution/backend/initialized_connection.h"
+#include "grenade/vx/execution/backend/stateful_connection.h"
+#include "grenade/vx/execution/jit_graph_executor.h"
+#include "grenade/vx/signal_flow/execution_health_info.h"
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+using namespace grenade::vx::execution;
+
+namespace {
+
+std::vector<bool> get_sampled(HealthInfoSampling const& sampling, size_t num_chunks)
+{
+	std::vector<bool> ret;
+	for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+		ret.push_back(sampling.is_sampled(chunk, num_chunks));
+	}
+	return ret;
+}
+
+JITGraphExecutor get_executor()
+{
+	std::map<grenade::common::ConnectionOnExecutor, backend::StatefulConnection> connections;
+	connections.emplace(
+	    grenade::common::ConnectionOnExecutor(),
+	    backend::StatefulConnection(
+	        backend::InitializedConnection(
+	            hxcomm::MultiConnection<hxcomm::vx::ZeroMockConnection>()),
+	        {{true}}));
+	return JITGraphExecutor(std::move(connections));
+}
+
+} // namespace
+
+TEST(HealthInfoSampling, is_sampled)
+{
+	EXPECT_EQ(get_sampled(HealthInfoSampling(), 3), std::vector<bool>({true, true, true}));
+	EXPECT_EQ(
+	    get_sampled(HealthInfoSampling(HealthInfoSampling::Mode::first_and_last), 4),
+	    std::vector<bool>({true, false, false, true}));
+	EXPECT_EQ(
+	    get_sampled(HealthInfoSampling(HealthInfoSampling::Mode::first_and_last), 1),
+	    std::vector<bool>({true}));
+	EXPECT_EQ(
+	    get_sampled(HealthInfoSampling(HealthInfoSampling::Mode::every_nth, 2), 5),
+	    std::vector<bool>({true, false, true, false, true}));
+	EXPECT_EQ(
+	    get_sampled(HealthInfoSampling(HealthInfoSampling::Mode::off), 2),
+	    std::vector<bool>({false, false}));
+
+	HealthInfoSampling zero_period(HealthInfoSampling::Mode::every_nth);
+	zero_period.period = 0;
+	EXPECT_THROW(zero_period.is_sampled(0, 1), std::invalid_argument);
+}
+
+TEST(HealthInfoSampling, General)
+{
+	HealthInfoSampling sampling;
+	EXPECT_EQ(sampling.mode, HealthInfoSampling::Mode::every_chunk);
+
+	HealthInfoSampling other(HealthInfoSampling::Mode::every_nth, 3);
+	EXPECT_NE(sampling, other);
+	sampling = other;
+	EXPECT_EQ(sampling, other);
+}
+
+TEST(HealthInfoSampling, Valid)
+{
+	EXPECT_TRUE(HealthInfoSampling().valid());
+	EXPECT_TRUE(HealthInfoSampling(HealthInfoSampling::Mode::every_nth, 1).valid());
+	EXPECT_THROW(
+	    HealthInfoSampling(HealthInfoSampling::Mode::every_nth, 0), std::invalid_argument);
+	// period is only relevant for Mode::every_nth
+	EXPECT_NO_THROW(HealthInfoSampling(HealthInfoSampling::Mode::every_chunk, 0));
+
+	HealthInfoSampling sampling(HealthInfoSampling::Mode::every_nth);
+	sampling.period = 0;
+	EXPECT_FALSE(sampling.valid());
+
+	auto executor = get_executor();
+	EXPECT_THROW(executor.set_health_info_sampling(sampling), std::invalid_argument);
+	EXPECT_EQ(executor.get_health_info_sampling(), HealthInfoSampling());
+	sampling.period = 2;
+	executor.set_health_info_sampling(sampling);
+	EXPECT_EQ(executor.get_health_info_sampling(), sampling);
+}
+
+TEST(HealthInfoSampling, ExecutionHealthInfoChunks)
+{
+	grenade::vx::signal_flow::ExecutionHealthInfo::ExecutionInstance info;
+	info.chips[grenade::vx::common::ChipOnConnection()];
+	info.num_sampled_chunks = 2;
+	info.num_chunks = 5;
+
+	auto other = info;
+	other.num_sampled_chunks = 1;
+	other.num_chunks = 3;
+
+	// numbers of chunks are accumulated with the counter values
+	info += other;
+	EXPECT_EQ(info.num_sampled_chunks, 3);
+	EXPECT_EQ(info.num_chunks, 8);
+
+	// difference of counter values keeps the numbers of chunks
+	info -= other;
+	EXPECT_EQ(info.num_sampled_chunks, 3);
+	EXPECT_EQ(info.num_chunks, 8);
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include "grenade/vx/execution/detail/profiler.h"
+#include "grenade/vx/execution/profile.h"
+#include <chrono>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace grenade::vx::execution;
+
+TEST(ExecutionProfile, Summary)
+{
+	ExecutionProfile profile;
+	EXPECT_TRUE(profile.get_summary().phases.empty());
+
+	ExecutionProfile::Span span;
+	span.phase = ExecutionProfile::Phase::encode;
+	span.duration = std::chrono::nanoseconds(10);
+	profile.spans.push_back(span);
+	span.duration = std::chrono::nanoseconds(30);
+	profile.spans.push_back(span);
+	span.phase = ExecutionProfile::Phase::merge;
+	span.duration = std::chrono::nanoseconds(5);
+	profile.spans.push_back(span);
+
+	auto const summary = profile.get_summary();
+	ASSERT_EQ(summary.phases.size(), 2);
+	EXPECT_EQ(summary.phases.at(ExecutionProfile::Phase::encode).count, 2);
+	EXPECT_EQ(
+	    summary.phases.at(ExecutionProfile::Phase::encode).total, std::chrono::nanoseconds(40));
+	EXPECT_EQ(summary.phases.at(ExecutionProfile::Phase::encode).min, std::chrono::nanoseconds(10));
+	EXPECT_EQ(summary.phases.at(ExecutionProfile::Phase::encode).max, std::chrono::nanoseconds(30));
+	EXPECT_EQ(summary.phases.at(ExecutionProfile::Phase::merge).count, 1);
+}
+
+TEST(ExecutionProfile, ChromeTrace)
+{
+	ExecutionProfile profile;
+	EXPECT_EQ(profile.to_chrome_trace(), "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n]}\n");
+
+	ExecutionProfile::Span span;
+	span.phase = ExecutionProfile::Phase::wait;
+	span.chip = grenade::vx::common::ChipOnConnection(1);
+	span.chunk = 2;
+	span.begin = std::chrono::nanoseconds(1500);
+	span.duration = std::chrono::nanoseconds(250);
+	span.thread = 3;
+	profile.spans.push_back(span);
+
+	EXPECT_EQ(
+	    profile.to_chrome_trace(),
+	    "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+	    "{\"name\":\"wait\",\"cat\":\"grenade\",\"ph\":\"X\",\"ts\":1.500,\"dur\":0.250,"
+	    "\"pid\":0,\"tid\":3,\"args\":{\"chip\":1,\"chunk\":2}}\n]}\n");
+
+	// synthesized spans are only part of the summary
+	auto const trace = profile.to_chrome_trace();
+	span.phase = ExecutionProfile::Phase::decode;
+	span.synthesized = true;
+	profile.spans.push_back(span);
+	EXPECT_EQ(profile.to_chrome_trace(), trace);
+	EXPECT_EQ(profile.get_summary().phases.at(ExecutionProfile::Phase::decode).count, 1);
+}
+
+TEST(Profiler, General)
+{
+	detail::Profiler profiler;
+	EXPECT_FALSE(profiler.get_enabled());
+
+	auto const record = [&profiler](ExecutionProfile::Phase const phase) {
+		ExecutionProfile::Span span;
+		span.phase = phase;
+		detail::Profiler::Scope const scope(&profiler, std::move(span));
+	};
+
+	// disabled profiler doesn't record
+	record(ExecutionProfile::Phase::rewrite);
+	EXPECT_TRUE(profiler.get_profile().spans.empty());
+
+	// null profiler is ignored
+	{
+		detail::Profiler::Scope const scope(nullptr, ExecutionProfile::Span());
+	}
+
+	profiler.set_enabled(true);
+	EXPECT_TRUE(profiler.get_enabled());
+
+	constexpr size_t num_threads = 4;
+	constexpr size_t num_spans_per_thread = 100;
+	std::vector<std::thread> threads;
+	for (size_t i = 0; i < num_threads; ++i) {
+		threads.emplace_back([record]() {
+			for (size_t j = 0; j < num_spans_per_thread; ++j) {
+				record(ExecutionProfile::Phase::program_build);
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	record(ExecutionProfile::Phase::merge);
+
+	auto const profile = profiler.get_profile();
+	ASSERT_EQ(profile.spans.size(), num_threads * num_spans_per_thread + 1);
+	std::set<size_t> thread_indices;
+	for (size_t i = 0; i < profile.spans.size(); ++i) {
+		thread_indices.insert(profile.spans.at(i).thread);
+		if (i > 0) {
+			EXPECT_LE(profile.spans.at(i - 1).begin, profile.spans.at(i).begin);
+		}
+	}
+	EXPECT_EQ(thread_indices.size(), num_threads + 1);
+	EXPECT_EQ(profile.spans.back().phase, ExecutionProfile::Phase::merge);
+	EXPECT_EQ(
+	    profile.get_summary().phases.at(ExecutionProfile::Phase::program_build).count,
+	    num_threads * num_spans_per_thread);
+
+	profiler.clear();
+	EXPECT_TRUE(profiler.get_profile().spans.empty());
+	record(ExecutionProfile::Phase::merge);
+	EXPECT_EQ(profiler.get_profile().spans.size(), 1);
+}
@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+
+#include "grenade/vx/network/abstract/mapper/greedy.h"
+
+#include "grenade/common/connection_on_executor.h"
+#include "grenade/common/edge.h"
+#include "grenade/common/linked_topology.h"
+#include "grenade/common/multi_index.h"
+#include "grenade/common/multi_index_sequence/cuboid.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/cell_on_population.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/compartment_on_neuron.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/receptor_on_compartment.h"
+#include "grenade/common/population.h"
+#include "grenade/common/projection.h"
+#include "grenade/common/projection_connector/sequence.h"
+#include "grenade/common/receptor_on_compartment.h"
+#include "grenade/common/time_domain_on_topology.h"
+#include "grenade/common/topology.h"
+#include "grenade/vx/execution/backend/initialized_connection.h"
+#include "grenade/vx/execution/backend/stateful_connection.h"
+#include "grenade/vx/execution/jit_graph_executor.h"
+#include "grenade/vx/network/abstract/calibration/fixture.h"
+#include "grenade/vx/network/abstract/population_cell/uncalibrated.h"
+#include "grenade/vx/network/abstract/projection_synapse/uncalibrated.h"
+#include "grenade/vx/network/receptor.h"
+#include "halco/hicann-dls/vx/v3/neuron.h"
+#include <map>
+#include <memory>
+
+using namespace halco::hicann_dls::vx::v3;
+using namespace grenade::vx::network;
+using namespace grenade::vx::network::abstract;
+using namespace grenade::common;
+
+namespace {
+
+/**
+ * Topology of a population with a single recurrent connection from and to its first neuron.
+ * @param num_neurons Number of neurons in the population
+ * @param weight Weight of the connection
+ */
+std::shared_ptr<Topology> get_topology(size_t num_neurons, size_t weight)
+{
+	auto topology = std::make_shared<Topology>();
+
+	Population population{
+	    UncalibratedNeuron{
+	        UncalibratedNeuron::Compartments{
+	            {CompartmentOnNeuron(),
+	             UncalibratedNeuron::Compartment{
+	                 UncalibratedNeuron::Compartment::SpikeMaster(0),
+	                 {{{ReceptorOnCompartment(0), Receptor::Type::excitatory}}}}}},
+	        LogicalNeuronCompartments(
+	            {{CompartmentOnLogicalNeuron(), {AtomicNeuronOnLogicalNeuron()}}})},
+	    CuboidMultiIndexSequence(
+	        {num_neurons}, MultiIndex({0}), {CellOnPopulationDimensionUnit()}),
+	    UncalibratedNeuron::ParameterSpace(num_neurons, {{CompartmentOnNeuron(), 1}}),
+	    TimeDomainOnTopology()};
+	auto const population_descriptor = topology->add_vertex(population);
+
+	Projection projection(
+	    UncalibratedSynapse{},
+	    UncalibratedSynapse::ParameterSpace{{UncalibratedSynapse::Weight(weight)}},
+	    SequenceConnector{
+	        CuboidMultiIndexSequence({1}), CuboidMultiIndexSequence({1}),
+	        CuboidMultiIndexSequence({1, 1})},
+	    TimeDomainOnTopology());
+	auto const projection_descriptor = topology->add_vertex(projection);
+
+	topology->add_edge(
+	    population_descriptor, projection_descriptor,
+	    Edge(
+	        CuboidMultiIndexSequence(
+	            {1, 1}, MultiIndex({0, 0}),
+	            {CellOnPopulationDimensionUnit(), CompartmentOnNeuronDimensionUnit()}),
+	        CuboidMultiIndexSequence({1}), 0, 0));
+	topology->add_edge(
+	    projection_descriptor, population_descriptor,
+	    Edge(
+	        CuboidMultiIndexSequence({1}),
+	        CuboidMultiIndexSequence(
+	            {1, 1, 1}, MultiIndex({0, 0, 0}),
+	            {CellOnPopulationDimensionUnit(), CompartmentOnNeuronDimensionUnit(),
+	             ReceptorOnCompartmentDimensionUnit()}),
+	        0, 0));
+	return topology;
+}
+
+grenade::vx::execution::JITGraphExecutor get_executor()
+{
+	std::map<ConnectionOnExecutor, grenade::vx::execution::backend::StatefulConnection>
+	    connections;
+	connections.emplace(
+	    ConnectionOnExecutor(),
+	    grenade::vx::execution::backend::StatefulConnection(
+	        grenade::vx::execution::backend::InitializedConnection(
+	            hxcomm::MultiConnection<hxcomm::vx::ZeroMockConnection>()),
+	        {{true}}));
+	return grenade::vx::execution::JITGraphExecutor(std::move(connections));
+}
+
+} // namespace
+
+TEST(GreedyMapper, CacheReuse)
+{
+	auto executor = get_executor();
+	FixtureCalibration const calibration;
+
+	GreedyMapper mapper;
+	mapper(get_topology(2, 63), calibration, executor);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_placements, 0);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_routings, 0);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_mappings, 0);
+
+	// unchanged topology reuses mapped topology
+	mapper(get_topology(2, 63), calibration, executor);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_placements, 1);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_routings, 1);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_mappings, 1);
+
+	// changed weights requiring the same number of synapse circuits reuse mapped topology
+	mapper(get_topology(2, 10), calibration, executor);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_placements, 2);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_routings, 2);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_mappings, 2);
+
+	// changed weights requiring more synapse circuits reuse placement but not routing
+	mapper(get_topology(2, 100), calibration, executor);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_placements, 3);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_routings, 2);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_mappings, 2);
+
+	// changed structure invalidates placement and routing
+	mapper(get_topology(3, 100), calibration, executor);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_placements, 3);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_routings, 2);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_mappings, 2);
+
+	// the topology replacing the cached one is reused afterwards
+	mapper(get_topology(3, 100), calibration, executor);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_placements, 4);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_routings, 3);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_mappings, 3);
+
+	// other calibration reuses placement and routing but not mapped topology
+	FixtureCalibration const other_calibration;
+	mapper(get_topology(3, 100), other_calibration, executor);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_placements, 5);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_routings, 4);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_mappings, 3);
+
+	// changed placer configuration invalidates placement
+	mapper.set_placement_mode(mapper.get_placement_mode());
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_placements, 0);
+	mapper(get_topology(3, 100), other_calibration, executor);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_placements, 0);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_routings, 0);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_mappings, 0);
+}
+
+TEST(GreedyMapper, WeightOnlyChange)
+{
+	auto executor = get_executor();
+	FixtureCalibration const calibration;
+
+	GreedyMapper mapper;
+	mapper(get_topology(2, 63), calibration, executor);
+	auto const topology = get_topology(2, 10);
+	auto const mapped_topology = mapper(topology, calibration, executor);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_routings, 1);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_mappings, 1);
+	EXPECT_EQ(mapped_topology.get_root(), *topology);
+
+	// all layers equal the layers found by mapping without cached results
+	auto const expectation = GreedyMapper()(topology, calibration, executor);
+	Topology const* layer = &mapped_topology;
+	Topology const* expected_layer = &expectation;
+	while (true) {
+		EXPECT_EQ(*layer, *expected_layer);
+		auto const linked_layer = dynamic_cast<LinkedTopology const*>(layer);
+		auto const expected_linked_layer = dynamic_cast<LinkedTopology const*>(expected_layer);
+		ASSERT_EQ(static_cast<bool>(linked_layer), static_cast<bool>(expected_linked_layer));
+		if (!linked_layer) {
+			break;
+		}
+		EXPECT_EQ(
+		    linked_layer->num_inter_graph_hyper_edges(),
+		    expected_linked_layer->num_inter_graph_hyper_edges());
+		layer = &linked_layer->get_reference();
+		expected_layer = &expected_linked_layer->get_reference();
+	}
+}
+
+TEST(GreedyMapper, Copy)
+{
+	auto executor = get_executor();
+	FixtureCalibration const calibration;
+
+	GreedyMapper mapper;
+	mapper.set_placement_mode(GreedyPlacer::Mode::connectivity_aware);
+	mapper(get_topology(2, 63), calibration, executor);
+	mapper(get_topology(2, 63), calibration, executor);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_placements, 1);
+
+	// copy keeps configuration but starts with empty cache
+	GreedyMapper copy(mapper);
+	EXPECT_EQ(copy.get_placement_mode(), GreedyPlacer::Mode::connectivity_aware);
+	EXPECT_EQ(copy.get_neuron_permutation(), mapper.get_neuron_permutation());
+	EXPECT_EQ(copy.get_cache_statistics().num_reused_placements, 0);
+	copy(get_topology(2, 63), calibration, executor);
+	EXPECT_EQ(copy.get_cache_statistics().num_reused_placements, 0);
+	copy(get_topology(2, 63), calibration, executor);
+	EXPECT_EQ(copy.get_cache_statistics().num_reused_placements, 1);
+
+	// assignment resets the cache of the assigned-to mapper
+	GreedyMapper assigned;
+	assigned(get_topology(2, 63), calibration, executor);
+	assigned(get_topology(2, 63), calibration, executor);
+	assigned = mapper;
+	EXPECT_EQ(assigned.get_placement_mode(), GreedyPlacer::Mode::connectivity_aware);
+	EXPECT_EQ(assigned.get_cache_statistics().num_reused_placements, 0);
+	assigned(get_topology(3, 63), calibration, executor);
+	EXPECT_EQ(assigned.get_cache_statistics().num_reused_placements, 0);
+
+	// the original mapper's cache is unaffected
+	mapper(get_topology(2, 63), calibration, executor);
+	EXPECT_EQ(mapper.get_cache_statistics().num_reused_placements, 2);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include "grenade/vx/network/abstract/mapping/detail/table_cache.h"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace grenade::vx::network::abstract::detail;
+
+TEST(TableCache, General)
+{
+	TableCache<std::vector<int>, std::string> cache;
+	EXPECT_TRUE(cache.empty());
+
+	size_t num_generated = 0;
+	auto const generate = [&num_generated](std::vector<int> const& key) {
+		num_generated++;
+		return std::to_string(key.size());
+	};
+
+	// miss
+	auto const table = cache.get({1, 2, 3}, generate);
+	EXPECT_EQ(*table, "3");
+	EXPECT_EQ(num_generated, 1);
+	EXPECT_FALSE(cache.empty());
+
+	// hit on equal key
+	auto const table_hit = cache.get({1, 2, 3}, generate);
+	EXPECT_EQ(table_hit, table);
+	EXPECT_EQ(num_generated, 1);
+
+	// invalidation on changed key
+	auto const table_changed = cache.get({1, 2, 4}, generate);
+	EXPECT_NE(table_changed, table);
+	EXPECT_EQ(*table_changed, "3");
+	EXPECT_EQ(num_generated, 2);
+
+	// previously handed out table stays valid after invalidation
+	EXPECT_EQ(*table, "3");
+
+	// copies and moves start empty
+	auto const cache_copy = cache;
+	EXPECT_TRUE(cache_copy.empty());
+	EXPECT_FALSE(cache.empty());
+	auto cache_assigned = TableCache<std::vector<int>, std::string>();
+	cache.get({1}, generate);
+	cache_assigned.get({1}, generate);
+	EXPECT_FALSE(cache_assigned.empty());
+	cache_assigned = cache;
+	EXPECT_TRUE(cache_assigned.empty());
+	auto const cache_moved = std::move(cache);
+	EXPECT_TRUE(cache_moved.empty());
+
+	// a copy generates its own table
+	num_generated = 0;
+	cache_copy.get({1, 2, 4}, generate);
+	EXPECT_EQ(num_generated, 1);
+
+	cache_assigned.get({1}, generate);
+	cache_assigned.reset();
+	EXPECT_TRUE(cache_assigned.empty());
+}
+
+TEST(TableCache, Concurrent)
+{
+	TableCache<int, int> cache;
+	std::atomic<size_t> num_generated = 0;
+	auto const generate = [&num_generated](int const key) {
+		num_generated++;
+		return key * 2;
+	};
+
+	std::vector<std::thread> threads;
+	for (size_t i = 0; i < 8; ++i) {
+		threads.emplace_back([&cache, generate]() {
+			for (size_t j = 0; j < 100; ++j) {
+				EXPECT_EQ(*cache.get(21, generate), 42);
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	EXPECT_EQ(num_generated, 1);
+}
@@ -0,0 +1,235 @@
+#include <gtest/gtest.h>
+
+#include "grenade/vx/network/abstract/mapping/cadc_recorder.h"
+
+#include "grenade/common/compartment_on_neuron.h"
+#include "grenade/common/connection_on_executor.h"
+#include "grenade/common/edge.h"
+#include "grenade/common/linked_topology.h"
+#include "grenade/common/multi_index.h"
+#include "grenade/common/multi_index_sequence/cuboid.h"
+#include "grenade/common/multi_index_sequence/list.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/cell_on_population.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/compartment_on_neuron.h"
+#include "grenade/common/population.h"
+#include "grenade/common/receptor_on_compartment.h"
+#include "grenade/common/time_domain_on_topology.h"
+#include "grenade/common/topology.h"
+#include "grenade/vx/execution/backend/initialized_connection.h"
+#include "grenade/vx/execution/backend/stateful_connection.h"
+#include "grenade/vx/execution/jit_graph_executor.h"
+#include "grenade/vx/network/abstract/calibration/fixture.h"
+#include "grenade/vx/network/abstract/mapper/greedy.h"
+#include "grenade/vx/network/abstract/multi_index_sequence_dimension_unit/atomic_neuron_on_compartment.h"
+#include "grenade/vx/network/abstract/population_cell/uncalibrated.h"
+#include "grenade/vx/network/abstract/recorder/cadc.h"
+#include "grenade/vx/network/receptor.h"
+#include "grenade/vx/signal_flow/types.h"
+#include "grenade/vx/signal_flow/vertex/cadc_membrane_readout_view.h"
+#include "halco/hicann-dls/vx/v3/neuron.h"
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+using namespace halco::hicann_dls::vx::v3;
+using namespace grenade::vx::network;
+using namespace grenade::vx::network::abstract;
+using namespace grenade::common;
+
+namespace {
+
+/**
+ * Mapped topology of a population with a subset of its neurons recorded by a CADC recorder.
+ */
+struct MappedCADCRecording
+{
+	std::shared_ptr<LinkedTopology> mapped_topology;
+	LinkedTopology const* level;
+	InterTopologyHyperEdgeOnLinkedTopology mapping_descriptor;
+	size_t num_recorded_neurons;
+
+	MappedCADCRecording(std::vector<size_t> const& recorded_neurons)
+	{
+		auto topology = std::make_shared<Topology>();
+
+		Population population{
+		    UncalibratedNeuron{
+		        UncalibratedNeuron::Compartments{
+		            {CompartmentOnNeuron(),
+		             UncalibratedNeuron::Compartment{
+		                 UncalibratedNeuron::Compartment::SpikeMaster(0),
+		                 {{{ReceptorOnCompartment(0), Receptor::Type::excitatory}}}}}},
+		        LogicalNeuronCompartments(
+		            {{CompartmentOnLogicalNeuron(), {AtomicNeuronOnLogicalNeuron()}}})},
+		    CuboidMultiIndexSequence(
+		        {NeuronColumnOnDLS::size}, MultiIndex({0}), {CellOnPopulationDimensionUnit()}),
+		    UncalibratedNeuron::ParameterSpace(
+		        NeuronColumnOnDLS::size, {{CompartmentOnNeuron(), 1}}),
+		    TimeDomainOnTopology()};
+		auto const population_descriptor = topology->add_vertex(population);
+
+		num_recorded_neurons = recorded_neurons.size();
+		CADCRecorder cadc_recorder(
+		    CuboidMultiIndexSequence({num_recorded_neurons}), false, TimeDomainOnTopology());
+		auto const cadc_recorder_descriptor = topology->add_vertex(cadc_recorder);
+
+		std::vector<MultiIndex> channels;
+		for (auto const neuron : recorded_neurons) {
+			channels.push_back(MultiIndex({neuron, 0, 0}));
+		}
+		topology->add_edge(
+		    population_descriptor, cadc_recorder_descriptor,
+		    Edge(
+		        ListMultiIndexSequence(
+		            channels, {CellOnPopulationDimensionUnit(), CompartmentOnNeuronDimensionUnit(),
+		                       AtomicNeuronOnCompartmentDimensionUnit()}),
+		        CuboidMultiIndexSequence({num_recorded_neurons}), 1, 0));
+
+		std::map<ConnectionOnExecutor, grenade::vx::execution::backend::StatefulConnection>
+		    connections;
+		connections.emplace(
+		    ConnectionOnExecutor(),
+		    grenade::vx::execution::backend::StatefulConnection(
+		        grenade::vx::execution::backend::InitializedConnection(
+		            hxcomm::MultiConnection<hxcomm::vx::ZeroMockConnection>()),
+		        {{true}}));
+		grenade::vx::execution::JITGraphExecutor executor(std::move(connections));
+
+		FixtureCalibration const calibration;
+		mapped_topology =
+		    std::make_shared<LinkedTopology>(GreedyMapper()(topology, calibration, executor));
+
+		level = mapped_topology.get();
+		while (level) {
+			for (auto const& descriptor : level->inter_graph_hyper_edges()) {
+				if (dynamic_cast<CADCRecorderMapping const*>(&level->get(descriptor))) {
+					mapping_descriptor = descriptor;
+					return;
+				}
+			}
+			level = dynamic_cast<LinkedTopology const*>(&level->get_reference());
+		}
+		throw std::runtime_error("Mapped topology doesn't contain CADC recorder mapping.");
+	}
+
+	CADCRecorderMapping const& get_mapping() const
+	{
+		return dynamic_cast<CADCRecorderMapping const&>(level->get(mapping_descriptor));
+	}
+
+	/**
+	 * Generate samples with the value of each read-out column being unique among all columns of
+	 * all linked vertices.
+	 * @param batch_size Number of batch entries
+	 * @param num_samples Number of samples per batch entry
+	 * @param num_surplus_values Number of values in addition to the read-out columns per sample
+	 */
+	std::vector<grenade::vx::signal_flow::vertex::CADCMembraneReadoutView::Results> get_results(
+	    size_t batch_size, size_t num_samples, size_t num_surplus_values = 0) const
+	{
+		std::vector<grenade::vx::signal_flow::vertex::CADCMembraneReadoutView::Results> ret;
+		size_t value = 0;
+		for (auto const& linked_vertex_descriptor : level->links(mapping_descriptor)) {
+			auto const& linked_vertex =
+			    dynamic_cast<grenade::vx::signal_flow::vertex::CADCMembraneReadoutView const&>(
+			        level->get(linked_vertex_descriptor));
+			std::vector<grenade::vx::signal_flow::Int8> data;
+			for (size_t i = 0; i < linked_vertex.get_columns().size() + num_surplus_values; ++i) {
+				data.push_back(grenade::vx::signal_flow::Int8(value));
+				value++;
+			}
+			grenade::vx::signal_flow::vertex::CADCMembraneReadoutView::Results::Samples samples(
+			    batch_size);
+			for (auto& batch_entry : samples) {
+				for (size_t s = 0; s < num_samples; ++s) {
+					batch_entry.emplace_back(grenade::vx::common::Time(s * 10), data);
+				}
+			}
+			ret.emplace_back(std::move(samples));
+		}
+		return ret;
+	}
+
+	CADCRecorder::Results map_output_data(
+	    std::vector<grenade::vx::signal_flow::vertex::CADCMembraneReadoutView::Results> const&
+	        results) const
+	{
+		std::vector<std::vector<std::optional<std::reference_wrapper<PortData const>>>>
+		    linked_vertex_output_data;
+		for (auto const& result : results) {
+			linked_vertex_output_data.push_back({std::cref(result)});
+		}
+		auto const ret = get_mapping().map_output_data(
+		    linked_vertex_output_data, level->links(mapping_descriptor),
+		    level->references(mapping_descriptor), *level);
+		return dynamic_cast<CADCRecorder::Results const&>(*ret.at(0).at(0));
+	}
+};
+
+} // namespace
+
+TEST(CADCRecorderMapping, MapOutputData)
+{
+	constexpr size_t batch_size = 13;
+	constexpr size_t num_samples = 7;
+
+	MappedCADCRecording const recording({14, 60, 25, 150, 3});
+	auto const results = recording.get_results(batch_size, num_samples);
+
+	auto const mapped = recording.map_output_data(results);
+	ASSERT_EQ(mapped.samples.size(), batch_size);
+
+	// every recorded neuron is assigned exactly one distinct read-out column
+	std::set<int> values;
+	for (size_t b = 0; b < batch_size; ++b) {
+		ASSERT_EQ(mapped.samples.at(b).size(), recording.num_recorded_neurons);
+		for (size_t n = 0; n < recording.num_recorded_neurons; ++n) {
+			auto const& samples = mapped.samples.at(b).at(n);
+			ASSERT_EQ(samples.size(), num_samples);
+			for (size_t s = 0; s < num_samples; ++s) {
+				EXPECT_EQ(samples.at(s).first, grenade::vx::common::Time(s * 10));
+				EXPECT_EQ(samples.at(s).second, samples.at(0).second);
+			}
+			if (b == 0) {
+				values.insert(samples.at(0).second.value());
+			} else {
+				EXPECT_EQ(samples.at(0).second, mapped.samples.at(0).at(n).at(0).second);
+			}
+		}
+	}
+	EXPECT_EQ(values.size(), recording.num_recorded_neurons);
+
+	// repeated mapping yields the same result
+	EXPECT_EQ(recording.map_output_data(results).samples, mapped.samples);
+
+	// a copy of the mapping yields the same result
+	auto const mapping_copy = recording.get_mapping();
+	std::vector<std::vector<std::optional<std::reference_wrapper<PortData const>>>>
+	    linked_vertex_output_data;
+	for (auto const& result : results) {
+		linked_vertex_output_data.push_back({std::cref(result)});
+	}
+	auto const copy_mapped = mapping_copy.map_output_data(
+	    linked_vertex_output_data, recording.level->links(recording.mapping_descriptor),
+	    recording.level->references(recording.mapping_descriptor), *recording.level);
+	EXPECT_EQ(
+	    dynamic_cast<CADCRecorder::Results const&>(*copy_mapped.at(0).at(0)).samples,
+	    mapped.samples);
+	EXPECT_EQ(mapping_copy.slots, recording.get_mapping().slots);
+}
+
+TEST(CADCRecorderMapping, MapOutputDataTooManyValues)
+{
+	MappedCADCRecording const recording({14, 60, 25, 150, 3});
+
+	// the exception thrown within the parallel gathering of a batch entry is propagated
+	EXPECT_THROW(
+	    recording.map_output_data(recording.get_results(8, 3, 1)), std::out_of_range);
+
+	// the mapping stays usable afterwards
+	EXPECT_NO_THROW(recording.map_output_data(recording.get_results(8, 3)));
+}
@@ -0,0 +1,300 @@
+#include <gtest/gtest.h>
+
+#include "grenade/vx/network/abstract/mapping/plasticity_rule.h"
+
+#include "grenade/common/compartment_on_neuron.h"
+#include "grenade/common/connection_on_executor.h"
+#include "grenade/common/edge.h"
+#include "grenade/common/linked_topology.h"
+#include "grenade/common/multi_index.h"
+#include "grenade/common/multi_index_sequence/cuboid.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/cell_on_population.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/compartment_on_neuron.h"
+#include "grenade/common/population.h"
+#include "grenade/common/receptor_on_compartment.h"
+#include "grenade/common/time_domain_on_topology.h"
+#include "grenade/common/topology.h"
+#include "grenade/vx/execution/backend/initialized_connection.h"
+#include "grenade/vx/execution/backend/stateful_connection.h"
+#include "grenade/vx/execution/jit_graph_executor.h"
+#include "grenade/vx/network/abstract/calibration/fixture.h"
+#include "grenade/vx/network/abstract/mapper/greedy.h"
+#include "grenade/vx/network/abstract/mapping/locally_placed_neuron.h"
+#include "grenade/vx/network/abstract/multi_index_sequence_dimension_unit/atomic_neuron_on_compartment.h"
+#include "grenade/vx/network/abstract/plasticity_rule.h"
+#include "grenade/vx/network/abstract/population_cell/uncalibrated.h"
+#include "grenade/vx/network/receptor.h"
+#include "grenade/vx/signal_flow/vertex/neuron_view.h"
+#include "grenade/vx/signal_flow/vertex/plasticity_rule.h"
+#include "grenade/vx/signal_flow/vertex/synapse_array_view_sparse.h"
+#include "halco/hicann-dls/vx/v3/neuron.h"
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace halco::hicann_dls::vx::v3;
+using namespace grenade::vx::network;
+using namespace grenade::vx::network::abstract;
+using namespace grenade::common;
+
+namespace {
+
+/**
+ * Mapped topology of a population spanning both neuron rows with a per-neuron observable
+ * recorded by a plasticity rule.
+ */
+struct MappedPlasticityRuleRecording
+{
+	static constexpr char observable_name[] = "observable";
+
+	std::shared_ptr<LinkedTopology> mapped_topology;
+	LinkedTopology const* level;
+	InterTopologyHyperEdgeOnLinkedTopology mapping_descriptor;
+	size_t num_neurons;
+
+	MappedPlasticityRuleRecording(size_t num_neurons) : num_neurons(num_neurons)
+	{
+		auto topology = std::make_shared<Topology>();
+
+		Population population{
+		    UncalibratedNeuron{
+		        UncalibratedNeuron::Compartments{
+		            {CompartmentOnNeuron(),
+		             UncalibratedNeuron::Compartment{
+		                 UncalibratedNeuron::Compartment::SpikeMaster(0),
+		                 {{{ReceptorOnCompartment(0), Receptor::Type::excitatory}}}}}},
+		        LogicalNeuronCompartments(
+		            {{CompartmentOnLogicalNeuron(), {AtomicNeuronOnLogicalNeuron()}}})},
+		    CuboidMultiIndexSequence(
+		        {num_neurons}, MultiIndex({0}), {CellOnPopulationDimensionUnit()}),
+		    UncalibratedNeuron::ParameterSpace(num_neurons, {{CompartmentOnNeuron(), 1}}),
+		    TimeDomainOnTopology()};
+		auto const population_descriptor = topology->add_vertex(population);
+
+		PlasticityRule::TimedRecordingConfig recording;
+		recording.observables[observable_name] =
+		    PlasticityRule::TimedRecordingConfig::ObservablePerNeuron{
+		        PlasticityRule::TimedRecordingConfig::ObservablePerNeuron::Type::int16,
+		        PlasticityRule::TimedRecordingConfig::ObservablePerNeuron::Layout::
+		            packed_active_columns};
+
+		auto const& population_shape =
+		    dynamic_cast<Population const&>(topology->get(population_descriptor)).get_shape();
+		PlasticityRule plasticity_rule(
+		    recording, PlasticityRule::ID(), {population_shape}, {}, TimeDomainOnTopology());
+		auto const plasticity_rule_descriptor = topology->add_vertex(plasticity_rule);
+
+		topology->add_edge(
+		    population_descriptor, plasticity_rule_descriptor,
+		    Edge(
+		        CuboidMultiIndexSequence(
+		            {num_neurons, 1, 1},
+		            {CellOnPopulationDimensionUnit(), CompartmentOnNeuronDimensionUnit(),
+		             AtomicNeuronOnCompartmentDimensionUnit()}),
+		        population_shape, 1, 0));
+
+		std::map<ConnectionOnExecutor, grenade::vx::execution::backend::StatefulConnection>
+		    connections;
+		connections.emplace(
+		    ConnectionOnExecutor(),
+		    grenade::vx::execution::backend::StatefulConnection(
+		        grenade::vx::execution::backend::InitializedConnection(
+		            hxcomm::MultiConnection<hxcomm::vx::ZeroMockConnection>()),
+		        {{true}}));
+		grenade::vx::execution::JITGraphExecutor executor(std::move(connections));
+
+		FixtureCalibration const calibration;
+		mapped_topology =
+		    std::make_shared<LinkedTopology>(GreedyMapper()(topology, calibration, executor));
+
+		level = mapped_topology.get();
+		while (level) {
+			for (auto const& descriptor : level->inter_graph_hyper_edges()) {
+				if (dynamic_cast<PlasticityRuleMapping const*>(&level->get(descriptor))) {
+					mapping_descriptor = descriptor;
+					return;
+				}
+			}
+			level = dynamic_cast<LinkedTopology const*>(&level->get_reference());
+		}
+		throw std::runtime_error("Mapped topology doesn't contain plasticity rule mapping.");
+	}
+
+	PlasticityRuleMapping const& get_mapping() const
+	{
+		return dynamic_cast<PlasticityRuleMapping const&>(level->get(mapping_descriptor));
+	}
+
+	/**
+	 * Unique value of an atomic neuron used as its recorded value.
+	 */
+	static int16_t get_value(AtomicNeuronOnDLS const& atomic_neuron)
+	{
+		return static_cast<int16_t>(
+		    atomic_neuron.toNeuronRowOnDLS().value() * NeuronColumnOnDLS::size +
+		    atomic_neuron.toNeuronColumnOnDLS().value());
+	}
+
+	/**
+	 * Expected recorded value per neuron of the population given by its placement.
+	 */
+	std::vector<int16_t> get_expectation() const
+	{
+		std::vector<int16_t> ret(num_neurons);
+		std::set<size_t> neurons;
+		for (auto const& descriptor : level->inter_graph_hyper_edges()) {
+			auto const mapping =
+			    dynamic_cast<LocallyPlacedNeuronMapping const*>(&level->get(descriptor));
+			if (!mapping) {
+				continue;
+			}
+			for (auto const& [neuron, anchor] : mapping->anchors) {
+				ret.at(neuron) = get_value(anchor.second);
+				neurons.insert(neuron);
+			}
+		}
+		if (neurons.size() != num_neurons) {
+			throw std::runtime_error("Not every neuron of the population is placed.");
+		}
+		return ret;
+	}
+
+	/**
+	 * Get number of neuron views the population is recorded from.
+	 */
+	size_t get_num_neuron_views() const
+	{
+		auto const& linked_vertex_descriptor = level->links(mapping_descriptor).at(0);
+		size_t ret = 0;
+		for (auto const& in_edge : level->in_edges(linked_vertex_descriptor)) {
+			if (dynamic_cast<grenade::vx::signal_flow::vertex::NeuronView const*>(
+			        &level->get(level->source(in_edge)))) {
+				ret++;
+			}
+		}
+		return ret;
+	}
+
+	/**
+	 * Generate hardware results with the value of each recorded atomic neuron being unique.
+	 * @param batch_size Number of batch entries
+	 * @param num_samples Number of samples per batch entry
+	 */
+	grenade::vx::signal_flow::vertex::PlasticityRule::Results get_results(
+	    size_t batch_size, size_t num_samples) const
+	{
+		typedef std::vector<grenade::vx::common::TimedDataSequence<std::vector<int16_t>>> Data;
+
+		auto const& linked_vertex_descriptor = level->links(mapping_descriptor).at(0);
+		size_t num_synapse_vertices = 0;
+		for (auto const& in_edge : level->in_edges(linked_vertex_descriptor)) {
+			if (dynamic_cast<grenade::vx::signal_flow::vertex::SynapseArrayViewSparse const*>(
+			        &level->get(level->source(in_edge)))) {
+				num_synapse_vertices++;
+			}
+		}
+
+		std::map<size_t, Data> data_per_port;
+		for (auto const& in_edge : level->in_edges(linked_vertex_descriptor)) {
+			auto const neuron_view =
+			    dynamic_cast<grenade::vx::signal_flow::vertex::NeuronView const*>(
+			        &level->get(level->source(in_edge)));
+			if (!neuron_view) {
+				continue;
+			}
+			std::vector<int16_t> values;
+			for (auto const& column : neuron_view->get_columns()) {
+				values.push_back(get_value(AtomicNeuronOnDLS(column, neuron_view->row)));
+			}
+			Data data(batch_size);
+			for (auto& batch_entry : data) {
+				for (size_t s = 0; s < num_samples; ++s) {
+					batch_entry.emplace_back(grenade::vx::common::Time(s * 10), values);
+				}
+			}
+			data_per_port.emplace(
+			    level->get(in_edge).port_on_target - num_synapse_vertices, std::move(data));
+		}
+
+		grenade::vx::signal_flow::vertex::PlasticityRule::TimedRecordingData recording_data;
+		auto& entries = recording_data.data_per_neuron[observable_name];
+		for (auto& [port, data] : data_per_port) {
+			if (port != entries.size()) {
+				throw std::logic_error("Neuron view ports are not contiguous.");
+			}
+			entries.emplace_back(std::move(data));
+		}
+		return grenade::vx::signal_flow::vertex::PlasticityRule::Results(recording_data);
+	}
+
+	static PlasticityRule::Results::TimedData map_output_data(
+	    PlasticityRuleMapping const& mapping,
+	    LinkedTopology const& level,
+	    InterTopologyHyperEdgeOnLinkedTopology const& mapping_descriptor,
+	    grenade::vx::signal_flow::vertex::PlasticityRule::Results const& results)
+	{
+		std::vector<std::vector<std::optional<std::reference_wrapper<PortData const>>>>
+		    linked_vertex_output_data{{std::cref(results)}};
+		auto const ret = mapping.map_output_data(
+		    linked_vertex_output_data, level.links(mapping_descriptor),
+		    level.references(mapping_descriptor), level);
+		return std::get<PlasticityRule::Results::TimedData>(
+		    dynamic_cast<PlasticityRule::Results const&>(*ret.at(0).at(0)).data);
+	}
+
+	PlasticityRule::Results::TimedData map_output_data(
+	    grenade::vx::signal_flow::vertex::PlasticityRule::Results const& results) const
+	{
+		return map_output_data(get_mapping(), *level, mapping_descriptor, results);
+	}
+};
+
+} // namespace
+
+TEST(PlasticityRuleMapping, MapOutputDataPerNeuron)
+{
+	constexpr size_t batch_size = 3;
+	constexpr size_t num_samples = 5;
+
+	// more neurons than fit into a single neuron row
+	MappedPlasticityRuleRecording const recording(NeuronColumnOnDLS::size + 44);
+	ASSERT_EQ(recording.get_num_neuron_views(), NeuronRowOnDLS::size);
+
+	auto const expectation = recording.get_expectation();
+	auto const results = recording.get_results(batch_size, num_samples);
+
+	auto const mapped = recording.map_output_data(results);
+	auto const& data = std::get<std::vector<grenade::vx::common::TimedDataSequence<
+	    std::vector<std::map<CompartmentOnLogicalNeuron, std::vector<int16_t>>>>>>(
+	    mapped.data_per_neuron.at(MappedPlasticityRuleRecording::observable_name).at(0));
+
+	// every neuron is assigned the value recorded by the neuron view of its own row
+	ASSERT_EQ(data.size(), batch_size);
+	for (auto const& batch_entry : data) {
+		ASSERT_EQ(batch_entry.size(), num_samples);
+		for (size_t s = 0; s < num_samples; ++s) {
+			EXPECT_EQ(batch_entry.at(s).time, grenade::vx::common::Time(s * 10));
+			ASSERT_EQ(batch_entry.at(s).data.size(), recording.num_neurons);
+			for (size_t n = 0; n < recording.num_neurons; ++n) {
+				EXPECT_EQ(
+				    batch_entry.at(s).data.at(n).at(CompartmentOnLogicalNeuron()),
+				    std::vector<int16_t>{expectation.at(n)});
+			}
+		}
+	}
+
+	// repeated mapping yields the same result
+	EXPECT_EQ(recording.map_output_data(results), mapped);
+
+	// a copy of the mapping shares the table and yields the same result
+	auto const mapping_copy = recording.get_mapping();
+	EXPECT_EQ(
+	    MappedPlasticityRuleRecording::map_output_data(
+	        mapping_copy, *recording.level, recording.mapping_descriptor, results),
+	    mapped);
+}
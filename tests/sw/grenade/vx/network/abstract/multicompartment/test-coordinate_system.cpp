@@ -1,11 +1,96 @@
 #include "grenade/vx/network/abstract/multicompartment/neuron.h"
 #include "grenade/vx/network/abstract/multicompartment/placement/coordinate_system.h"
+#include "grenade/vx/network/abstract/multicompartment/placement/coordinate_system_bitboard.h"
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <random>
 
 using namespace grenade::vx::network::abstract;
 
+namespace {
+
+/**
+ * Check for connections with open ends per neuron circuit.
+ */
+bool has_empty_connections_scalar(CoordinateSystem const& coordinates, size_t x_max)
+{
+	auto const& cs = coordinates.coordinate_system;
+	for (size_t x = 0; x < x_max; x++) {
+		for (size_t y = 0; y < 2; y++) {
+			bool const on_shared_line =
+			    cs[y][x].switch_circuit_shared || cs[y][x].switch_circuit_shared_conductance;
+			bool const shared_left = x != 0 && cs[y][x - 1].switch_shared_right;
+			if ((cs[y][x].switch_top_bottom && !cs[1 - y][x].switch_top_bottom) ||
+			    (on_shared_line && !(cs[y][x].switch_shared_right || shared_left)) ||
+			    (cs[y][x].switch_shared_right &&
+			     (!(cs[y][x + 1].switch_circuit_shared ||
+			        cs[y][x + 1].switch_circuit_shared_conductance ||
+			        cs[y][x + 1].switch_shared_right) ||
+			      !(on_shared_line || shared_left)))) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/**
+ * Check for connections both directly and via shared line per neuron circuit.
+ */
+bool has_double_connections_scalar(CoordinateSystem const& coordinates, size_t x_max)
+{
+	for (size_t x = 0; x < x_max; x++) {
+		for (size_t y = 0; y < 2; y++) {
+			if (coordinates.connected_right(x, y) && coordinates.connected_right_shared(x, y)) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/**
+ * Check for neuron circuits connected via conductance and directly to the shared line per neuron
+ * circuit.
+ */
+bool double_switch_scalar(CoordinateSystem const& coordinates, size_t x_max)
+{
+	for (size_t y = 0; y < 2; y++) {
+		for (size_t x = 0; x < x_max; x++) {
+			if (coordinates.coordinate_system[y][x].switch_circuit_shared &&
+			    coordinates.coordinate_system[y][x].switch_circuit_shared_conductance) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/**
+ * Check for short circuited compartments by walking along the shared line per neuron circuit.
+ */
+bool short_circuit_scalar(CoordinateSystem const& coordinates, size_t x_max)
+{
+	auto const& cs = coordinates.coordinate_system;
+	for (size_t y = 0; y < 2; y++) {
+		for (size_t x = 0; x < x_max; x++) {
+			if (!cs[y][x].switch_circuit_shared || !cs[y][x].compartment) {
+				continue;
+			}
+			for (size_t x_temp = x; cs[y][x_temp].switch_shared_right; x_temp++) {
+				if (cs[y][x_temp].switch_circuit_shared && cs[y][x_temp].compartment &&
+				    cs[y][x_temp].compartment != cs[y][x].compartment) {
+					return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
+} // namespace
+
 
 TEST(MulticompartmentPlacementCoordinates, BaseTest)
 {
@@ -304,3 +389,134 @@ TEST(MulticompartmentPlacementCoordiantes, EmptyConnections)
 	EXPECT_EQ(coordinates[0][2].switch_circuit_shared, 1);
 	EXPECT_EQ(coordinates[0][3].switch_circuit_shared_conductance, 1);
 }
+
+
+TEST(MulticompartmentPlacementCoordinates, Bitboard)
+{
+	std::mt19937 gen(1234);
+
+	for (size_t i = 0; i < 100; i++) {
+		CoordinateSystem coordinates;
+		std::bernoulli_distribution switch_distribution(
+		    std::uniform_real_distribution<>(0.05, 0.5)(gen));
+		for (size_t y = 0; y < 2; y++) {
+			for (size_t x = 0; x < 255; x++) {
+				coordinates[y][x].switch_shared_right = switch_distribution(gen);
+				coordinates[y][x].switch_right = switch_distribution(gen);
+				coordinates[y][x].switch_top_bottom = switch_distribution(gen);
+				coordinates[y][x].switch_circuit_shared = switch_distribution(gen);
+				coordinates[y][x].switch_circuit_shared_conductance = switch_distribution(gen);
+			}
+		}
+
+		CoordinateSystemBitboard const bitboard(coordinates);
+
+		// Connection detection matches detection per neuron circuit
+		auto const connected = bitboard.connected();
+		for (size_t y = 0; y < 2; y++) {
+			for (size_t x = 0; x < 256; x++) {
+				EXPECT_EQ(connected[y].test(x), coordinates.connected(x, y));
+			}
+		}
+
+		// Components match assignment of compartments via direct connections
+		auto const components = bitboard.components(true);
+		CoordinateSystem assigned = coordinates;
+		grenade::common::CompartmentOnNeuron compartment;
+		for (size_t y = 0; y < 2; y++) {
+			for (size_t x = 0; x < 256; x++) {
+				if (!assigned[y][x].compartment &&
+				    (assigned.connected_to_shared_line(x, y) || assigned.connected_right(x, y) ||
+				     assigned.connected_top_bottom(x, y))) {
+					assigned.assign_compartment_direct(x, y, compartment);
+					compartment += grenade::common::CompartmentOnNeuron(1);
+				}
+			}
+		}
+		ASSERT_EQ(components.size(), compartment.value());
+		for (size_t c = 0; c < components.size(); c++) {
+			for (size_t y = 0; y < 2; y++) {
+				for (size_t x = 0; x < 256; x++) {
+					EXPECT_EQ(
+					    components.at(c)[y].test(x),
+					    assigned[y][x].compartment ==
+					        grenade::common::CompartmentOnNeuron(c));
+				}
+			}
+		}
+	}
+}
+
+
+TEST(MulticompartmentPlacementCoordinates, BitboardQueries)
+{
+	std::mt19937 gen(4321);
+	std::uniform_int_distribution<size_t> x_max_distribution(0, 255);
+	std::uniform_int_distribution<size_t> compartment_distribution(0, 3);
+
+	for (size_t i = 0; i < 200; i++) {
+		CoordinateSystem coordinates;
+		std::bernoulli_distribution switch_distribution(
+		    std::uniform_real_distribution<>(0.01, 0.3)(gen));
+		for (size_t y = 0; y < 2; y++) {
+			for (size_t x = 0; x < 255; x++) {
+				coordinates[y][x].switch_shared_right = switch_distribution(gen);
+				coordinates[y][x].switch_right = switch_distribution(gen);
+				coordinates[y][x].switch_top_bottom = switch_distribution(gen);
+				coordinates[y][x].switch_circuit_shared = switch_distribution(gen);
+				coordinates[y][x].switch_circuit_shared_conductance = switch_distribution(gen);
+				if (auto const compartment = compartment_distribution(gen); compartment != 0) {
+					coordinates.set_compartment(
+					    x, y, grenade::common::CompartmentOnNeuron(compartment));
+				}
+			}
+		}
+
+		for (size_t j = 0; j < 5; j++) {
+			auto const x_max = x_max_distribution(gen);
+			EXPECT_EQ(
+			    coordinates.has_empty_connections(x_max),
+			    has_empty_connections_scalar(coordinates, x_max));
+			EXPECT_EQ(
+			    coordinates.has_double_connections(x_max),
+			    has_double_connections_scalar(coordinates, x_max));
+			EXPECT_EQ(coordinates.double_switch(x_max), double_switch_scalar(coordinates, x_max));
+			EXPECT_EQ(coordinates.short_circuit(x_max), short_circuit_scalar(coordinates, x_max));
+		}
+	}
+}
+
+TEST(MulticompartmentPlacementCoordinates, BitboardInvalidation)
+{
+	CoordinateSystem coordinates;
+	EXPECT_FALSE(coordinates.double_switch(255));
+	EXPECT_FALSE(coordinates.has_empty_connections(255));
+
+	// modification via operator[]
+	coordinates[0][3].switch_circuit_shared = true;
+	coordinates[0][3].switch_circuit_shared_conductance = true;
+	EXPECT_TRUE(coordinates.double_switch(255));
+	EXPECT_TRUE(coordinates.has_empty_connections(255));
+
+	// modification via set_config
+	coordinates.set_config(3, 0, UnplacedNeuronCircuit());
+	EXPECT_FALSE(coordinates.double_switch(255));
+	EXPECT_FALSE(coordinates.has_empty_connections(255));
+
+	// modification via connect_shared
+	coordinates.connect_shared(2, 5, 1);
+	EXPECT_FALSE(coordinates.has_empty_connections(255));
+	EXPECT_EQ(coordinates.get_extent(), 4);
+
+	// copies keep their own representation
+	CoordinateSystem copy = coordinates;
+	copy.clear();
+	EXPECT_EQ(copy.get_extent(), 0);
+	EXPECT_EQ(coordinates.get_extent(), 4);
+
+	// modification via clear_invalid_connections
+	coordinates[1][4].switch_shared_right = false;
+	coordinates.clear_invalid_connections(255);
+	EXPECT_FALSE(coordinates.has_empty_connections(255));
+	EXPECT_EQ(coordinates.get_extent(), 0);
+}
@@ -1,4 +1,6 @@
 #include "grenade/vx/network/abstract/multicompartment/placement/algorithm_brute_force.h"
+#include "grenade/vx/network/abstract/multicompartment/neuron_generator.h"
+#include "grenade/vx/network/abstract/multicompartment/resource_manager.h"
 #include "grenade/vx/test_helper/multicompartment_common_test_function.h"
 
 #include <string>
@@ -27,3 +29,29 @@ TEST(MulticompartmentNeuron, RandomNeuronsBruteForce)
 	    file_name, logger, num_runs, max_num_compartments, max_num_synaptic_inputs,
 	    algorithm.clone());
 }
+
+TEST(MulticompartmentNeuron, BruteForceDeterministic)
+{
+	NeuronGenerator neuron_generator(1234);
+	for (size_t num_compartments = 1; num_compartments <= 3; ++num_compartments) {
+		auto const generated =
+		    neuron_generator.generate(num_compartments, num_compartments - 1, 10, false, true);
+		ResourceManager resources;
+		resources.add_config(generated.neuron, generated.parameter_space, generated.environment);
+
+		PlacementAlgorithmBruteForce sequential(60);
+		sequential.parallel_runs = 1;
+		auto const reference = sequential.run(CoordinateSystem(), generated.neuron, resources);
+		ASSERT_TRUE(reference.finished);
+
+		// result is independent of the number of threads and of repetition
+		for (size_t parallel_runs : {0, 1, 2, 8, 8}) {
+			PlacementAlgorithmBruteForce parallel(60);
+			parallel.parallel_runs = parallel_runs;
+			auto const result = parallel.run(CoordinateSystem(), generated.neuron, resources);
+			EXPECT_TRUE(result.finished);
+			EXPECT_EQ(result.coordinate_system, reference.coordinate_system)
+			    << "parallel_runs: " << parallel_runs;
+		}
+	}
+}
@@ -1,6 +1,9 @@
 #include "grenade/vx/network/abstract/multicompartment/placement/algorithm_evolutionary.h"
+#include "grenade/vx/network/abstract/multicompartment/neuron_generator.h"
+#include "grenade/vx/network/abstract/multicompartment/resource_manager.h"
 #include "grenade/vx/test_helper/multicompartment_common_test_function.h"
 
+#include <algorithm>
 #include <future>
 #include <vector>
 
@@ -131,4 +134,75 @@ TEST(MulticompartmentNeuron, RandomNeuronsEvolutionary)
 	LOG4CXX_INFO(
 	    logger,
 	    "Finished multicompartment placement test with evolutionary algorithm succesfully.");
-}
\ No newline at end of file
+}
+TEST(MulticompartmentNeuron, EvolutionaryMemoization)
+{
+	NeuronGenerator neuron_generator(1234);
+	auto const generated = neuron_generator.generate(3, 2, 10, false, true);
+	ResourceManager resources;
+	resources.add_config(generated.neuron, generated.parameter_space, generated.environment);
+
+	auto run_parameters = EvolutionaryParameters();
+	run_parameters.p_mutate_individual = 0.4;
+	run_parameters.p_mutate_gene = 0.01;
+	run_parameters.p_mutate_initial = 0.8;
+	run_parameters.p_shift = 0.1;
+	run_parameters.p_add = 0.1;
+	run_parameters.p_remove = 0.1;
+	run_parameters.p_mate = 0.2;
+	run_parameters.seed = 4321;
+	run_parameters.x_max = 10;
+	run_parameters.population_size = 200;
+	run_parameters.time_limit = 10;
+	run_parameters.run_limit = 1;
+	run_parameters.tournament_contestants = 2;
+	run_parameters.mating_block_size = 3 * run_parameters.x_max;
+	run_parameters.min_shift = 1;
+	run_parameters.max_shift = 4;
+	run_parameters.together_add_remove = false;
+	run_parameters.number_columns_add_remove = 1;
+	run_parameters.lower_limit_add_remove = 1;
+	run_parameters.upper_limit_add_remove = run_parameters.x_max - 1;
+	run_parameters.number_hall_of_fame = 0.05 * run_parameters.population_size;
+	run_parameters.parallel_threads = 4;
+
+	auto const expect_equal_runs = [](PlacementAlgorithmEvolutionary const& algorithm,
+	                                  PlacementAlgorithmEvolutionary const& reference) {
+		auto const best_in_pops = algorithm.get_best_in_pops();
+		auto const reference_best_in_pops = reference.get_best_in_pops();
+		auto const result = algorithm.get_final_result();
+		auto const reference_result = reference.get_final_result();
+
+		// generations are equal up to the one where either run stopped
+		size_t const num_generations =
+		    std::min(best_in_pops.size(), reference_best_in_pops.size());
+		ASSERT_GT(num_generations, 0);
+		for (size_t i = 0; i < num_generations; ++i) {
+			EXPECT_EQ(best_in_pops.at(i), reference_best_in_pops.at(i));
+		}
+		if (result.finished && reference_result.finished) {
+			EXPECT_EQ(best_in_pops.size(), reference_best_in_pops.size());
+			EXPECT_EQ(result.coordinate_system, reference_result.coordinate_system);
+		}
+	};
+
+	PlacementAlgorithmEvolutionary memoized(run_parameters);
+	memoized.run(CoordinateSystem(), generated.neuron, resources);
+
+	// memoization doesn't alter the result
+	run_parameters.memoize_fitness = false;
+	PlacementAlgorithmEvolutionary unmemoized(run_parameters);
+	unmemoized.run(CoordinateSystem(), generated.neuron, resources);
+	expect_equal_runs(memoized, unmemoized);
+
+	// copy starts with empty memoization and yields the same result
+	PlacementAlgorithmEvolutionary copy(memoized);
+	EXPECT_EQ(copy.get_best_in_pops(), memoized.get_best_in_pops());
+	copy.reset();
+	copy.run(CoordinateSystem(), generated.neuron, resources);
+	expect_equal_runs(copy, memoized);
+
+	// assignment replaces state and memoization
+	unmemoized = memoized;
+	EXPECT_EQ(unmemoized.get_best_in_pops(), memoized.get_best_in_pops());
+}
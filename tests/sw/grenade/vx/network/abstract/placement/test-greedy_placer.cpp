@@ -0,0 +1,247 @@
+#include <gtest/gtest.h>
+
+#include "grenade/common/connection_on_executor.h"
+#include "grenade/common/edge.h"
+#include "grenade/common/multi_index.h"
+#include "grenade/common/multi_index_sequence/cuboid.h"
+#include "grenade/common/multi_index_sequence/list.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/cell_on_population.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/compartment_on_neuron.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/receptor_on_compartment.h"
+#include "grenade/common/population.h"
+#include "grenade/common/projection.h"
+#include "grenade/common/projection_connector/sequence.h"
+#include "grenade/common/receptor_on_compartment.h"
+#include "grenade/common/time_domain_on_topology.h"
+#include "grenade/common/topology.h"
+#include "grenade/common/topology_rewrite/add_linked_topology.h"
+#include "grenade/common/topology_rewrite/execution_instance.h"
+#include "grenade/common/topology_rewrite/identity_replacement.h"
+#include "grenade/common/topology_rewrite/population.h"
+#include "grenade/common/topology_rewrite/projection.h"
+#include "grenade/common/topology_rewrite/recorder.h"
+#include "grenade/common/vertex_on_topology.h"
+#include "grenade/vx/network/abstract/mapped_topology_rewrite/placement.h"
+#include "grenade/vx/network/abstract/placement/greedy_placer.h"
+#include "grenade/vx/network/abstract/population_cell/uncalibrated.h"
+#include "grenade/vx/network/abstract/projection_synapse/uncalibrated.h"
+#include "grenade/vx/network/abstract/resource_estimator/population.h"
+#include "grenade/vx/network/abstract/topology_rewrite/plasticity_rule.h"
+#include "grenade/vx/network/build_connection_routing.h"
+#include "grenade/vx/network/exception.h"
+#include "grenade/vx/network/routing/greedy/routing_constraints.h"
+#include "grenade/vx/network/routing/greedy_router.h"
+#include <algorithm>
+#include <random>
+
+using namespace grenade::common;
+using namespace grenade::vx::network;
+using namespace grenade::vx::network::abstract;
+using namespace grenade::vx::network::routing::greedy;
+using namespace halco::hicann_dls::vx::v3;
+using namespace halco::common;
+
+namespace {
+
+std::shared_ptr<LinkedTopology> get_placed_topology(
+    std::shared_ptr<Topology> const& topology, GreedyPlacer::Mode const mode)
+{
+	auto mapped_topology = std::make_shared<LinkedTopology>(topology);
+	assert(mapped_topology);
+
+	{
+		IdentityReplacementTopologyRewrite copy_rewrite(mapped_topology);
+		copy_rewrite();
+	}
+
+	{
+		PopulationResourceEstimator population_resource_estimator(*mapped_topology, {});
+		PopulationResourceEstimator::Resource population_system_resources(
+		    AtomicNeuronOnDLS::size, PADIBusOnPADIBusBlock::size, {2});
+
+		ExecutionInstanceTopologyRewrite::SystemResources executor_system_resources;
+		executor_system_resources.emplace(ConnectionOnExecutor(), population_system_resources);
+
+		PopulationTopologyRewrite population_rewrite(
+		    population_resource_estimator, executor_system_resources, mapped_topology);
+		population_rewrite();
+
+		RecorderTopologyRewrite recorder_rewrite(mapped_topology);
+		recorder_rewrite();
+
+		PlasticityRuleRewrite plasticity_rule_rewrite(mapped_topology);
+		plasticity_rule_rewrite();
+
+		ProjectionTopologyRewrite projection_rewrite(mapped_topology);
+		projection_rewrite();
+
+		ExecutionInstanceTopologyRewrite execution_instance_rewrite(
+		    population_resource_estimator, executor_system_resources, mapped_topology);
+		execution_instance_rewrite();
+	}
+
+	GreedyPlacer placer;
+	placer.set_mode(mode);
+	auto placement_result = placer(*mapped_topology);
+
+	{
+		AddLinkedTopologyRewrite add_linked_topology(mapped_topology);
+		add_linked_topology();
+	}
+
+	PlacementRewrite placement_rewrite(std::move(placement_result), mapped_topology);
+	placement_rewrite();
+
+	return mapped_topology;
+}
+
+/**
+ * Random network of equally-sized populations with sparse random projections between them.
+ */
+std::shared_ptr<Topology> get_random_network(
+    size_t num_populations,
+    size_t population_size,
+    double projection_probability,
+    double connection_probability,
+    std::mt19937& rng)
+{
+	auto topology = std::make_shared<Topology>();
+
+	std::vector<VertexOnTopology> populations;
+	for (size_t p = 0; p < num_populations; ++p) {
+		Population population{
+		    UncalibratedNeuron{
+		        UncalibratedNeuron::Compartments{
+		            {CompartmentOnNeuron(),
+		             UncalibratedNeuron::Compartment{
+		                 UncalibratedNeuron::Compartment::SpikeMaster(0),
+		                 {{
+		                     {ReceptorOnCompartment(0), Receptor::Type::excitatory},
+		                 }}}}},
+		        LogicalNeuronCompartments(
+		            {{CompartmentOnLogicalNeuron(), {AtomicNeuronOnLogicalNeuron()}}})},
+		    CuboidMultiIndexSequence(
+		        {population_size}, MultiIndex({0}), {CellOnPopulationDimensionUnit()}),
+		    UncalibratedNeuron::ParameterSpace(population_size, {{CompartmentOnNeuron(), 1}}),
+		    TimeDomainOnTopology()};
+		populations.push_back(topology->add_vertex(population));
+	}
+
+	std::bernoulli_distribution projection_distribution(projection_probability);
+	std::bernoulli_distribution connection_distribution(connection_probability);
+	for (auto const& source : populations) {
+		for (auto const& target : populations) {
+			if (!projection_distribution(rng)) {
+				continue;
+			}
+			std::vector<MultiIndex> connections;
+			for (size_t i = 0; i < population_size; ++i) {
+				for (size_t j = 0; j < population_size; ++j) {
+					if (connection_distribution(rng)) {
+						connections.push_back(MultiIndex({i, j}));
+					}
+				}
+			}
+			if (connections.empty()) {
+				continue;
+			}
+			UncalibratedSynapse::ParameterSpace parameter_space{
+			    std::vector<UncalibratedSynapse::Weight>(
+			        connections.size(), UncalibratedSynapse::Weight(63))};
+			Projection projection(
+			    UncalibratedSynapse{}, std::move(parameter_space),
+			    SequenceConnector{
+			        CuboidMultiIndexSequence({population_size}),
+			        CuboidMultiIndexSequence({population_size}),
+			        ListMultiIndexSequence(std::move(connections))},
+			    TimeDomainOnTopology());
+			auto const projection_descriptor = topology->add_vertex(projection);
+
+			topology->add_edge(
+			    source, projection_descriptor,
+			    Edge(
+			        CuboidMultiIndexSequence(
+			            {population_size, 1}, MultiIndex({0, 0}),
+			            {CellOnPopulationDimensionUnit(), CompartmentOnNeuronDimensionUnit()}),
+			        CuboidMultiIndexSequence({population_size}), 0, 0));
+			topology->add_edge(
+			    projection_descriptor, target,
+			    Edge(
+			        CuboidMultiIndexSequence({population_size}),
+			        CuboidMultiIndexSequence(
+			            {population_size, 1, 1}, MultiIndex({0, 0, 0}),
+			            {CellOnPopulationDimensionUnit(), CompartmentOnNeuronDimensionUnit(),
+			             ReceptorOnCompartmentDimensionUnit()}),
+			        0, 0));
+		}
+	}
+	return topology;
+}
+
+size_t get_max_num_synapse_rows_per_padi_bus(LinkedTopology const& mapped_topology)
+{
+	std::vector<VertexOnTopology> partitioned_vertex_descriptors;
+	for (auto const& partitioned_vertex_descriptor : mapped_topology.get_reference().vertices()) {
+		partitioned_vertex_descriptors.emplace_back(partitioned_vertex_descriptor);
+	}
+
+	auto const connection_routing_result =
+	    build_connection_routing(mapped_topology, partitioned_vertex_descriptors);
+	RoutingConstraints constraints(
+	    mapped_topology, partitioned_vertex_descriptors, connection_routing_result);
+	auto const num_synapse_rows = constraints.get_num_synapse_rows_per_padi_bus();
+	return *std::max_element(num_synapse_rows.begin(), num_synapse_rows.end());
+}
+
+/**
+ * Get whether the placed topology is routed successfully by the default router.
+ */
+bool is_routable(LinkedTopology const& mapped_topology)
+{
+	try {
+		routing::GreedyRouter router;
+		router(mapped_topology);
+	} catch (UnsuccessfulRouting const&) {
+		return false;
+	}
+	return true;
+}
+
+} // namespace
+
+
+TEST(GreedyPlacer, ConnectivityAware)
+{
+	constexpr size_t num_networks_per_density = 5;
+
+	std::mt19937 rng(1234);
+
+	size_t num_synapse_rows_permutation = 0;
+	size_t num_synapse_rows_connectivity_aware = 0;
+	size_t num_routed_permutation = 0;
+	size_t num_routed_connectivity_aware = 0;
+	// connection densities from well below to above the limit of routability, so that both
+	// placement modes route some networks and fail to route others
+	for (double const connection_probability : {0.05, 0.1, 0.15, 0.2}) {
+		for (size_t n = 0; n < num_networks_per_density; ++n) {
+			auto const topology = get_random_network(8, 48, 0.5, connection_probability, rng);
+
+			auto const mapped_topology_permutation =
+			    get_placed_topology(topology, GreedyPlacer::Mode::permutation);
+			auto const mapped_topology_connectivity_aware =
+			    get_placed_topology(topology, GreedyPlacer::Mode::connectivity_aware);
+
+			num_synapse_rows_permutation +=
+			    get_max_num_synapse_rows_per_padi_bus(*mapped_topology_permutation);
+			num_synapse_rows_connectivity_aware +=
+			    get_max_num_synapse_rows_per_padi_bus(*mapped_topology_connectivity_aware);
+
+			num_routed_permutation += is_routable(*mapped_topology_permutation);
+			num_routed_connectivity_aware += is_routable(*mapped_topology_connectivity_aware);
+		}
+	}
+
+	EXPECT_LE(num_synapse_rows_connectivity_aware, num_synapse_rows_permutation);
+	EXPECT_GT(num_routed_connectivity_aware, 0);
+	EXPECT_GT(num_routed_connectivity_aware, num_routed_permutation);
+}
@@ -0,0 +1,314 @@
+#include "grenade/vx/network/abstract/data_archive.h"
+
+#include "grenade/common/input_data.h"
+#include "grenade/vx/network/abstract/clock_cycle_time_domain_runtimes.h"
+#include "grenade/vx/network/abstract/population_cell/external_source.h"
+#include "grenade/vx/network/abstract/recorder/cadc.h"
+#include "grenade/vx/network/abstract/recorder/madc.h"
+#include "grenade/vx/network/abstract/recorder/spike.h"
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <cereal/archives/portable_binary.hpp>
+#include <cereal/types/base_class.hpp>
+#include <cereal/types/polymorphic.hpp>
+#include <cereal/types/vector.hpp>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+using namespace grenade::vx::network::abstract;
+using grenade::common::PortOnTopology;
+using grenade::common::VertexOnTopology;
+using grenade::vx::common::Time;
+
+namespace data_archive_test {
+
+/**
+ * Port data without columnar representation, which is stored via cereal.
+ */
+struct ValuePortData : public grenade::common::PortData
+{
+	ValuePortData(std::vector<int> values = {}) : values(std::move(values)) {}
+
+	std::vector<int> values;
+
+	virtual std::unique_ptr<grenade::common::PortData> copy() const override
+	{
+		return std::make_unique<ValuePortData>(*this);
+	}
+
+	virtual std::unique_ptr<grenade::common::PortData> move() override
+	{
+		return std::make_unique<ValuePortData>(std::move(*this));
+	}
+
+	virtual bool is_equal_to(grenade::common::PortData const& other) const override
+	{
+		return values == static_cast<ValuePortData const&>(other).values;
+	}
+
+	virtual std::ostream& print(std::ostream& os) const override
+	{
+		return os << "ValuePortData(" << values.size() << ")";
+	}
+
+	template <typename Archive>
+	void serialize(Archive& ar, std::uint32_t const)
+	{
+		ar(cereal::base_class<grenade::common::PortData>(this), values);
+	}
+};
+
+} // namespace data_archive_test
+
+CEREAL_REGISTER_TYPE(data_archive_test::ValuePortData)
+CEREAL_REGISTER_POLYMORPHIC_RELATION(grenade::common::PortData, data_archive_test::ValuePortData)
+
+namespace {
+
+/**
+ * Get path of temporary file unique to the process.
+ * @param name Name of file
+ */
+std::filesystem::path get_temporary_path(std::string const& name)
+{
+	return std::filesystem::temp_directory_path() /
+	       ("grenade-test-" + std::to_string(::getpid()) + "-" + name);
+}
+
+/**
+ * Time-domain runtimes without support in the data archive.
+ */
+struct UnsupportedTimeDomainRuntimes : public grenade::common::TimeDomainRuntimes
+{
+	virtual size_t batch_size() const override
+	{
+		return 1;
+	}
+
+	virtual std::unique_ptr<grenade::common::TimeDomainRuntimes> copy() const override
+	{
+		return std::make_unique<UnsupportedTimeDomainRuntimes>(*this);
+	}
+
+	virtual std::unique_ptr<grenade::common::TimeDomainRuntimes> move() override
+	{
+		return std::make_unique<UnsupportedTimeDomainRuntimes>(std::move(*this));
+	}
+
+protected:
+	virtual bool is_equal_to(grenade::common::TimeDomainRuntimes const&) const override
+	{
+		return true;
+	}
+
+	virtual std::ostream& print(std::ostream& os) const override
+	{
+		return os << "UnsupportedTimeDomainRuntimes()";
+	}
+};
+
+} // namespace
+
+TEST(DataArchive, WriteRead)
+{
+	auto const path = get_temporary_path("data_archive");
+	std::filesystem::remove(path);
+
+	SpikeRecorder::Results spikes(SpikeRecorder::Results::Spikes{
+	    {{Time(1), Time(5)}, {}, {Time(3)}}, {{}, {Time(2), Time(4), Time(8)}, {}}});
+
+	MADCRecorder::Results madc(MADCRecorder::Results::Samples{
+	    {{{Time(1), grenade::vx::signal_flow::MADCSampleFromChip::Value(12)},
+	      {Time(2), grenade::vx::signal_flow::MADCSampleFromChip::Value(400)}}}});
+
+	CADCRecorder::Results cadc(CADCRecorder::Results::Samples{
+	    {{{Time(7), grenade::vx::signal_flow::Int8(-3)}},
+	     {{Time(9), grenade::vx::signal_flow::Int8(100)}}}});
+
+	ExternalSourceNeuron::Dynamics external_source(ExternalSourceNeuron::Dynamics::SpikeTimes{
+	    {{Time(10)}, {Time(11), Time(12)}}, {{}, {}}, {{Time(13)}, {}}});
+
+	PortOnTopology const spikes_port(VertexOnTopology(3), 0);
+	PortOnTopology const madc_port(VertexOnTopology(1), 0);
+	PortOnTopology const cadc_port(VertexOnTopology(5), 1);
+	PortOnTopology const external_source_port(VertexOnTopology(2), 0);
+
+	{
+		DataArchiveWriter writer(path.string());
+		writer.write(spikes_port, spikes);
+		writer.write(madc_port, madc);
+		EXPECT_THROW(writer.write(madc_port, madc), std::runtime_error);
+
+		grenade::common::Data data;
+		data.ports.set(cadc_port, cadc);
+		data.ports.set(external_source_port, external_source);
+		writer.write(data);
+		writer.close();
+		EXPECT_THROW(writer.write(spikes_port, spikes), std::runtime_error);
+	}
+
+	DataArchiveReader reader(path.string());
+	EXPECT_EQ(
+	    reader.get_ports(),
+	    (std::vector<PortOnTopology>{spikes_port, madc_port, cadc_port, external_source_port}));
+	EXPECT_EQ(reader.get_type(spikes_port), DataArchive::Type::spike_recorder_results);
+	EXPECT_EQ(reader.get_type(madc_port), DataArchive::Type::madc_recorder_results);
+	EXPECT_EQ(reader.get_type(cadc_port), DataArchive::Type::cadc_recorder_results);
+	EXPECT_EQ(reader.get_type(external_source_port), DataArchive::Type::external_source_dynamics);
+	EXPECT_THROW(reader.get_type(PortOnTopology(VertexOnTopology(3), 1)), std::out_of_range);
+
+	auto const events = reader.get_events(spikes_port);
+	EXPECT_EQ(events.outer_size, 2);
+	EXPECT_EQ(events.inner_size, 3);
+	EXPECT_EQ(
+	    std::vector<uint64_t>(events.offsets.begin(), events.offsets.end()),
+	    (std::vector<uint64_t>{0, 2, 2, 3, 3, 6, 6}));
+	EXPECT_EQ(
+	    std::vector<uint64_t>(events.times.begin(), events.times.end()),
+	    (std::vector<uint64_t>{1, 5, 3, 2, 4, 8}));
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(events.times.data()) % 64, 0);
+
+	auto const madc_events = reader.get_events(madc_port);
+	EXPECT_EQ(
+	    std::vector<DataArchive::MADCValue>(
+	        madc_events.madc_values.begin(), madc_events.madc_values.end()),
+	    (std::vector<DataArchive::MADCValue>{12, 400}));
+
+	auto const read_spikes = reader.read(spikes_port);
+	ASSERT_TRUE(read_spikes);
+	EXPECT_EQ(*read_spikes, spikes);
+	auto const read_madc = reader.read(madc_port);
+	ASSERT_TRUE(read_madc);
+	EXPECT_EQ(*read_madc, madc);
+
+	grenade::common::Data data;
+	reader.read(data);
+	EXPECT_TRUE(data.ports.contains(spikes_port));
+	EXPECT_TRUE(data.ports.contains(madc_port));
+	EXPECT_EQ(data.ports.get(cadc_port), cadc);
+	EXPECT_EQ(data.ports.get(external_source_port), external_source);
+
+	std::filesystem::remove(path);
+}
+
+TEST(DataArchive, Invalid)
+{
+	auto const path = get_temporary_path("data_archive_invalid");
+
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file << "corrupted";
+	}
+	EXPECT_THROW(DataArchiveReader(path.string()), std::runtime_error);
+
+	// non-homogeneous shape
+	{
+		DataArchiveWriter writer(path.string());
+		SpikeRecorder::Results spikes(
+		    SpikeRecorder::Results::Spikes{{{Time(1)}, {}}, {{Time(2)}}});
+		EXPECT_THROW(
+		    writer.write(PortOnTopology(VertexOnTopology(0), 0), spikes), std::runtime_error);
+		// rejected data leaves the archive unchanged
+		writer.write(
+		    PortOnTopology(VertexOnTopology(0), 0),
+		    SpikeRecorder::Results(SpikeRecorder::Results::Spikes{{{Time(1)}}, {{Time(2)}}}));
+	}
+	{
+		DataArchiveReader reader(path.string());
+		EXPECT_EQ(
+		    reader.get_ports(),
+		    (std::vector<PortOnTopology>{PortOnTopology(VertexOnTopology(0), 0)}));
+		EXPECT_EQ(
+		    reader.get_type(PortOnTopology(VertexOnTopology(0), 0)),
+		    DataArchive::Type::spike_recorder_results);
+	}
+
+	std::filesystem::remove(path);
+	EXPECT_THROW(DataArchiveReader(path.string()), std::runtime_error);
+}
+
+TEST(DataArchive, CerealFallback)
+{
+	auto const path = get_temporary_path("data_archive_cereal");
+	std::filesystem::remove(path);
+
+	data_archive_test::ValuePortData const value({1, -2, 3});
+	SpikeRecorder::Results const spikes(SpikeRecorder::Results::Spikes{{{Time(1), Time(2)}}});
+
+	PortOnTopology const value_port(VertexOnTopology(0), 1);
+	PortOnTopology const spikes_port(VertexOnTopology(1), 0);
+
+	{
+		DataArchiveWriter writer(path.string());
+		writer.write(value_port, value);
+		writer.write(spikes_port, spikes);
+	}
+
+	DataArchiveReader reader(path.string());
+	EXPECT_EQ(reader.get_ports(), (std::vector<PortOnTopology>{value_port, spikes_port}));
+	EXPECT_EQ(reader.get_type(value_port), DataArchive::Type::cereal);
+	EXPECT_THROW(reader.get_events(value_port), std::runtime_error);
+
+	auto const read_value = reader.read(value_port);
+	ASSERT_TRUE(read_value);
+	EXPECT_EQ(*read_value, value);
+	auto const read_spikes = reader.read(spikes_port);
+	ASSERT_TRUE(read_spikes);
+	EXPECT_EQ(*read_spikes, spikes);
+
+	std::filesystem::remove(path);
+}
+
+TEST(DataArchive, TimeDomainRuntimes)
+{
+	auto const path = get_temporary_path("data_archive_runtimes");
+	std::filesystem::remove(path);
+
+	ExternalSourceNeuron::Dynamics const external_source(
+	    ExternalSourceNeuron::Dynamics::SpikeTimes{{{Time(10)}}, {{Time(11), Time(12)}}});
+	PortOnTopology const external_source_port(VertexOnTopology(2), 0);
+
+	ClockCycleTimeDomainRuntimes const runtimes({Time(100), std::nullopt}, Time(20), false);
+	ClockCycleTimeDomainRuntimes const other_runtimes({Time(3), Time(4)}, Time(0));
+
+	grenade::common::InputData input_data;
+	input_data.ports.set(external_source_port, external_source);
+	input_data.time_domain_runtimes.set(grenade::common::TimeDomainOnTopology(0), runtimes);
+	input_data.time_domain_runtimes.set(grenade::common::TimeDomainOnTopology(3), other_runtimes);
+
+	{
+		DataArchiveWriter writer(path.string());
+
+		// rejected runtimes leave the archive unchanged
+		grenade::common::InputData unsupported;
+		unsupported.ports.set(PortOnTopology(VertexOnTopology(0), 0), external_source);
+		unsupported.time_domain_runtimes.set(
+		    grenade::common::TimeDomainOnTopology(1), UnsupportedTimeDomainRuntimes());
+		EXPECT_THROW(writer.write(unsupported), std::runtime_error);
+
+		writer.write(input_data);
+
+		grenade::common::InputData duplicate;
+		duplicate.time_domain_runtimes.set(grenade::common::TimeDomainOnTopology(0), runtimes);
+		EXPECT_THROW(writer.write(duplicate), std::runtime_error);
+	}
+
+	DataArchiveReader reader(path.string());
+	EXPECT_EQ(reader.get_ports(), (std::vector<PortOnTopology>{external_source_port}));
+
+	grenade::common::InputData read_input_data;
+	reader.read(read_input_data);
+	EXPECT_EQ(read_input_data, input_data);
+
+	// reading into data without runtimes only restores the ports
+	grenade::common::Data read_data;
+	reader.read(read_data);
+	EXPECT_EQ(read_data.ports.get(external_source_port), external_source);
+
+	std::filesystem::remove(path);
+}
@@ -0,0 +1,75 @@
+#include "grenade/vx/network/abstract/mapper/persistent_cache.h"
+
+#include "halco/common/iter_all.h"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+using namespace grenade::vx::network::abstract;
+using namespace halco::hicann_dls::vx::v3;
+
+TEST(PersistentMappingCache, StoreLoad)
+{
+	auto const directory =
+	    std::filesystem::temp_directory_path() / "grenade-test-persistent_mapping_cache";
+	std::filesystem::remove_all(directory);
+
+	PersistentMappingCache cache(directory.string());
+	EXPECT_EQ(cache.size_in_bytes(), 0);
+
+	PlacementResult placement_result;
+	placement_result.neuron_anchors[grenade::common::VertexOnTopology(3)] = {
+	    AtomicNeuronOnDLS(Enum(5)), AtomicNeuronOnDLS(Enum(7))};
+	placement_result.background_locations[grenade::common::VertexOnTopology(4)]
+	                                     [HemisphereOnDLS::bottom] = PADIBusOnPADIBusBlock(2);
+
+	EXPECT_FALSE(cache.load_placement("a"));
+	cache.store_placement("a", placement_result);
+	EXPECT_GT(cache.size_in_bytes(), 0);
+
+	auto const loaded = cache.load_placement("a");
+	ASSERT_TRUE(loaded);
+	EXPECT_EQ(loaded->neuron_anchors, placement_result.neuron_anchors);
+	EXPECT_EQ(loaded->background_locations, placement_result.background_locations);
+
+	EXPECT_FALSE(cache.load_placement("b"));
+	EXPECT_FALSE(cache.load_routing("a"));
+
+	// corrupted entries are removed on load
+	for (auto const& entry : std::filesystem::directory_iterator(directory)) {
+		std::ofstream file(entry.path(), std::ios::binary | std::ios::trunc);
+		file << "corrupted";
+	}
+	EXPECT_FALSE(cache.load_placement("a"));
+	EXPECT_EQ(cache.size_in_bytes(), 0);
+
+	std::filesystem::remove_all(directory);
+}
+
+TEST(PersistentMappingCache, Eviction)
+{
+	auto const directory =
+	    std::filesystem::temp_directory_path() / "grenade-test-persistent_mapping_cache_eviction";
+	std::filesystem::remove_all(directory);
+
+	PlacementResult placement_result;
+	for (auto const atomic_neuron : halco::common::iter_all<AtomicNeuronOnDLS>()) {
+		placement_result.neuron_anchors[grenade::common::VertexOnTopology(atomic_neuron.toEnum())]
+		    .push_back(atomic_neuron);
+	}
+
+	PersistentMappingCache unlimited_cache(directory.string());
+	unlimited_cache.store_placement("a", placement_result);
+	auto const entry_size = unlimited_cache.size_in_bytes();
+	unlimited_cache.clear();
+	EXPECT_EQ(unlimited_cache.size_in_bytes(), 0);
+
+	PersistentMappingCache cache(directory.string(), entry_size * 2);
+	cache.store_placement("a", placement_result);
+	cache.store_placement("b", placement_result);
+	EXPECT_EQ(cache.size_in_bytes(), entry_size * 2);
+	cache.store_placement("c", placement_result);
+	EXPECT_LE(cache.size_in_bytes(), entry_size * 2);
+
+	std::filesystem::remove_all(directory);
+}
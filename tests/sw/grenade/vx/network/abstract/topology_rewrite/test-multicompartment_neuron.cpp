@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+
+#include "grenade/vx/network/abstract/topology_rewrite/multicompartment_neuron.h"
+
+#include "ccalix/types.h"
+#include "grenade/common/edge.h"
+#include "grenade/common/linked_topology.h"
+#include "grenade/common/multi_index.h"
+#include "grenade/common/multi_index_sequence/cuboid.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/cell_on_population.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/compartment_on_neuron.h"
+#include "grenade/common/population.h"
+#include "grenade/common/projection.h"
+#include "grenade/common/projection_connector/sequence.h"
+#include "grenade/common/time_domain_on_topology.h"
+#include "grenade/common/topology.h"
+#include "grenade/common/topology_rewrite/identity_replacement.h"
+#include "grenade/vx/network/abstract/multi_index_sequence_dimension_unit/mechanism_on_compartment.h"
+#include "grenade/vx/network/abstract/multicompartment/compartment.h"
+#include "grenade/vx/network/abstract/multicompartment/compartment_connection/conductance.h"
+#include "grenade/vx/network/abstract/multicompartment/mechanism/capacitance.h"
+#include "grenade/vx/network/abstract/multicompartment/mechanism/synaptic_current.h"
+#include "grenade/vx/network/abstract/multicompartment/neuron.h"
+#include "grenade/vx/network/abstract/multicompartment/placement/algorithm_ruleset.h"
+#include "grenade/vx/network/abstract/population_cell/calibrated.h"
+#include "grenade/vx/network/abstract/population_cell/external_source.h"
+#include "grenade/vx/network/abstract/projection_synapse/uncalibrated.h"
+#include "lola/vx/v3/neuron.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+using namespace grenade::common;
+using namespace grenade::vx::network::abstract;
+
+namespace {
+
+/**
+ * Placement algorithm counting the number of runs over all its clones.
+ */
+struct CountingPlacementAlgorithm : public PlacementAlgorithm
+{
+	CountingPlacementAlgorithm(std::shared_ptr<std::atomic<size_t>> num_runs) :
+	    m_num_runs(std::move(num_runs)), m_algorithm(std::make_unique<PlacementAlgorithmRuleset>())
+	{
+	}
+
+	virtual AlgorithmResult run(
+	    CoordinateSystem const& coordinate_system,
+	    Neuron const& neuron,
+	    ResourceManager const& resources) override
+	{
+		(*m_num_runs)++;
+		return m_algorithm->run(coordinate_system, neuron, resources);
+	}
+
+	virtual std::unique_ptr<PlacementAlgorithm> clone() const override
+	{
+		return std::make_unique<CountingPlacementAlgorithm>(m_num_runs);
+	}
+
+	virtual void reset() override
+	{
+		m_algorithm->reset();
+	}
+
+private:
+	std::shared_ptr<std::atomic<size_t>> m_num_runs;
+	std::unique_ptr<PlacementAlgorithm> m_algorithm;
+};
+
+/**
+ * Topology of an external source population projecting onto the given number of identical
+ * two-compartment neuron populations.
+ * @param num_populations Number of neuron populations
+ */
+std::shared_ptr<Topology> get_topology(size_t num_populations)
+{
+	auto topology = std::make_shared<Topology>();
+
+	constexpr size_t size_i = 8;
+
+	auto const population_input = topology->add_vertex(Population{
+	    ExternalSourceNeuron(),
+	    CuboidMultiIndexSequence({size_i}, MultiIndex({0}), {CellOnPopulationDimensionUnit()}),
+	    ExternalSourceNeuron::ParameterSpace(size_i), TimeDomainOnTopology()});
+
+	Neuron neuron;
+	Compartment compartment;
+	auto const mechanism_capacitance_on_compartment =
+	    compartment.mechanisms.insert(MechanismCapacitance());
+	auto const mechanism_synin_on_compartment =
+	    compartment.mechanisms.insert(MechanismSynapticInputCurrent());
+	auto const compartment_on_neuron_0 = neuron.add_compartment(compartment);
+	auto const compartment_on_neuron_1 = neuron.add_compartment(compartment);
+	auto const compartment_connection_on_neuron = neuron.add_compartment_connection(
+	    compartment_on_neuron_0, compartment_on_neuron_1, CompartmentConnectionConductance());
+
+	Neuron::ParameterSpace parameter_space;
+	Compartment::ParameterSpace compartment_parameter_space;
+	compartment_parameter_space.mechanisms.set(
+	    mechanism_capacitance_on_compartment,
+	    MechanismCapacitance::ParameterSpace(
+	        {{ccalix::CapacitanceInFarad(1.5e-12), ccalix::CapacitanceInFarad(1.5e-12)}}));
+	compartment_parameter_space.mechanisms.set(
+	    mechanism_synin_on_compartment,
+	    MechanismSynapticInputCurrent::ParameterSpace(
+	        {{lola::vx::v3::AtomicNeuron::AnalogValue(500),
+	          lola::vx::v3::AtomicNeuron::AnalogValue(500)}},
+	        {{lola::vx::v3::AtomicNeuron::AnalogValue(600),
+	          lola::vx::v3::AtomicNeuron::AnalogValue(600)}},
+	        {{ccalix::TimeInS(10e-6), ccalix::TimeInS(10e-6)}}));
+	parameter_space.compartments.emplace(compartment_on_neuron_0, compartment_parameter_space);
+	parameter_space.compartments.emplace(compartment_on_neuron_1, compartment_parameter_space);
+	parameter_space.compartment_connections.set(
+	    compartment_connection_on_neuron, CompartmentConnectionConductance::ParameterSpace(
+	                                          {{ccalix::TimeInS(10e-6), ccalix::TimeInS(10e-6)}}));
+
+	for (size_t i = 0; i < num_populations; ++i) {
+		auto const population_output = topology->add_vertex(Population{
+		    neuron,
+		    CuboidMultiIndexSequence({1}, MultiIndex({0}), {CellOnPopulationDimensionUnit()}),
+		    parameter_space, TimeDomainOnTopology()});
+
+		auto const projection = topology->add_vertex(Projection(
+		    UncalibratedSynapse(),
+		    UncalibratedSynapse::ParameterSpace{
+		        std::vector(size_i, UncalibratedSynapse::Weight(63))},
+		    SequenceConnector{
+		        CuboidMultiIndexSequence({size_i}, {CellOnPopulationDimensionUnit()}),
+		        CuboidMultiIndexSequence({1}, {CellOnPopulationDimensionUnit()}),
+		        CuboidMultiIndexSequence(
+		            {size_i, 1},
+		            {CellOnPopulationDimensionUnit(), CellOnPopulationDimensionUnit()})},
+		    TimeDomainOnTopology()));
+
+		topology->add_edge(
+		    population_input, projection,
+		    Edge(
+		        CuboidMultiIndexSequence(
+		            {size_i, 1}, MultiIndex({0, 0}),
+		            {CellOnPopulationDimensionUnit(), CompartmentOnNeuronDimensionUnit()}),
+		        CuboidMultiIndexSequence({size_i}, {CellOnPopulationDimensionUnit()}), 0, 0));
+		topology->add_edge(
+		    projection, population_output,
+		    Edge(
+		        CuboidMultiIndexSequence({1}, {CellOnPopulationDimensionUnit()}),
+		        CuboidMultiIndexSequence(
+		            {1, 1, 1}, MultiIndex({0, 0, mechanism_synin_on_compartment.value()}),
+		            {CellOnPopulationDimensionUnit(), CompartmentOnNeuronDimensionUnit(),
+		             MechanismOnCompartmentDimensionUnit()}),
+		        0, 0));
+	}
+	return topology;
+}
+
+/**
+ * Apply multi-compartment neuron rewrite to copy of topology.
+ * @param topology Reference topology
+ * @param num_runs Counter of placement algorithm runs
+ * @param deduplicate_models Whether to deduplicate identical neuron models
+ */
+std::shared_ptr<LinkedTopology> rewrite(
+    std::shared_ptr<Topology const> topology,
+    std::shared_ptr<std::atomic<size_t>> num_runs,
+    bool deduplicate_models)
+{
+	auto linked_topology = std::make_shared<LinkedTopology>(std::move(topology));
+	IdentityReplacementTopologyRewrite copy_rewrite(linked_topology);
+	copy_rewrite();
+	MulticompartmentNeuronRewrite neuron_rewrite(
+	    linked_topology, std::make_unique<CountingPlacementAlgorithm>(std::move(num_runs)),
+	    deduplicate_models);
+	neuron_rewrite();
+	return linked_topology;
+}
+
+} // namespace
+
+TEST(MulticompartmentNeuronRewrite, Deduplication)
+{
+	constexpr size_t num_populations = 3;
+	auto const topology = get_topology(num_populations);
+
+	auto const num_runs_deduplicated = std::make_shared<std::atomic<size_t>>(0);
+	auto const deduplicated = rewrite(topology, num_runs_deduplicated, true);
+	auto const num_runs = std::make_shared<std::atomic<size_t>>(0);
+	auto const reference = rewrite(topology, num_runs, false);
+
+	// identical populations share a single placement
+	EXPECT_EQ(num_runs_deduplicated->load(), 1);
+	EXPECT_EQ(num_runs->load(), num_populations);
+
+	// deduplication doesn't alter the result
+	EXPECT_TRUE(
+	    static_cast<Topology const&>(*deduplicated) == static_cast<Topology const&>(*reference));
+
+	std::vector<Population const*> calibrated_populations;
+	for (auto const& vertex : deduplicated->vertices()) {
+		if (auto const population = dynamic_cast<Population const*>(&deduplicated->get(vertex));
+		    population && dynamic_cast<CalibratedNeuron const*>(&population->get_cell())) {
+			calibrated_populations.push_back(population);
+		}
+	}
+	ASSERT_EQ(calibrated_populations.size(), num_populations);
+	for (auto const& population : calibrated_populations) {
+		EXPECT_EQ(population->get_cell(), calibrated_populations.front()->get_cell());
+		EXPECT_EQ(
+		    population->get_parameter_space(),
+		    calibrated_populations.front()->get_parameter_space());
+	}
+	EXPECT_EQ(
+	    deduplicated->num_inter_graph_hyper_edges(), reference->num_inter_graph_hyper_edges());
+}
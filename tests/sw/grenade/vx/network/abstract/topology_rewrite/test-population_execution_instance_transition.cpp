@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include "grenade/vx/network/abstract/topology_rewrite/population_execution_instance_transition.h"
+
+#include "grenade/common/connection_on_executor.h"
+#include "grenade/common/edge.h"
+#include "grenade/common/execution_instance_id.h"
+#include "grenade/common/execution_instance_on_executor.h"
+#include "grenade/common/inter_topology_hyper_edge/identity.h"
+#include "grenade/common/linked_topology.h"
+#include "grenade/common/multi_index.h"
+#include "grenade/common/multi_index_sequence/cuboid.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/cell_on_population.h"
+#include "grenade/common/multi_index_sequence_dimension_unit/compartment_on_neuron.h"
+#include "grenade/common/population.h"
+#include "grenade/common/projection.h"
+#include "grenade/common/projection_connector/sequence.h"
+#include "grenade/common/time_domain_on_topology.h"
+#include "grenade/common/topology.h"
+#include "grenade/vx/network/abstract/population_cell/external_source.h"
+#include "grenade/vx/network/abstract/projection_synapse/uncalibrated.h"
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <set>
+#include <vector>
+
+using namespace grenade::common;
+using namespace grenade::vx::network::abstract;
+
+namespace {
+
+ExecutionInstanceOnExecutor get_execution_instance(size_t id)
+{
+	return ExecutionInstanceOnExecutor(ExecutionInstanceID(id), ConnectionOnExecutor());
+}
+
+Population get_external_source_population(
+    std::optional<ExecutionInstanceOnExecutor> const& execution_instance)
+{
+	return Population(
+	    ExternalSourceNeuron(), CuboidMultiIndexSequence({1}, {CellOnPopulationDimensionUnit()}),
+	    ExternalSourceNeuron::ParameterSpace(1), TimeDomainOnTopology(), execution_instance);
+}
+
+Projection get_projection(ExecutionInstanceOnExecutor const& execution_instance)
+{
+	return Projection(
+	    UncalibratedSynapse{},
+	    UncalibratedSynapse::ParameterSpace{{UncalibratedSynapse::Weight(63)}},
+	    SequenceConnector{
+	        CuboidMultiIndexSequence({1}), CuboidMultiIndexSequence({1}),
+	        CuboidMultiIndexSequence({1, 1})},
+	    TimeDomainOnTopology(), execution_instance);
+}
+
+Edge get_edge()
+{
+	return Edge(
+	    CuboidMultiIndexSequence(
+	        {1, 1}, MultiIndex({0, 0}),
+	        {CellOnPopulationDimensionUnit(), CompartmentOnNeuronDimensionUnit()}),
+	    CuboidMultiIndexSequence({1}), 0, 0);
+}
+
+} // namespace
+
+TEST(PopulationExecutionInstanceTransitionRewrite, ExternalSourceToMultipleExecutionInstances)
+{
+	auto const reference_topology = std::make_shared<Topology>();
+	auto const reference_source =
+	    reference_topology->add_vertex(get_external_source_population(std::nullopt));
+
+	auto linked_topology = std::make_shared<LinkedTopology>(reference_topology);
+	auto const source =
+	    linked_topology->add_vertex(get_external_source_population(get_execution_instance(0)));
+	linked_topology->add_inter_graph_hyper_edge(
+	    {source}, {reference_source}, IdentityInterTopologyHyperEdge());
+	linked_topology->inter_topology_time_domain_edges.emplace(
+	    TimeDomainOnTopology(), TimeDomainOnTopology());
+
+	// two projections on the first target execution instance, one on the second
+	std::vector<VertexOnTopology> const projections{
+	    linked_topology->add_vertex(get_projection(get_execution_instance(1))),
+	    linked_topology->add_vertex(get_projection(get_execution_instance(1))),
+	    linked_topology->add_vertex(get_projection(get_execution_instance(2)))};
+	for (auto const& projection : projections) {
+		linked_topology->add_edge(source, projection, get_edge());
+	}
+
+	PopulationExecutionInstanceTransitionRewrite rewrite(linked_topology);
+	rewrite();
+
+	// one copy of the source per target execution instance
+	EXPECT_EQ(linked_topology->num_vertices(), 6);
+	EXPECT_EQ(linked_topology->out_degree(source), 0);
+
+	std::set<VertexOnTopology> copies;
+	for (auto const& projection : projections) {
+		ASSERT_EQ(linked_topology->in_degree(projection), 1);
+		auto const copy = linked_topology->source(*linked_topology->in_edges(projection).begin());
+		EXPECT_NE(copy, source);
+		auto const& copy_population = dynamic_cast<Population const&>(linked_topology->get(copy));
+		EXPECT_TRUE(dynamic_cast<ExternalSourceNeuron const*>(&copy_population.get_cell()));
+		EXPECT_EQ(
+		    copy_population.get_execution_instance_on_executor(),
+		    dynamic_cast<Projection const&>(linked_topology->get(projection))
+		        .get_execution_instance_on_executor());
+		copies.insert(copy);
+	}
+	EXPECT_EQ(copies.size(), 2);
+
+	// each copy references the reference source by exactly one inter-topology hyper edge
+	EXPECT_EQ(linked_topology->num_inter_graph_hyper_edges(), 3);
+	for (auto const& copy : copies) {
+		auto const hyper_edges = linked_topology->inter_graph_hyper_edges_by_linked(copy);
+		ASSERT_EQ(std::distance(hyper_edges.begin(), hyper_edges.end()), 1);
+		auto const& references = linked_topology->references(*hyper_edges.begin());
+		ASSERT_EQ(references.size(), 1);
+		EXPECT_EQ(*references.begin(), reference_source);
+	}
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include "grenade/vx/network/routing/greedy/resource_set.h"
+#include "halco/hicann-dls/vx/v3/neuron.h"
+#include "halco/hicann-dls/vx/v3/padi.h"
+#include <set>
+#include <vector>
+
+using namespace grenade::vx::network::routing::greedy;
+using namespace halco::common;
+using namespace halco::hicann_dls::vx::v3;
+
+TEST(ResourceSet, General)
+{
+	ResourceSet<AtomicNeuronOnDLS> set;
+	EXPECT_TRUE(set.empty());
+	EXPECT_EQ(set.size(), 0);
+	EXPECT_EQ(set.begin(), set.end());
+
+	set.insert(AtomicNeuronOnDLS(Enum(300)));
+	set.insert(AtomicNeuronOnDLS(Enum(3)));
+	set.insert(AtomicNeuronOnDLS(Enum(300)));
+	set.insert(AtomicNeuronOnDLS(Enum(511)));
+	EXPECT_FALSE(set.empty());
+	EXPECT_EQ(set.size(), 3);
+	EXPECT_TRUE(set.contains(AtomicNeuronOnDLS(Enum(3))));
+	EXPECT_FALSE(set.contains(AtomicNeuronOnDLS(Enum(4))));
+
+	// iteration order equals std::set
+	std::set<AtomicNeuronOnDLS> const reference{
+	    AtomicNeuronOnDLS(Enum(511)), AtomicNeuronOnDLS(Enum(3)), AtomicNeuronOnDLS(Enum(300))};
+	EXPECT_EQ(
+	    std::vector<AtomicNeuronOnDLS>(set.begin(), set.end()),
+	    std::vector<AtomicNeuronOnDLS>(reference.begin(), reference.end()));
+	EXPECT_EQ(ResourceSet<AtomicNeuronOnDLS>(reference.begin(), reference.end()), set);
+
+	set.erase(AtomicNeuronOnDLS(Enum(300)));
+	EXPECT_EQ(set.size(), 2);
+	EXPECT_FALSE(set.contains(AtomicNeuronOnDLS(Enum(300))));
+
+	set.clear();
+	EXPECT_TRUE(set.empty());
+
+	EXPECT_EQ(ResourceSet<PADIBusOnDLS>::all().size(), PADIBusOnDLS::size);
+}
+
+TEST(ResourceSet, SetAlgebra)
+{
+	ResourceSet<PADIBusOnDLS> const a{PADIBusOnDLS(Enum(0)), PADIBusOnDLS(Enum(1))};
+	ResourceSet<PADIBusOnDLS> const b{PADIBusOnDLS(Enum(1)), PADIBusOnDLS(Enum(2))};
+
+	EXPECT_EQ(
+	    a | b, (ResourceSet<PADIBusOnDLS>{
+	               PADIBusOnDLS(Enum(0)), PADIBusOnDLS(Enum(1)), PADIBusOnDLS(Enum(2))}));
+	EXPECT_EQ(a & b, ResourceSet<PADIBusOnDLS>{PADIBusOnDLS(Enum(1))});
+	EXPECT_EQ(a - b, ResourceSet<PADIBusOnDLS>{PADIBusOnDLS(Enum(0))});
+	EXPECT_TRUE(a.intersects(b));
+	EXPECT_FALSE((a - b).intersects(b));
+	EXPECT_TRUE(a.includes(a & b));
+	EXPECT_FALSE(a.includes(b));
+	EXPECT_TRUE(ResourceSet<PADIBusOnDLS>::all().includes(a | b));
+}
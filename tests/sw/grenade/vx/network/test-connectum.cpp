@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include "grenade/vx/network/connectum.h"
+
+using namespace grenade::vx::network;
+using namespace halco::common;
+using namespace halco::hicann_dls::vx::v3;
+
+namespace {
+
+ConnectumConnection make_connection(size_t source_population, size_t index, size_t projection)
+{
+	return ConnectumConnection{
+	    {grenade::common::VertexOnTopology(source_population), index,
+	     CompartmentOnLogicalNeuron()},
+	    AtomicNeuronOnDLS(Enum(index)),
+	    Receptor::Type::excitatory,
+	    grenade::common::VertexOnTopology(projection),
+	    index};
+}
+
+} // namespace
+
+TEST(ConnectumDigest, General)
+{
+	std::vector<ConnectumConnection> connectum{
+	    make_connection(0, 0, 2), make_connection(0, 1, 2), make_connection(1, 0, 3),
+	    make_connection(1, 0, 3)};
+
+	ConnectumDigest digest;
+	for (auto const& connection : connectum) {
+		digest.insert(connection);
+	}
+	EXPECT_EQ(digest.size(), connectum.size());
+	EXPECT_EQ(digest.fragments.size(), 2);
+
+	// independent of order and partitioning of insertion
+	ConnectumDigest digest_reversed;
+	ConnectumDigest digest_reversed_other;
+	digest_reversed.insert(connectum.at(3));
+	digest_reversed.insert(connectum.at(2));
+	digest_reversed_other.insert(connectum.at(1));
+	digest_reversed_other.insert(connectum.at(0));
+	digest_reversed.merge(digest_reversed_other);
+	EXPECT_EQ(digest, digest_reversed);
+	EXPECT_TRUE(digest.get_mismatching_fragments(digest_reversed).empty());
+
+	// multiplicity of connections is considered
+	ConnectumDigest digest_unique;
+	for (size_t i = 0; i < 3; ++i) {
+		digest_unique.insert(connectum.at(i));
+	}
+	EXPECT_NE(digest, digest_unique);
+	EXPECT_EQ(
+	    digest.get_mismatching_fragments(digest_unique),
+	    std::vector{ConnectumDigest::FragmentOnConnectum{
+	        grenade::common::VertexOnTopology(1), grenade::common::VertexOnTopology(3)}});
+
+	// exchanged connection of equal count is detected
+	ConnectumDigest digest_modified;
+	for (size_t i = 1; i < connectum.size(); ++i) {
+		digest_modified.insert(connectum.at(i));
+	}
+	digest_modified.insert(make_connection(0, 2, 2));
+	EXPECT_NE(digest, digest_modified);
+	EXPECT_EQ(
+	    digest.get_mismatching_fragments(digest_modified),
+	    std::vector{ConnectumDigest::FragmentOnConnectum{
+	        grenade::common::VertexOnTopology(0), grenade::common::VertexOnTopology(2)}});
+
+	// fragments missing in either digest are detected
+	ConnectumDigest digest_empty;
+	EXPECT_EQ(digest.get_mismatching_fragments(digest_empty).size(), 2);
+	EXPECT_EQ(digest_empty.get_mismatching_fragments(digest).size(), 2);
+}